@@ -157,7 +157,7 @@ if [ "$CXX_STL" = "libc++" ]; then
 fi
 
 # Determine STLport build parameters
-STLPORT_CFLAGS="$COMMON_CFLAGS -DGNU_SOURCE -I$STLPORT_SRCDIR/stlport $GABIXX_INCLUDES"
+STLPORT_CFLAGS="$COMMON_CFLAGS -DGNU_SOURCE -I$STLPORT_SRCDIR/stlport $GABIXX_INCLUDES -I$ANDROID_NDK_ROOT/sources/android/cpufeatures"
 STLPORT_CXXFLAGS="$COMMON_CXXFLAGS"
 STLPORT_SOURCES=\
 "src/dll_main.cpp \
@@ -188,10 +188,15 @@ src/complex.cpp \
 src/complex_io.cpp \
 src/complex_trig.cpp \
 src/string.cpp \
+src/string_search.cpp \
 src/bitset.cpp \
 src/allocators.cpp \
 src/c_locale.c \
-src/cxa.c"
+src/cxa.c \
+src/cpu_features.c"
+
+# The NEON kernels of string_search.cpp, only built for armeabi-v7a.
+STLPORT_NEON_SOURCES="src/string_search_neon.cpp"
 
 # Determine Libc++ build parameters
 LIBCXX_CFLAGS="$COMMON_CFLAGS $LIBCXX_INCLUDES -Drestrict=__restrict__"
@@ -442,6 +447,10 @@ build_stl_libs_for_abi ()
       builder_cxxflags "$DEFAULT_CXXFLAGS $CXX_STL_CXXFLAGS $EXTRA_CXXFLAGS"
       builder_ldflags "$CXX_STL_LDFLAGS"
       builder_sources $CXX_STL_SOURCES
+      if [ "$CXX_STL" = "stlport" -a "$ABI" = "armeabi-v7a" ]; then
+        builder_cflags "-mfpu=neon"
+        builder_sources $STLPORT_NEON_SOURCES
+      fi
     fi
 
     if [ "$TYPE" = "static" ]; then
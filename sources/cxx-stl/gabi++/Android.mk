@@ -30,6 +30,7 @@ else # ! GABIXX_FORCE_REBUILD
   LOCAL_SRC_FILES:= $(libgabi++_src_files)
   LOCAL_EXPORT_C_INCLUDES := $(libgabi++_c_includes)
   LOCAL_C_INCLUDES := $(libgabi++_c_includes)
+  LOCAL_CFLAGS := $(libgabi++_cflags)
   LOCAL_CPP_FEATURES := rtti exceptions
   include $(BUILD_SHARED_LIBRARY)
 
@@ -41,6 +42,7 @@ else # ! GABIXX_FORCE_REBUILD
   LOCAL_CPP_EXTENSION := .cc
   LOCAL_EXPORT_C_INCLUDES := $(libgabi++_c_includes)
   LOCAL_C_INCLUDES := $(libgabi++_c_includes)
+  LOCAL_CFLAGS := $(libgabi++_cflags)
   LOCAL_CPP_FEATURES := rtti exceptions
   include $(BUILD_STATIC_LIBRARY)
 
@@ -273,7 +273,17 @@ namespace __cxxabiv1
                     size_t element_size,
                     __cxa_vec_copy_constructor constructor,
                     __cxa_vec_destructor destructor );
->>>>>>> parent of b3f9e45... gabi++: Implement missing array helper functions.
+
+    // Demangles |mangled_name| into a buffer allocated with malloc(). If
+    // |output_buffer| is not NULL, it must have been allocated with
+    // malloc(), and be |*length| bytes long; it is reallocated if too
+    // small. On return, |*status| is 0 on success, -1 if memory couldn't
+    // be allocated, -2 if |mangled_name| is not a valid name, and -3 if
+    // an argument is invalid.
+    char* __cxa_demangle(const char* mangled_name,
+                         char* output_buffer,
+                         size_t* length,
+                         int* status);
 
   } // extern "C"
 
@@ -281,5 +291,95 @@ namespace __cxxabiv1
 
 namespace abi = __cxxabiv1;
 
+// GAbi++ extensions.
+namespace __gabixx {
+
+  // Enables or disables the cache of __dynamic_cast() results. The cache
+  // is disabled by default: it is keyed by vtable and type_info addresses,
+  // which a library loaded after a dlclose() can reuse. A program that
+  // enables it and unloads libraries must call
+  // __flush_dynamic_cast_cache() after each dlclose().
+  void __set_dynamic_cast_cache_enabled(bool enabled);
+
+  // Invalidates all the entries of the __dynamic_cast() cache.
+  void __flush_dynamic_cast_cache();
+
+  // Gets the number of __dynamic_cast() calls served by the cache (hits),
+  // and the ones that had to walk the type tree (misses). Returns false,
+  // and zeroes both, if GAbi++ was built without GABIXX_EH_COUNTERS=1.
+  bool __get_dynamic_cast_cache_stats(unsigned long* hits,
+                                      unsigned long* misses);
+
+  // Thread-caching size-class allocator. operator new and operator delete
+  // use it when GAbi++ is built with GABIXX_SIZE_CLASS_ALLOCATOR=1. These
+  // functions are weak, so a program can replace the allocator.
+  //
+  // __size_class_allocate() returns NULL on failure. Blocks larger than
+  // the largest size class come from malloc(). __size_class_deallocate()
+  // accepts any block returned by __size_class_allocate(), while
+  // __size_class_deallocate_sized() also requires the size it was
+  // allocated with, and skips the size class lookup.
+  void* __size_class_allocate(size_t size);
+  void __size_class_deallocate(void* ptr);
+  void __size_class_deallocate_sized(void* ptr, size_t size);
+
+  // Statistics of one size class of the allocator.
+  struct __size_class_stats {
+    // Size of the objects in this class.
+    size_t size;
+    // Number of allocations served from this class.
+    unsigned long allocations;
+    // Bytes of free objects held in thread caches.
+    size_t cached_bytes;
+    // Bytes of free objects held in the central free list.
+    size_t central_bytes;
+    // Bytes of spans carved into objects of this class.
+    size_t span_bytes;
+  };
+
+  // Gets statistics of up to |max_count| size classes of the allocator.
+  // Returns the number of size classes. The counters are gathered without
+  // stopping other threads, so they are approximate.
+  int __get_size_class_stats(__size_class_stats* stats, int max_count);
+
+  // Demangles |mangled_name| into |buffer|, which is |size| bytes long,
+  // without allocating memory, so it can be called from signal handlers.
+  // Returns the length of the demangled name, not counting the
+  // terminating zero, or -1 and an empty string if |mangled_name| is not a
+  // valid name. If the result is |size| or more, the buffer was too small,
+  // and its contents are unspecified, but zero-terminated.
+  int __demangle(const char* mangled_name, char* buffer, size_t size);
+
+  // Exception handling counters. They are only maintained when GAbi++ is
+  // built with GABIXX_EH_COUNTERS=1, as updating them has a cost.
+  struct __eh_counters {
+    // Exceptions allocated by __cxa_allocate_exception(), and how many of
+    // them reused a buffer cached by the thread, or came from the
+    // emergency arena.
+    unsigned long exceptions_allocated;
+    unsigned long cached_buffers;
+    unsigned long emergency_buffers;
+    // Exceptions thrown and rethrown.
+    unsigned long exceptions_thrown;
+    unsigned long exceptions_rethrown;
+    // Frames seen by the personality routine while searching for a
+    // handler, and while unwinding to it.
+    unsigned long frames_searched;
+    unsigned long frames_unwound;
+    // Bytes of LSDA (exception tables) decoded, and call-site lookups
+    // served by the call-site cache instead.
+    unsigned long lsda_bytes_decoded;
+    unsigned long call_site_cache_hits;
+  };
+
+  // Copies the exception handling counters to |counters|. Returns false,
+  // and zeroes |counters|, if GAbi++ was built without them.
+  bool __get_eh_counters(__eh_counters* counters);
+
+  // Resets the exception handling counters.
+  void __reset_eh_counters();
+
+} // namespace __gabixx
+
 #endif /* defined(__GABIXX_CXXABI_H__) */
 
@@ -46,7 +46,6 @@
 #  define _GABIXX_NOEXCEPT_(x) /* nothing */
 #endif
 
-<<<<<<< HEAD
 // Use _GABIXX_HIDDEN to declare internal functions of GAbi++ that should
 // never be exposed to client code.
 #define _GABIXX_HIDDEN  __attribute__((__visibility__("hidden")))
@@ -54,8 +53,6 @@
 // Use _GABIXX_WEAK to define a symbol with weak linkage.
 #define _GABIXX_WEAK  __attribute__((__weak__))
 
-=======
->>>>>>> 7a9c376... gabi++: Fix terminate / unexpected thread-safety.
 // Use _GABIXX_ALWAYS_INLINE to declare a function that shall always be
 // inlined. Note that the always_inline doesn't make a function inline
 // per se.
@@ -75,6 +72,16 @@
 #define _GABIXX_HAS_EXCEPTIONS 0
 #endif
 
+// _GABIXX_HAS_NATIVE_TLS will be 1 if the target supports ELF thread-local
+// storage (__thread) natively, or 0 otherwise. Bionic doesn't, and the
+// compiler's emulation of __thread is built on pthread_getspecific(), so
+// Android builds keep using pthread keys directly.
+#if !defined(__ANDROID__) && (defined(__GNUC__) || defined(__clang__))
+#define _GABIXX_HAS_NATIVE_TLS 1
+#else
+#define _GABIXX_HAS_NATIVE_TLS 0
+#endif
+
 // TODO(digit): Use __atomic_load_acq_rel when available.
 #define __gabixx_sync_load(address)  \
     __sync_fetch_and_add((address), (typeof(*(address)))0)
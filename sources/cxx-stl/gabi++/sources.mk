@@ -6,6 +6,7 @@ libgabi++_src_files := \
         src/class_type_info.cc \
         src/cxxabi.cc \
         src/delete.cc \
+        src/demangle.cc \
         src/dwarf_helper.cc \
         src/dynamic_cast.cc \
         src/enum_type_info.cc \
@@ -22,8 +23,24 @@ libgabi++_src_files := \
         src/pointer_to_member_type_info.cc \
         src/call_unexpected.cc \
         src/si_class_type_info.cc \
+        src/size_class_allocator.cc \
         src/terminate.cc \
         src/type_info.cc \
         src/vmi_class_type_info.cc
 
 libgabi++_c_includes := $(libgabi++_path)/include
+
+# Define GABIXX_SIZE_CLASS_ALLOCATOR=true to make operator new/delete use
+# the size-class allocator of src/size_class_allocator.cc for small blocks,
+# instead of malloc()/free() directly.
+libgabi++_cflags :=
+ifeq ($(GABIXX_SIZE_CLASS_ALLOCATOR),true)
+  libgabi++_cflags += -DGABIXX_SIZE_CLASS_ALLOCATOR=1
+endif
+
+# Define GABIXX_EH_COUNTERS=true to maintain the exception handling
+# counters returned by __gabixx::__get_eh_counters(), and the dynamic_cast
+# cache counters returned by __gabixx::__get_dynamic_cast_cache_stats().
+ifeq ($(GABIXX_EH_COUNTERS),true)
+  libgabi++_cflags += -DGABIXX_EH_COUNTERS=1
+endif
@@ -28,6 +28,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <pthread.h>
 
@@ -48,11 +49,108 @@ namespace {
     __cxa_free_exception(exc+1);
   }
 
+  // Exception objects are allocated in a few size classes, and freed
+  // buffers are cached per thread, so code that throws in a loop doesn't
+  // call malloc() / free() for every exception. Sizes include the
+  // ExceptionBlockHeader and the __cxa_exception header.
+  const size_t kExceptionSizeClasses[] = { 256, 512, 1024 };
+
+  enum {
+    kNumSizeClasses = sizeof(kExceptionSizeClasses) /
+                      sizeof(kExceptionSizeClasses[0]),
+    // Maximum number of cached buffers per size class and thread.
+    kMaxCachedBlocks = 8,
+    // Values of ExceptionBlockHeader::sizeClass for buffers that are not
+    // cached: larger ones, and the ones from the emergency arena.
+    kLargeBlock = kNumSizeClasses,
+    kEmergencyBlock,
+  };
+
+  // Precedes every exception buffer. Its size is twice the size of a
+  // pointer, so the thrown object keeps the alignment malloc() gives.
+  struct ExceptionBlockHeader {
+    size_t sizeClass;
+    size_t padding;
+  };
+
+  // Overlays a cached exception buffer.
+  struct FreeExceptionBlock {
+    FreeExceptionBlock* next;
+  };
+
+  // Thread-specific C++ runtime info block.
+  struct CxaThreadInfo {
+    __cxa_eh_globals globals;
+    FreeExceptionBlock* freeBlocks[kNumSizeClasses];
+    unsigned freeCounts[kNumSizeClasses];
+#if _GABIXX_HAS_NATIVE_TLS
+    bool registered;
+    // Set once the key destructor has drained the cache of the thread.
+    // Buffers freed by the thread after that are not cached, since nothing
+    // would release them.
+    bool exited;
+#endif
+  };
+
+  // Emergency arena, used when malloc() fails, so std::bad_alloc and
+  // other small exceptions can always be thrown.
+  enum {
+    kEmergencyBlockSize = 1024,
+    kEmergencyBlockCount = 16,
+  };
+
+  static char sEmergencyArena[kEmergencyBlockSize * kEmergencyBlockCount]
+      __attribute__((__aligned__(16)));
+  static bool sEmergencyUsed[kEmergencyBlockCount];
+  static pthread_mutex_t sEmergencyLock = PTHREAD_MUTEX_INITIALIZER;
+
+  void* allocateEmergencyBlock(size_t size) {
+    if (size > kEmergencyBlockSize) {
+      return NULL;
+    }
+    void* block = NULL;
+    pthread_mutex_lock(&sEmergencyLock);
+    for (int i = 0; i < kEmergencyBlockCount; ++i) {
+      if (!sEmergencyUsed[i]) {
+        sEmergencyUsed[i] = true;
+        block = sEmergencyArena + i * kEmergencyBlockSize;
+        break;
+      }
+    }
+    pthread_mutex_unlock(&sEmergencyLock);
+    return block;
+  }
+
+  void freeEmergencyBlock(void* block) {
+    size_t index = (static_cast<char*>(block) - sEmergencyArena) /
+                   kEmergencyBlockSize;
+    pthread_mutex_lock(&sEmergencyLock);
+    sEmergencyUsed[index] = false;
+    pthread_mutex_unlock(&sEmergencyLock);
+  }
+
+  void freeCachedBlocks(CxaThreadInfo* info) {
+    for (int i = 0; i < kNumSizeClasses; ++i) {
+      FreeExceptionBlock* block = info->freeBlocks[i];
+      while (block != NULL) {
+        FreeExceptionBlock* next = block->next;
+        free(block);
+        block = next;
+      }
+      info->freeBlocks[i] = NULL;
+      info->freeCounts[i] = 0;
+    }
+  }
+
   // Technical note:
   // Use a pthread_key_t to hold the key used to store our thread-specific
-  // __cxa_eh_globals objects. The key is created and destroyed through
+  // CxaThreadInfo objects. The key is created and destroyed through
   // a static C++ object.
   //
+  // When the target supports native TLS, the objects themselves live in
+  // thread-local storage, and the key is only used to release the cached
+  // exception buffers when a thread exits.
+  //
 
   // Due to a bug in the dynamic linker that was only fixed in Froyo, the
   // static C++ destructor may be called with a value of NULL for the
@@ -77,36 +175,72 @@ namespace {
       pthread_key_delete(__cxa_thread_key);
     }
 
-    static __cxa_eh_globals* getFast() {
+#if _GABIXX_HAS_NATIVE_TLS
+    static CxaThreadInfo* getFast() {
+      return &threadInfo;
+    }
+
+    static CxaThreadInfo* getSlow() {
+      if (!threadInfo.registered && !threadInfo.exited) {
+        threadInfo.registered = true;
+        pthread_setspecific(__cxa_thread_key, &threadInfo);
+      }
+      return &threadInfo;
+    }
+
+    // Returns the info block whose buffer cache may be used by the current
+    // thread, or NULL.
+    static CxaThreadInfo* getCache() {
+      return threadInfo.exited ? NULL : &threadInfo;
+    }
+#else
+    static CxaThreadInfo* getFast() {
       void* obj = pthread_getspecific(__cxa_thread_key);
-      return reinterpret_cast<__cxa_eh_globals*>(obj);
+      return reinterpret_cast<CxaThreadInfo*>(obj);
     }
 
-    static __cxa_eh_globals* getSlow() {
+    static CxaThreadInfo* getSlow() {
       void* obj = pthread_getspecific(__cxa_thread_key);
       if (obj == NULL) {
-        obj = malloc(sizeof(__cxa_eh_globals));
+        obj = malloc(sizeof(CxaThreadInfo));
         if (!obj) {
           // Shouldn't happen, but better be safe than sorry.
           __gabixx::__fatal_error(
               "Can't allocate thread-specific C++ runtime info block.");
-          __gabixx::__fatal_error("Can't allocate thread-specific C++ runtime info block.");
-
         }
-        memset(obj, 0, sizeof(__cxa_eh_globals));
+        memset(obj, 0, sizeof(CxaThreadInfo));
         pthread_setspecific(__cxa_thread_key, obj);
       }
-      return reinterpret_cast<__cxa_eh_globals*>(obj);
+      return reinterpret_cast<CxaThreadInfo*>(obj);
     }
 
+    static CxaThreadInfo* getCache() {
+      return getFast();
+    }
+#endif
+
   private:
     // Called when a thread is destroyed.
     static void freeObject(void* obj) {
-      free(obj);
+      CxaThreadInfo* info = reinterpret_cast<CxaThreadInfo*>(obj);
+      freeCachedBlocks(info);
+#if _GABIXX_HAS_NATIVE_TLS
+      info->registered = false;
+      info->exited = true;
+#else
+      free(info);
+#endif
     }
 
+#if _GABIXX_HAS_NATIVE_TLS
+    static __thread CxaThreadInfo threadInfo;
+#endif
   };
 
+#if _GABIXX_HAS_NATIVE_TLS
+  __thread CxaThreadInfo CxaThreadKey::threadInfo;
+#endif
+
   // The single static instance, this forces the compiler to register
   // a constructor and destructor for this object in the final library
   // file. They handle the pthread_key_t allocation/deallocation.
@@ -128,6 +262,10 @@ namespace {
 
 
 namespace __cxxabiv1 {
+#if GABIXX_EH_COUNTERS
+  __gabixx::__eh_counters ehCounters;
+#endif
+
   __shim_type_info::~__shim_type_info() {
   }
 
@@ -136,24 +274,54 @@ namespace __cxxabiv1 {
   }
 
   extern "C" __cxa_eh_globals* __cxa_get_globals() {
-    return CxaThreadKey::getSlow();
+    return &CxaThreadKey::getSlow()->globals;
   }
 
   extern "C" __cxa_eh_globals* __cxa_get_globals_fast() {
-    return CxaThreadKey::getFast();
+    CxaThreadInfo* info = CxaThreadKey::getFast();
+    return info != NULL ? &info->globals : NULL;
   }
 
 
   extern "C" void *__cxa_allocate_exception(size_t thrown_size) {
-    size_t size = thrown_size + sizeof(__cxa_exception);
-    __cxa_exception *buffer = static_cast<__cxa_exception*>(malloc(size));
-    if (!buffer) {
-      // Since Android uses memory-overcommit, we enter here only when
-      // the exception object is VERY large. This will propably never happen.
-      // Therefore, we decide to use no emergency spaces.
+    size_t size = sizeof(ExceptionBlockHeader) + sizeof(__cxa_exception) +
+                  thrown_size;
+    size_t sizeClass = kLargeBlock;
+    for (int i = 0; i < kNumSizeClasses; ++i) {
+      if (size <= kExceptionSizeClasses[i]) {
+        sizeClass = i;
+        break;
+      }
+    }
+
+    void* block = NULL;
+    if (sizeClass != kLargeBlock) {
+      CxaThreadInfo* info = CxaThreadKey::getSlow();
+      FreeExceptionBlock* cached = info->freeBlocks[sizeClass];
+      if (cached != NULL) {
+        info->freeBlocks[sizeClass] = cached->next;
+        info->freeCounts[sizeClass]--;
+        block = cached;
+        GABIXX_EH_COUNT(cached_buffers, 1);
+      } else {
+        block = malloc(kExceptionSizeClasses[sizeClass]);
+      }
+    } else {
+      block = malloc(size);
+    }
+    if (!block) {
+      block = allocateEmergencyBlock(size);
+      sizeClass = kEmergencyBlock;
+      GABIXX_EH_COUNT(emergency_buffers, 1);
+    }
+    if (!block) {
       __gabixx::__fatal_error("Not enough memory to allocate exception!");
     }
+    GABIXX_EH_COUNT(exceptions_allocated, 1);
 
+    ExceptionBlockHeader* header = static_cast<ExceptionBlockHeader*>(block);
+    header->sizeClass = sizeClass;
+    __cxa_exception *buffer = reinterpret_cast<__cxa_exception*>(header + 1);
     memset(buffer, 0, sizeof(__cxa_exception));
     return buffer + 1;
   }
@@ -169,7 +337,27 @@ namespace __cxxabiv1 {
       }
     }
 
-    free(exc);
+    ExceptionBlockHeader* header =
+        reinterpret_cast<ExceptionBlockHeader*>(exc) - 1;
+    size_t sizeClass = header->sizeClass;
+    if (sizeClass == kEmergencyBlock) {
+      freeEmergencyBlock(header);
+      return;
+    }
+    if (sizeClass < kNumSizeClasses) {
+      // The buffer may have been allocated by another thread, which is
+      // fine, since all cached buffers come from malloc().
+      CxaThreadInfo* info = CxaThreadKey::getCache();
+      if (info != NULL && info->freeCounts[sizeClass] < kMaxCachedBlocks) {
+        FreeExceptionBlock* block =
+            reinterpret_cast<FreeExceptionBlock*>(header);
+        block->next = info->freeBlocks[sizeClass];
+        info->freeBlocks[sizeClass] = block;
+        info->freeCounts[sizeClass]++;
+        return;
+      }
+    }
+    free(header);
   }
 
 
@@ -183,6 +371,7 @@ namespace __cxxabiv1 {
     header->unwindHeader.exception_class = __gxx_exception_class;
     header->unwindHeader.exception_cleanup = defaultExceptionCleanupFunc;
 
+    GABIXX_EH_COUNT(exceptions_thrown, 1);
     throwException(header);
   }
 
@@ -201,6 +390,7 @@ namespace __cxxabiv1 {
       globals->caughtExceptions = 0;
     }
 
+    GABIXX_EH_COUNT(exceptions_rethrown, 1);
     throwException(header);
   }
 
@@ -271,7 +461,7 @@ namespace __cxxabiv1 {
     __cxa_eh_globals* globals = __cxa_get_globals();
     if (globals == NULL)
       return false;
-    return globals->uncaughtExceptions == 0;
+    return globals->uncaughtExceptions != 0;
   }
 
   extern "C" void __cxa_decrement_exception_refcount(void* exceptionObject)
@@ -313,3 +503,23 @@ namespace __cxxabiv1 {
   }
 
 } // namespace __cxxabiv1
+
+namespace __gabixx {
+
+  bool __get_eh_counters(__eh_counters* counters) {
+#if GABIXX_EH_COUNTERS
+    *counters = __cxxabiv1::ehCounters;
+    return true;
+#else
+    memset(counters, 0, sizeof(*counters));
+    return false;
+#endif
+  }
+
+  void __reset_eh_counters() {
+#if GABIXX_EH_COUNTERS
+    memset(&__cxxabiv1::ehCounters, 0, sizeof(__cxxabiv1::ehCounters));
+#endif
+  }
+
+} // namespace __gabixx
@@ -28,14 +28,37 @@
 // delete.cc: delete operator
 
 #include <gabixx_config.h>
+#include <cxxabi.h>
 #include <stdlib.h>
 #include <new>
 
+namespace {
+  // Frees a block allocated by allocate_block() in new.cc.
+  inline void deallocate_block(void* ptr) {
+#if GABIXX_SIZE_CLASS_ALLOCATOR
+    __gabixx::__size_class_deallocate(ptr);
+#else
+    free(ptr);
+#endif
+  }
+
+
+#if !defined(GABIXX_LIBCXX)
+  // Frees a block allocated by allocate_aligned() in new.cc.
+  inline void deallocate_aligned(void* ptr, std::align_val_t align) {
+    if (static_cast<std::size_t>(align) <= 2 * sizeof(void*))
+      ::operator delete(ptr);
+    else if (ptr)
+      free(ptr);
+  }
+#endif  // !defined(GABIXX_LIBCXX)
+}
+
 _GABIXX_WEAK
 void operator delete(void* ptr) _GABIXX_NOEXCEPT
 {
   if (ptr)
-    free(ptr);
+    deallocate_block(ptr);
 }
 
 _GABIXX_WEAK
@@ -47,8 +70,7 @@ void operator delete[](void* ptr) _GABIXX_NOEXCEPT
 _GABIXX_WEAK
 void operator delete(void* ptr, const std::nothrow_t &) _GABIXX_NOEXCEPT
 {
-    if (ptr)
-        free(ptr);
+    ::operator delete(ptr);
 }
 
 _GABIXX_WEAK
@@ -56,3 +78,62 @@ void operator delete[](void* ptr, const std::nothrow_t &nt) _GABIXX_NOEXCEPT
 {
     ::operator delete(ptr, nt);
 }
+
+// The sized forms forward to the unsized ones, as a program may replace
+// operator new and operator delete without replacing them: its blocks must
+// not be handed to the allocator of allocate_block().
+_GABIXX_WEAK
+void operator delete(void* ptr, std::size_t size) _GABIXX_NOEXCEPT
+{
+    ::operator delete(ptr);
+}
+
+_GABIXX_WEAK
+void operator delete[](void* ptr, std::size_t size) _GABIXX_NOEXCEPT
+{
+    ::operator delete(ptr, size);
+}
+
+#if !defined(GABIXX_LIBCXX)
+
+_GABIXX_WEAK
+void operator delete(void* ptr, std::align_val_t align) _GABIXX_NOEXCEPT
+{
+    deallocate_aligned(ptr, align);
+}
+
+_GABIXX_WEAK
+void operator delete(void* ptr, std::align_val_t align,
+                     const std::nothrow_t &) _GABIXX_NOEXCEPT
+{
+    deallocate_aligned(ptr, align);
+}
+
+_GABIXX_WEAK
+void operator delete(void* ptr, std::size_t size,
+                     std::align_val_t align) _GABIXX_NOEXCEPT
+{
+    ::operator delete(ptr, align);
+}
+
+_GABIXX_WEAK
+void operator delete[](void* ptr, std::align_val_t align) _GABIXX_NOEXCEPT
+{
+    ::operator delete(ptr, align);
+}
+
+_GABIXX_WEAK
+void operator delete[](void* ptr, std::align_val_t align,
+                       const std::nothrow_t &nt) _GABIXX_NOEXCEPT
+{
+    ::operator delete(ptr, align, nt);
+}
+
+_GABIXX_WEAK
+void operator delete[](void* ptr, std::size_t size,
+                       std::align_val_t align) _GABIXX_NOEXCEPT
+{
+    ::operator delete(ptr, size, align);
+}
+
+#endif  // !defined(GABIXX_LIBCXX)
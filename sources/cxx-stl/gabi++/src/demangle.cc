@@ -0,0 +1,2286 @@
+// Copyright (C) 2013 The Android Open Source Project
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS ``AS IS'' AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+//
+// demangle.cc: __cxa_demangle() and a demangler that doesn't allocate
+// memory.
+//
+// References:
+// Itanium C++ ABI at http://www.codesourcery.com/public/cxx-abi/abi.html
+//
+// The demangler never builds a tree of the mangled name, and never copies
+// demangled strings. Substitutions and template arguments are recorded as
+// ranges of the mangled name, and are demangled again each time they are
+// referenced. All state lives in a fixed-size object on the stack, and
+// the output goes directly to the caller's buffer, so __gabixx::__demangle
+// can be called from signal handlers.
+//
+// The output follows the format of the GNU c++filt tool.
+
+#include <cxxabi.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+  // Limits of the demangler state. Names that exceed them are reported
+  // as invalid.
+  const int kMaxSubstitutions = 128;
+  const int kMaxTemplateArgs = 32;
+  const int kMaxModifiers = 16;
+  const int kMaxDepth = 128;
+
+  // Special values of Demangler::packIndex_.
+  const int kNoPack = -1;
+  const int kCountPack = -2;
+
+  // Size of the stack buffer used by __cxa_demangle() to find the size of
+  // the output when the caller doesn't provide a buffer.
+  const size_t kStackBufferSize = 256;
+
+  // Names of the builtin types, indexed by their code minus 'a'.
+  const char* const kBuiltinTypes[26] = {
+    "signed char",         // a
+    "bool",                // b
+    "char",                // c
+    "double",              // d
+    "long double",         // e
+    "float",               // f
+    "__float128",          // g
+    "unsigned char",       // h
+    "int",                 // i
+    "unsigned int",        // j
+    NULL,                  // k
+    "long",                // l
+    "unsigned long",       // m
+    "__int128",            // n
+    "unsigned __int128",   // o
+    NULL,                  // p
+    NULL,                  // q
+    NULL,                  // r
+    "short",               // s
+    "unsigned short",      // t
+    NULL,                  // u: vendor extended type
+    "void",                // v
+    "wchar_t",             // w
+    "long long",           // x
+    "unsigned long long",  // y
+    "...",                 // z
+  };
+
+  // Builtin types with a 'D' prefix, indexed the same way.
+  const char* const kExtendedBuiltinTypes[26] = {
+    "auto",                // a
+    NULL,                  // b
+    "decltype(auto)",      // c
+    "decimal64",           // d
+    "decimal128",          // e
+    "decimal32",           // f
+    NULL,                  // g
+    "half",                // h
+    "char32_t",            // i
+    NULL, NULL, NULL, NULL, // j-m
+    "decltype(nullptr)",   // n
+    NULL, NULL, NULL, NULL, // o-r
+    "char16_t",            // s
+    NULL,                  // t
+    "char8_t",             // u
+    NULL, NULL, NULL, NULL, NULL, // v-z
+  };
+
+  // Table lookup rather than a search, as this is done for every type.
+  inline const char* findBuiltinType(const char* const* table, char code) {
+    if (code < 'a' || code > 'z')
+      return NULL;
+    return table[code - 'a'];
+  }
+
+  struct OperatorName {
+    char code[3];
+    const char* name;
+    // Number of operands in expressions, 0 if the operator can't appear
+    // in expressions handled by this demangler.
+    int arity;
+  };
+
+  const OperatorName kOperatorNames[] = {
+    { "nw", "new", 0 },
+    { "na", "new[]", 0 },
+    { "dl", "delete", 1 },
+    { "da", "delete[]", 1 },
+    { "ps", "+", 1 },
+    { "ng", "-", 1 },
+    { "ad", "&", 1 },
+    { "de", "*", 1 },
+    { "co", "~", 1 },
+    { "pl", "+", 2 },
+    { "mi", "-", 2 },
+    { "ml", "*", 2 },
+    { "dv", "/", 2 },
+    { "rm", "%", 2 },
+    { "an", "&", 2 },
+    { "or", "|", 2 },
+    { "eo", "^", 2 },
+    { "aS", "=", 2 },
+    { "pL", "+=", 2 },
+    { "mI", "-=", 2 },
+    { "mL", "*=", 2 },
+    { "dV", "/=", 2 },
+    { "rM", "%=", 2 },
+    { "aN", "&=", 2 },
+    { "oR", "|=", 2 },
+    { "eO", "^=", 2 },
+    { "ls", "<<", 2 },
+    { "rs", ">>", 2 },
+    { "lS", "<<=", 2 },
+    { "rS", ">>=", 2 },
+    { "eq", "==", 2 },
+    { "ne", "!=", 2 },
+    { "lt", "<", 2 },
+    { "gt", ">", 2 },
+    { "le", "<=", 2 },
+    { "ge", ">=", 2 },
+    { "ss", "<=>", 2 },
+    { "nt", "!", 1 },
+    { "aa", "&&", 2 },
+    { "oo", "||", 2 },
+    { "pp", "++", 1 },
+    { "mm", "--", 1 },
+    { "cm", ",", 2 },
+    { "pm", "->*", 2 },
+    { "pt", "->", 0 },
+    { "cl", "()", 0 },
+    { "ix", "[]", 2 },
+    { "qu", "?", 0 },
+  };
+
+  const OperatorName* findOperatorName(char c0, char c1) {
+    size_t count = sizeof(kOperatorNames) / sizeof(kOperatorNames[0]);
+    for (size_t i = 0; i < count; ++i) {
+      if (kOperatorNames[i].code[0] == c0 && kOperatorNames[i].code[1] == c1)
+        return &kOperatorNames[i];
+    }
+    return NULL;
+  }
+
+  // Standard substitutions, other than St.
+  struct StandardSubstitution {
+    char code;
+    // Full name.
+    const char* name;
+    // Name of the constructors and destructor.
+    const char* shortName;
+  };
+
+  const StandardSubstitution kStandardSubstitutions[] = {
+    { 'a', "std::allocator", "allocator" },
+    { 'b', "std::basic_string", "basic_string" },
+    { 's', "std::basic_string<char, std::char_traits<char>, "
+           "std::allocator<char> >", "basic_string" },
+    { 'i', "std::basic_istream<char, std::char_traits<char> >",
+           "basic_istream" },
+    { 'o', "std::basic_ostream<char, std::char_traits<char> >",
+           "basic_ostream" },
+    { 'd', "std::basic_iostream<char, std::char_traits<char> >",
+           "basic_iostream" },
+  };
+
+  inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  inline bool isUpper(char c) {
+    return c >= 'A' && c <= 'Z';
+  }
+
+  inline bool isLower(char c) {
+    return c >= 'a' && c <= 'z';
+  }
+
+  // What a recorded range of the mangled name is, and how it must be
+  // parsed when it is referenced.
+  enum SpanKind {
+    SPAN_PREFIX,
+    SPAN_TYPE,
+    SPAN_TEMPLATE_ARG,
+    SPAN_EXPRESSION,
+  };
+
+  struct Span {
+    const char* begin;
+    const char* end;
+    SpanKind kind;
+  };
+
+  // Type modifier, i.e. pointer, reference, cv-qualifiers, etc.
+  struct Modifier {
+    // 'P', 'R', 'O', 'C', 'G', 'M', 'U', or 'K' for cv-qualifiers.
+    char code;
+    // For cv-qualifiers, a combination of the kConst, kVolatile and
+    // kRestrict flags.
+    unsigned char qualifiers;
+    // Start of the modifier in the mangled name.
+    const char* begin;
+    // Class type of a pointer to member, or vendor qualifier name.
+    Span operand;
+  };
+
+  const unsigned kConst = 1;
+  const unsigned kVolatile = 2;
+  const unsigned kRestrict = 4;
+
+  // Information on the last name parsed, needed to demangle the enclosing
+  // encoding.
+  struct NameState {
+    // Last source name, for constructors and destructors.
+    const char* lastName;
+    size_t lastNameLength;
+    // True if the name ends with template arguments, in which case the
+    // encoding includes the return type.
+    bool endsWithTemplateArgs;
+    // True if the name is a constructor, destructor, or conversion
+    // operator, whose encodings never include the return type.
+    bool isCtorDtorConv;
+    // cv-qualifiers and ref-qualifier ('R', 'O' or 0) of a nested name.
+    unsigned qualifiers;
+    char refQualifier;
+  };
+
+  class Demangler {
+  public:
+    Demangler(const char* mangled, char* buffer, size_t size)
+        : pos_(mangled), end_(mangled + strlen(mangled)),
+          buffer_(buffer), size_(size), length_(0), last_(0), mute_(0),
+          referenceEnd_(0), referenceCode_(0),
+          numSubstitutions_(0), numTemplateArgs_(0), replaying_(0),
+          depth_(0), typeDepth_(0), inLambdaSignature_(false),
+          packIndex_(kNoPack), packSize_(-1),
+          declaratorDepth_(-1), declaratorEnd_(0) {
+      memset(&name_, 0, sizeof(name_));
+    }
+
+    // Demangles the name. Returns false if it isn't valid.
+    bool demangle();
+
+    // Length of the demangled name.
+    size_t length() const { return length_; }
+
+  private:
+    // Input.
+    char peek() const { return pos_ < end_ ? *pos_ : '\0'; }
+    char peekAt(size_t n) const {
+      return static_cast<size_t>(end_ - pos_) > n ? pos_[n] : '\0';
+    }
+    bool consume(char c) {
+      if (peek() != c)
+        return false;
+      pos_++;
+      return true;
+    }
+    bool consume(char c0, char c1) {
+      if (peek() != c0 || peekAt(1) != c1)
+        return false;
+      pos_ += 2;
+      return true;
+    }
+    bool parseNumber(long* value, bool* negative);
+    bool parseSeqId(unsigned* value);
+    bool parseDiscriminator();
+
+    // Output.
+    void put(char c);
+    void put(const char* str, size_t len);
+    void put(const char* str) { put(str, strlen(str)); }
+    void putNumber(unsigned long value);
+    void putRange(const char* begin, const char* end) {
+      put(begin, end - begin);
+    }
+    void rotate(size_t start, size_t middle, size_t end);
+    void erase(size_t position);
+    void truncate(size_t length);
+
+    // Substitutions and template arguments.
+    bool addSubstitution(SpanKind kind, const char* begin);
+    bool replay(const Span& span);
+    bool parseSubstitution();
+    bool parseSubstitutionSpan(Span* span);
+    bool parseTemplateParam();
+    bool parseTemplateParamSpan(Span* span);
+    bool findPackElement(Span* span);
+    bool parsePackExpansion(SpanKind kind);
+    bool resolveModifiedType(Span* span);
+
+    // Grammar.
+    bool parseEncoding(bool withReturnType = true);
+    bool parseSpecialName();
+    bool parseCallOffset();
+    bool parseName();
+    bool parseUnscopedName();
+    bool parseNestedName();
+    bool parsePrefix();
+    bool parseLocalName();
+    bool parseUnqualifiedName();
+    bool parseSourceName();
+    bool parseOperatorName();
+    bool parseAbiTags();
+    bool parseLambda();
+    bool parseTemplateArgs();
+    bool parseTemplateArg();
+    bool parseBareFunctionType();
+    bool parseType();
+    bool parseClassEnumType();
+    bool parseModifiedType(Modifier* mods, int count);
+    bool parseFunctionType(const Modifier* mods, int count);
+    bool parseArrayType(const Modifier* mods, int count);
+    bool parseVectorType();
+    bool parseDecltype();
+    bool parseExpression(bool* primary);
+    bool parseExpression() {
+      bool primary;
+      return parseExpression(&primary);
+    }
+    bool parseExprPrimary();
+    bool parseAddressOfName(bool* ok);
+
+    void putModifier(const Modifier& mod, bool inParens);
+    void putQualifiers(unsigned qualifiers);
+
+    // Fast path for simple function names.
+    bool demangleSimpleFunction();
+
+    // Input.
+    const char* pos_;
+    const char* end_;
+
+    // Output.
+    char* buffer_;
+    size_t size_;
+    size_t length_;
+    char last_;
+    int mute_;
+    // Output length after the last reference modifier, and the modifier.
+    size_t referenceEnd_;
+    char referenceCode_;
+
+    Span substitutions_[kMaxSubstitutions];
+    int numSubstitutions_;
+    Span templateArgs_[kMaxTemplateArgs];
+    int numTemplateArgs_;
+
+    // Greater than zero while demangling a recorded range again.
+    int replaying_;
+    // Recursion depth, to reject malicious names.
+    int depth_;
+    // Nesting level of types, to find the template arguments of the
+    // encoding.
+    int typeDepth_;
+    // True while parsing the signature of a lambda, where template
+    // parameters are "auto" parameters.
+    bool inLambdaSignature_;
+    // Element of the argument pack being expanded, kNoPack if none, or
+    // kCountPack to count the elements into packSize_.
+    int packIndex_;
+    int packSize_;
+    // Nesting level of the return type of the encoding being parsed, and
+    // output position of the closing parenthesis of its declarator, when
+    // it is a pointer to function.
+    int declaratorDepth_;
+    size_t declaratorEnd_;
+
+    NameState name_;
+  };
+
+  // Saves and restores the name state around nested constructs, such as
+  // the types of template arguments.
+  class NameStateSaver {
+  public:
+    NameStateSaver(NameState* state) : state_(state), saved_(*state) {}
+    ~NameStateSaver() { *state_ = saved_; }
+  private:
+    NameState* state_;
+    NameState saved_;
+  };
+
+  // Limits the recursion depth.
+  class DepthGuard {
+  public:
+    DepthGuard(int* depth) : depth_(depth) { ++*depth_; }
+    ~DepthGuard() { --*depth_; }
+    bool exceeded() const { return *depth_ > kMaxDepth; }
+  private:
+    int* depth_;
+  };
+
+  void Demangler::put(char c) {
+    if (mute_ > 0)
+      return;
+    if (length_ + 1 < size_)
+      buffer_[length_] = c;
+    length_++;
+    last_ = c;
+  }
+
+  void Demangler::put(const char* str, size_t len) {
+    if (mute_ > 0 || len == 0)
+      return;
+    if (length_ + len < size_) {
+      memcpy(buffer_ + length_, str, len);
+    } else if (length_ + 1 < size_) {
+      memcpy(buffer_ + length_, str, size_ - 1 - length_);
+    }
+    length_ += len;
+    last_ = str[len - 1];
+  }
+
+  void Demangler::putNumber(unsigned long value) {
+    char digits[24];
+    int count = 0;
+    do {
+      digits[count++] = '0' + value % 10;
+      value /= 10;
+    } while (value != 0);
+    while (count > 0)
+      put(digits[--count]);
+  }
+
+  // Moves the output from |middle| to |end| before the output from
+  // |start| to |middle|. Nothing is done if the output has been truncated,
+  // as it will have to be demangled again anyway.
+  void Demangler::rotate(size_t start, size_t middle, size_t end) {
+    if (mute_ > 0 || length_ + 1 > size_)
+      return;
+    char* buffer = buffer_;
+    size_t ranges[3][2] = {
+      { start, middle }, { middle, end }, { start, end }
+    };
+    for (int i = 0; i < 3; ++i) {
+      size_t lo = ranges[i][0];
+      size_t hi = ranges[i][1];
+      while (lo + 1 < hi) {
+        char c = buffer[lo];
+        buffer[lo++] = buffer[--hi];
+        buffer[hi] = c;
+      }
+    }
+  }
+
+  // Removes the character at |position| of the output.
+  void Demangler::erase(size_t position) {
+    if (mute_ > 0)
+      return;
+    rotate(position, position + 1, length_);
+    length_--;
+  }
+
+  // Drops the output after |length|.
+  void Demangler::truncate(size_t length) {
+    if (mute_ > 0 || length == length_)
+      return;
+    length_ = length;
+    if (length > 0 && length < size_)
+      last_ = buffer_[length - 1];
+  }
+
+  // <number> ::= [n] <non-negative decimal integer>
+  bool Demangler::parseNumber(long* value, bool* negative) {
+    *negative = consume('n');
+    if (!isDigit(peek()))
+      return false;
+    long result = 0;
+    while (isDigit(peek())) {
+      if (result > 100000000)
+        return false;
+      result = result * 10 + (*pos_++ - '0');
+    }
+    *value = result;
+    return true;
+  }
+
+  // <seq-id> ::= <0-9A-Z>+, followed by '_'. Returns the value plus one,
+  // or zero for a lone '_'.
+  bool Demangler::parseSeqId(unsigned* value) {
+    unsigned result = 0;
+    if (consume('_')) {
+      *value = 0;
+      return true;
+    }
+    while (isDigit(peek()) || isUpper(peek())) {
+      char c = *pos_++;
+      if (result > 0xffffff)
+        return false;
+      result = result * 36 + (isDigit(c) ? c - '0' : c - 'A' + 10);
+    }
+    if (!consume('_'))
+      return false;
+    *value = result + 1;
+    return true;
+  }
+
+  // <discriminator> ::= _ <digit> | __ <number> _
+  bool Demangler::parseDiscriminator() {
+    if (peek() != '_')
+      return true;
+    if (isDigit(peekAt(1))) {
+      pos_ += 2;
+      return true;
+    }
+    if (peekAt(1) == '_' && isDigit(peekAt(2))) {
+      pos_ += 2;
+      while (isDigit(peek()))
+        pos_++;
+      return consume('_');
+    }
+    return true;
+  }
+
+  bool Demangler::addSubstitution(SpanKind kind, const char* begin) {
+    if (replaying_ > 0)
+      return true;
+    if (numSubstitutions_ == kMaxSubstitutions)
+      return false;
+    Span& span = substitutions_[numSubstitutions_++];
+    span.begin = begin;
+    span.end = pos_;
+    span.kind = kind;
+    return true;
+  }
+
+  // Demangles a recorded range of the mangled name again.
+  bool Demangler::replay(const Span& span) {
+    DepthGuard guard(&depth_);
+    if (guard.exceeded())
+      return false;
+
+    const char* savedPos = pos_;
+    const char* savedEnd = end_;
+    const int savedTypeDepth = typeDepth_;
+    pos_ = span.begin;
+    end_ = span.end;
+    replaying_++;
+    // A recorded type stands for the reference being replaced, at the same
+    // nesting level.
+    if (span.kind == SPAN_TYPE || span.kind == SPAN_TEMPLATE_ARG)
+      typeDepth_--;
+    bool ok;
+    switch (span.kind) {
+    case SPAN_PREFIX:
+      ok = parsePrefix();
+      break;
+    case SPAN_TYPE:
+      ok = parseType();
+      break;
+    case SPAN_TEMPLATE_ARG:
+      ok = parseTemplateArg();
+      break;
+    default:
+      ok = parseExpression();
+      break;
+    }
+    ok = ok && pos_ == end_;
+    replaying_--;
+    typeDepth_ = savedTypeDepth;
+    pos_ = savedPos;
+    end_ = savedEnd;
+    return ok;
+  }
+
+  // Parses a reference to a recorded substitution, other than a standard
+  // one.
+  bool Demangler::parseSubstitutionSpan(Span* span) {
+    unsigned index;
+    if (!consume('S') || !parseSeqId(&index))
+      return false;
+    if (index >= static_cast<unsigned>(numSubstitutions_))
+      return false;
+    *span = substitutions_[index];
+    return true;
+  }
+
+  // <substitution> ::= S [<seq-id>] _
+  //                ::= Sa | Sb | Ss | Si | So | Sd
+  bool Demangler::parseSubstitution() {
+    if (peek() != 'S')
+      return false;
+    char c = peekAt(1);
+    if (isLower(c)) {
+      size_t count = sizeof(kStandardSubstitutions) /
+                     sizeof(kStandardSubstitutions[0]);
+      for (size_t i = 0; i < count; ++i) {
+        const StandardSubstitution& sub = kStandardSubstitutions[i];
+        if (sub.code == c) {
+          pos_ += 2;
+          put(sub.name);
+          name_.lastName = sub.shortName;
+          name_.lastNameLength = strlen(sub.shortName);
+          return true;
+        }
+      }
+      return false;
+    }
+    Span span;
+    return parseSubstitutionSpan(&span) && replay(span);
+  }
+
+  // Parses a reference to a template argument. The element being expanded
+  // is returned for argument packs, so the modifiers of the pattern apply
+  // to it as to any other type.
+  bool Demangler::parseTemplateParamSpan(Span* span) {
+    unsigned index;
+    if (!consume('T') || !parseSeqId(&index))
+      return false;
+    if (index >= static_cast<unsigned>(numTemplateArgs_))
+      return false;
+    *span = templateArgs_[index];
+    if (packIndex_ != kNoPack && span->begin[0] == 'J')
+      return findPackElement(span);
+    return true;
+  }
+
+  // <template-param> ::= T_ | T <number> _
+  bool Demangler::parseTemplateParam() {
+    if (inLambdaSignature_) {
+      unsigned index;
+      if (!consume('T') || !parseSeqId(&index))
+        return false;
+      put("auto:");
+      putNumber(index + 1);
+      return true;
+    }
+    Span span;
+    return parseTemplateParamSpan(&span) && replay(span);
+  }
+
+  // Replaces the argument pack |span| with its element being expanded, or
+  // counts its elements into packSize_, leaving the whole pack.
+  bool Demangler::findPackElement(Span* span) {
+    DepthGuard guard(&depth_);
+    if (guard.exceeded())
+      return false;
+    const char* savedPos = pos_;
+    const char* savedEnd = end_;
+    const int savedDeclaratorDepth = declaratorDepth_;
+    const int index = packIndex_;
+    pos_ = span->begin + 1;
+    end_ = span->end;
+    mute_++;
+    replaying_++;
+    packIndex_ = kNoPack;
+    declaratorDepth_ = -1;
+    bool ok = true;
+    int count = 0;
+    for (; ok && peek() != 'E'; ++count) {
+      const char* element = pos_;
+      ok = pos_ < end_ && parseTemplateArg();
+      if (ok && count == index) {
+        span->begin = element;
+        span->end = pos_;
+        break;
+      }
+    }
+    if (index == kCountPack)
+      packSize_ = count;
+    else
+      ok = ok && count == index;
+    declaratorDepth_ = savedDeclaratorDepth;
+    packIndex_ = index;
+    replaying_--;
+    mute_--;
+    pos_ = savedPos;
+    end_ = savedEnd;
+    return ok;
+  }
+
+  // <type> ::= Dp <type>
+  // <expression> ::= sp <expression>
+  //
+  // The pattern, a type or an expression according to |kind|, is printed
+  // once for each element of the argument pack it refers to, or as
+  // "(pattern)..." or "pattern..." if there is none.
+  bool Demangler::parsePackExpansion(SpanKind kind) {
+    pos_ += 2;
+    const char* pattern = pos_;
+    const int savedIndex = packIndex_;
+    const int savedSize = packSize_;
+
+    // Count the elements, recording the substitutions of the pattern.
+    packIndex_ = kCountPack;
+    packSize_ = -1;
+    mute_++;
+    bool ok = kind == SPAN_TYPE ? parseType() : parseExpression();
+    mute_--;
+    const char* patternEnd = pos_;
+    int size = packSize_;
+
+    if (ok && size < 0) {
+      packIndex_ = kNoPack;
+      Span span = { pattern, patternEnd, kind };
+      if (kind == SPAN_TYPE)
+        put('(');
+      ok = replay(span);
+      put(kind == SPAN_TYPE ? ")..." : "...");
+    }
+    for (int i = 0; ok && i < size; ++i) {
+      if (i > 0)
+        put(", ");
+      packIndex_ = i;
+      pos_ = pattern;
+      replaying_++;
+      ok = kind == SPAN_TYPE ? parseType() : parseExpression();
+      ok = ok && pos_ == patternEnd;
+      replaying_--;
+    }
+    pos_ = patternEnd;
+    packIndex_ = savedIndex;
+    packSize_ = savedSize;
+    return ok;
+  }
+
+  // <mangled-name> ::= _Z <encoding> [.<clone-suffix>]*
+  //
+  // Types are also accepted, as returned by std::type_info::name().
+  bool Demangler::demangle() {
+    if (pos_[0] == '_' && pos_[1] == 'Z') {
+      const char* start = pos_;
+      if (demangleSimpleFunction())
+        return true;
+      pos_ = start;
+      length_ = 0;
+      last_ = 0;
+
+      pos_ += 2;
+      if (!parseEncoding())
+        return false;
+      while (peek() == '.' && (isLower(peekAt(1)) || peekAt(1) == '_')) {
+        put(" [clone ");
+        const char* suffix = pos_++;
+        while (isLower(peek()) || peek() == '_')
+          pos_++;
+        while (peek() == '.' && isDigit(peekAt(1))) {
+          pos_++;
+          while (isDigit(peek()))
+            pos_++;
+        }
+        putRange(suffix, pos_);
+        put(']');
+      }
+      return pos_ == end_;
+    }
+    return parseType() && pos_ == end_;
+  }
+
+  // Handles names of functions that are not templates, whose names only
+  // contain source names, and whose parameters are builtin types, possibly
+  // with pointers, references, and cv-qualifiers. Most C++ symbols of
+  // typical programs are such names, which don't need to record any
+  // substitution. Returns false for all other names.
+  bool Demangler::demangleSimpleFunction() {
+    pos_ += 2;
+    bool nested = consume('N');
+    unsigned qualifiers = 0;
+    if (nested && consume('K'))
+      qualifiers = kConst;
+    bool first = true;
+    do {
+      if (!isDigit(peek()))
+        return false;
+      if (!first)
+        put("::");
+      if (!parseSourceName())
+        return false;
+      first = false;
+    } while (nested && peek() != 'E');
+    if (nested)
+      pos_++;
+    if (pos_ == end_)
+      return false;
+
+    put('(');
+    if (peek() == 'v' && peekAt(1) == '\0') {
+      pos_++;
+    } else {
+      first = true;
+      while (pos_ < end_) {
+        if (!first)
+          put(", ");
+        first = false;
+        // Modifiers, from outermost to innermost.
+        char mods[4];
+        int count = 0;
+        while (count < 4 && (peek() == 'P' || peek() == 'R' || peek() == 'K'))
+          mods[count++] = *pos_++;
+        const char* type = findBuiltinType(kBuiltinTypes, peek());
+        if (type == NULL || (count > 0 && peek() == 'z'))
+          return false;
+        pos_++;
+        put(type);
+        while (count > 0) {
+          switch (mods[--count]) {
+          case 'P': put('*'); break;
+          case 'R': put('&'); break;
+          default: put(" const"); break;
+          }
+        }
+      }
+    }
+    put(')');
+    putQualifiers(qualifiers);
+    return true;
+  }
+
+  // <encoding> ::= <name> <bare-function-type>
+  //            ::= <name>
+  //            ::= <special-name>
+  bool Demangler::parseEncoding(bool withReturnType) {
+    DepthGuard guard(&depth_);
+    if (guard.exceeded())
+      return false;
+
+    char c = peek();
+    if (c == 'T' || (c == 'G' && (peekAt(1) == 'V' || peekAt(1) == 'R')))
+      return parseSpecialName();
+
+    size_t nameStart = length_;
+    if (!parseName())
+      return false;
+    NameState state = name_;
+
+    c = peek();
+    if (c == '\0' || c == 'E' || c == '.')
+      return true;
+
+    // Start of the part of the return type that follows the parameters.
+    size_t returnTail = 0;
+    if (state.endsWithTemplateArgs && !state.isCtorDtorConv) {
+      if (!withReturnType) {
+        mute_++;
+        bool ok = parseType();
+        mute_--;
+        if (!ok)
+          return false;
+      } else {
+        size_t returnStart = length_;
+        declaratorDepth_ = typeDepth_ + 1;
+        declaratorEnd_ = 0;
+        bool ok = parseType();
+        declaratorDepth_ = -1;
+        if (!ok)
+          return false;
+        if (declaratorEnd_ != 0) {
+          // The return type is a pointer to function, so the name and
+          // parameters go in its parentheses, as in "void (*f(int))()".
+          returnTail = declaratorEnd_;
+          rotate(nameStart, returnStart, declaratorEnd_);
+        } else {
+          put(' ');
+          rotate(nameStart, returnStart, length_);
+        }
+      }
+    }
+    size_t parametersStart = length_;
+    if (!parseBareFunctionType())
+      return false;
+    putQualifiers(state.qualifiers);
+    if (state.refQualifier == 'R')
+      put(" &");
+    else if (state.refQualifier == 'O')
+      put(" &&");
+    if (returnTail != 0)
+      rotate(returnTail, parametersStart, length_);
+    return true;
+  }
+
+  // <bare-function-type> ::= <signature type>+
+  bool Demangler::parseBareFunctionType() {
+    bool any = false;
+    put('(');
+    if (peek() == 'v') {
+      char next = peekAt(1);
+      if (next == '\0' || next == 'E' || next == '.') {
+        pos_++;
+        put(')');
+        return true;
+      }
+    }
+    bool first = true;
+    for (;;) {
+      char c = peek();
+      if (c == '\0' || c == 'E' || c == '.')
+        break;
+      size_t separator = length_;
+      if (!first)
+        put(", ");
+      size_t type = length_;
+      if (!parseType())
+        return false;
+      // Empty pack expansions print nothing.
+      if (length_ == type)
+        truncate(separator);
+      else
+        first = false;
+      any = true;
+    }
+    put(')');
+    return any;
+  }
+
+  // <special-name> ::= TV <type> | TT <type> | TI <type> | TS <type>
+  //                ::= Th <call-offset> <encoding>
+  //                ::= Tv <call-offset> <encoding>
+  //                ::= Tc <call-offset> <call-offset> <encoding>
+  //                ::= TC <type> <number> _ <type>
+  //                ::= TW <name> | TH <name>
+  //                ::= GV <name>
+  //                ::= GR <name> [<seq-id>] _
+  bool Demangler::parseSpecialName() {
+    char c0 = *pos_++;
+    char c1 = peek();
+    pos_++;
+    if (c0 == 'G') {
+      if (c1 == 'V') {
+        put("guard variable for ");
+        return parseName();
+      }
+      size_t nameStart = length_;
+      if (!parseName())
+        return false;
+      size_t nameEnd = length_;
+      unsigned index = 0;
+      if (!consume('_') && !parseSeqId(&index))
+        return false;
+      put("reference temporary #");
+      putNumber(index);
+      put(" for ");
+      rotate(nameStart, nameEnd, length_);
+      return true;
+    }
+
+    switch (c1) {
+    case 'V':
+      put("vtable for ");
+      return parseType();
+    case 'T':
+      put("VTT for ");
+      return parseType();
+    case 'I':
+      put("typeinfo for ");
+      return parseType();
+    case 'S':
+      put("typeinfo name for ");
+      return parseType();
+    case 'h':
+      put("non-virtual thunk to ");
+      pos_--;
+      return parseCallOffset() && parseEncoding();
+    case 'v':
+      put("virtual thunk to ");
+      pos_--;
+      return parseCallOffset() && parseEncoding();
+    case 'c':
+      put("covariant return thunk to ");
+      return parseCallOffset() && parseCallOffset() && parseEncoding();
+    case 'W':
+      put("TLS wrapper function for ");
+      return parseName();
+    case 'H':
+      put("TLS init function for ");
+      return parseName();
+    case 'C': {
+      put("construction vtable for ");
+      size_t derivedStart = length_;
+      if (!parseType())
+        return false;
+      size_t derivedEnd = length_;
+      long offset;
+      bool negative;
+      if (!parseNumber(&offset, &negative) || !consume('_'))
+        return false;
+      if (!parseType())
+        return false;
+      put("-in-");
+      rotate(derivedStart, derivedEnd, length_);
+      return true;
+    }
+    default:
+      return false;
+    }
+  }
+
+  // <call-offset> ::= h <nv-offset> _
+  //               ::= v <v-offset> _
+  // <nv-offset> ::= <number>
+  // <v-offset> ::= <number> _ <number>
+  bool Demangler::parseCallOffset() {
+    long value;
+    bool negative;
+    if (consume('h'))
+      return parseNumber(&value, &negative) && consume('_');
+    if (consume('v'))
+      return parseNumber(&value, &negative) && consume('_') &&
+             parseNumber(&value, &negative) && consume('_');
+    return false;
+  }
+
+  // <name> ::= <nested-name>
+  //        ::= <unscoped-name>
+  //        ::= <unscoped-template-name> <template-args>
+  //        ::= <local-name>
+  bool Demangler::parseName() {
+    name_.endsWithTemplateArgs = false;
+    name_.isCtorDtorConv = false;
+    name_.qualifiers = 0;
+    name_.refQualifier = 0;
+
+    char c = peek();
+    if (c == 'N')
+      return parseNestedName();
+    if (c == 'Z')
+      return parseLocalName();
+
+    const char* start = pos_;
+    if (c == 'S' && peekAt(1) != 't') {
+      // <unscoped-template-name> ::= <substitution>
+      if (!parseSubstitution() || peek() != 'I')
+        return false;
+    } else {
+      if (!parseUnscopedName())
+        return false;
+      if (peek() != 'I')
+        return true;
+      if (!addSubstitution(SPAN_PREFIX, start))
+        return false;
+    }
+    if (!parseTemplateArgs())
+      return false;
+    name_.endsWithTemplateArgs = true;
+    return true;
+  }
+
+  // <unscoped-name> ::= <unqualified-name>
+  //                 ::= St <unqualified-name>
+  bool Demangler::parseUnscopedName() {
+    if (consume('S', 't'))
+      put("std::");
+    return parseUnqualifiedName();
+  }
+
+  // <nested-name> ::= N [<CV-qualifiers>] [<ref-qualifier>] <prefix>
+  //                   <unqualified-name> E
+  //               ::= N [<CV-qualifiers>] [<ref-qualifier>]
+  //                   <template-prefix> <template-args> E
+  bool Demangler::parseNestedName() {
+    pos_++;
+    unsigned qualifiers = 0;
+    if (consume('r'))
+      qualifiers |= kRestrict;
+    if (consume('V'))
+      qualifiers |= kVolatile;
+    if (consume('K'))
+      qualifiers |= kConst;
+    char refQualifier = 0;
+    if (peek() == 'R' || peek() == 'O')
+      refQualifier = *pos_++;
+
+    if (!parsePrefix() || !consume('E'))
+      return false;
+    name_.qualifiers = qualifiers;
+    name_.refQualifier = refQualifier;
+    return true;
+  }
+
+  // Parses the components of a nested name, up to the final 'E', or the
+  // end of the input when demangling a recorded prefix again. Each prefix
+  // but the whole name is a substitution candidate.
+  //
+  // <prefix> ::= <prefix> <unqualified-name>
+  //          ::= <template-prefix> <template-args>
+  //          ::= <template-param>
+  //          ::= <decltype>
+  //          ::= <substitution>
+  //          ::= <prefix> <data-member-prefix>
+  bool Demangler::parsePrefix() {
+    const char* start = pos_;
+    bool first = true;
+    for (;;) {
+      char c = peek();
+      if (c == '\0' || c == 'E')
+        break;
+      bool candidate = true;
+      if (c == 'I') {
+        if (first || !parseTemplateArgs())
+          return false;
+        name_.endsWithTemplateArgs = true;
+      } else if (c == 'M') {
+        // <data-member-prefix> ::= <member source-name> [<template-args>] M
+        if (first)
+          return false;
+        pos_++;
+        candidate = false;
+      } else {
+        if (!first)
+          put("::");
+        name_.endsWithTemplateArgs = false;
+        if (c == 'S' && peekAt(1) == 't') {
+          pos_ += 2;
+          put("std");
+          candidate = false;
+        } else if (c == 'S') {
+          if (!parseSubstitution())
+            return false;
+          candidate = false;
+        } else if (c == 'T') {
+          if (!parseTemplateParam())
+            return false;
+        } else if (c == 'D' && (peekAt(1) == 't' || peekAt(1) == 'T')) {
+          if (!parseDecltype())
+            return false;
+        } else {
+          if (!parseUnqualifiedName())
+            return false;
+        }
+      }
+      first = false;
+      c = peek();
+      if (candidate && c != 'E' && c != '\0' &&
+          !addSubstitution(SPAN_PREFIX, start))
+        return false;
+    }
+    return !first;
+  }
+
+  // <local-name> ::= Z <function encoding> E <entity name> [<discriminator>]
+  //              ::= Z <function encoding> E s [<discriminator>]
+  //              ::= Z <function encoding> Ed [<number>] _ <entity name>
+  bool Demangler::parseLocalName() {
+    pos_++;
+    // The return type of the enclosing function is not printed.
+    if (!parseEncoding(false) || !consume('E'))
+      return false;
+    if (consume('s')) {
+      put("::string literal");
+      name_.endsWithTemplateArgs = false;
+      name_.isCtorDtorConv = false;
+      name_.qualifiers = 0;
+      name_.refQualifier = 0;
+      return parseDiscriminator();
+    }
+    if (consume('d')) {
+      long number = -1;
+      bool negative;
+      if (peek() != '_' && !parseNumber(&number, &negative))
+        return false;
+      if (!consume('_'))
+        return false;
+      put("::{default arg#");
+      putNumber(number + 2);
+      put('}');
+    }
+    put("::");
+    return parseName() && parseDiscriminator();
+  }
+
+  // <unqualified-name> ::= <operator-name> [<abi-tags>]
+  //                    ::= <ctor-dtor-name>
+  //                    ::= <source-name> [<abi-tags>]
+  //                    ::= <unnamed-type-name>
+  //                    ::= L <source-name> [<discriminator>]
+  bool Demangler::parseUnqualifiedName() {
+    char c = peek();
+    name_.isCtorDtorConv = false;
+    if (isDigit(c))
+      return parseSourceName() && parseAbiTags();
+    if (c == 'L') {
+      pos_++;
+      return parseSourceName() && parseDiscriminator();
+    }
+    if (c == 'U')
+      return parseLambda();
+    if (c == 'C') {
+      // <ctor-dtor-name> ::= C1 | C2 | C3 | C4 | C5 | CI1 <type> | CI2 <type>
+      pos_++;
+      if (consume('I')) {
+        if (!isDigit(peek()))
+          return false;
+        pos_++;
+        mute_++;
+        bool ok = parseType();
+        mute_--;
+        if (!ok)
+          return false;
+      } else {
+        if (!isDigit(peek()))
+          return false;
+        pos_++;
+      }
+      if (name_.lastName == NULL)
+        return false;
+      put(name_.lastName, name_.lastNameLength);
+      name_.isCtorDtorConv = true;
+      return parseAbiTags();
+    }
+    if (c == 'D' && isDigit(peekAt(1))) {
+      // <ctor-dtor-name> ::= D0 | D1 | D2 | D4 | D5
+      pos_ += 2;
+      if (name_.lastName == NULL)
+        return false;
+      put('~');
+      put(name_.lastName, name_.lastNameLength);
+      name_.isCtorDtorConv = true;
+      return parseAbiTags();
+    }
+    if (isLower(c))
+      return parseOperatorName() && parseAbiTags();
+    return false;
+  }
+
+  // <source-name> ::= <positive length number> <identifier>
+  bool Demangler::parseSourceName() {
+    size_t length = 0;
+    while (isDigit(peek())) {
+      length = length * 10 + (*pos_++ - '0');
+      if (length > 0x10000)
+        return false;
+    }
+    if (length == 0 || static_cast<size_t>(end_ - pos_) < length)
+      return false;
+    const char* name = pos_;
+    pos_ += length;
+    if (length >= 10 && memcmp(name, "_GLOBAL_", 8) == 0 &&
+        (name[8] == '_' || name[8] == '.' || name[8] == '$') &&
+        name[9] == 'N') {
+      put("(anonymous namespace)");
+    } else {
+      put(name, length);
+    }
+    name_.lastName = name;
+    name_.lastNameLength = length;
+    return true;
+  }
+
+  // <abi-tags> ::= <abi-tag>*
+  // <abi-tag> ::= B <source-name>
+  bool Demangler::parseAbiTags() {
+    while (peek() == 'B') {
+      pos_++;
+      size_t length = 0;
+      while (isDigit(peek()))
+        length = length * 10 + (*pos_++ - '0');
+      if (length == 0 || static_cast<size_t>(end_ - pos_) < length)
+        return false;
+      put("[abi:");
+      put(pos_, length);
+      put(']');
+      pos_ += length;
+    }
+    return true;
+  }
+
+  // <operator-name> ::= <two lowercase letters>
+  //                 ::= cv <type>
+  //                 ::= li <source-name>
+  //                 ::= v <digit> <source-name>
+  bool Demangler::parseOperatorName() {
+    char c0 = peek();
+    char c1 = peekAt(1);
+    if (c0 == 'c' && c1 == 'v') {
+      pos_ += 2;
+      put("operator ");
+      if (!parseType())
+        return false;
+      name_.isCtorDtorConv = true;
+      return true;
+    }
+    if (c0 == 'l' && c1 == 'i') {
+      pos_ += 2;
+      put("operator\"\" ");
+      return parseSourceName();
+    }
+    if (c0 == 'v' && isDigit(c1)) {
+      pos_ += 2;
+      put("operator ");
+      return parseSourceName();
+    }
+    const OperatorName* op = findOperatorName(c0, c1);
+    if (op == NULL)
+      return false;
+    pos_ += 2;
+    put("operator");
+    if (isLower(op->name[0]))
+      put(' ');
+    put(op->name);
+    return true;
+  }
+
+  // <unnamed-type-name> ::= Ut [<number>] _
+  //                     ::= <closure-type-name>
+  // <closure-type-name> ::= Ul <lambda-sig> E [<number>] _
+  // <lambda-sig> ::= <parameter type>+
+  bool Demangler::parseLambda() {
+    pos_++;
+    long number = -1;
+    bool negative;
+    if (consume('t')) {
+      if (peek() != '_' && !parseNumber(&number, &negative))
+        return false;
+      if (!consume('_'))
+        return false;
+      put("{unnamed type#");
+      putNumber(number + 2);
+      put('}');
+      return true;
+    }
+    if (!consume('l'))
+      return false;
+    put("{lambda(");
+    bool saved = inLambdaSignature_;
+    inLambdaSignature_ = true;
+    bool ok = true;
+    if (peek() == 'v' && peekAt(1) == 'E') {
+      pos_++;
+    } else {
+      bool first = true;
+      while (ok && peek() != 'E') {
+        if (peek() == '\0') {
+          ok = false;
+          break;
+        }
+        if (!first)
+          put(", ");
+        first = false;
+        ok = parseType();
+      }
+    }
+    inLambdaSignature_ = saved;
+    if (!ok || !consume('E'))
+      return false;
+    if (peek() != '_' && !parseNumber(&number, &negative))
+      return false;
+    if (!consume('_'))
+      return false;
+    put(")#");
+    putNumber(number + 2);
+    put('}');
+    return true;
+  }
+
+  // <template-args> ::= I <template-arg>+ E
+  //
+  // The arguments of the name of the encoding are recorded, as the targets
+  // of template parameters.
+  bool Demangler::parseTemplateArgs() {
+    DepthGuard guard(&depth_);
+    if (guard.exceeded() || !consume('I'))
+      return false;
+    NameStateSaver saver(&name_);
+    bool record = replaying_ == 0 && typeDepth_ == 0;
+    if (record)
+      numTemplateArgs_ = 0;
+    if (last_ == '<')
+      put(' ');
+    put('<');
+    bool first = true;
+    while (peek() != 'E') {
+      if (peek() == '\0')
+        return false;
+      size_t separator = length_;
+      if (!first)
+        put(", ");
+      size_t arg = length_;
+      const char* start = pos_;
+      typeDepth_++;
+      bool ok = parseTemplateArg();
+      typeDepth_--;
+      if (!ok)
+        return false;
+      // Empty argument packs print nothing. Like c++filt, a following
+      // '>' isn't separated from the previous argument then.
+      if (length_ != arg) {
+        first = false;
+      } else if (!first && mute_ == 0) {
+        truncate(separator);
+        last_ = ' ';
+      }
+      if (record) {
+        if (numTemplateArgs_ == kMaxTemplateArgs)
+          return false;
+        Span& span = templateArgs_[numTemplateArgs_++];
+        span.begin = start;
+        span.end = pos_;
+        span.kind = SPAN_TEMPLATE_ARG;
+      }
+    }
+    pos_++;
+    if (last_ == '>')
+      put(' ');
+    put('>');
+    return true;
+  }
+
+  // <template-arg> ::= <type>
+  //                ::= X <expression> E
+  //                ::= <expr-primary>
+  //                ::= J <template-arg>* E
+  bool Demangler::parseTemplateArg() {
+    char c = peek();
+    if (c == 'X') {
+      pos_++;
+      return parseExpression() && consume('E');
+    }
+    if (c == 'L')
+      return parseExprPrimary();
+    if (c == 'J') {
+      // Argument packs are printed as their elements.
+      pos_++;
+      bool first = true;
+      while (peek() != 'E') {
+        if (peek() == '\0')
+          return false;
+        size_t separator = length_;
+        if (!first)
+          put(", ");
+        size_t arg = length_;
+        if (!parseTemplateArg())
+          return false;
+        if (length_ == arg)
+          truncate(separator);
+        else
+          first = false;
+      }
+      pos_++;
+      return true;
+    }
+    return parseType();
+  }
+
+  // <type> ::= <builtin-type>
+  //        ::= <qualified-type>
+  //        ::= <function-type>
+  //        ::= <class-enum-type>
+  //        ::= <array-type>
+  //        ::= <pointer-to-member-type>
+  //        ::= <template-param>
+  //        ::= <template-template-param> <template-args>
+  //        ::= <decltype>
+  //        ::= P <type> | R <type> | O <type> | C <type> | G <type>
+  //        ::= <substitution>
+  //        ::= Dp <type>
+  //        ::= Dv <number> _ <type>
+  bool Demangler::parseType() {
+    DepthGuard guard(&depth_);
+    if (guard.exceeded())
+      return false;
+    NameStateSaver saver(&name_);
+    typeDepth_++;
+
+    const char* start = pos_;
+    char c = peek();
+    bool ok;
+    const char* builtin = findBuiltinType(kBuiltinTypes, c);
+    if (builtin != NULL) {
+      pos_++;
+      put(builtin);
+      ok = true;
+    } else {
+      switch (c) {
+      case 'u':
+        pos_++;
+        ok = parseSourceName() && addSubstitution(SPAN_TYPE, start);
+        break;
+      case 'D': {
+        char c1 = peekAt(1);
+        builtin = findBuiltinType(kExtendedBuiltinTypes, c1);
+        if (builtin != NULL) {
+          pos_ += 2;
+          put(builtin);
+          ok = true;
+        } else if (c1 == 'F') {
+          // DF <number> _: ISO/IEC TS 18661 binary floating point types.
+          pos_ += 2;
+          long bits;
+          bool negative;
+          ok = parseNumber(&bits, &negative) && consume('_');
+          put("_Float");
+          putNumber(bits);
+        } else if (c1 == 'p') {
+          ok = parsePackExpansion(SPAN_TYPE) && addSubstitution(SPAN_TYPE, start);
+        } else if (c1 == 't' || c1 == 'T') {
+          ok = parseDecltype() && addSubstitution(SPAN_TYPE, start);
+        } else if (c1 == 'v') {
+          ok = parseVectorType() && addSubstitution(SPAN_TYPE, start);
+        } else {
+          ok = false;
+        }
+        break;
+      }
+      case 'P':
+      case 'R':
+      case 'O':
+      case 'C':
+      case 'G':
+      case 'K':
+      case 'V':
+      case 'r':
+      case 'M':
+      case 'U':
+      case 'F':
+      case 'A': {
+        Modifier mods[kMaxModifiers];
+        ok = parseModifiedType(mods, 0);
+        break;
+      }
+      case 'T':
+        // <template-template-param> <template-args>
+        ok = parseTemplateParam() && addSubstitution(SPAN_TYPE, start);
+        if (ok && peek() == 'I')
+          ok = parseTemplateArgs() && addSubstitution(SPAN_TYPE, start);
+        break;
+      case 'S':
+        if (peekAt(1) != 't') {
+          ok = parseSubstitution();
+          if (ok && peek() == 'I')
+            ok = parseTemplateArgs() && addSubstitution(SPAN_TYPE, start);
+          break;
+        }
+        // Fall through.
+      default:
+        ok = parseClassEnumType();
+        break;
+      }
+    }
+    typeDepth_--;
+    return ok;
+  }
+
+  // <class-enum-type> ::= <name>
+  bool Demangler::parseClassEnumType() {
+    const char* start = pos_;
+    char c = peek();
+    if (!isDigit(c) && c != 'N' && c != 'Z' && c != 'S')
+      return false;
+    return parseName() && addSubstitution(SPAN_TYPE, start);
+  }
+
+  void Demangler::putQualifiers(unsigned qualifiers) {
+    if (qualifiers & kConst)
+      put(" const");
+    if (qualifiers & kVolatile)
+      put(" volatile");
+    if (qualifiers & kRestrict)
+      put(" restrict");
+  }
+
+  // Prints a type modifier, after the type it applies to, or in the
+  // parentheses of a function or array type.
+  void Demangler::putModifier(const Modifier& mod, bool inParens) {
+    switch (mod.code) {
+    case 'P':
+      put('*');
+      break;
+    case 'R':
+    case 'O':
+      // References to references collapse, as in "int&" for "T&&" when T
+      // is "int&".
+      if (!inParens && mute_ == 0 && length_ > 0 &&
+          length_ == referenceEnd_) {
+        if (referenceCode_ == 'O' && mod.code == 'R') {
+          erase(length_ - 1);
+          referenceEnd_ = length_;
+          referenceCode_ = 'R';
+        }
+        break;
+      }
+      put(mod.code == 'R' ? "&" : "&&");
+      referenceEnd_ = length_;
+      referenceCode_ = mod.code;
+      break;
+    case 'C':
+      put(" _Complex");
+      break;
+    case 'G':
+      put(" _Imaginary");
+      break;
+    case 'K':
+      if (inParens && last_ == '(')
+        put(' ');
+      putQualifiers(mod.qualifiers);
+      break;
+    case 'M':
+      if (!inParens || last_ != '(')
+        put(' ');
+      replay(mod.operand);
+      put("::*");
+      break;
+    case 'U':
+      put(' ');
+      putRange(mod.operand.begin, mod.operand.end);
+      break;
+    }
+  }
+
+  // Returns true if a recorded type starts with type modifiers, or is a
+  // function or array type.
+  bool isModifiedType(const Span& span) {
+    if (span.kind != SPAN_TYPE && span.kind != SPAN_TEMPLATE_ARG)
+      return false;
+    switch (span.begin[0]) {
+    case 'P': case 'R': case 'O': case 'C': case 'G':
+    case 'K': case 'V': case 'r': case 'M': case 'F': case 'A':
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // Follows references to substitutions and template parameters that make
+  // up a whole recorded type, until a modified type, which replaces |span|.
+  // Returns false if there is none.
+  bool Demangler::resolveModifiedType(Span* span) {
+    for (int i = 0; i < kMaxDepth; ++i) {
+      if (isModifiedType(*span))
+        return true;
+      char c = span->begin[0];
+      if ((c != 'S' || isLower(span->begin[1])) && c != 'T')
+        return false;
+      const char* savedPos = pos_;
+      const char* savedEnd = end_;
+      pos_ = span->begin;
+      end_ = span->end;
+      Span next;
+      bool found = c == 'S' ? parseSubstitutionSpan(&next)
+                            : parseTemplateParamSpan(&next);
+      found = found && pos_ == end_;
+      pos_ = savedPos;
+      end_ = savedEnd;
+      if (!found)
+        return false;
+      *span = next;
+    }
+    return false;
+  }
+
+  // Parses a chain of type modifiers, and the type they apply to. The
+  // modifiers are printed after the type, or in parentheses for function
+  // and array types. Each modified type is a substitution candidate, from
+  // the innermost to the outermost.
+  //
+  // |mods| holds |count| modifiers that apply to this type, when it is the
+  // target of a substitution or template parameter, which are needed to
+  // print function and array types, as in "void (**)(int)".
+  //
+  // <qualified-type> ::= <qualifiers> <type>
+  // <pointer-to-member-type> ::= M <class type> <member type>
+  bool Demangler::parseModifiedType(Modifier* mods, int count) {
+    const int first = count;
+    for (;;) {
+      char c = peek();
+      if (count == kMaxModifiers)
+        return false;
+      Modifier& mod = mods[count];
+      mod.begin = pos_;
+      mod.qualifiers = 0;
+      if (c == 'r' || c == 'V' || c == 'K') {
+        mod.code = 'K';
+        if (consume('r'))
+          mod.qualifiers |= kRestrict;
+        if (consume('V'))
+          mod.qualifiers |= kVolatile;
+        if (consume('K'))
+          mod.qualifiers |= kConst;
+        // cv-qualifiers of the type this type refers to merge with its own.
+        if (count == first && count > 0 && mods[count - 1].code == 'K') {
+          mods[count - 1].qualifiers |= mod.qualifiers;
+          continue;
+        }
+      } else if ((c == 'R' || c == 'O') && count == first && count > 0 &&
+                 (mods[count - 1].code == 'R' || mods[count - 1].code == 'O')) {
+        // A reference to the reference this type refers to collapses into
+        // a single one, which is an rvalue reference only if both are.
+        if (c == 'R')
+          mods[count - 1].code = 'R';
+        pos_++;
+        continue;
+      } else if (c == 'P' || c == 'R' || c == 'O' || c == 'C' || c == 'G') {
+        mod.code = c;
+        pos_++;
+      } else if (c == 'M') {
+        // The class type is printed later, with the modifiers.
+        mod.code = c;
+        pos_++;
+        mod.operand.begin = pos_;
+        mod.operand.kind = SPAN_TYPE;
+        mute_++;
+        bool ok = parseType();
+        mute_--;
+        if (!ok)
+          return false;
+        mod.operand.end = pos_;
+      } else if (c == 'U' && peekAt(1) != 't' && peekAt(1) != 'l') {
+        // <extended-qualifier> ::= U <source-name>
+        mod.code = c;
+        pos_++;
+        size_t length = 0;
+        while (isDigit(peek()))
+          length = length * 10 + (*pos_++ - '0');
+        if (length == 0 || static_cast<size_t>(end_ - pos_) < length)
+          return false;
+        mod.operand.begin = pos_;
+        mod.operand.end = pos_ + length;
+        pos_ += length;
+      } else {
+        break;
+      }
+      count++;
+    }
+
+    // The modified type may come from a substitution or a template
+    // parameter, in which case its own modifiers are combined with these.
+    bool ok;
+    char c = peek();
+    Span span;
+    bool modified = false;
+    const char* start = pos_;
+    if ((c == 'S' && !isLower(peekAt(1))) ||
+        (c == 'T' && !inLambdaSignature_)) {
+      bool found = c == 'S' ? parseSubstitutionSpan(&span)
+                            : parseTemplateParamSpan(&span);
+      modified = found && peek() != 'I' && resolveModifiedType(&span);
+      if (!modified)
+        pos_ = start;
+    }
+    if (modified) {
+      DepthGuard guard(&depth_);
+      if (guard.exceeded())
+        return false;
+      const char* savedPos = pos_;
+      const char* savedEnd = end_;
+      pos_ = span.begin;
+      end_ = span.end;
+      replaying_++;
+      ok = parseModifiedType(mods, count) && pos_ == end_;
+      replaying_--;
+      pos_ = savedPos;
+      end_ = savedEnd;
+      // Template parameters are substitution candidates.
+      if (ok && c == 'T')
+        ok = addSubstitution(SPAN_TYPE, start);
+    } else if (c == 'F') {
+      // The cv-qualifiers of a function type are part of it, so a
+      // cv-qualified function type is a single substitution candidate.
+      bool qualified = count > first && mods[count - 1].code == 'K';
+      ok = parseFunctionType(mods, count) &&
+           (qualified || addSubstitution(SPAN_TYPE, start));
+    } else if (c == 'A') {
+      ok = parseArrayType(mods, count);
+    } else {
+      ok = parseType();
+      for (int i = count - 1; ok && i >= 0; --i)
+        putModifier(mods[i], false);
+    }
+    for (int i = count - 1; ok && i >= first; --i)
+      ok = addSubstitution(SPAN_TYPE, mods[i].begin);
+    return ok;
+  }
+
+  // Parses a function type, printing |mods| in parentheses, as in
+  // "void (*)(int)". cv-qualifiers that apply to the function itself are
+  // printed after its parameters.
+  //
+  // <function-type> ::= F [Y] <bare-function-type> [<ref-qualifier>] E
+  bool Demangler::parseFunctionType(const Modifier* mods, int count) {
+    if (!consume('F'))
+      return false;
+    consume('Y');
+    unsigned qualifiers = 0;
+    if (count > 0 && mods[count - 1].code == 'K')
+      qualifiers = mods[--count].qualifiers;
+
+    if (!parseType())
+      return false;
+    if (count > 0) {
+      put(" (");
+      for (int i = count - 1; i >= 0; --i)
+        putModifier(mods[i], true);
+      if (typeDepth_ == declaratorDepth_) {
+        declaratorEnd_ = length_;
+        declaratorDepth_ = -1;
+      }
+      put(')');
+    } else {
+      put(' ');
+    }
+
+    put('(');
+    if (peek() == 'v' &&
+        (peekAt(1) == 'E' || ((peekAt(1) == 'R' || peekAt(1) == 'O') &&
+                              peekAt(2) == 'E'))) {
+      pos_++;
+    } else {
+      bool first = true;
+      for (;;) {
+        char c = peek();
+        if (c == 'E' || ((c == 'R' || c == 'O') && peekAt(1) == 'E'))
+          break;
+        if (c == '\0')
+          return false;
+        if (!first)
+          put(", ");
+        first = false;
+        if (!parseType())
+          return false;
+      }
+    }
+    put(')');
+    putQualifiers(qualifiers);
+    if (consume('R'))
+      put(" &");
+    else if (consume('O'))
+      put(" &&");
+    return consume('E');
+  }
+
+  // Parses an array type, including the dimensions of nested arrays,
+  // printing |mods| in parentheses, as in "int (*) [10]".
+  //
+  // <array-type> ::= A <positive dimension number> _ <element type>
+  //              ::= A [<dimension expression>] _ <element type>
+  bool Demangler::parseArrayType(const Modifier* mods, int count) {
+    // Start of each nested array type, and its dimension. Numbers are
+    // copied as is, while expressions are demangled again.
+    const char* arrays[kMaxModifiers];
+    Span dims[kMaxModifiers];
+    int numDims = 0;
+    while (peek() == 'A') {
+      if (numDims == kMaxModifiers)
+        return false;
+      arrays[numDims] = pos_++;
+      Span& dim = dims[numDims++];
+      dim.begin = pos_;
+      dim.kind = SPAN_PREFIX;
+      if (isDigit(peek())) {
+        while (isDigit(peek()))
+          pos_++;
+      } else if (peek() != '_') {
+        mute_++;
+        bool ok = parseExpression();
+        mute_--;
+        if (!ok)
+          return false;
+        dim.kind = SPAN_EXPRESSION;
+      }
+      dim.end = pos_;
+      if (!consume('_'))
+        return false;
+    }
+    // cv-qualifiers of an array apply to its elements.
+    unsigned qualifiers = 0;
+    while (count > 0 && mods[count - 1].code == 'K')
+      qualifiers |= mods[--count].qualifiers;
+    if (!parseType())
+      return false;
+    putQualifiers(qualifiers);
+
+    if (count > 0) {
+      put(" (");
+      for (int i = count - 1; i >= 0; --i)
+        putModifier(mods[i], true);
+      put(')');
+    }
+    put(' ');
+    for (int i = 0; i < numDims; ++i) {
+      put('[');
+      if (dims[i].kind == SPAN_EXPRESSION) {
+        if (!replay(dims[i]))
+          return false;
+      } else {
+        putRange(dims[i].begin, dims[i].end);
+      }
+      put(']');
+    }
+
+    // The innermost arrays are substitution candidates first.
+    for (int i = numDims - 1; i >= 0; --i) {
+      if (!addSubstitution(SPAN_TYPE, arrays[i]))
+        return false;
+    }
+    return true;
+  }
+
+  // <vector-type> ::= Dv <number> _ <type>
+  bool Demangler::parseVectorType() {
+    pos_ += 2;
+    long size;
+    bool negative;
+    if (!parseNumber(&size, &negative) || !consume('_') || !parseType())
+      return false;
+    put(" __vector(");
+    putNumber(size);
+    put(')');
+    return true;
+  }
+
+  // <decltype> ::= Dt <expression> E
+  //            ::= DT <expression> E
+  bool Demangler::parseDecltype() {
+    pos_ += 2;
+    put("decltype (");
+    if (!parseExpression() || !consume('E'))
+      return false;
+    put(')');
+    return true;
+  }
+
+  // <expr-primary> ::= L <type> <value number> E
+  //                ::= L <type> <value float> E
+  //                ::= L <mangled-name> E
+  bool Demangler::parseExprPrimary() {
+    if (!consume('L'))
+      return false;
+    if (consume('_', 'Z') || consume('Z')) {
+      NameStateSaver saver(&name_);
+      return parseEncoding() && consume('E');
+    }
+
+    if (consume('D', 'n')) {
+      put(consume('0') ? "(decltype(nullptr))0" : "decltype(nullptr)");
+      return consume('E');
+    }
+    char type = peek();
+    if (type == 'b' && (peekAt(1) == '0' || peekAt(1) == '1') &&
+        peekAt(2) == 'E') {
+      put(peekAt(1) == '1' ? "true" : "false");
+      pos_ += 3;
+      return true;
+    }
+
+    const char* suffix = NULL;
+    switch (type) {
+    case 'i': suffix = ""; break;
+    case 'j': suffix = "u"; break;
+    case 'l': suffix = "l"; break;
+    case 'm': suffix = "ul"; break;
+    case 'x': suffix = "ll"; break;
+    case 'y': suffix = "ull"; break;
+    }
+    bool isFloat = type == 'f' || type == 'd' || type == 'e';
+    if (suffix != NULL) {
+      pos_++;
+    } else {
+      put('(');
+      NameStateSaver saver(&name_);
+      if (!parseType())
+        return false;
+      put(')');
+    }
+    if (consume('n'))
+      put('-');
+    if (isFloat)
+      put('[');
+    const char* value = pos_;
+    while (peek() != 'E') {
+      if (peek() == '\0')
+        return false;
+      pos_++;
+    }
+    putRange(value, pos_);
+    if (isFloat)
+      put(']');
+    if (suffix != NULL)
+      put(suffix);
+    pos_++;
+    return true;
+  }
+
+  // Parses "ad L_Z <encoding> E" as "&name", when the encoding is a
+  // variable, or a member function, whose parameters c++filt doesn't print
+  // as for a pointer to member. Returns false, consuming nothing, for other
+  // functions, which are printed as "&(encoding)" as other operands.
+  bool Demangler::parseAddressOfName(bool* ok) {
+    const char* start = pos_;
+    pos_ += 3;
+    consume('_');
+    if (!consume('Z') || peek() == 'T' || peek() == 'G') {
+      pos_ = start;
+      return false;
+    }
+    NameStateSaver saver(&name_);
+    const char* name = pos_;
+    bool nested = peek() == 'N';
+    mute_++;
+    replaying_++;
+    bool found = parseName();
+    replaying_--;
+    mute_--;
+    bool variable = found && peek() == 'E';
+    found = found && (variable || (nested && !name_.endsWithTemplateArgs &&
+                                   name_.qualifiers == 0 &&
+                                   name_.refQualifier == 0));
+    pos_ = name;
+    if (!found) {
+      pos_ = start;
+      return false;
+    }
+    put('&');
+    *ok = parseName();
+    if (*ok && !variable) {
+      mute_++;
+      *ok = parseBareFunctionType();
+      mute_--;
+    }
+    *ok = *ok && consume('E');
+    return true;
+  }
+
+  // Parses the subset of <expression> that appears in the signatures of
+  // function templates. |*primary| is set when the expression doesn't need
+  // parentheses as an operand.
+  bool Demangler::parseExpression(bool* primary) {
+    DepthGuard guard(&depth_);
+    if (guard.exceeded())
+      return false;
+    NameStateSaver saver(&name_);
+    *primary = true;
+
+    char c0 = peek();
+    char c1 = peekAt(1);
+    if (c0 == 'T')
+      return parseTemplateParam();
+    if (c0 == 'L') {
+      // External names are printed as calls, which need parentheses.
+      *primary = c1 != 'Z' && c1 != '_';
+      return parseExprPrimary();
+    }
+    if (isDigit(c0))
+      return parseSourceName();
+    if (c0 == 'f' && c1 == 'p') {
+      // <function-param> ::= fp <CV-qualifiers> [<number>] _
+      pos_ += 2;
+      while (peek() == 'r' || peek() == 'V' || peek() == 'K')
+        pos_++;
+      long number = -1;
+      bool negative;
+      if (peek() != '_' && !parseNumber(&number, &negative))
+        return false;
+      if (!consume('_'))
+        return false;
+      put("{parm#");
+      putNumber(number + 2);
+      put('}');
+      return true;
+    }
+
+    *primary = false;
+    if (c0 == 's' && c1 == 'r') {
+      // sr <type> <unqualified-name> [<template-args>]
+      pos_ += 2;
+      if (!parseType())
+        return false;
+      put("::");
+      if (!parseUnqualifiedName())
+        return false;
+      *primary = true;
+      return peek() != 'I' || parseTemplateArgs();
+    }
+    if ((c0 == 's' || c0 == 'a') && (c1 == 't' || c1 == 'z')) {
+      pos_ += 2;
+      put(c0 == 's' ? "sizeof (" : "alignof (");
+      bool ok = c1 == 't' ? parseType() : parseExpression();
+      put(')');
+      return ok;
+    }
+    if (c0 == 's' && c1 == 'Z') {
+      // The size of a known argument pack is printed as a number.
+      pos_ += 2;
+      const char* param = pos_;
+      const int savedIndex = packIndex_;
+      const int savedSize = packSize_;
+      Span span;
+      packIndex_ = kCountPack;
+      packSize_ = -1;
+      bool ok = !inLambdaSignature_ && parseTemplateParamSpan(&span);
+      int size = packSize_;
+      packIndex_ = savedIndex;
+      packSize_ = savedSize;
+      if (ok && size >= 0) {
+        *primary = true;
+        putNumber(size);
+        return true;
+      }
+      pos_ = param;
+      put("sizeof...(");
+      ok = parseTemplateParam();
+      put(')');
+      return ok;
+    }
+    if (c0 == 's' && c1 == 'p')
+      return parsePackExpansion(SPAN_EXPRESSION);
+    if (c0 == 'c' && c1 == 'v') {
+      // cv <type> <expression>
+      pos_ += 2;
+      put('(');
+      if (!parseType())
+        return false;
+      put(")(");
+      if (!parseExpression())
+        return false;
+      put(')');
+      return true;
+    }
+    if (c0 == 'c' && c1 == 'l') {
+      // cl <expression>+ E
+      pos_ += 2;
+      size_t paren = length_;
+      put('(');
+      bool calleePrimary;
+      if (!parseExpression(&calleePrimary))
+        return false;
+      if (calleePrimary)
+        erase(paren);
+      else
+        put(')');
+      put('(');
+      bool first = true;
+      while (peek() != 'E') {
+        if (peek() == '\0')
+          return false;
+        if (!first)
+          put(", ");
+        first = false;
+        if (!parseExpression())
+          return false;
+      }
+      pos_++;
+      put(')');
+      return true;
+    }
+    if ((c0 == 'd' || c0 == 'p') && c1 == 't') {
+      // dt <expression> <unresolved-name>, pt <expression> <unresolved-name>
+      pos_ += 2;
+      if (!parseExpression())
+        return false;
+      put(c0 == 'd' ? "." : "->");
+      return parseUnqualifiedName();
+    }
+
+    if (c0 == 'a' && c1 == 'd' && peekAt(2) == 'L') {
+      bool ok;
+      if (parseAddressOfName(&ok))
+        return ok;
+    }
+
+    const OperatorName* op = findOperatorName(c0, c1);
+    if (op == NULL || op->arity == 0)
+      return false;
+    pos_ += 2;
+    // Operands are printed in parentheses, unless they are primary
+    // expressions.
+    for (int i = 0; i < op->arity; ++i) {
+      if (i == 1 || op->arity == 1)
+        put(op->name);
+      size_t paren = length_;
+      put('(');
+      bool operandPrimary;
+      if (!parseExpression(&operandPrimary))
+        return false;
+      if (operandPrimary)
+        erase(paren);
+      else
+        put(')');
+    }
+    return true;
+  }
+
+} // namespace
+
+namespace __gabixx {
+
+  int __demangle(const char* mangled_name, char* buffer, size_t size) {
+    if (mangled_name == NULL)
+      return -1;
+    Demangler demangler(mangled_name, buffer, size);
+    if (!demangler.demangle()) {
+      if (size > 0)
+        buffer[0] = '\0';
+      return -1;
+    }
+    size_t length = demangler.length();
+    if (size > 0)
+      buffer[length < size ? length : size - 1] = '\0';
+    return static_cast<int>(length);
+  }
+
+} // namespace __gabixx
+
+namespace __cxxabiv1 {
+
+  extern "C" char* __cxa_demangle(const char* mangled_name,
+                                  char* output_buffer,
+                                  size_t* length,
+                                  int* status) {
+    if (mangled_name == NULL || (output_buffer != NULL && length == NULL)) {
+      if (status != NULL)
+        *status = -3;
+      return NULL;
+    }
+
+    char stackBuffer[kStackBufferSize];
+    char* buffer = output_buffer;
+    size_t size = output_buffer != NULL ? *length : 0;
+    if (buffer == NULL) {
+      buffer = stackBuffer;
+      size = sizeof(stackBuffer);
+    }
+
+    int result = __gabixx::__demangle(mangled_name, buffer, size);
+    if (result < 0) {
+      if (status != NULL)
+        *status = -2;
+      return NULL;
+    }
+
+    size_t needed = static_cast<size_t>(result) + 1;
+    if (buffer == output_buffer && needed <= size) {
+      if (status != NULL)
+        *status = 0;
+      return output_buffer;
+    }
+
+    char* output = static_cast<char*>(realloc(output_buffer, needed));
+    if (output == NULL) {
+      if (status != NULL)
+        *status = -1;
+      return NULL;
+    }
+    if (needed <= size)
+      memcpy(output, stackBuffer, needed);
+    else
+      __gabixx::__demangle(mangled_name, output, needed);
+    if (length != NULL)
+      *length = needed;
+    if (status != NULL)
+      *status = 0;
+    return output;
+  }
+
+} // namespace __cxxabiv1
@@ -262,6 +262,135 @@ namespace
       }
      context->dst_object = saved_dst_object;
   }
+
+  // Cache of __dynamic_cast() results.
+  //
+  // The result of a cast only depends on the layout of the most derived
+  // object, the source and destination types, the static hint, and the
+  // position of the source subobject in the most derived object, so it is
+  // cached as an offset from the most derived object. The layout is
+  // identified by the vtable of the most derived object rather than by its
+  // type_info: objects under construction use construction vtables, that
+  // share the type_info of the class being constructed but may place
+  // virtual bases differently.
+  //
+  // The cache is a small direct-mapped table shared by all threads. Each
+  // entry is guarded by a sequence number, odd while the entry is being
+  // written, so readers never block and simply miss on a torn entry, and
+  // writers skip caching if another thread is writing the same entry.
+  //
+  // A library loaded after a dlclose() may reuse the addresses of the
+  // vtables and type_infos of the unloaded one, and would then hit the
+  // entries of the unloaded library. The runtime is not told about
+  // unloads, and asking the dynamic linker on every cast would cost more
+  // than the cache saves, so the cache is disabled by default. Programs
+  // that enable it and unload libraries must call
+  // __gabixx::__flush_dynamic_cast_cache() after dlclose(): entries only
+  // match in the epoch they were stored in.
+
+  const int cast_cache_size = 256;
+
+  // Marks a cached failed cast. Valid results are never at a negative
+  // offset from the most derived object.
+  const std::ptrdiff_t failed_cast_offset = -1;
+
+  struct cast_cache_entry
+  {
+    volatile unsigned sequence;
+    unsigned epoch;
+    const void* vtable;
+    const abi::__class_type_info* src_type;
+    const abi::__class_type_info* dst_type;
+    std::ptrdiff_t src2dst_offset;
+    std::ptrdiff_t src_offset;
+    std::ptrdiff_t result_offset;
+  };
+
+  cast_cache_entry cast_cache[cast_cache_size];
+  bool cast_cache_enabled = false;
+  volatile unsigned cast_cache_epoch;
+
+#if GABIXX_EH_COUNTERS
+  // Hit and miss counters, only maintained in builds with the exception
+  // handling counters, as atomic updates on the hot path have a cost.
+  unsigned long cast_cache_hits;
+  unsigned long cast_cache_misses;
+#  if defined(__ATOMIC_RELAXED)
+#    define GABIXX_CAST_COUNT(counter) \
+       __atomic_fetch_add(&counter, 1, __ATOMIC_RELAXED)
+#  else
+#    define GABIXX_CAST_COUNT(counter) __sync_fetch_and_add(&counter, 1)
+#  endif
+#else
+#  define GABIXX_CAST_COUNT(counter) ((void)0)
+#endif
+
+  cast_cache_entry*
+  get_cast_cache_entry(const void* vtable,
+                       const abi::__class_type_info* src,
+                       const abi::__class_type_info* dst,
+                       std::ptrdiff_t src_offset)
+  {
+    // Multiplicative hashing, keeping the upper bits of a 32-bit product.
+    unsigned hash = static_cast<unsigned>(reinterpret_cast<std::size_t>(vtable));
+    hash = (hash ^ static_cast<unsigned>(reinterpret_cast<std::size_t>(src)))
+           * 0x9e3779b1U;
+    hash = (hash ^ static_cast<unsigned>(reinterpret_cast<std::size_t>(dst)))
+           * 0x9e3779b1U;
+    hash = (hash ^ static_cast<unsigned>(src_offset)) * 0x9e3779b1U;
+    return &cast_cache[(hash >> 24) % cast_cache_size];
+  }
+
+  bool
+  lookup_cast_cache(const void* vtable,
+                    const abi::__class_type_info* src,
+                    const abi::__class_type_info* dst,
+                    std::ptrdiff_t src2dst_offset,
+                    std::ptrdiff_t src_offset,
+                    std::ptrdiff_t* result_offset)
+  {
+    cast_cache_entry* entry =
+      get_cast_cache_entry(vtable, src, dst, src_offset);
+    unsigned sequence = entry->sequence;
+    if (sequence & 1)
+      return false;
+    __sync_synchronize();
+    bool hit = entry->vtable == vtable
+               && entry->src_type == src
+               && entry->dst_type == dst
+               && entry->src2dst_offset == src2dst_offset
+               && entry->src_offset == src_offset
+               && entry->epoch == cast_cache_epoch;
+    *result_offset = entry->result_offset;
+    __sync_synchronize();
+    return hit && entry->sequence == sequence;
+  }
+
+  void
+  store_cast_cache(const void* vtable,
+                   const abi::__class_type_info* src,
+                   const abi::__class_type_info* dst,
+                   std::ptrdiff_t src2dst_offset,
+                   std::ptrdiff_t src_offset,
+                   std::ptrdiff_t result_offset)
+  {
+    cast_cache_entry* entry =
+      get_cast_cache_entry(vtable, src, dst, src_offset);
+    unsigned sequence = entry->sequence;
+    if ((sequence & 1)
+        || !__sync_bool_compare_and_swap(&entry->sequence, sequence,
+                                         sequence + 1))
+      return;
+    entry->epoch = cast_cache_epoch;
+    entry->vtable = vtable;
+    entry->src_type = src;
+    entry->dst_type = dst;
+    entry->src2dst_offset = src2dst_offset;
+    entry->src_offset = src_offset;
+    entry->result_offset = result_offset;
+    __sync_synchronize();
+    entry->sequence = sequence + 2;
+  }
 } // namespace
 
 namespace __cxxabiv1
@@ -270,32 +399,16 @@ namespace __cxxabiv1
 #define DYNAMIC_CAST_NOT_PUBLIC_BASE -2
 #define DYNAMIC_CAST_MULTIPLE_PUBLIC_NONVIRTUAL_BASE -3
 
-  /* v: source address to be adjusted; nonnull, and since the
-   *    source object is polymorphic, *(void**)v is a virtual pointer.
-   * src: static type of the source object.
-   * dst: destination type (the "T" in "dynamic_cast<T>(v)").
-   * src2dst_offset: a static hint about the location of the
-   *    source subobject with respect to the complete object;
-   *    special negative values are:
-   *       -1: no hint
-   *       -2: src is not a public base of dst
-   *       -3: src is a multiple public base type but never a
-   *           virtual base type
-   *    otherwise, the src type is a unique public nonvirtual
-   *    base type of dst at offset src2dst_offset from the
-   *    origin of dst.
-   */
-  extern "C" void*
-  __dynamic_cast (const void *v,
-                  const abi::__class_type_info *src,
-                  const abi::__class_type_info *dst,
-                  std::ptrdiff_t src2dst_offset)
+  // Performs the cast, walking the type tree of the most derived object.
+  static void*
+  dynamic_cast_uncached(const void *v,
+                        const abi::__class_type_info *src,
+                        const abi::__class_type_info *dst,
+                        std::ptrdiff_t src2dst_offset,
+                        const void* most_derived_object,
+                        const abi::__class_type_info*
+                            most_derived_class_type_info)
   {
-    const void* most_derived_object = get_most_derived_object(v);
-    const void* vtable = get_vtable(most_derived_object);
-    const abi::__class_type_info* most_derived_class_type_info =
-      get_class_type_info(vtable);
-
     // If T is not a public base type of the most derived class referred
     // by v, the cast always fails.
     void* t_object =
@@ -353,4 +466,91 @@ namespace __cxxabiv1
       walk_object(most_derived_object, most_derived_class_type_info, v, src);
     return v_object == v ? t_object : NULL;
   }
+
+  /* v: source address to be adjusted; nonnull, and since the
+   *    source object is polymorphic, *(void**)v is a virtual pointer.
+   * src: static type of the source object.
+   * dst: destination type (the "T" in "dynamic_cast<T>(v)").
+   * src2dst_offset: a static hint about the location of the
+   *    source subobject with respect to the complete object;
+   *    special negative values are:
+   *       -1: no hint
+   *       -2: src is not a public base of dst
+   *       -3: src is a multiple public base type but never a
+   *           virtual base type
+   *    otherwise, the src type is a unique public nonvirtual
+   *    base type of dst at offset src2dst_offset from the
+   *    origin of dst.
+   */
+  extern "C" void*
+  __dynamic_cast (const void *v,
+                  const abi::__class_type_info *src,
+                  const abi::__class_type_info *dst,
+                  std::ptrdiff_t src2dst_offset)
+  {
+    const void* most_derived_object = get_most_derived_object(v);
+    const void* vtable = get_vtable(most_derived_object);
+    const abi::__class_type_info* most_derived_class_type_info =
+      get_class_type_info(vtable);
+
+    if (!cast_cache_enabled)
+      return dynamic_cast_uncached(v, src, dst, src2dst_offset,
+                                   most_derived_object,
+                                   most_derived_class_type_info);
+
+    std::ptrdiff_t src_offset =
+      static_cast<const char*>(v) -
+      static_cast<const char*>(most_derived_object);
+    std::ptrdiff_t result_offset;
+    if (lookup_cast_cache(vtable, src, dst, src2dst_offset, src_offset,
+                          &result_offset))
+      {
+        GABIXX_CAST_COUNT(cast_cache_hits);
+        if (result_offset == failed_cast_offset)
+          return NULL;
+        return const_cast<void*>(adjust_pointer(most_derived_object,
+                                                result_offset));
+      }
+
+    GABIXX_CAST_COUNT(cast_cache_misses);
+    void* result = dynamic_cast_uncached(v, src, dst, src2dst_offset,
+                                         most_derived_object,
+                                         most_derived_class_type_info);
+    result_offset = failed_cast_offset;
+    if (result != NULL)
+      result_offset = static_cast<const char*>(result) -
+                      static_cast<const char*>(most_derived_object);
+    store_cast_cache(vtable, src, dst, src2dst_offset, src_offset,
+                     result_offset);
+    return result;
+  }
 } // namespace __cxxabiv1
+
+namespace __gabixx
+{
+  void
+  __set_dynamic_cast_cache_enabled(bool enabled)
+  {
+    cast_cache_enabled = enabled;
+  }
+
+  void
+  __flush_dynamic_cast_cache()
+  {
+    __sync_fetch_and_add(&cast_cache_epoch, 1);
+  }
+
+  bool
+  __get_dynamic_cast_cache_stats(unsigned long* hits, unsigned long* misses)
+  {
+#if GABIXX_EH_COUNTERS
+    *hits = cast_cache_hits;
+    *misses = cast_cache_misses;
+    return true;
+#else
+    *hits = 0;
+    *misses = 0;
+    return false;
+#endif
+  }
+} // namespace __gabixx
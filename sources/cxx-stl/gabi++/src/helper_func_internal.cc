@@ -54,6 +54,119 @@ namespace __cxxabiv1 {
     std::terminate();
   }
 
+  // Call-site lookup cache.
+  //
+  // Decoding the call-site table of an LSDA is a linear walk over
+  // variable-length records, and it happens in both unwind phases for
+  // every frame. The cache maps (LSDA, IP) to the position of the record
+  // of the call site containing IP in the call-site table. It is a small
+  // direct-mapped table shared by all threads. Each entry is guarded by a
+  // sequence number, odd while the entry is being written, so readers
+  // never block and simply miss on a torn entry, and writers skip caching
+  // if another thread is writing the same entry.
+  //
+  // After a dlclose(), another library can be loaded at the same addresses,
+  // and hit entries stored for the unloaded one. So the record is decoded
+  // again from the current table, and a hit is only used if this record
+  // contains IP. Nothing else tells the runtime that a library has been
+  // unloaded without taking the dynamic linker's lock.
+  enum {
+    kCallSiteCacheSize = 256,
+  };
+
+  struct CallSiteCacheEntry {
+    volatile uint32_t sequence;
+    uint32_t callSiteOffset;
+    const uint8_t* lsda;
+    uintptr_t ip;
+  };
+
+  static CallSiteCacheEntry callSiteCache[kCallSiteCacheSize];
+
+  static CallSiteCacheEntry* getCallSiteCacheEntry(const uint8_t* lsda,
+                                                   uintptr_t ip) {
+    uintptr_t hash = ip ^ (ip >> 9) ^ (reinterpret_cast<uintptr_t>(lsda) >> 3);
+    return &callSiteCache[hash % kCallSiteCacheSize];
+  }
+
+  static bool lookupCallSiteCache(const uint8_t* lsda,
+                                  uintptr_t ip,
+                                  uint32_t* callSiteOffset) {
+    CallSiteCacheEntry* entry = getCallSiteCacheEntry(lsda, ip);
+    uint32_t sequence = entry->sequence;
+    if (sequence & 1) {
+      return false;
+    }
+    __sync_synchronize();
+    bool hit = entry->lsda == lsda && entry->ip == ip;
+    *callSiteOffset = entry->callSiteOffset;
+    __sync_synchronize();
+    return hit && entry->sequence == sequence;
+  }
+
+  static void storeCallSiteCache(const uint8_t* lsda,
+                                 uintptr_t ip,
+                                 uint32_t callSiteOffset) {
+    CallSiteCacheEntry* entry = getCallSiteCacheEntry(lsda, ip);
+    uint32_t sequence = entry->sequence;
+    if ((sequence & 1) ||
+        !__sync_bool_compare_and_swap(&entry->sequence, sequence,
+                                      sequence + 1)) {
+      return;
+    }
+    entry->lsda = lsda;
+    entry->ip = ip;
+    entry->callSiteOffset = callSiteOffset;
+    __sync_synchronize();
+    entry->sequence = sequence + 2;
+  }
+
+  // Decodes the call-site record at *callSitePtr, and advances it past the
+  // record. Returns true if the call site contains ipOffset.
+  static bool readCallSite(const uint8_t** callSitePtr,
+                           uint8_t callSiteEncoding,
+                           uintptr_t ipOffset,
+                           uintptr_t* landingPad,
+                           uintptr_t* actionEntry,
+                           bool* pastIp) {
+    uintptr_t start = readEncodedPointer(callSitePtr, callSiteEncoding);
+    uintptr_t length = readEncodedPointer(callSitePtr, callSiteEncoding);
+    *landingPad = readEncodedPointer(callSitePtr, callSiteEncoding);
+    *actionEntry = readULEB128(callSitePtr);
+    *pastIp = ipOffset < start;
+    return (start <= ipOffset) && (ipOffset < (start + length));
+  }
+
+  // Walks the call-site table looking for the record containing ipOffset,
+  // and stores its address in *callSite. landingPad is relative to the
+  // landing pad base. Returns false if there is no call site for ipOffset.
+  static bool findCallSite(const uint8_t* callSitePtr,
+                           const uint8_t* callSiteTableEnd,
+                           uint8_t callSiteEncoding,
+                           uintptr_t ipOffset,
+                           const uint8_t** callSite,
+                           uintptr_t* landingPad,
+                           uintptr_t* actionEntry) {
+#if GABIXX_EH_COUNTERS
+    const uint8_t* callSiteTableStart = callSitePtr;
+#endif
+    bool found = false;
+    while (callSitePtr < callSiteTableEnd) {
+      bool pastIp;
+      *callSite = callSitePtr;
+      if (readCallSite(&callSitePtr, callSiteEncoding, ipOffset,
+                       landingPad, actionEntry, &pastIp)) {
+        found = true;
+        break;
+      } else if (pastIp) {
+        // Call sites are sorted by start address.
+        break;
+      }
+    }
+    GABIXX_EH_COUNT(lsda_bytes_decoded, callSitePtr - callSiteTableStart);
+    return found;
+  }
+
   // Boring stuff which has lots of encode/decode details
   void scanEHTable(ScanResultInternal& results,
                    _Unwind_Action actions,
@@ -112,171 +225,194 @@ namespace __cxxabiv1 {
     const uint8_t* callSiteTableStart = lsda;
     const uint8_t* callSiteTableEnd = callSiteTableStart + callSiteTableLength;
     const uint8_t* actionTableStart = callSiteTableEnd;
-    const uint8_t* callSitePtr = callSiteTableStart;
+    GABIXX_EH_COUNT(lsda_bytes_decoded,
+                    callSiteTableStart - results.languageSpecificData);
+
+    // Find the call site containing ip. Both phases, and every throw
+    // through this frame, look up the same call site, so its position is
+    // cached.
+    uintptr_t landingPad;
+    uintptr_t actionEntry;
+    uint32_t callSiteOffset;
+    bool found = false;
+    if (lookupCallSiteCache(results.languageSpecificData, ip,
+                            &callSiteOffset) &&
+        callSiteOffset < callSiteTableLength) {
+      const uint8_t* callSitePtr = callSiteTableStart + callSiteOffset;
+      bool pastIp;
+      found = readCallSite(&callSitePtr, callSiteEncoding, ipOffset,
+                           &landingPad, &actionEntry, &pastIp);
+      GABIXX_EH_COUNT(lsda_bytes_decoded,
+                      callSitePtr - (callSiteTableStart + callSiteOffset));
+      if (found) {
+        GABIXX_EH_COUNT(call_site_cache_hits, 1);
+      }
+    }
+    if (!found) {
+      const uint8_t* callSite;
+      if (!findCallSite(callSiteTableStart, callSiteTableEnd,
+                        callSiteEncoding, ipOffset,
+                        &callSite, &landingPad, &actionEntry)) {
+        // There is no call site for this ip
+        call_terminate(unwind_exception);
+      }
+      storeCallSiteCache(results.languageSpecificData, ip,
+                         static_cast<uint32_t>(callSite - callSiteTableStart));
+    }
+    if (landingPad != 0) {
+      landingPad = (uintptr_t)lpStart + landingPad;
+    }
 
+    if (landingPad == 0) {
+      // No handler here
+      results.reason = _URC_CONTINUE_UNWIND;
+      return;
+    }
 
-    while (callSitePtr < callSiteTableEnd) {
-      uintptr_t start = readEncodedPointer(&callSitePtr, callSiteEncoding);
-      uintptr_t length = readEncodedPointer(&callSitePtr, callSiteEncoding);
-      uintptr_t landingPad = readEncodedPointer(&callSitePtr, callSiteEncoding);
-      uintptr_t actionEntry = readULEB128(&callSitePtr);
-      if ((start <= ipOffset) && (ipOffset < (start + length))) {
-        if (landingPad == 0) {
-          // No handler here
-          results.reason = _URC_CONTINUE_UNWIND;
-          return;
-        }
+    if (actionEntry == 0) {
+      if ((actions & _UA_CLEANUP_PHASE) && !(actions & _UA_HANDLER_FRAME))
+      {
+        results.ttypeIndex = 0;
+        results.landingPad = landingPad;
+        results.reason = _URC_HANDLER_FOUND;
+        return;
+      }
+      // No handler here
+      results.reason = _URC_CONTINUE_UNWIND;
+      return;
+    }
 
-        landingPad = (uintptr_t)lpStart + landingPad;
-        if (actionEntry == 0) {
-          if ((actions & _UA_CLEANUP_PHASE) && !(actions & _UA_HANDLER_FRAME))
+    const uint8_t* action = actionTableStart + (actionEntry - 1);
+    while (true) {
+      const uint8_t* actionRecord = action;
+      int64_t ttypeIndex = readSLEB128(&action);
+      GABIXX_EH_COUNT(lsda_bytes_decoded, action - actionRecord);
+      if (ttypeIndex > 0) {
+        // Found a catch, does it actually catch?
+        // First check for catch (...)
+        const __shim_type_info* catchType =
+          getTypePtr(static_cast<uint64_t>(ttypeIndex),
+                     classInfo, ttypeEncoding, unwind_exception);
+        if (catchType == 0) {
+          // Found catch (...) catches everything, including foreign exceptions
+          if ((actions & _UA_SEARCH_PHASE) || (actions & _UA_HANDLER_FRAME))
           {
-            results.ttypeIndex = 0;
+            // Save state and return _URC_HANDLER_FOUND
+            results.ttypeIndex = ttypeIndex;
+            results.actionRecord = actionRecord;
             results.landingPad = landingPad;
+            results.adjustedPtr = unwind_exception+1;
             results.reason = _URC_HANDLER_FOUND;
             return;
           }
-          // No handler here
-          results.reason = _URC_CONTINUE_UNWIND;
-          return;
-        }
+          else if (!(actions & _UA_FORCE_UNWIND))
+          {
+            // It looks like the exception table has changed
+            //    on us.  Likely stack corruption!
+            call_terminate(unwind_exception);
+          }
+        } else if (native_exception) {
+          __cxa_exception* exception_header = (__cxa_exception*)(unwind_exception+1) - 1;
+          void* adjustedPtr = unwind_exception+1;
+          const __shim_type_info* excpType =
+              static_cast<const __shim_type_info*>(exception_header->exceptionType);
+          if (adjustedPtr == 0 || excpType == 0) {
+            // Such a disaster! What's wrong?
+            call_terminate(unwind_exception);
+          }
 
-        const uint8_t* action = actionTableStart + (actionEntry - 1);
-        while (true) {
-          const uint8_t* actionRecord = action;
-          int64_t ttypeIndex = readSLEB128(&action);
-          if (ttypeIndex > 0) {
-            // Found a catch, does it actually catch?
-            // First check for catch (...)
-            const __shim_type_info* catchType =
-              getTypePtr(static_cast<uint64_t>(ttypeIndex),
-                         classInfo, ttypeEncoding, unwind_exception);
-            if (catchType == 0) {
-              // Found catch (...) catches everything, including foreign exceptions
-              if ((actions & _UA_SEARCH_PHASE) || (actions & _UA_HANDLER_FRAME))
-              {
-                // Save state and return _URC_HANDLER_FOUND
-                results.ttypeIndex = ttypeIndex;
-                results.actionRecord = actionRecord;
-                results.landingPad = landingPad;
-                results.adjustedPtr = unwind_exception+1;
-                results.reason = _URC_HANDLER_FOUND;
-                return;
-              }
-              else if (!(actions & _UA_FORCE_UNWIND))
-              {
-                // It looks like the exception table has changed
-                //    on us.  Likely stack corruption!
-                call_terminate(unwind_exception);
-              }
-            } else if (native_exception) {
-              __cxa_exception* exception_header = (__cxa_exception*)(unwind_exception+1) - 1;
-              void* adjustedPtr = unwind_exception+1;
-              const __shim_type_info* excpType =
-                  static_cast<const __shim_type_info*>(exception_header->exceptionType);
-              if (adjustedPtr == 0 || excpType == 0) {
-                // Such a disaster! What's wrong?
-                call_terminate(unwind_exception);
-              }
-
-              // Only derefence once, so put ouside the recursive search below
-              if (dynamic_cast<const __pointer_type_info*>(excpType)) {
-                adjustedPtr = *static_cast<void**>(adjustedPtr);
-              }
-
-              // Let's play!
-              if (catchType->can_catch(excpType, adjustedPtr)) {
-                if (actions & _UA_SEARCH_PHASE) {
-                  // Cache it.
-                  results.ttypeIndex = ttypeIndex;
-                  results.actionRecord = actionRecord;
-                  results.landingPad = landingPad;
-                  results.adjustedPtr = adjustedPtr;
-                  results.reason = _URC_HANDLER_FOUND;
-                  return;
-                } else if (!(actions & _UA_FORCE_UNWIND)) {
-                  // It looks like the exception table has changed
-                  //    on us.  Likely stack corruption!
-                  call_terminate(unwind_exception);
-                }
-              } // catchType->can_catch
-            } // if (catchType == 0)
-          } else if (ttypeIndex < 0) {
-            // Found an exception spec.
-            if (native_exception) {
-              __cxa_exception* header = reinterpret_cast<__cxa_exception*>(unwind_exception+1)-1;
-              void* adjustedPtr = unwind_exception+1;
-              const std::type_info* excpType = header->exceptionType;
-              if (adjustedPtr == 0 || excpType == 0) {
-                // Such a disaster! What's wrong?
-                call_terminate(unwind_exception);
-              }
-
-              // Let's play!
-              if (canExceptionSpecCatch(ttypeIndex, classInfo,
-                                        ttypeEncoding, excpType,
-                                        adjustedPtr, unwind_exception)) {
-                if (actions & _UA_SEARCH_PHASE) {
-                  // Cache it.
-                  results.ttypeIndex = ttypeIndex;
-                  results.actionRecord = actionRecord;
-                  results.landingPad = landingPad;
-                  results.adjustedPtr = adjustedPtr;
-                  results.reason = _URC_HANDLER_FOUND;
-                  return;
-                } else if (!(actions & _UA_FORCE_UNWIND)) {
-                  // It looks like the exception table has changed
-                  //    on us.  Likely stack corruption!
-                  call_terminate(unwind_exception);
-                }
-              }
-            } else {  // ! native_exception
-              // foreign exception must be caught by exception spec
-              if ((actions & _UA_SEARCH_PHASE) || (actions & _UA_HANDLER_FRAME)) {
-                results.ttypeIndex = ttypeIndex;
-                results.actionRecord = actionRecord;
-                results.landingPad = landingPad;
-                results.adjustedPtr = unwind_exception+1;
-                results.reason = _URC_HANDLER_FOUND;
-                return;
-              }
-              else if (!(actions & _UA_FORCE_UNWIND)) {
-                // It looks like the exception table has changed
-                //    on us.  Likely stack corruption!
-                call_terminate(unwind_exception);
-              }
-            }
-          } else {  // ttypeIndex == 0
-            // Found a cleanup, or nothing
-            if ((actions & _UA_CLEANUP_PHASE) && !(actions & _UA_HANDLER_FRAME)) {
+          // Only derefence once, so put ouside the recursive search below
+          if (dynamic_cast<const __pointer_type_info*>(excpType)) {
+            adjustedPtr = *static_cast<void**>(adjustedPtr);
+          }
+
+          // Let's play!
+          if (catchType->can_catch(excpType, adjustedPtr)) {
+            if (actions & _UA_SEARCH_PHASE) {
+              // Cache it.
               results.ttypeIndex = ttypeIndex;
               results.actionRecord = actionRecord;
               results.landingPad = landingPad;
-              results.adjustedPtr = unwind_exception+1;
+              results.adjustedPtr = adjustedPtr;
               results.reason = _URC_HANDLER_FOUND;
               return;
+            } else if (!(actions & _UA_FORCE_UNWIND)) {
+              // It looks like the exception table has changed
+              //    on us.  Likely stack corruption!
+              call_terminate(unwind_exception);
             }
+          } // catchType->can_catch
+        } // if (catchType == 0)
+      } else if (ttypeIndex < 0) {
+        // Found an exception spec.
+        if (native_exception) {
+          __cxa_exception* header = reinterpret_cast<__cxa_exception*>(unwind_exception+1)-1;
+          void* adjustedPtr = unwind_exception+1;
+          const std::type_info* excpType = header->exceptionType;
+          if (adjustedPtr == 0 || excpType == 0) {
+            // Such a disaster! What's wrong?
+            call_terminate(unwind_exception);
           }
 
-
-          const uint8_t* temp = action;
-          int64_t actionOffset = readSLEB128(&temp);
-          if (actionOffset == 0) {
-            // End of action list, no matching handler or cleanup found
-            results.reason = _URC_CONTINUE_UNWIND;
+          // Let's play!
+          if (canExceptionSpecCatch(ttypeIndex, classInfo,
+                                    ttypeEncoding, excpType,
+                                    adjustedPtr, unwind_exception)) {
+            if (actions & _UA_SEARCH_PHASE) {
+              // Cache it.
+              results.ttypeIndex = ttypeIndex;
+              results.actionRecord = actionRecord;
+              results.landingPad = landingPad;
+              results.adjustedPtr = adjustedPtr;
+              results.reason = _URC_HANDLER_FOUND;
+              return;
+            } else if (!(actions & _UA_FORCE_UNWIND)) {
+              // It looks like the exception table has changed
+              //    on us.  Likely stack corruption!
+              call_terminate(unwind_exception);
+            }
+          }
+        } else {  // ! native_exception
+          // foreign exception must be caught by exception spec
+          if ((actions & _UA_SEARCH_PHASE) || (actions & _UA_HANDLER_FRAME)) {
+            results.ttypeIndex = ttypeIndex;
+            results.actionRecord = actionRecord;
+            results.landingPad = landingPad;
+            results.adjustedPtr = unwind_exception+1;
+            results.reason = _URC_HANDLER_FOUND;
             return;
           }
-
-          // Go to next action
-          action += actionOffset;
+          else if (!(actions & _UA_FORCE_UNWIND)) {
+            // It looks like the exception table has changed
+            //    on us.  Likely stack corruption!
+            call_terminate(unwind_exception);
+          }
         }
-      } else if (ipOffset < start) {
-        // There is no call site for this ip
-        call_terminate(unwind_exception);
+      } else {  // ttypeIndex == 0
+        // Found a cleanup, or nothing
+        if ((actions & _UA_CLEANUP_PHASE) && !(actions & _UA_HANDLER_FRAME)) {
+          results.ttypeIndex = ttypeIndex;
+          results.actionRecord = actionRecord;
+          results.landingPad = landingPad;
+          results.adjustedPtr = unwind_exception+1;
+          results.reason = _URC_HANDLER_FOUND;
+          return;
+        }
+      }
+
+
+      const uint8_t* temp = action;
+      int64_t actionOffset = readSLEB128(&temp);
+      GABIXX_EH_COUNT(lsda_bytes_decoded, temp - action);
+      if (actionOffset == 0) {
+        // End of action list, no matching handler or cleanup found
+        results.reason = _URC_CONTINUE_UNWIND;
+        return;
       }
-    } // while (callSitePtr < callSiteTableEnd)
 
-    call_terminate(unwind_exception);
+      // Go to next action
+      action += actionOffset;
+    }
   }
 
   /*
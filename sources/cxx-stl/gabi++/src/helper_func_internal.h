@@ -38,6 +38,15 @@ namespace __cxxabiv1 {
 
   void call_terminate(_Unwind_Exception* unwind_exception) _GABIXX_HIDDEN;
 
+  // Exception handling counters, see __gabixx::__get_eh_counters().
+#if GABIXX_EH_COUNTERS
+  extern __gabixx::__eh_counters ehCounters _GABIXX_HIDDEN;
+#  define GABIXX_EH_COUNT(counter, value) \
+    __sync_fetch_and_add(&__cxxabiv1::ehCounters.counter, (value))
+#else
+#  define GABIXX_EH_COUNT(counter, value) ((void)0)
+#endif
+
 #if __arm__
   uint32_t decodeRelocTarget2 (uint32_t ptr) _GABIXX_HIDDEN;
 #endif
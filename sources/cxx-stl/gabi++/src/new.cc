@@ -27,12 +27,50 @@
 //
 
 #include <gabixx_config.h>
+#include <cxxabi.h>
+#include <malloc.h>
 #include <stdlib.h>
 #include <new>
 
 using std::new_handler;
 namespace {
   new_handler cur_handler;
+
+  // Allocates a block with malloc(), or with the size-class allocator if
+  // GAbi++ is built with GABIXX_SIZE_CLASS_ALLOCATOR=1. Blocks must be
+  // freed with deallocate_block() in delete.cc.
+  inline void* allocate_block(std::size_t size) {
+#if GABIXX_SIZE_CLASS_ALLOCATOR
+    return __gabixx::__size_class_allocate(size);
+#else
+    return malloc(size);
+#endif
+  }
+
+#if !defined(GABIXX_LIBCXX)
+  // Allocates a block aligned to |align| bytes, calling the new handler
+  // until it succeeds. Alignments the regular allocation path already
+  // provides go through it, so such blocks can be freed as regular ones.
+  void* allocate_aligned(std::size_t size, std::align_val_t align) {
+    std::size_t alignment = static_cast<std::size_t>(align);
+    if (alignment <= 2 * sizeof(void*))
+      return ::operator new(size);
+
+    void* space;
+    do {
+      space = memalign(alignment, size);
+      if (space) {
+        return space;
+      }
+      new_handler handler = cur_handler;
+      if (handler == NULL) {
+        throw std::bad_alloc();
+      }
+      handler();
+    } while (space == 0);
+    __builtin_unreachable();
+  }
+#endif  // !defined(GABIXX_LIBCXX)
 }
 
 namespace std {
@@ -63,7 +101,7 @@ _GABIXX_WEAK
 void* operator new(std::size_t size) throw(std::bad_alloc) {
   void* space;
   do {
-    space = malloc(size);
+    space = allocate_block(size);
     if (space) {
       return space;
     }
@@ -80,7 +118,7 @@ _GABIXX_WEAK
 void* operator new(std::size_t size, const std::nothrow_t& no)
     _GABIXX_NOEXCEPT {
   try {
-    ::operator new(size);
+    return ::operator new(size);
   } catch (const std::bad_alloc&) {
     return 0;
   }
@@ -96,3 +134,35 @@ void* operator new[](std::size_t size, const std::nothrow_t& no)
     _GABIXX_NOEXCEPT {
   return ::operator new(size, no);
 }
+
+#if !defined(GABIXX_LIBCXX)
+
+_GABIXX_WEAK
+void* operator new(std::size_t size, std::align_val_t align)
+    throw(std::bad_alloc) {
+  return allocate_aligned(size, align);
+}
+
+_GABIXX_WEAK
+void* operator new(std::size_t size, std::align_val_t align,
+                   const std::nothrow_t& no) _GABIXX_NOEXCEPT {
+  try {
+    return ::operator new(size, align);
+  } catch (const std::bad_alloc&) {
+    return 0;
+  }
+}
+
+_GABIXX_WEAK
+void* operator new[](std::size_t size, std::align_val_t align)
+    throw(std::bad_alloc) {
+  return ::operator new(size, align);
+}
+
+_GABIXX_WEAK
+void* operator new[](std::size_t size, std::align_val_t align,
+                     const std::nothrow_t& no) _GABIXX_NOEXCEPT {
+  return ::operator new(size, align, no);
+}
+
+#endif  // !defined(GABIXX_LIBCXX)
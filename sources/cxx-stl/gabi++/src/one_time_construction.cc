@@ -42,74 +42,107 @@
  * code simpler and slightly more efficient
  */
 
+#include <limits.h>
 #include <stddef.h>
-#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 
-/* In this implementation, we use a single global mutex+condvar pair.
+#include <gabixx_config.h>
+
+#ifndef FUTEX_PRIVATE_FLAG
+#define FUTEX_PRIVATE_FLAG  128
+#endif
+
+/* The guard variable doubles as a futex word:
  *
- * Pros: portable and doesn't require playing with futexes, atomics
- *       and memory barriers.
+ *   bit 0   (0x1)   - initialization complete.
+ *   bit 8   (0x100) - initialization in progress.
+ *   bit 9   (0x200) - at least one thread waits for completion.
  *
- * Cons: Slower than necessary.
+ * The already-initialized case is a single acquire load, so a function-local
+ * static doesn't serialize its callers once it has been constructed. Threads
+ * that find the guard pending sleep on the guard word itself, and release or
+ * abort only wakes the threads waiting for that particular guard, and only if
+ * there are any.
  */
-static pthread_mutex_t  sMutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER;
-static pthread_cond_t   sCond  = PTHREAD_COND_INITIALIZER;
+#define GUARD_COMPLETE  0x1
+#define GUARD_PENDING   0x100
+#define GUARD_WAITING   0x200
+
+static _GABIXX_ALWAYS_INLINE int guard_load_acquire(int volatile * gv)
+{
+#if defined(__ATOMIC_ACQUIRE)
+    return __atomic_load_n(gv, __ATOMIC_ACQUIRE);
+#else
+    // Older compilers only provide full barriers.
+    int guard = *gv;
+    __sync_synchronize();
+    return guard;
+#endif
+}
 
+static void guard_wait(int volatile * gv, int value)
+{
+    // Returns immediately if the guard no longer holds the expected value,
+    // spurious wake-ups are handled by the caller's loop.
+    syscall(__NR_futex, gv, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, value, NULL);
+}
+
+static void guard_wake_all(int volatile * gv)
+{
+    syscall(__NR_futex, gv, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX);
+}
 
 extern "C" int __cxa_guard_acquire(int volatile * gv)
 {
-    pthread_mutex_lock(&sMutex);
+    // Fast path: the object has already been constructed.
+    int guard = guard_load_acquire(gv);
+    if ((guard & GUARD_COMPLETE) != 0)
+        return 0;
+
     for (;;) {
-        // while gv points to a volatile value, we use the
-        // previous pthread_mutex_lock or pthread_cond_wait
-        // as a trivial memory barrier
-        int guard = *gv;
-        if ((guard & 1) != 0) {
+        if ((guard & GUARD_COMPLETE) != 0) {
             /* already initialized - return 0 */
-            pthread_mutex_unlock(&sMutex);
             return 0;
         }
 
-        // we use bit 8 to indicate that the guard value is being
-        // initialized, and bit 9 to indicate that there is another
-        // thread waiting for its completion.
-        if ((guard & 0x100) == 0) {
+        if ((guard & GUARD_PENDING) == 0) {
             // nobody is initializing this yet, so mark the guard value
-            // first. and allow initialization to proceed.
-            *gv = 0x100;
-            pthread_mutex_unlock(&sMutex);
-            return 1;
+            // first, and allow initialization to proceed.
+            if (__sync_bool_compare_and_swap(gv, guard, GUARD_PENDING))
+                return 1;
+            guard = guard_load_acquire(gv);
+            continue;
         }
 
-        // already being initialized by amother thread,
-        // we must indicate that there is a waiter, then
-        // wait to be woken up before trying again.
-        *gv = guard | 0x200;
-        pthread_cond_wait(&sCond, &sMutex);
+        // already being initialized by another thread, we must indicate
+        // that there is a waiter, then wait to be woken up before trying
+        // again.
+        if ((guard & GUARD_WAITING) == 0) {
+            if (!__sync_bool_compare_and_swap(gv, guard,
+                                              guard | GUARD_WAITING)) {
+                guard = guard_load_acquire(gv);
+                continue;
+            }
+            guard |= GUARD_WAITING;
+        }
+        guard_wait(gv, guard);
+        guard = guard_load_acquire(gv);
     }
 }
 
 extern "C" void __cxa_guard_release(int volatile * gv)
 {
-    pthread_mutex_lock(&sMutex);
-
-    int guard = *gv;
     // this indicates initialization for our two ABIs.
-    *gv = 0x1;
-    if ((guard & 0x200) != 0)
-        pthread_cond_broadcast(&sCond);
-
-    pthread_mutex_unlock(&sMutex);
+    int guard = __gabixx_sync_swap(gv, GUARD_COMPLETE);
+    if ((guard & GUARD_WAITING) != 0)
+        guard_wake_all(gv);
 }
 
 extern "C" void __cxa_guard_abort(int volatile * gv)
 {
-    pthread_mutex_lock(&sMutex);
-
-    int guard = *gv;
-    *gv = 0;
-    if ((guard & 0x200) != 0)
-        pthread_cond_broadcast(&sCond);
-
-    pthread_mutex_unlock(&sMutex);
+    int guard = __gabixx_sync_swap(gv, 0);
+    if ((guard & GUARD_WAITING) != 0)
+        guard_wake_all(gv);
 }
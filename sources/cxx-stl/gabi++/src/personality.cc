@@ -61,6 +61,12 @@ namespace __cxxabiv1 {
     bool native_exception = exceptionClass == __gxx_exception_class;
     ScanResultInternal results;
 
+    if (actions & _UA_SEARCH_PHASE) {
+      GABIXX_EH_COUNT(frames_searched, 1);
+    } else {
+      GABIXX_EH_COUNT(frames_unwound, 1);
+    }
+
     /*
      * Phase 1: Search
      */
@@ -0,0 +1,408 @@
+// Copyright (C) 2013 The Android Open Source Project
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS ``AS IS'' AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+//
+// size_class_allocator.cc: Thread-caching size-class allocator.
+//
+// Small objects are served from per-thread caches of free objects, one per
+// size class. Caches are refilled in batches from central free lists, that
+// carve objects out of 64 KB spans. The size class of an object is found
+// from its span through a radix map, so objects don't need a header, and
+// sized deallocation doesn't even need the lookup. Larger blocks come from
+// malloc().
+
+#include <gabixx_config.h>
+#include <cxxabi.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace {
+
+  // All objects are aligned like malloc() blocks.
+  const size_t kAlignment = 2 * sizeof(void*);
+
+  // Object sizes of the size classes, in units of kAlignment.
+  const int kNumSizeClasses = 16;
+  const size_t kSizeClassUnits[kNumSizeClasses] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 14, 16, 20, 24, 28, 32
+  };
+  const size_t kMaxSmallSize = 32 * kAlignment;
+
+  // Size class for a number of kAlignment units.
+  const unsigned char kUnitsToSizeClass[32 + 1] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+    12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15
+  };
+
+  // Spans are aligned to their size.
+  const int kSpanShift = 16;
+  const size_t kSpanSize = static_cast<size_t>(1) << kSpanShift;
+
+  // Number of objects moved between a thread cache and a central list at
+  // once, and maximum number of objects a thread cache holds per class.
+  const int kBatchSize = 32;
+  const int kMaxCachedObjects = 2 * kBatchSize;
+
+  struct FreeObject {
+    FreeObject* next;
+  };
+
+  inline int getSizeClass(size_t size) {
+    return kUnitsToSizeClass[(size + kAlignment - 1) / kAlignment];
+  }
+
+  inline size_t getClassSize(int sizeClass) {
+    return kSizeClassUnits[sizeClass] * kAlignment;
+  }
+
+  // Radix map from span numbers to size class + 1, or 0 for memory that
+  // doesn't belong to a span. The root and the leaves are allocated when
+  // the first span in their range is created, and never freed, so lookups
+  // need no lock.
+  const int kAddressBits = sizeof(void*) == 8 ? 48 : 32;
+  const int kLeafBits = 16;
+  const int kRootBits = kAddressBits - kSpanShift - kLeafBits;
+
+  unsigned char* volatile* volatile spanMap;
+  pthread_mutex_t spanMapLock = PTHREAD_MUTEX_INITIALIZER;
+
+  // Span number of an address. The top byte of 64-bit pointers may hold a
+  // tag (ARMv8 top-byte ignore, used for memory tagging), which is not part
+  // of the address.
+  inline uintptr_t getSpan(const void* ptr) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    if (sizeof(address) == 8)
+      address &= ~(static_cast<uintptr_t>(0xff) << (sizeof(address) * 8 - 8));
+    return address >> kSpanShift;
+  }
+
+  inline int getSpanSizeClass(const void* ptr) {
+    uintptr_t span = getSpan(ptr);
+    uintptr_t root = span >> kLeafBits;
+    if (root >= (static_cast<uintptr_t>(1) << kRootBits))
+      return -1;
+    unsigned char* volatile* map = spanMap;
+    if (map == NULL)
+      return -1;
+    unsigned char* leaf = map[root];
+    if (leaf == NULL)
+      return -1;
+    return leaf[span & ((1 << kLeafBits) - 1)] - 1;
+  }
+
+  bool registerSpan(const void* ptr, int sizeClass) {
+    uintptr_t span = getSpan(ptr);
+    uintptr_t root = span >> kLeafBits;
+    if (root >= (static_cast<uintptr_t>(1) << kRootBits))
+      return false;
+    pthread_mutex_lock(&spanMapLock);
+    if (spanMap == NULL) {
+      unsigned char* volatile* map = static_cast<unsigned char* volatile*>(
+          calloc(static_cast<size_t>(1) << kRootBits, sizeof(*map)));
+      if (map == NULL) {
+        pthread_mutex_unlock(&spanMapLock);
+        return false;
+      }
+      // Make the zeroed root visible before publishing it.
+      __sync_synchronize();
+      spanMap = map;
+    }
+    unsigned char* leaf = spanMap[root];
+    if (leaf == NULL) {
+      leaf = static_cast<unsigned char*>(calloc(1, 1 << kLeafBits));
+      if (leaf != NULL) {
+        // Make the zeroed leaf visible before publishing it.
+        __sync_synchronize();
+        spanMap[root] = leaf;
+      }
+    }
+    if (leaf != NULL)
+      leaf[span & ((1 << kLeafBits) - 1)] =
+          static_cast<unsigned char>(sizeClass + 1);
+    pthread_mutex_unlock(&spanMapLock);
+    return leaf != NULL;
+  }
+
+  // Central free list of a size class.
+  struct CentralList {
+    pthread_mutex_t lock;
+    FreeObject* freeObjects;
+    size_t freeCount;
+    // Unused part of the most recent span.
+    char* spanCursor;
+    char* spanEnd;
+    size_t spanCount;
+  };
+
+#define CENTRAL_LIST_INIT  { PTHREAD_MUTEX_INITIALIZER, NULL, 0, NULL, NULL, 0 }
+
+  CentralList centralLists[kNumSizeClasses] = {
+    CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT,
+    CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT,
+    CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT,
+    CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT, CENTRAL_LIST_INIT,
+  };
+
+  // Moves up to |count| free objects of a size class from its central list
+  // to |*list|. Returns the number of objects moved, zero if no memory is
+  // left.
+  int takeFromCentral(int sizeClass, FreeObject** list, int count) {
+    CentralList* central = &centralLists[sizeClass];
+    size_t size = getClassSize(sizeClass);
+    int taken = 0;
+    pthread_mutex_lock(&central->lock);
+    while (taken < count) {
+      FreeObject* obj = central->freeObjects;
+      if (obj != NULL) {
+        central->freeObjects = obj->next;
+        central->freeCount--;
+      } else {
+        if (central->spanCursor + size > central->spanEnd) {
+          void* span = memalign(kSpanSize, kSpanSize);
+          if (span == NULL)
+            break;
+          if (!registerSpan(span, sizeClass)) {
+            free(span);
+            break;
+          }
+          central->spanCursor = static_cast<char*>(span);
+          central->spanEnd = central->spanCursor + kSpanSize;
+          central->spanCount++;
+        }
+        obj = reinterpret_cast<FreeObject*>(central->spanCursor);
+        central->spanCursor += size;
+      }
+      obj->next = *list;
+      *list = obj;
+      taken++;
+    }
+    pthread_mutex_unlock(&central->lock);
+    return taken;
+  }
+
+  // Moves up to |count| objects from |*list| to the central list of a size
+  // class.
+  void returnToCentral(int sizeClass, FreeObject** list, int count) {
+    CentralList* central = &centralLists[sizeClass];
+    pthread_mutex_lock(&central->lock);
+    while (count-- > 0 && *list != NULL) {
+      FreeObject* obj = *list;
+      *list = obj->next;
+      obj->next = central->freeObjects;
+      central->freeObjects = obj;
+      central->freeCount++;
+    }
+    pthread_mutex_unlock(&central->lock);
+  }
+
+  // Per-thread cache of free objects.
+  struct ThreadCache {
+    FreeObject* freeObjects[kNumSizeClasses];
+    int freeCount[kNumSizeClasses];
+    unsigned long allocations[kNumSizeClasses];
+    ThreadCache* prev;
+    ThreadCache* next;
+  };
+
+  // All thread caches, for statistics. Allocation counters of exited
+  // threads are accumulated in retiredAllocations.
+  ThreadCache* threadCaches;
+  unsigned long retiredAllocations[kNumSizeClasses];
+  pthread_mutex_t threadCachesLock = PTHREAD_MUTEX_INITIALIZER;
+
+  pthread_key_t threadCacheKey;
+  pthread_once_t threadCacheKeyOnce = PTHREAD_ONCE_INIT;
+
+#if _GABIXX_HAS_NATIVE_TLS
+  // Copy of the pthread_getspecific() value, which is cheaper to read.
+  __thread ThreadCache* currentThreadCache;
+  // Set once the cache of the thread has been destroyed. Objects the thread
+  // frees after that go straight to the central lists, as a new cache
+  // would never be drained.
+  __thread bool threadCacheDestroyed;
+#endif
+
+  // Called when a thread is destroyed.
+  void destroyThreadCache(void* obj) {
+    ThreadCache* cache = static_cast<ThreadCache*>(obj);
+#if _GABIXX_HAS_NATIVE_TLS
+    currentThreadCache = NULL;
+    threadCacheDestroyed = true;
+#endif
+    for (int i = 0; i < kNumSizeClasses; ++i)
+      returnToCentral(i, &cache->freeObjects[i], cache->freeCount[i]);
+
+    pthread_mutex_lock(&threadCachesLock);
+    for (int i = 0; i < kNumSizeClasses; ++i)
+      retiredAllocations[i] += cache->allocations[i];
+    if (cache->prev != NULL)
+      cache->prev->next = cache->next;
+    else
+      threadCaches = cache->next;
+    if (cache->next != NULL)
+      cache->next->prev = cache->prev;
+    pthread_mutex_unlock(&threadCachesLock);
+
+    free(cache);
+  }
+
+  void createThreadCacheKey() {
+    pthread_key_create(&threadCacheKey, destroyThreadCache);
+  }
+
+  // Gets the cache of the current thread, creating it if needed. Returns
+  // NULL if the cache can't be allocated, or has been destroyed.
+  ThreadCache* getThreadCache() {
+#if _GABIXX_HAS_NATIVE_TLS
+    if (__builtin_expect(currentThreadCache != NULL, 1))
+      return currentThreadCache;
+    if (threadCacheDestroyed)
+      return NULL;
+#endif
+    pthread_once(&threadCacheKeyOnce, createThreadCacheKey);
+    ThreadCache* cache =
+        static_cast<ThreadCache*>(pthread_getspecific(threadCacheKey));
+    if (cache != NULL)
+      return cache;
+
+    cache = static_cast<ThreadCache*>(calloc(1, sizeof(ThreadCache)));
+    if (cache == NULL)
+      return NULL;
+    pthread_mutex_lock(&threadCachesLock);
+    cache->next = threadCaches;
+    if (threadCaches != NULL)
+      threadCaches->prev = cache;
+    threadCaches = cache;
+    pthread_mutex_unlock(&threadCachesLock);
+    pthread_setspecific(threadCacheKey, cache);
+#if _GABIXX_HAS_NATIVE_TLS
+    currentThreadCache = cache;
+#endif
+    return cache;
+  }
+
+  void deallocateInClass(void* ptr, int sizeClass) {
+    FreeObject* obj = static_cast<FreeObject*>(ptr);
+    ThreadCache* cache = getThreadCache();
+    if (cache == NULL) {
+      obj->next = NULL;
+      returnToCentral(sizeClass, &obj, 1);
+      return;
+    }
+    obj->next = cache->freeObjects[sizeClass];
+    cache->freeObjects[sizeClass] = obj;
+    if (++cache->freeCount[sizeClass] > kMaxCachedObjects) {
+      returnToCentral(sizeClass, &cache->freeObjects[sizeClass], kBatchSize);
+      cache->freeCount[sizeClass] -= kBatchSize;
+    }
+  }
+
+} // namespace
+
+namespace __gabixx {
+
+  _GABIXX_WEAK
+  void* __size_class_allocate(size_t size) {
+    if (size > kMaxSmallSize)
+      return malloc(size);
+
+    int sizeClass = getSizeClass(size);
+    ThreadCache* cache = getThreadCache();
+    if (cache == NULL) {
+      FreeObject* obj = NULL;
+      takeFromCentral(sizeClass, &obj, 1);
+      return obj;
+    }
+
+    FreeObject* obj = cache->freeObjects[sizeClass];
+    if (obj == NULL) {
+      cache->freeCount[sizeClass] +=
+          takeFromCentral(sizeClass, &cache->freeObjects[sizeClass],
+                          kBatchSize);
+      obj = cache->freeObjects[sizeClass];
+      if (obj == NULL)
+        return NULL;
+    }
+    cache->freeObjects[sizeClass] = obj->next;
+    cache->freeCount[sizeClass]--;
+    cache->allocations[sizeClass]++;
+    return obj;
+  }
+
+  _GABIXX_WEAK
+  void __size_class_deallocate(void* ptr) {
+    if (ptr == NULL)
+      return;
+    int sizeClass = getSpanSizeClass(ptr);
+    if (sizeClass < 0)
+      free(ptr);
+    else
+      deallocateInClass(ptr, sizeClass);
+  }
+
+  _GABIXX_WEAK
+  void __size_class_deallocate_sized(void* ptr, size_t size) {
+    if (ptr == NULL)
+      return;
+    if (size > kMaxSmallSize)
+      free(ptr);
+    else
+      deallocateInClass(ptr, getSizeClass(size));
+  }
+
+  int __get_size_class_stats(__size_class_stats* stats, int max_count) {
+    if (max_count > kNumSizeClasses)
+      max_count = kNumSizeClasses;
+    for (int i = 0; i < max_count; ++i) {
+      size_t size = getClassSize(i);
+      stats[i].size = size;
+      stats[i].allocations = 0;
+      stats[i].cached_bytes = 0;
+
+      CentralList* central = &centralLists[i];
+      pthread_mutex_lock(&central->lock);
+      stats[i].central_bytes = central->freeCount * size;
+      stats[i].span_bytes = central->spanCount * kSpanSize;
+      pthread_mutex_unlock(&central->lock);
+    }
+
+    pthread_mutex_lock(&threadCachesLock);
+    for (int i = 0; i < max_count; ++i)
+      stats[i].allocations = retiredAllocations[i];
+    for (ThreadCache* cache = threadCaches; cache != NULL;
+         cache = cache->next) {
+      for (int i = 0; i < max_count; ++i) {
+        stats[i].allocations += cache->allocations[i];
+        stats[i].cached_bytes += cache->freeCount[i] * stats[i].size;
+      }
+    }
+    pthread_mutex_unlock(&threadCachesLock);
+    return kNumSizeClasses;
+  }
+
+} // namespace __gabixx
@@ -37,6 +37,112 @@
 
 #include <typeinfo>
 
+#if defined(__ARM_EABI__) && !defined(GABIXX_LIBCXX)
+namespace
+{
+  // Cache of the hashes of mangled type names.
+  //
+  // Most comparisons of type_infos with different names can be decided by
+  // comparing the hashes of their names, so the hash of each name is
+  // computed once and kept in a small direct-mapped table, indexed by the
+  // address of the name. Each slot is written only once: a thread claims
+  // it with a compare-and-swap, then stores the hash and the name.
+  //
+  // A library loaded after a dlclose() may place another name at the
+  // address of a cached one, and the runtime is not told about unloads.
+  // So a slot also records the length of its name and eight of its bytes,
+  // spread from the first to the last one, and is only used for a name
+  // that still matches them. This is much cheaper than hashing the name
+  // again, but a name of the same length that only differs elsewhere
+  // would still get the stale hash.
+  //
+  // Lookups need no memory barrier: the fields of a slot only go from
+  // zero to their final value, and a reader that sees a zero hash or
+  // length computes the hash itself. Names whose slot is taken by another
+  // name have their hash computed on each use.
+
+  const int name_hash_cache_size = 512;
+
+  // Marks a slot whose hash is being written.
+  const char* const claimed_slot = "";
+
+  struct name_hash_cache_entry
+  {
+    const char* volatile name;
+    volatile unsigned hash;
+    volatile unsigned length;
+    volatile unsigned long long sample;
+  };
+
+  name_hash_cache_entry name_hash_cache[name_hash_cache_size];
+
+  // FNV-1a hash of a mangled name, never zero.
+  unsigned
+  compute_name_hash(const char* name)
+  {
+    unsigned hash = 2166136261U;
+    for (const unsigned char* p = reinterpret_cast<const unsigned char*>(name);
+         *p != '\0'; ++p)
+      hash = (hash ^ *p) * 16777619U;
+    return hash != 0 ? hash : 1;
+  }
+
+  // Packs eight bytes of a name of |length| bytes, the first and the last
+  // ones included.
+  unsigned long long
+  compute_name_sample(const char* name, unsigned length)
+  {
+    unsigned long long sample = 0;
+    for (unsigned i = 0; i < 8; ++i)
+      sample = (sample << 8)
+               | static_cast<unsigned char>(name[i * (length - 1) / 7]);
+    return sample;
+  }
+
+  inline unsigned
+  get_name_hash_slot(const char* name)
+  {
+    // Multiplicative hashing, keeping the upper bits of a 32-bit product.
+    unsigned slot = static_cast<unsigned>(reinterpret_cast<std::size_t>(name))
+                    * 0x9e3779b1U;
+    return (slot >> 23) % name_hash_cache_size;
+  }
+
+  unsigned
+  get_name_hash_slow(const char* name, name_hash_cache_entry* entry)
+  {
+    unsigned hash = compute_name_hash(name);
+    if (entry->name == NULL
+        && __sync_bool_compare_and_swap(&entry->name,
+                                        static_cast<const char*>(NULL),
+                                        claimed_slot)) {
+      unsigned length = strlen(name);
+      if (length != 0) {
+        entry->sample = compute_name_sample(name, length);
+        entry->length = length;
+      }
+      entry->hash = hash;
+      entry->name = name;
+    }
+    return hash;
+  }
+
+  inline unsigned
+  get_name_hash(const char* name)
+  {
+    name_hash_cache_entry* entry = &name_hash_cache[get_name_hash_slot(name)];
+    if (entry->name == name) {
+      unsigned hash = entry->hash;
+      unsigned length = entry->length;
+      if (hash != 0 && length != 0 && strlen(name) == length
+          && entry->sample == compute_name_sample(name, length))
+        return hash;
+    }
+    return get_name_hash_slow(name, entry);
+  }
+} // namespace
+#endif
+
 namespace std
 {
   type_info::~type_info()
@@ -49,7 +155,12 @@ namespace std
   {
 #ifdef __ARM_EABI__
     // IHI0041A CPPABI 3.2.5.6.  Because of weak linkage and share libraries,
-    // we perform string comparison.
+    // we perform string comparison, unless the names are the same string,
+    // or their hashes show that they differ.
+    if (this == &rhs || this->__type_name == rhs.__type_name)
+      return true;
+    if (get_name_hash(this->__type_name) != get_name_hash(rhs.__type_name))
+      return false;
     return strcmp(this->__type_name, rhs.__type_name) == 0;
 #else
     return this == &rhs;
@@ -74,5 +185,15 @@ namespace std
 #endif
   }
 
+  std::size_t
+  type_info::hash_code() const
+  {
+#ifdef __ARM_EABI__
+    return get_name_hash(this->__type_name);
+#else
+    return reinterpret_cast<std::size_t>(this);
+#endif
+  }
+
 #endif // !defined(GABIXX_LIBCXX)
 } // end namespace std
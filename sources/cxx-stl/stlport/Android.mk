@@ -45,14 +45,22 @@ libstlport_src_files := \
         src/complex_io.cpp \
         src/complex_trig.cpp \
         src/string.cpp \
+        src/string_search.cpp \
         src/bitset.cpp \
         src/allocators.cpp \
         src/c_locale.c \
         src/cxa.c \
+        src/cpu_features.c \
+
+# The NEON kernels of string_search.cpp, used when the CPU has NEON.
+ifeq ($(TARGET_ARCH_ABI),armeabi-v7a)
+libstlport_src_files += src/string_search_neon.cpp.neon
+endif
 
 libstlport_cflags := -D_GNU_SOURCE
 libstlport_cppflags := -fuse-cxa-atexit
 libstlport_c_includes := $(libstlport_path)/stlport
+libstlport_private_c_includes := $(libstlport_path)/../../android/cpufeatures
 
 #It is much more practical to include the sources of GAbi++ in our builds
 # of STLport. This is similar to what the GNU libstdc++ does (it includes
@@ -95,7 +103,7 @@ LOCAL_SRC_FILES := $(libstlport_src_files)
 LOCAL_SRC_FILES += $(libgabi++_src_files:%=../gabi++/%)
 LOCAL_CFLAGS := $(libstlport_cflags)
 LOCAL_CPPFLAGS := $(libstlport_cppflags)
-LOCAL_C_INCLUDES := $(libstlport_c_includes)
+LOCAL_C_INCLUDES := $(libstlport_c_includes) $(libstlport_private_c_includes)
 LOCAL_EXPORT_C_INCLUDES := $(libstlport_c_includes)
 LOCAL_CPP_FEATURES := rtti exceptions
 include $(BUILD_STATIC_LIBRARY)
@@ -107,9 +115,26 @@ LOCAL_SRC_FILES := $(libstlport_src_files)
 LOCAL_SRC_FILES += $(libgabi++_src_files:%=../gabi++/%)
 LOCAL_CFLAGS := $(libstlport_cflags)
 LOCAL_CPPFLAGS := $(libstlport_cppflags)
-LOCAL_C_INCLUDES := $(libstlport_c_includes)
+LOCAL_C_INCLUDES := $(libstlport_c_includes) $(libstlport_private_c_includes)
 LOCAL_EXPORT_C_INCLUDES := $(libstlport_c_includes)
 LOCAL_CPP_FEATURES := rtti exceptions
 include $(BUILD_SHARED_LIBRARY)
 
 endif # STLPORT_FORCE_REBUILD == true
+
+# STLport built in the light debug mode (see _STLP_DEBUG_LIGHT in
+# stlport/stl/config/user_config.h), reporting the errors it detects with a
+# runtime_error. Code built in a debug mode cannot be linked with the release
+# libraries, so this one is always rebuilt from sources, for the unit tests.
+include $(CLEAR_VARS)
+LOCAL_MODULE := stlport_static_debug_light
+LOCAL_CPP_EXTENSION := .cpp .cc
+LOCAL_SRC_FILES := $(libstlport_src_files)
+LOCAL_SRC_FILES += $(libgabi++_src_files:%=../gabi++/%)
+LOCAL_CFLAGS := $(libstlport_cflags)
+LOCAL_CPPFLAGS := $(libstlport_cppflags) -D_STLP_DEBUG_LIGHT -D_STLP_DEBUG_MODE_THROWS
+LOCAL_C_INCLUDES := $(libstlport_c_includes) $(libstlport_private_c_includes)
+LOCAL_EXPORT_C_INCLUDES := $(libstlport_c_includes)
+LOCAL_EXPORT_CPPFLAGS := -D_STLP_DEBUG_LIGHT -D_STLP_DEBUG_MODE_THROWS
+LOCAL_CPP_FEATURES := rtti exceptions
+include $(BUILD_STATIC_LIBRARY)
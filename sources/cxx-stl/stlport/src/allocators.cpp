@@ -176,8 +176,7 @@ __oom_handler_type _STLP_CALL __malloc_alloc::set_malloc_handler(__oom_handler_t
 //    information that we can return the object to the proper free list
 //    without permanently losing part of the object.
 //
-
-#define _STLP_NFREELISTS 16
+// The number of size classes, _STLP_NFREELISTS, is defined in stl/_alloc.h.
 
 #if defined (_STLP_LEAKS_PEDANTIC) && defined (_STLP_USE_DYNAMIC_LIB)
 /*
@@ -204,6 +203,23 @@ __oom_handler_type _STLP_CALL __malloc_alloc::set_malloc_handler(__oom_handler_t
 #  define _STLP_USE_LOCK_FREE_IMPLEMENTATION
 #endif
 
+/* With pthreads, the lock based implementation keeps a small cache of free
+ * nodes per thread and per size class (a magazine) in front of the shared
+ * free lists, so that most allocations and deallocations do not take
+ * _Node_Alloc_Lock. Nodes move between a thread cache and the shared free
+ * lists in batches, and a thread cache is drained back to the shared free
+ * lists when its thread exits. Nodes are not owned by a thread: a node freed
+ * by another thread simply goes to the cache of that thread.
+ * The caches are not used when the node allocator memory is cleaned up at
+ * exit (_STLP_DO_CLEAN_NODE_ALLOC), as they could outlive the chunks, and
+ * can be disabled with _STLP_NO_NODE_ALLOC_THREAD_CACHE.
+ */
+#if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION) && \
+    defined (_STLP_PTHREADS) && !defined (_STLP_NO_THREADS) && \
+    !defined (_STLP_DO_CLEAN_NODE_ALLOC) && !defined (_STLP_NO_NODE_ALLOC_THREAD_CACHE)
+#  define _STLP_USE_NODE_ALLOC_THREAD_CACHE
+#endif
+
 #if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
 #  if defined (_STLP_THREADS)
 
@@ -260,7 +276,13 @@ class __node_alloc_impl {
 #else
   typedef _Node_alloc_obj       _Obj;
   typedef _Obj* _STLP_VOLATILE  _Freelist;
-  typedef _Obj*                 _ChunkList;
+
+  // Header at the beginning of each chunk of memory.
+  struct _Chunk {
+    _Chunk* _M_next;
+    char* _M_end;     // pointer to end of the chunk
+  };
+  typedef _Chunk*               _ChunkList;
 #endif
 
 private:
@@ -303,20 +325,117 @@ public:
 private:
   // Free all the allocated chuncks of memory
   static void _S_chunk_dealloc();
+#  if defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
   // Beginning of the linked list of allocated chunks of memory
   static _ChunkList _S_chunks;
+#  endif
 #endif /* _STLP_DO_CLEAN_NODE_ALLOC */
 
+#if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
+  // Beginning of the linked list of allocated chunks of memory
+  static _ChunkList _S_chunks;
+  // Chunk and size class accounting, protected by the allocation lock.
+  static size_t _S_chunk_count;
+  static size_t _S_chunk_bytes;
+  static size_t _S_chunk_high_watermark;
+  // Number of nodes carved out of the chunks, per size class.
+  static size_t _S_node_count[_STLP_NFREELISTS];
+  // Length of _S_free_list, per size class, and total size of its nodes.
+  static size_t _S_free_count[_STLP_NFREELISTS];
+  static size_t _S_free_bytes;
+  // trim() is called when _S_free_bytes goes over _S_trim_trigger.
+  static size_t _S_trim_threshold;
+  static size_t _S_trim_trigger;
+  // Incremented each time chunks are released, so that _S_trim() can tell
+  // whether the chunks it took note of are still there.
+  static size_t _S_release_count;
+
+  static void _S_add_free(size_t __i, size_t __nobjs) {
+    _S_free_count[__i] += __nobjs;
+    _S_free_bytes += __nobjs * (__i + 1) * _ALIGN;
+  }
+  static void _S_remove_free(size_t __i, size_t __nobjs) {
+    _S_free_count[__i] -= __nobjs;
+    _S_free_bytes -= __nobjs * (__i + 1) * _ALIGN;
+  }
+  // Returns whether _S_trim() should be called once the lock is released.
+  static bool _S_check_trim_threshold() {
+    if (_S_trim_threshold == 0 || _S_free_bytes <= _S_trim_trigger)
+      return false;
+    // Other deallocations don't ask for a trim until this one is done.
+    _S_trim_trigger = ~(size_t)0;
+    return true;
+  }
+
+  // Occupancy of a chunk computed by _S_trim().
+  struct _ChunkUsage {
+    _Chunk* _M_chunk;
+    size_t _M_free_bytes;
+  };
+  static int _S_compare_chunks(const void* __x, const void* __y);
+  // Returns the chunk containing __p, or 0 if it is not one of the __count
+  // chunks of __usage, that is sorted by address.
+  static _ChunkUsage* _S_find_chunk(_ChunkUsage* __usage, size_t __count, const void* __p);
+  // Releases the chunks that only contain free nodes.
+  // Takes the allocation lock, that must not be held.
+  static size_t _S_trim();
+#endif
+
+#if defined (_STLP_USE_NODE_ALLOC_THREAD_CACHE)
+  // Free nodes owned by one thread, per size class.
+  struct _ThreadCache {
+    _Obj* _M_free_list[_STLP_NFREELISTS];
+    int _M_count[_STLP_NFREELISTS];
+  };
+  // Number of nodes moved at once between a thread cache and the shared
+  // free lists, and maximum number of nodes in a thread cache per size class.
+  enum { _S_BATCH = 16, _S_CACHE_MAX = 2 * _S_BATCH };
+
+  static pthread_key_t _S_cache_key;
+  static pthread_once_t _S_cache_once;
+  static bool _S_cache_key_initialized;
+  static void _S_create_cache_key();
+  // Called on thread exit to drain the thread cache.
+  static void _S_cache_destructor(void* __p);
+  // Returns the cache of the calling thread, or 0 if it cannot be created.
+  static _ThreadCache* _S_get_thread_cache();
+  // Moves a batch of nodes of size __n to the empty cache, from the shared
+  // free list or from a new chunk.
+  static void _S_fill_thread_cache(_ThreadCache* __cache, size_t __n);
+  // Moves the first __nobjs nodes of free list __i of the cache to the
+  // shared free list.
+  static void _S_flush_thread_cache(_ThreadCache* __cache, size_t __i, int __nobjs);
+  // Moves all the nodes of the cache to the shared free lists.
+  static void _S_drain_thread_cache(_ThreadCache* __cache);
+#endif
+
 public:
   /* __n must be > 0      */
   static void* _M_allocate(size_t& __n);
   /* __p may not be 0 */
   static void _M_deallocate(void *__p, size_t __n);
+
+  static size_t _M_trim();
+  static void _M_set_trim_threshold(size_t __bytes);
+  static void _M_get_stats(__node_alloc_stats& __stats);
 };
 
 #if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
 void* __node_alloc_impl::_M_allocate(size_t& __n) {
   __n = _S_round_up(__n);
+#  if defined (_STLP_USE_NODE_ALLOC_THREAD_CACHE)
+  _ThreadCache* __cache = _S_get_thread_cache();
+  if (__cache != 0) {
+    size_t __i = _S_FREELIST_INDEX(__n);
+    if (__cache->_M_count[__i] == 0) {
+      _S_fill_thread_cache(__cache, __n);
+    }
+    _Obj* __result = __cache->_M_free_list[__i];
+    __cache->_M_free_list[__i] = __result->_M_next;
+    --__cache->_M_count[__i];
+    return __result;
+  }
+#  endif
   _Obj * _STLP_VOLATILE * __my_free_list = _S_free_list + _S_FREELIST_INDEX(__n);
   _Obj *__r;
 
@@ -327,6 +446,7 @@ void* __node_alloc_impl::_M_allocate(size_t& __n) {
 
   if ( (__r  = *__my_free_list) != 0 ) {
     *__my_free_list = __r->_M_next;
+    _S_remove_free(_S_FREELIST_INDEX(__n), 1);
   } else {
     __r = _S_refill(__n);
   }
@@ -338,25 +458,41 @@ void* __node_alloc_impl::_M_allocate(size_t& __n) {
 }
 
 void __node_alloc_impl::_M_deallocate(void *__p, size_t __n) {
-  _Obj * _STLP_VOLATILE * __my_free_list = _S_free_list + _S_FREELIST_INDEX(__n);
   _Obj * __pobj = __STATIC_CAST(_Obj*, __p);
+#  if defined (_STLP_USE_NODE_ALLOC_THREAD_CACHE)
+  _ThreadCache* __cache = _S_get_thread_cache();
+  if (__cache != 0) {
+    size_t __i = _S_FREELIST_INDEX(__n);
+    __pobj->_M_next = __cache->_M_free_list[__i];
+    __cache->_M_free_list[__i] = __pobj;
+    if (++__cache->_M_count[__i] > _S_CACHE_MAX) {
+      _S_flush_thread_cache(__cache, __i, _S_BATCH);
+    }
+    return;
+  }
+#  endif
+  _Obj * _STLP_VOLATILE * __my_free_list = _S_free_list + _S_FREELIST_INDEX(__n);
 
-  // acquire lock
-  _Node_Alloc_Lock __lock_instance;
-  __pobj->_M_next = *__my_free_list;
-  *__my_free_list = __pobj;
+  bool __trim;
+  {
+    // acquire lock
+    _Node_Alloc_Lock __lock_instance;
+    __pobj->_M_next = *__my_free_list;
+    *__my_free_list = __pobj;
+    _S_add_free(_S_FREELIST_INDEX(__n), 1);
+    __trim = _S_check_trim_threshold();
 
 #  if defined (_STLP_DO_CLEAN_NODE_ALLOC)
-  _S_dealloc_call();
+    _S_dealloc_call();
 #  endif
-  // lock is released here
+    // lock is released here
+  }
+  if (__trim) {
+    _S_trim();
+  }
 }
 
-#  if defined (_STLP_DO_CLEAN_NODE_ALLOC)
-#    define _STLP_OFFSET sizeof(_Obj)
-#  else
-#    define _STLP_OFFSET 0
-#  endif
+#  define _STLP_OFFSET sizeof(_Chunk)
 
 /* We allocate memory in large chunks in order to avoid fragmenting     */
 /* the malloc heap too much.                                            */
@@ -371,6 +507,7 @@ char* __node_alloc_impl::_S_chunk_alloc(size_t _p_size, int& __nobjs) {
     if (__bytes_left >= __total_bytes) {
       __result = _S_start_free;
       _S_start_free += __total_bytes;
+      _S_node_count[_S_FREELIST_INDEX(_p_size)] += __nobjs;
       return __result;
     }
 
@@ -379,6 +516,7 @@ char* __node_alloc_impl::_S_chunk_alloc(size_t _p_size, int& __nobjs) {
       __total_bytes = _p_size * __nobjs;
       __result = _S_start_free;
       _S_start_free += __total_bytes;
+      _S_node_count[_S_FREELIST_INDEX(_p_size)] += __nobjs;
       return __result;
     }
 
@@ -386,6 +524,8 @@ char* __node_alloc_impl::_S_chunk_alloc(size_t _p_size, int& __nobjs) {
     _Obj* _STLP_VOLATILE* __my_free_list = _S_free_list + _S_FREELIST_INDEX(__bytes_left);
     __REINTERPRET_CAST(_Obj*, _S_start_free)->_M_next = *__my_free_list;
     *__my_free_list = __REINTERPRET_CAST(_Obj*, _S_start_free);
+    ++_S_node_count[_S_FREELIST_INDEX(__bytes_left)];
+    _S_add_free(_S_FREELIST_INDEX(__bytes_left), 1);
     _S_start_free = _S_end_free = 0;
   }
 
@@ -406,6 +546,8 @@ char* __node_alloc_impl::_S_chunk_alloc(size_t _p_size, int& __nobjs) {
       __p = *__my_free_list;
       if (0 != __p) {
         *__my_free_list = __p -> _M_next;
+        --_S_node_count[_S_FREELIST_INDEX(__i)];
+        _S_remove_free(_S_FREELIST_INDEX(__i), 1);
         _S_start_free = __REINTERPRET_CAST(char*, __p);
         _S_end_free = _S_start_free + __i;
         return _S_chunk_alloc(_p_size, __nobjs);
@@ -419,10 +561,15 @@ char* __node_alloc_impl::_S_chunk_alloc(size_t _p_size, int& __nobjs) {
 #endif
 
   _S_heap_size += __bytes_to_get >> 4;
-#  if defined (_STLP_DO_CLEAN_NODE_ALLOC)
-  __REINTERPRET_CAST(_Obj*, _S_start_free)->_M_next = _S_chunks;
-  _S_chunks = __REINTERPRET_CAST(_Obj*, _S_start_free);
-#  endif
+  _Chunk* __chunk = __REINTERPRET_CAST(_Chunk*, _S_start_free);
+  __chunk->_M_next = _S_chunks;
+  __chunk->_M_end = _S_start_free + __bytes_to_get;
+  _S_chunks = __chunk;
+  ++_S_chunk_count;
+  _S_chunk_bytes += __bytes_to_get;
+  if (_S_chunk_bytes > _S_chunk_high_watermark) {
+    _S_chunk_high_watermark = _S_chunk_bytes;
+  }
   _S_end_free = _S_start_free + __bytes_to_get;
   _S_start_free += _STLP_OFFSET;
   return _S_chunk_alloc(_p_size, __nobjs);
@@ -445,6 +592,7 @@ _Node_alloc_obj* __node_alloc_impl::_S_refill(size_t __n) {
   /* Build free list in chunk */
   __result = __REINTERPRET_CAST(_Obj*, __chunk);
   *__my_free_list = __next_obj = __REINTERPRET_CAST(_Obj*, __chunk + __n);
+  _S_add_free(_S_FREELIST_INDEX(__n), __nobjs - 1);
   for (--__nobjs; --__nobjs; ) {
     __current_obj = __next_obj;
     __next_obj = __REINTERPRET_CAST(_Obj*, __REINTERPRET_CAST(char*, __next_obj) + __n);
@@ -454,6 +602,101 @@ _Node_alloc_obj* __node_alloc_impl::_S_refill(size_t __n) {
   return __result;
 }
 
+#  if defined (_STLP_USE_NODE_ALLOC_THREAD_CACHE)
+void __node_alloc_impl::_S_create_cache_key()
+{ _S_cache_key_initialized = (pthread_key_create(&_S_cache_key, _S_cache_destructor) == 0); }
+
+/* A node allocation done by a later thread specific data destructor creates
+ * a new cache, that is drained by the next round of destructor calls. */
+void __node_alloc_impl::_S_cache_destructor(void* __p) {
+  _ThreadCache* __cache = __STATIC_CAST(_ThreadCache*, __p);
+  _S_drain_thread_cache(__cache);
+  free(__cache);
+}
+
+__node_alloc_impl::_ThreadCache* __node_alloc_impl::_S_get_thread_cache() {
+  pthread_once(&_S_cache_once, _S_create_cache_key);
+  if (!_S_cache_key_initialized) {
+    return 0;
+  }
+  _ThreadCache* __cache = __STATIC_CAST(_ThreadCache*, pthread_getspecific(_S_cache_key));
+  if (__cache == 0) {
+    // Not allocated with the node allocator itself, and failures only make
+    // this thread fall back to the shared free lists.
+    __cache = __STATIC_CAST(_ThreadCache*, calloc(1, sizeof(_ThreadCache)));
+    if (__cache != 0 && pthread_setspecific(_S_cache_key, __cache) != 0) {
+      free(__cache);
+      __cache = 0;
+    }
+  }
+  return __cache;
+}
+
+void __node_alloc_impl::_S_fill_thread_cache(_ThreadCache* __cache, size_t __n) {
+  size_t __i = _S_FREELIST_INDEX(__n);
+  _Obj* __head;
+  _Obj* __tail = 0;
+  int __nobjs = 1;
+  char* __chunk = 0;
+  {
+    _Node_Alloc_Lock __lock_instance;
+    __head = _S_free_list[__i];
+    if (__head != 0) {
+      for (__tail = __head; __nobjs < _S_BATCH && __tail->_M_next != 0; ++__nobjs) {
+        __tail = __tail->_M_next;
+      }
+      _S_free_list[__i] = __tail->_M_next;
+      _S_remove_free(__i, __nobjs);
+    } else {
+      __nobjs = _S_BATCH;
+      __chunk = _S_chunk_alloc(__n, __nobjs);
+    }
+  }
+
+  if (__chunk != 0) {
+    /* Build free list in chunk, the lock is not needed anymore */
+    __head = __tail = __REINTERPRET_CAST(_Obj*, __chunk);
+    for (int __k = 1; __k < __nobjs; ++__k) {
+      __tail->_M_next = __REINTERPRET_CAST(_Obj*, __chunk + __k * __n);
+      __tail = __tail->_M_next;
+    }
+  }
+  __tail->_M_next = 0;
+  __cache->_M_free_list[__i] = __head;
+  __cache->_M_count[__i] = __nobjs;
+}
+
+void __node_alloc_impl::_S_flush_thread_cache(_ThreadCache* __cache, size_t __i, int __nobjs) {
+  _Obj* __head = __cache->_M_free_list[__i];
+  _Obj* __tail = __head;
+  for (int __k = 1; __k < __nobjs; ++__k) {
+    __tail = __tail->_M_next;
+  }
+  __cache->_M_free_list[__i] = __tail->_M_next;
+  __cache->_M_count[__i] -= __nobjs;
+
+  bool __trim;
+  {
+    _Node_Alloc_Lock __lock_instance;
+    __tail->_M_next = _S_free_list[__i];
+    _S_free_list[__i] = __head;
+    _S_add_free(__i, __nobjs);
+    __trim = _S_check_trim_threshold();
+  }
+  if (__trim) {
+    _S_trim();
+  }
+}
+
+void __node_alloc_impl::_S_drain_thread_cache(_ThreadCache* __cache) {
+  for (size_t __i = 0; __i < _STLP_NFREELISTS; ++__i) {
+    if (__cache->_M_count[__i] != 0) {
+      _S_flush_thread_cache(__cache, __i, __cache->_M_count[__i]);
+    }
+  }
+}
+#  endif
+
 #  if defined (_STLP_DO_CLEAN_NODE_ALLOC)
 void __node_alloc_impl::_S_alloc_call()
 { ++_S_alloc_counter(); }
@@ -466,7 +709,7 @@ void __node_alloc_impl::_S_dealloc_call() {
 
 /* We deallocate all the memory chunks      */
 void __node_alloc_impl::_S_chunk_dealloc() {
-  _Obj *__pcur = _S_chunks, *__pnext;
+  _Chunk *__pcur = _S_chunks, *__pnext;
   while (__pcur != 0) {
     __pnext = __pcur->_M_next;
     __stlp_delete_chunck(__pcur);
@@ -475,9 +718,179 @@ void __node_alloc_impl::_S_chunk_dealloc() {
   _S_chunks = 0;
   _S_start_free = _S_end_free = 0;
   _S_heap_size = 0;
+  _S_chunk_count = _S_chunk_bytes = _S_free_bytes = 0;
+  ++_S_release_count;
   memset(__REINTERPRET_CAST(char*, __CONST_CAST(_Obj**, &_S_free_list[0])), 0, _STLP_NFREELISTS * sizeof(_Obj*));
+  memset(_S_node_count, 0, sizeof(_S_node_count));
+  memset(_S_free_count, 0, sizeof(_S_free_count));
+}
+#  endif
+
+int __node_alloc_impl::_S_compare_chunks(const void* __x, const void* __y) {
+  const char* __cx = __REINTERPRET_CAST(const char*, __STATIC_CAST(const _ChunkUsage*, __x)->_M_chunk);
+  const char* __cy = __REINTERPRET_CAST(const char*, __STATIC_CAST(const _ChunkUsage*, __y)->_M_chunk);
+  return __cx < __cy ? -1 : (__cx > __cy ? 1 : 0);
+}
+
+__node_alloc_impl::_ChunkUsage*
+__node_alloc_impl::_S_find_chunk(_ChunkUsage* __usage, size_t __count, const void* __p) {
+  size_t __lo = 0, __hi = __count;
+  while (__hi - __lo > 1) {
+    size_t __mid = (__lo + __hi) / 2;
+    if (__REINTERPRET_CAST(const char*, __usage[__mid]._M_chunk) <= __STATIC_CAST(const char*, __p))
+      __lo = __mid;
+    else
+      __hi = __mid;
+  }
+  // Chunks allocated after _S_trim() took note of them are not in __usage.
+  _Chunk* __chunk = __usage[__lo]._M_chunk;
+  if (__STATIC_CAST(const char*, __p) < __REINTERPRET_CAST(const char*, __chunk) ||
+      __STATIC_CAST(const char*, __p) >= __chunk->_M_end)
+    return 0;
+  return __usage + __lo;
+}
+
+/* A chunk can be released when its free nodes and its part of the current */
+/* free memory buffer cover all of it. Nodes in thread caches or in use    */
+/* keep their chunk.                                                       */
+/* The array of chunks is allocated and sorted without holding the lock,   */
+/* so that allocations are only held up while the free lists are walked.  */
+size_t __node_alloc_impl::_S_trim() {
+  const size_t __released_chunk = ~(size_t)0;
+  size_t __released = 0;
+  size_t __count;
+  size_t __i;
+  {
+    _Node_Alloc_Lock __lock_instance;
+    __count = _S_chunk_count;
+  }
+  _ChunkUsage* __usage = 0;
+  if (__count != 0) {
+    __usage = __STATIC_CAST(_ChunkUsage*, malloc(__count * sizeof(_ChunkUsage)));
+  }
+
+  size_t __release_count = 0;
+  if (__usage != 0) {
+    // Chunks are added at the head of the list: the ones allocated since
+    // __count was read are left out, and are not released this time.
+    _Node_Alloc_Lock __lock_instance;
+    _Chunk* __chunk = _S_chunks;
+    for (__i = 0; __i < __count && __chunk != 0; __chunk = __chunk->_M_next, ++__i) {
+      __usage[__i]._M_chunk = __chunk;
+      __usage[__i]._M_free_bytes = 0;
+    }
+    __count = __i;
+    __release_count = _S_release_count;
+  }
+  if (__count != 0) {
+    qsort(__usage, __count, sizeof(_ChunkUsage), _S_compare_chunks);
+  }
+
+  {
+    _Node_Alloc_Lock __lock_instance;
+    // Give up if another trim has released chunks in the meantime.
+    if (__count != 0 && __release_count == _S_release_count) {
+      _Chunk* __chunk;
+      _Obj* __p;
+      _ChunkUsage* __chunk_usage;
+      for (__i = 0; __i < _STLP_NFREELISTS; ++__i) {
+        for (__p = _S_free_list[__i]; __p != 0; __p = __p->_M_next) {
+          if ((__chunk_usage = _S_find_chunk(__usage, __count, __p)) != 0)
+            __chunk_usage->_M_free_bytes += (__i + 1) * _ALIGN;
+        }
+      }
+      if (_S_start_free != _S_end_free &&
+          (__chunk_usage = _S_find_chunk(__usage, __count, _S_start_free)) != 0) {
+        __chunk_usage->_M_free_bytes += _S_end_free - _S_start_free;
+      }
+
+      bool __any_free = false;
+      for (__i = 0; __i < __count; ++__i) {
+        __chunk = __usage[__i]._M_chunk;
+        if (__usage[__i]._M_free_bytes == (size_t)(__chunk->_M_end - __REINTERPRET_CAST(char*, __chunk)) - _STLP_OFFSET) {
+          __usage[__i]._M_free_bytes = __released_chunk;
+          __any_free = true;
+        }
+      }
+
+      if (__any_free) {
+        // Remove the nodes of the released chunks from the free lists.
+        for (__i = 0; __i < _STLP_NFREELISTS; ++__i) {
+          _Obj* _STLP_VOLATILE* __link = _S_free_list + __i;
+          size_t __removed = 0;
+          while ((__p = *__link) != 0) {
+            __chunk_usage = _S_find_chunk(__usage, __count, __p);
+            if (__chunk_usage != 0 && __chunk_usage->_M_free_bytes == __released_chunk) {
+              *__link = __p->_M_next;
+              ++__removed;
+            } else {
+              __link = &__p->_M_next;
+            }
+          }
+          _S_remove_free(__i, __removed);
+          _S_node_count[__i] -= __removed;
+        }
+        if (_S_start_free == _S_end_free ||
+            ((__chunk_usage = _S_find_chunk(__usage, __count, _S_start_free)) != 0 &&
+             __chunk_usage->_M_free_bytes == __released_chunk)) {
+          _S_start_free = _S_end_free = 0;
+        }
+
+        _Chunk** __chunk_link = &_S_chunks;
+        while ((__chunk = *__chunk_link) != 0) {
+          __chunk_usage = _S_find_chunk(__usage, __count, __chunk);
+          if (__chunk_usage != 0 && __chunk_usage->_M_free_bytes == __released_chunk) {
+            size_t __bytes = __chunk->_M_end - __REINTERPRET_CAST(char*, __chunk);
+            *__chunk_link = __chunk->_M_next;
+            --_S_chunk_count;
+            _S_chunk_bytes -= __bytes;
+            _S_heap_size -= (_S_heap_size < (__bytes >> 4)) ? _S_heap_size : (__bytes >> 4);
+            __released += __bytes;
+            __stlp_delete_chunck(__chunk);
+          } else {
+            __chunk_link = &__chunk->_M_next;
+          }
+        }
+        ++_S_release_count;
+      }
+    }
+    _S_trim_trigger = _S_free_bytes + _S_trim_threshold;
+  }
+  free(__usage);
+  return __released;
 }
+
+size_t __node_alloc_impl::_M_trim() {
+#  if defined (_STLP_USE_NODE_ALLOC_THREAD_CACHE)
+  // Only the cache of the calling thread can be drained.
+  pthread_once(&_S_cache_once, _S_create_cache_key);
+  if (_S_cache_key_initialized) {
+    _ThreadCache* __cache = __STATIC_CAST(_ThreadCache*, pthread_getspecific(_S_cache_key));
+    if (__cache != 0) {
+      _S_drain_thread_cache(__cache);
+    }
+  }
 #  endif
+  return _S_trim();
+}
+
+void __node_alloc_impl::_M_set_trim_threshold(size_t __bytes) {
+  _Node_Alloc_Lock __lock_instance;
+  _S_trim_threshold = __bytes;
+  _S_trim_trigger = _S_free_bytes + __bytes;
+}
+
+void __node_alloc_impl::_M_get_stats(__node_alloc_stats& __stats) {
+  _Node_Alloc_Lock __lock_instance;
+  for (size_t __i = 0; __i < _STLP_NFREELISTS; ++__i) {
+    __stats.node_size[__i] = (__i + 1) * _ALIGN;
+    __stats.bytes[__i] = _S_node_count[__i] * (__i + 1) * _ALIGN;
+    __stats.free_nodes[__i] = _S_free_count[__i];
+  }
+  __stats.chunk_count = _S_chunk_count;
+  __stats.heap_bytes = _S_chunk_bytes;
+  __stats.heap_high_watermark = _S_chunk_high_watermark;
+}
 
 #else
 
@@ -687,6 +1100,22 @@ void __node_alloc_impl::_S_chunk_dealloc() {
 }
 #  endif
 
+/* The lock free implementation does not track the occupancy of the chunks, */
+/* nodes are never given back to the system.                                */
+size_t __node_alloc_impl::_M_trim()
+{ return 0; }
+
+void __node_alloc_impl::_M_set_trim_threshold(size_t)
+{}
+
+void __node_alloc_impl::_M_get_stats(__node_alloc_stats& __stats) {
+  memset(&__stats, 0, sizeof(__stats));
+  for (size_t __i = 0; __i < _STLP_NFREELISTS; ++__i) {
+    __stats.node_size[__i] = (__i + 1) * _ALIGN;
+  }
+  __stats.heap_bytes = __STATIC_CAST(size_t, _STLP_ATOMIC_ADD(&_S_heap_size, 0)) << 4;
+}
+
 #endif
 
 #if defined (_STLP_DO_CLEAN_NODE_ALLOC)
@@ -724,6 +1153,12 @@ char *__node_alloc_impl::_S_start_free = 0;
 char *__node_alloc_impl::_S_end_free = 0;
 #endif
 
+#if defined (_STLP_USE_NODE_ALLOC_THREAD_CACHE)
+pthread_key_t __node_alloc_impl::_S_cache_key = 0;
+pthread_once_t __node_alloc_impl::_S_cache_once = PTHREAD_ONCE_INIT;
+bool __node_alloc_impl::_S_cache_key_initialized = false;
+#endif
+
 #if defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
 _STLP_VOLATILE __add_atomic_t
 #else
@@ -731,12 +1166,21 @@ size_t
 #endif
 __node_alloc_impl::_S_heap_size = 0;
 
-#if defined (_STLP_DO_CLEAN_NODE_ALLOC)
-#  if defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
+#if defined (_STLP_DO_CLEAN_NODE_ALLOC) && defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
 _STLP_atomic_freelist __node_alloc_impl::_S_chunks;
-#  else
-_Node_alloc_obj* __node_alloc_impl::_S_chunks  = 0;
-#  endif
+#endif
+
+#if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
+__node_alloc_impl::_Chunk* __node_alloc_impl::_S_chunks = 0;
+size_t __node_alloc_impl::_S_chunk_count = 0;
+size_t __node_alloc_impl::_S_chunk_bytes = 0;
+size_t __node_alloc_impl::_S_chunk_high_watermark = 0;
+size_t __node_alloc_impl::_S_node_count[_STLP_NFREELISTS];
+size_t __node_alloc_impl::_S_free_count[_STLP_NFREELISTS];
+size_t __node_alloc_impl::_S_free_bytes = 0;
+size_t __node_alloc_impl::_S_trim_threshold = 0;
+size_t __node_alloc_impl::_S_trim_trigger = 0;
+size_t __node_alloc_impl::_S_release_count = 0;
 #endif
 
 void * _STLP_CALL __node_alloc::_M_allocate(size_t& __n)
@@ -745,6 +1189,15 @@ void * _STLP_CALL __node_alloc::_M_allocate(size_t& __n)
 void _STLP_CALL __node_alloc::_M_deallocate(void *__p, size_t __n)
 { __node_alloc_impl::_M_deallocate(__p, __n); }
 
+size_t _STLP_CALL __node_alloc::trim()
+{ return __node_alloc_impl::_M_trim(); }
+
+void _STLP_CALL __node_alloc::set_trim_threshold(size_t __bytes)
+{ __node_alloc_impl::_M_set_trim_threshold(__bytes); }
+
+void _STLP_CALL __node_alloc::get_stats(__node_alloc_stats& __stats)
+{ __node_alloc_impl::_M_get_stats(__stats); }
+
 #if defined (_STLP_PTHREADS) && !defined (_STLP_NO_THREADS)
 
 #  define _STLP_DATA_ALIGNMENT 8
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The cpufeatures library, built into STLport (see cpu_features.c) under
+// names of its own so that it does not clash with the copy an application
+// links with.
+
+#ifndef _STLP_CPU_FEATURES_H
+#define _STLP_CPU_FEATURES_H
+
+#define android_getCpuFamily   __stlp_android_getCpuFamily
+#define android_getCpuFeatures __stlp_android_getCpuFeatures
+#define android_getCpuCount    __stlp_android_getCpuCount
+#define android_setCpu         __stlp_android_setCpu
+
+#include <cpu-features.h>
+
+#endif /* _STLP_CPU_FEATURES_H */
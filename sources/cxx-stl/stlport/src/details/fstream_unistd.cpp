@@ -33,6 +33,7 @@ extern "C" {
 #if !defined (_CRAY) && ! defined (__EMX__)
 #  include <sys/mman.h>           // For mmap
 #endif
+#include <sys/uio.h>            // For writev
 
 //  on HP-UX 11, this one contradicts with pthread.h on pthread_atfork, unless we unset this
 #if defined (__hpux) && defined (__GNUC__)
@@ -282,6 +283,28 @@ bool _Filebuf_base::_M_write(char* buf, ptrdiff_t n)
   }
 }
 
+// Same as above for two buffers, written with writev: the characters of
+// the second one did not go through the filebuf's buffer.
+bool _Filebuf_base::_M_write(char* buf1, ptrdiff_t n1, const char* buf2, ptrdiff_t n2)
+{
+  struct iovec iov[2];
+  iov[0].iov_base = buf1;
+  iov[0].iov_len = n1;
+  iov[1].iov_base = __CONST_CAST(char*, buf2);
+  iov[1].iov_len = n2;
+
+  ptrdiff_t written = writev(_M_file_id, iov, 2);
+  if (written < 0)
+    return false;
+
+  // Partial write: go on with plain writes.
+  if (written < n1)
+    return _M_write(buf1 + written, n1 - written) &&
+           _M_write(__CONST_CAST(char*, buf2), n2);
+  written -= n1;
+  return written == n2 || _M_write(__CONST_CAST(char*, buf2) + written, n2 - written);
+}
+
 // Wrapper for lseek or the like.
 streamoff _Filebuf_base::_M_seek(streamoff offset, ios_base::seekdir dir)
 {
@@ -323,6 +346,13 @@ void* _Filebuf_base::_M_mmap(streamoff offset, streamoff len)
       this->_M_unmap(base, len);
       base = 0;
     }
+#  if defined (MADV_SEQUENTIAL)
+    else {
+      // Filebufs read forward: let the kernel read ahead aggressively and
+      // drop the pages behind.
+      madvise(base, len, MADV_SEQUENTIAL);
+    }
+#  endif
   } else
     base =0;
 #else
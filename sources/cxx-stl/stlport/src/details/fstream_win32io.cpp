@@ -543,6 +543,9 @@ bool _Filebuf_base::_M_write(char* buf, ptrdiff_t n) {
   }
 }
 
+bool _Filebuf_base::_M_write(char* buf1, ptrdiff_t n1, const char* buf2, ptrdiff_t n2)
+{ return _M_write(buf1, n1) && _M_write(__CONST_CAST(char*, buf2), n2); }
+
 // Wrapper for lseek or the like.
 streamoff _Filebuf_base::_M_seek(streamoff offset, ios_base::seekdir dir) {
   streamoff result = -1;
@@ -31,6 +31,8 @@
 _STLP_BEGIN_NAMESPACE
 
 // fbp : let us map 1 MB maximum, just be sure not to trash VM
+// With a 64 bits address space the whole file is mapped instead, and the
+// chunks are as large as the buffer if pubsetbuf asked for a larger one.
 #define MMAP_CHUNK 0x100000L
 
 _Underflow< char, char_traits<char> >::int_type _STLP_CALL
@@ -71,8 +73,13 @@ _Underflow< char, char_traits<char> >::_M_doit(basic_filebuf<char, char_traits<c
 
       __this->_M_mmap_len = __size - __offset;
 
-      if (__this->_M_mmap_len > MMAP_CHUNK)
-        __this->_M_mmap_len = MMAP_CHUNK;
+      if (sizeof(void*) < 8) {
+        streamoff __chunk = __this->_M_int_buf_EOS - __this->_M_int_buf;
+        if (__chunk < MMAP_CHUNK)
+          __chunk = MMAP_CHUNK;
+        if (__this->_M_mmap_len > __chunk)
+          __this->_M_mmap_len = __chunk;
+      }
 
       if ((__this->_M_mmap_base = __this->_M_base._M_mmap(__offset, __this->_M_mmap_len)) != 0) {
         __this->setg(__STATIC_CAST(char*, __this->_M_mmap_base),
@@ -97,6 +97,84 @@ bool _STLP_CALL __get_fdigit_or_sep(wchar_t& c, wchar_t sep,
 
 #endif
 
+// Decimal integer input of char streams using the classic locale.  The
+// number is only parsed from the get area if it ends there, otherwise
+// num_get, which knows how to refill the buffer, is used.  The value and
+// the state are the ones __get_integer gives.
+template <class _Integer, class _Unsigned>
+static bool _STLP_CALL
+__get_classic_decimal(istream& is, _Integer& x, _Unsigned, ios_base::iostate& err) {
+  if (!is._M_is_classic() || (is.flags() & ios_base::basefield) != ios_base::dec)
+    return false;
+
+  streambuf* sb = is.rdbuf();
+  const char* first = sb->_M_gptr();
+  const char* last = sb->_M_egptr();
+  const char* cur = first;
+  if (cur == last)
+    return false;
+
+  const bool negative = *cur == '-';
+  if (negative || *cur == '+')
+    ++cur;
+
+  const bool is_signed = numeric_limits<_Integer>::is_signed;
+  const _Unsigned max_pos = (numeric_limits<_Integer>::max)();
+  const _Unsigned max_val = (negative && is_signed) ? max_pos + 1 : max_pos;
+  const _Unsigned cutoff = max_val / 10;
+  const unsigned cutlim = (unsigned)(max_val % 10);
+  const char* digits = cur;
+  _Unsigned val = 0;
+  bool ovflow = false;
+  for (; cur != last; ++cur) {
+    const unsigned d = (unsigned)(unsigned char)*cur - '0';
+    if (d > 9)
+      break;
+    if (val < cutoff || (val == cutoff && d <= cutlim))
+      val = val * 10 + d;
+    else
+      ovflow = true;  // don't need to keep accumulating
+  }
+  if (cur == last)
+    return false;
+
+  sb->_M_gbump((int)(cur - first));
+  if (cur == digits)
+    err = ios_base::failbit;
+  else if (ovflow) {
+    x = (negative && is_signed) ? (numeric_limits<_Integer>::min)()
+                                : (numeric_limits<_Integer>::max)();
+    err = ios_base::failbit;
+  }
+  else {
+    x = __STATIC_CAST(_Integer, negative ? 0 - val : val);
+    err = ios_base::goodbit;
+  }
+  return true;
+}
+
+_STLP_DECLSPEC bool _STLP_CALL
+__get_classic_num(istream& is, long& x, ios_base::iostate& err)
+{ return __get_classic_decimal(is, x, 0UL, err); }
+
+_STLP_DECLSPEC bool _STLP_CALL
+__get_classic_num(istream& is, unsigned int& x, ios_base::iostate& err)
+{ return __get_classic_decimal(is, x, 0U, err); }
+
+_STLP_DECLSPEC bool _STLP_CALL
+__get_classic_num(istream& is, unsigned long& x, ios_base::iostate& err)
+{ return __get_classic_decimal(is, x, 0UL, err); }
+
+#if defined (_STLP_LONG_LONG)
+_STLP_DECLSPEC bool _STLP_CALL
+__get_classic_num(istream& is, _STLP_LONG_LONG& x, ios_base::iostate& err)
+{ return __get_classic_decimal(is, x, __STATIC_CAST(unsigned _STLP_LONG_LONG, 0), err); }
+
+_STLP_DECLSPEC bool _STLP_CALL
+__get_classic_num(istream& is, unsigned _STLP_LONG_LONG& x, ios_base::iostate& err)
+{ return __get_classic_decimal(is, x, __STATIC_CAST(unsigned _STLP_LONG_LONG, 0), err); }
+#endif
+
 _STLP_MOVE_TO_STD_NAMESPACE
 
 #if !defined(_STLP_NO_FORCE_INSTANTIATE)
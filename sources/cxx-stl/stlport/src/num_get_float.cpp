@@ -118,6 +118,11 @@ typedef uint64_t uint64;
 // hand-unrolled.
 static void _Stl_mult64(const uint64 u, const uint64 v,
                         uint64& high, uint64& low) {
+#if defined (__SIZEOF_INT128__)
+  unsigned __int128 p = (unsigned __int128)u * v;
+  high = (uint64)(p >> 64);
+  low = (uint64)p;
+#else
   const uint64 low_mask = ULL(0xffffffff);
   const uint64 u0 = u & low_mask;
   const uint64 u1 = u >> 32;
@@ -134,6 +139,312 @@ static void _Stl_mult64(const uint64 u, const uint64 v,
   uint64 x = u0 * v1 + w1;
   low += (x & low_mask) << 32;
   high = u1 * v1 + w2 + (x >> 32);
+#endif
+}
+
+#define _Stl_HIBITULL (ULL(1) << 63)
+
+/* Fast path of the conversion, for a decimal significand w of at most
+ * _STLP_FAST_ATOD_DIGITS digits times 10^exp10.  The slow path below
+ * normalizes the digits and scales them with up to three rounded 64-bit
+ * products, this one needs at most one and returns false whenever it
+ * cannot be sure of the correctly rounded result, the caller then uses the
+ * slow path.
+ */
+#define _STLP_FAST_ATOD_DIGITS 19
+
+/* 10^0 to 10^22 are exact doubles, and so is any integer below 2^53: when
+ * double operations are not carried out in a wider type, w * 10^exp10 and
+ * w / 10^-exp10 are correctly rounded (Clinger).
+ */
+#if defined (__FLT_EVAL_METHOD__) && (__FLT_EVAL_METHOD__ == 0)
+#  define _STLP_EXACT_DOUBLE_ARITHMETIC
+static const double _Stl_exact_tenpow[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
+
+/* Normalized 10^q truncated to 64 bits, for q from -342 to 308. */
+#define _STLP_FAST_ATOD_MIN_EXP10 (-342)
+#define _STLP_FAST_ATOD_MAX_EXP10 308
+
+static const uint64 _Stl_tenpow_hi[_STLP_FAST_ATOD_MAX_EXP10 - _STLP_FAST_ATOD_MIN_EXP10 + 1] = {
+  ULL(0xeef453d6923bd65a), ULL(0x9558b4661b6565f8), ULL(0xbaaee17fa23ebf76),
+  ULL(0xe95a99df8ace6f53), ULL(0x91d8a02bb6c10594), ULL(0xb64ec836a47146f9),
+  ULL(0xe3e27a444d8d98b7), ULL(0x8e6d8c6ab0787f72), ULL(0xb208ef855c969f4f),
+  ULL(0xde8b2b66b3bc4723), ULL(0x8b16fb203055ac76), ULL(0xaddcb9e83c6b1793),
+  ULL(0xd953e8624b85dd78), ULL(0x87d4713d6f33aa6b), ULL(0xa9c98d8ccb009506),
+  ULL(0xd43bf0effdc0ba48), ULL(0x84a57695fe98746d), ULL(0xa5ced43b7e3e9188),
+  ULL(0xcf42894a5dce35ea), ULL(0x818995ce7aa0e1b2), ULL(0xa1ebfb4219491a1f),
+  ULL(0xca66fa129f9b60a6), ULL(0xfd00b897478238d0), ULL(0x9e20735e8cb16382),
+  ULL(0xc5a890362fddbc62), ULL(0xf712b443bbd52b7b), ULL(0x9a6bb0aa55653b2d),
+  ULL(0xc1069cd4eabe89f8), ULL(0xf148440a256e2c76), ULL(0x96cd2a865764dbca),
+  ULL(0xbc807527ed3e12bc), ULL(0xeba09271e88d976b), ULL(0x93445b8731587ea3),
+  ULL(0xb8157268fdae9e4c), ULL(0xe61acf033d1a45df), ULL(0x8fd0c16206306bab),
+  ULL(0xb3c4f1ba87bc8696), ULL(0xe0b62e2929aba83c), ULL(0x8c71dcd9ba0b4925),
+  ULL(0xaf8e5410288e1b6f), ULL(0xdb71e91432b1a24a), ULL(0x892731ac9faf056e),
+  ULL(0xab70fe17c79ac6ca), ULL(0xd64d3d9db981787d), ULL(0x85f0468293f0eb4e),
+  ULL(0xa76c582338ed2621), ULL(0xd1476e2c07286faa), ULL(0x82cca4db847945ca),
+  ULL(0xa37fce126597973c), ULL(0xcc5fc196fefd7d0c), ULL(0xff77b1fcbebcdc4f),
+  ULL(0x9faacf3df73609b1), ULL(0xc795830d75038c1d), ULL(0xf97ae3d0d2446f25),
+  ULL(0x9becce62836ac577), ULL(0xc2e801fb244576d5), ULL(0xf3a20279ed56d48a),
+  ULL(0x9845418c345644d6), ULL(0xbe5691ef416bd60c), ULL(0xedec366b11c6cb8f),
+  ULL(0x94b3a202eb1c3f39), ULL(0xb9e08a83a5e34f07), ULL(0xe858ad248f5c22c9),
+  ULL(0x91376c36d99995be), ULL(0xb58547448ffffb2d), ULL(0xe2e69915b3fff9f9),
+  ULL(0x8dd01fad907ffc3b), ULL(0xb1442798f49ffb4a), ULL(0xdd95317f31c7fa1d),
+  ULL(0x8a7d3eef7f1cfc52), ULL(0xad1c8eab5ee43b66), ULL(0xd863b256369d4a40),
+  ULL(0x873e4f75e2224e68), ULL(0xa90de3535aaae202), ULL(0xd3515c2831559a83),
+  ULL(0x8412d9991ed58091), ULL(0xa5178fff668ae0b6), ULL(0xce5d73ff402d98e3),
+  ULL(0x80fa687f881c7f8e), ULL(0xa139029f6a239f72), ULL(0xc987434744ac874e),
+  ULL(0xfbe9141915d7a922), ULL(0x9d71ac8fada6c9b5), ULL(0xc4ce17b399107c22),
+  ULL(0xf6019da07f549b2b), ULL(0x99c102844f94e0fb), ULL(0xc0314325637a1939),
+  ULL(0xf03d93eebc589f88), ULL(0x96267c7535b763b5), ULL(0xbbb01b9283253ca2),
+  ULL(0xea9c227723ee8bcb), ULL(0x92a1958a7675175f), ULL(0xb749faed14125d36),
+  ULL(0xe51c79a85916f484), ULL(0x8f31cc0937ae58d2), ULL(0xb2fe3f0b8599ef07),
+  ULL(0xdfbdcece67006ac9), ULL(0x8bd6a141006042bd), ULL(0xaecc49914078536d),
+  ULL(0xda7f5bf590966848), ULL(0x888f99797a5e012d), ULL(0xaab37fd7d8f58178),
+  ULL(0xd5605fcdcf32e1d6), ULL(0x855c3be0a17fcd26), ULL(0xa6b34ad8c9dfc06f),
+  ULL(0xd0601d8efc57b08b), ULL(0x823c12795db6ce57), ULL(0xa2cb1717b52481ed),
+  ULL(0xcb7ddcdda26da268), ULL(0xfe5d54150b090b02), ULL(0x9efa548d26e5a6e1),
+  ULL(0xc6b8e9b0709f109a), ULL(0xf867241c8cc6d4c0), ULL(0x9b407691d7fc44f8),
+  ULL(0xc21094364dfb5636), ULL(0xf294b943e17a2bc4), ULL(0x979cf3ca6cec5b5a),
+  ULL(0xbd8430bd08277231), ULL(0xece53cec4a314ebd), ULL(0x940f4613ae5ed136),
+  ULL(0xb913179899f68584), ULL(0xe757dd7ec07426e5), ULL(0x9096ea6f3848984f),
+  ULL(0xb4bca50b065abe63), ULL(0xe1ebce4dc7f16dfb), ULL(0x8d3360f09cf6e4bd),
+  ULL(0xb080392cc4349dec), ULL(0xdca04777f541c567), ULL(0x89e42caaf9491b60),
+  ULL(0xac5d37d5b79b6239), ULL(0xd77485cb25823ac7), ULL(0x86a8d39ef77164bc),
+  ULL(0xa8530886b54dbdeb), ULL(0xd267caa862a12d66), ULL(0x8380dea93da4bc60),
+  ULL(0xa46116538d0deb78), ULL(0xcd795be870516656), ULL(0x806bd9714632dff6),
+  ULL(0xa086cfcd97bf97f3), ULL(0xc8a883c0fdaf7df0), ULL(0xfad2a4b13d1b5d6c),
+  ULL(0x9cc3a6eec6311a63), ULL(0xc3f490aa77bd60fc), ULL(0xf4f1b4d515acb93b),
+  ULL(0x991711052d8bf3c5), ULL(0xbf5cd54678eef0b6), ULL(0xef340a98172aace4),
+  ULL(0x9580869f0e7aac0e), ULL(0xbae0a846d2195712), ULL(0xe998d258869facd7),
+  ULL(0x91ff83775423cc06), ULL(0xb67f6455292cbf08), ULL(0xe41f3d6a7377eeca),
+  ULL(0x8e938662882af53e), ULL(0xb23867fb2a35b28d), ULL(0xdec681f9f4c31f31),
+  ULL(0x8b3c113c38f9f37e), ULL(0xae0b158b4738705e), ULL(0xd98ddaee19068c76),
+  ULL(0x87f8a8d4cfa417c9), ULL(0xa9f6d30a038d1dbc), ULL(0xd47487cc8470652b),
+  ULL(0x84c8d4dfd2c63f3b), ULL(0xa5fb0a17c777cf09), ULL(0xcf79cc9db955c2cc),
+  ULL(0x81ac1fe293d599bf), ULL(0xa21727db38cb002f), ULL(0xca9cf1d206fdc03b),
+  ULL(0xfd442e4688bd304a), ULL(0x9e4a9cec15763e2e), ULL(0xc5dd44271ad3cdba),
+  ULL(0xf7549530e188c128), ULL(0x9a94dd3e8cf578b9), ULL(0xc13a148e3032d6e7),
+  ULL(0xf18899b1bc3f8ca1), ULL(0x96f5600f15a7b7e5), ULL(0xbcb2b812db11a5de),
+  ULL(0xebdf661791d60f56), ULL(0x936b9fcebb25c995), ULL(0xb84687c269ef3bfb),
+  ULL(0xe65829b3046b0afa), ULL(0x8ff71a0fe2c2e6dc), ULL(0xb3f4e093db73a093),
+  ULL(0xe0f218b8d25088b8), ULL(0x8c974f7383725573), ULL(0xafbd2350644eeacf),
+  ULL(0xdbac6c247d62a583), ULL(0x894bc396ce5da772), ULL(0xab9eb47c81f5114f),
+  ULL(0xd686619ba27255a2), ULL(0x8613fd0145877585), ULL(0xa798fc4196e952e7),
+  ULL(0xd17f3b51fca3a7a0), ULL(0x82ef85133de648c4), ULL(0xa3ab66580d5fdaf5),
+  ULL(0xcc963fee10b7d1b3), ULL(0xffbbcfe994e5c61f), ULL(0x9fd561f1fd0f9bd3),
+  ULL(0xc7caba6e7c5382c8), ULL(0xf9bd690a1b68637b), ULL(0x9c1661a651213e2d),
+  ULL(0xc31bfa0fe5698db8), ULL(0xf3e2f893dec3f126), ULL(0x986ddb5c6b3a76b7),
+  ULL(0xbe89523386091465), ULL(0xee2ba6c0678b597f), ULL(0x94db483840b717ef),
+  ULL(0xba121a4650e4ddeb), ULL(0xe896a0d7e51e1566), ULL(0x915e2486ef32cd60),
+  ULL(0xb5b5ada8aaff80b8), ULL(0xe3231912d5bf60e6), ULL(0x8df5efabc5979c8f),
+  ULL(0xb1736b96b6fd83b3), ULL(0xddd0467c64bce4a0), ULL(0x8aa22c0dbef60ee4),
+  ULL(0xad4ab7112eb3929d), ULL(0xd89d64d57a607744), ULL(0x87625f056c7c4a8b),
+  ULL(0xa93af6c6c79b5d2d), ULL(0xd389b47879823479), ULL(0x843610cb4bf160cb),
+  ULL(0xa54394fe1eedb8fe), ULL(0xce947a3da6a9273e), ULL(0x811ccc668829b887),
+  ULL(0xa163ff802a3426a8), ULL(0xc9bcff6034c13052), ULL(0xfc2c3f3841f17c67),
+  ULL(0x9d9ba7832936edc0), ULL(0xc5029163f384a931), ULL(0xf64335bcf065d37d),
+  ULL(0x99ea0196163fa42e), ULL(0xc06481fb9bcf8d39), ULL(0xf07da27a82c37088),
+  ULL(0x964e858c91ba2655), ULL(0xbbe226efb628afea), ULL(0xeadab0aba3b2dbe5),
+  ULL(0x92c8ae6b464fc96f), ULL(0xb77ada0617e3bbcb), ULL(0xe55990879ddcaabd),
+  ULL(0x8f57fa54c2a9eab6), ULL(0xb32df8e9f3546564), ULL(0xdff9772470297ebd),
+  ULL(0x8bfbea76c619ef36), ULL(0xaefae51477a06b03), ULL(0xdab99e59958885c4),
+  ULL(0x88b402f7fd75539b), ULL(0xaae103b5fcd2a881), ULL(0xd59944a37c0752a2),
+  ULL(0x857fcae62d8493a5), ULL(0xa6dfbd9fb8e5b88e), ULL(0xd097ad07a71f26b2),
+  ULL(0x825ecc24c873782f), ULL(0xa2f67f2dfa90563b), ULL(0xcbb41ef979346bca),
+  ULL(0xfea126b7d78186bc), ULL(0x9f24b832e6b0f436), ULL(0xc6ede63fa05d3143),
+  ULL(0xf8a95fcf88747d94), ULL(0x9b69dbe1b548ce7c), ULL(0xc24452da229b021b),
+  ULL(0xf2d56790ab41c2a2), ULL(0x97c560ba6b0919a5), ULL(0xbdb6b8e905cb600f),
+  ULL(0xed246723473e3813), ULL(0x9436c0760c86e30b), ULL(0xb94470938fa89bce),
+  ULL(0xe7958cb87392c2c2), ULL(0x90bd77f3483bb9b9), ULL(0xb4ecd5f01a4aa828),
+  ULL(0xe2280b6c20dd5232), ULL(0x8d590723948a535f), ULL(0xb0af48ec79ace837),
+  ULL(0xdcdb1b2798182244), ULL(0x8a08f0f8bf0f156b), ULL(0xac8b2d36eed2dac5),
+  ULL(0xd7adf884aa879177), ULL(0x86ccbb52ea94baea), ULL(0xa87fea27a539e9a5),
+  ULL(0xd29fe4b18e88640e), ULL(0x83a3eeeef9153e89), ULL(0xa48ceaaab75a8e2b),
+  ULL(0xcdb02555653131b6), ULL(0x808e17555f3ebf11), ULL(0xa0b19d2ab70e6ed6),
+  ULL(0xc8de047564d20a8b), ULL(0xfb158592be068d2e), ULL(0x9ced737bb6c4183d),
+  ULL(0xc428d05aa4751e4c), ULL(0xf53304714d9265df), ULL(0x993fe2c6d07b7fab),
+  ULL(0xbf8fdb78849a5f96), ULL(0xef73d256a5c0f77c), ULL(0x95a8637627989aad),
+  ULL(0xbb127c53b17ec159), ULL(0xe9d71b689dde71af), ULL(0x9226712162ab070d),
+  ULL(0xb6b00d69bb55c8d1), ULL(0xe45c10c42a2b3b05), ULL(0x8eb98a7a9a5b04e3),
+  ULL(0xb267ed1940f1c61c), ULL(0xdf01e85f912e37a3), ULL(0x8b61313bbabce2c6),
+  ULL(0xae397d8aa96c1b77), ULL(0xd9c7dced53c72255), ULL(0x881cea14545c7575),
+  ULL(0xaa242499697392d2), ULL(0xd4ad2dbfc3d07787), ULL(0x84ec3c97da624ab4),
+  ULL(0xa6274bbdd0fadd61), ULL(0xcfb11ead453994ba), ULL(0x81ceb32c4b43fcf4),
+  ULL(0xa2425ff75e14fc31), ULL(0xcad2f7f5359a3b3e), ULL(0xfd87b5f28300ca0d),
+  ULL(0x9e74d1b791e07e48), ULL(0xc612062576589dda), ULL(0xf79687aed3eec551),
+  ULL(0x9abe14cd44753b52), ULL(0xc16d9a0095928a27), ULL(0xf1c90080baf72cb1),
+  ULL(0x971da05074da7bee), ULL(0xbce5086492111aea), ULL(0xec1e4a7db69561a5),
+  ULL(0x9392ee8e921d5d07), ULL(0xb877aa3236a4b449), ULL(0xe69594bec44de15b),
+  ULL(0x901d7cf73ab0acd9), ULL(0xb424dc35095cd80f), ULL(0xe12e13424bb40e13),
+  ULL(0x8cbccc096f5088cb), ULL(0xafebff0bcb24aafe), ULL(0xdbe6fecebdedd5be),
+  ULL(0x89705f4136b4a597), ULL(0xabcc77118461cefc), ULL(0xd6bf94d5e57a42bc),
+  ULL(0x8637bd05af6c69b5), ULL(0xa7c5ac471b478423), ULL(0xd1b71758e219652b),
+  ULL(0x83126e978d4fdf3b), ULL(0xa3d70a3d70a3d70a), ULL(0xcccccccccccccccc),
+  ULL(0x8000000000000000), ULL(0xa000000000000000), ULL(0xc800000000000000),
+  ULL(0xfa00000000000000), ULL(0x9c40000000000000), ULL(0xc350000000000000),
+  ULL(0xf424000000000000), ULL(0x9896800000000000), ULL(0xbebc200000000000),
+  ULL(0xee6b280000000000), ULL(0x9502f90000000000), ULL(0xba43b74000000000),
+  ULL(0xe8d4a51000000000), ULL(0x9184e72a00000000), ULL(0xb5e620f480000000),
+  ULL(0xe35fa931a0000000), ULL(0x8e1bc9bf04000000), ULL(0xb1a2bc2ec5000000),
+  ULL(0xde0b6b3a76400000), ULL(0x8ac7230489e80000), ULL(0xad78ebc5ac620000),
+  ULL(0xd8d726b7177a8000), ULL(0x878678326eac9000), ULL(0xa968163f0a57b400),
+  ULL(0xd3c21bcecceda100), ULL(0x84595161401484a0), ULL(0xa56fa5b99019a5c8),
+  ULL(0xcecb8f27f4200f3a), ULL(0x813f3978f8940984), ULL(0xa18f07d736b90be5),
+  ULL(0xc9f2c9cd04674ede), ULL(0xfc6f7c4045812296), ULL(0x9dc5ada82b70b59d),
+  ULL(0xc5371912364ce305), ULL(0xf684df56c3e01bc6), ULL(0x9a130b963a6c115c),
+  ULL(0xc097ce7bc90715b3), ULL(0xf0bdc21abb48db20), ULL(0x96769950b50d88f4),
+  ULL(0xbc143fa4e250eb31), ULL(0xeb194f8e1ae525fd), ULL(0x92efd1b8d0cf37be),
+  ULL(0xb7abc627050305ad), ULL(0xe596b7b0c643c719), ULL(0x8f7e32ce7bea5c6f),
+  ULL(0xb35dbf821ae4f38b), ULL(0xe0352f62a19e306e), ULL(0x8c213d9da502de45),
+  ULL(0xaf298d050e4395d6), ULL(0xdaf3f04651d47b4c), ULL(0x88d8762bf324cd0f),
+  ULL(0xab0e93b6efee0053), ULL(0xd5d238a4abe98068), ULL(0x85a36366eb71f041),
+  ULL(0xa70c3c40a64e6c51), ULL(0xd0cf4b50cfe20765), ULL(0x82818f1281ed449f),
+  ULL(0xa321f2d7226895c7), ULL(0xcbea6f8ceb02bb39), ULL(0xfee50b7025c36a08),
+  ULL(0x9f4f2726179a2245), ULL(0xc722f0ef9d80aad6), ULL(0xf8ebad2b84e0d58b),
+  ULL(0x9b934c3b330c8577), ULL(0xc2781f49ffcfa6d5), ULL(0xf316271c7fc3908a),
+  ULL(0x97edd871cfda3a56), ULL(0xbde94e8e43d0c8ec), ULL(0xed63a231d4c4fb27),
+  ULL(0x945e455f24fb1cf8), ULL(0xb975d6b6ee39e436), ULL(0xe7d34c64a9c85d44),
+  ULL(0x90e40fbeea1d3a4a), ULL(0xb51d13aea4a488dd), ULL(0xe264589a4dcdab14),
+  ULL(0x8d7eb76070a08aec), ULL(0xb0de65388cc8ada8), ULL(0xdd15fe86affad912),
+  ULL(0x8a2dbf142dfcc7ab), ULL(0xacb92ed9397bf996), ULL(0xd7e77a8f87daf7fb),
+  ULL(0x86f0ac99b4e8dafd), ULL(0xa8acd7c0222311bc), ULL(0xd2d80db02aabd62b),
+  ULL(0x83c7088e1aab65db), ULL(0xa4b8cab1a1563f52), ULL(0xcde6fd5e09abcf26),
+  ULL(0x80b05e5ac60b6178), ULL(0xa0dc75f1778e39d6), ULL(0xc913936dd571c84c),
+  ULL(0xfb5878494ace3a5f), ULL(0x9d174b2dcec0e47b), ULL(0xc45d1df942711d9a),
+  ULL(0xf5746577930d6500), ULL(0x9968bf6abbe85f20), ULL(0xbfc2ef456ae276e8),
+  ULL(0xefb3ab16c59b14a2), ULL(0x95d04aee3b80ece5), ULL(0xbb445da9ca61281f),
+  ULL(0xea1575143cf97226), ULL(0x924d692ca61be758), ULL(0xb6e0c377cfa2e12e),
+  ULL(0xe498f455c38b997a), ULL(0x8edf98b59a373fec), ULL(0xb2977ee300c50fe7),
+  ULL(0xdf3d5e9bc0f653e1), ULL(0x8b865b215899f46c), ULL(0xae67f1e9aec07187),
+  ULL(0xda01ee641a708de9), ULL(0x884134fe908658b2), ULL(0xaa51823e34a7eede),
+  ULL(0xd4e5e2cdc1d1ea96), ULL(0x850fadc09923329e), ULL(0xa6539930bf6bff45),
+  ULL(0xcfe87f7cef46ff16), ULL(0x81f14fae158c5f6e), ULL(0xa26da3999aef7749),
+  ULL(0xcb090c8001ab551c), ULL(0xfdcb4fa002162a63), ULL(0x9e9f11c4014dda7e),
+  ULL(0xc646d63501a1511d), ULL(0xf7d88bc24209a565), ULL(0x9ae757596946075f),
+  ULL(0xc1a12d2fc3978937), ULL(0xf209787bb47d6b84), ULL(0x9745eb4d50ce6332),
+  ULL(0xbd176620a501fbff), ULL(0xec5d3fa8ce427aff), ULL(0x93ba47c980e98cdf),
+  ULL(0xb8a8d9bbe123f017), ULL(0xe6d3102ad96cec1d), ULL(0x9043ea1ac7e41392),
+  ULL(0xb454e4a179dd1877), ULL(0xe16a1dc9d8545e94), ULL(0x8ce2529e2734bb1d),
+  ULL(0xb01ae745b101e9e4), ULL(0xdc21a1171d42645d), ULL(0x899504ae72497eba),
+  ULL(0xabfa45da0edbde69), ULL(0xd6f8d7509292d603), ULL(0x865b86925b9bc5c2),
+  ULL(0xa7f26836f282b732), ULL(0xd1ef0244af2364ff), ULL(0x8335616aed761f1f),
+  ULL(0xa402b9c5a8d3a6e7), ULL(0xcd036837130890a1), ULL(0x802221226be55a64),
+  ULL(0xa02aa96b06deb0fd), ULL(0xc83553c5c8965d3d), ULL(0xfa42a8b73abbf48c),
+  ULL(0x9c69a97284b578d7), ULL(0xc38413cf25e2d70d), ULL(0xf46518c2ef5b8cd1),
+  ULL(0x98bf2f79d5993802), ULL(0xbeeefb584aff8603), ULL(0xeeaaba2e5dbf6784),
+  ULL(0x952ab45cfa97a0b2), ULL(0xba756174393d88df), ULL(0xe912b9d1478ceb17),
+  ULL(0x91abb422ccb812ee), ULL(0xb616a12b7fe617aa), ULL(0xe39c49765fdf9d94),
+  ULL(0x8e41ade9fbebc27d), ULL(0xb1d219647ae6b31c), ULL(0xde469fbd99a05fe3),
+  ULL(0x8aec23d680043bee), ULL(0xada72ccc20054ae9), ULL(0xd910f7ff28069da4),
+  ULL(0x87aa9aff79042286), ULL(0xa99541bf57452b28), ULL(0xd3fa922f2d1675f2),
+  ULL(0x847c9b5d7c2e09b7), ULL(0xa59bc234db398c25), ULL(0xcf02b2c21207ef2e),
+  ULL(0x8161afb94b44f57d), ULL(0xa1ba1ba79e1632dc), ULL(0xca28a291859bbf93),
+  ULL(0xfcb2cb35e702af78), ULL(0x9defbf01b061adab), ULL(0xc56baec21c7a1916),
+  ULL(0xf6c69a72a3989f5b), ULL(0x9a3c2087a63f6399), ULL(0xc0cb28a98fcf3c7f),
+  ULL(0xf0fdf2d3f3c30b9f), ULL(0x969eb7c47859e743), ULL(0xbc4665b596706114),
+  ULL(0xeb57ff22fc0c7959), ULL(0x9316ff75dd87cbd8), ULL(0xb7dcbf5354e9bece),
+  ULL(0xe5d3ef282a242e81), ULL(0x8fa475791a569d10), ULL(0xb38d92d760ec4455),
+  ULL(0xe070f78d3927556a), ULL(0x8c469ab843b89562), ULL(0xaf58416654a6babb),
+  ULL(0xdb2e51bfe9d0696a), ULL(0x88fcf317f22241e2), ULL(0xab3c2fddeeaad25a),
+  ULL(0xd60b3bd56a5586f1), ULL(0x85c7056562757456), ULL(0xa738c6bebb12d16c),
+  ULL(0xd106f86e69d785c7), ULL(0x82a45b450226b39c), ULL(0xa34d721642b06084),
+  ULL(0xcc20ce9bd35c78a5), ULL(0xff290242c83396ce), ULL(0x9f79a169bd203e41),
+  ULL(0xc75809c42c684dd1), ULL(0xf92e0c3537826145), ULL(0x9bbcc7a142b17ccb),
+  ULL(0xc2abf989935ddbfe), ULL(0xf356f7ebf83552fe), ULL(0x98165af37b2153de),
+  ULL(0xbe1bf1b059e9a8d6), ULL(0xeda2ee1c7064130c), ULL(0x9485d4d1c63e8be7),
+  ULL(0xb9a74a0637ce2ee1), ULL(0xe8111c87c5c1ba99), ULL(0x910ab1d4db9914a0),
+  ULL(0xb54d5e4a127f59c8), ULL(0xe2a0b5dc971f303a), ULL(0x8da471a9de737e24),
+  ULL(0xb10d8e1456105dad), ULL(0xdd50f1996b947518), ULL(0x8a5296ffe33cc92f),
+  ULL(0xace73cbfdc0bfb7b), ULL(0xd8210befd30efa5a), ULL(0x8714a775e3e95c78),
+  ULL(0xa8d9d1535ce3b396), ULL(0xd31045a8341ca07c), ULL(0x83ea2b892091e44d),
+  ULL(0xa4e4b66b68b65d60), ULL(0xce1de40642e3f4b9), ULL(0x80d2ae83e9ce78f3),
+  ULL(0xa1075a24e4421730), ULL(0xc94930ae1d529cfc), ULL(0xfb9b7cd9a4a7443c),
+  ULL(0x9d412e0806e88aa5), ULL(0xc491798a08a2ad4e), ULL(0xf5b5d7ec8acb58a2),
+  ULL(0x9991a6f3d6bf1765), ULL(0xbff610b0cc6edd3f), ULL(0xeff394dcff8a948e),
+  ULL(0x95f83d0a1fb69cd9), ULL(0xbb764c4ca7a4440f), ULL(0xea53df5fd18d5513),
+  ULL(0x92746b9be2f8552c), ULL(0xb7118682dbb66a77), ULL(0xe4d5e82392a40515),
+  ULL(0x8f05b1163ba6832d), ULL(0xb2c71d5bca9023f8), ULL(0xdf78e4b2bd342cf6),
+  ULL(0x8bab8eefb6409c1a), ULL(0xae9672aba3d0c320), ULL(0xda3c0f568cc4f3e8),
+  ULL(0x8865899617fb1871), ULL(0xaa7eebfb9df9de8d), ULL(0xd51ea6fa85785631),
+  ULL(0x8533285c936b35de), ULL(0xa67ff273b8460356), ULL(0xd01fef10a657842c),
+  ULL(0x8213f56a67f6b29b), ULL(0xa298f2c501f45f42), ULL(0xcb3f2f7642717713),
+  ULL(0xfe0efb53d30dd4d7), ULL(0x9ec95d1463e8a506), ULL(0xc67bb4597ce2ce48),
+  ULL(0xf81aa16fdc1b81da), ULL(0x9b10a4e5e9913128), ULL(0xc1d4ce1f63f57d72),
+  ULL(0xf24a01a73cf2dccf), ULL(0x976e41088617ca01), ULL(0xbd49d14aa79dbc82),
+  ULL(0xec9c459d51852ba2), ULL(0x93e1ab8252f33b45), ULL(0xb8da1662e7b00a17),
+  ULL(0xe7109bfba19c0c9d), ULL(0x906a617d450187e2), ULL(0xb484f9dc9641e9da),
+  ULL(0xe1a63853bbd26451), ULL(0x8d07e33455637eb2), ULL(0xb049dc016abc5e5f),
+  ULL(0xdc5c5301c56b75f7), ULL(0x89b9b3e11b6329ba), ULL(0xac2820d9623bf429),
+  ULL(0xd732290fbacaf133), ULL(0x867f59a9d4bed6c0), ULL(0xa81f301449ee8c70),
+  ULL(0xd226fc195c6a2f8c), ULL(0x83585d8fd9c25db7), ULL(0xa42e74f3d032f525),
+  ULL(0xcd3a1230c43fb26f), ULL(0x80444b5e7aa7cf85), ULL(0xa0555e361951c366),
+  ULL(0xc86ab5c39fa63440), ULL(0xfa856334878fc150), ULL(0x9c935e00d4b9d8d2),
+  ULL(0xc3b8358109e84f07), ULL(0xf4a642e14c6262c8), ULL(0x98e7e9cccfbd7dbd),
+  ULL(0xbf21e44003acdd2c), ULL(0xeeea5d5004981478), ULL(0x95527a5202df0ccb),
+  ULL(0xbaa718e68396cffd), ULL(0xe950df20247c83fd), ULL(0x91d28b7416cdd27e),
+  ULL(0xb6472e511c81471d), ULL(0xe3d8f9e563a198e5), ULL(0x8e679c2f5e44ff8f)
+};
+
+/* Eisel-Lemire: the 128-bit product of the normalized w with the truncated
+ * 10^exp10 is at most w below the exact product, so it gives the 54 leading
+ * bits of the result unless that error can carry into them, or the result
+ * is a tie between two doubles.  Denormal results are left to the slow path.
+ */
+static bool _Stl_fast_atod(uint64 w, int exp10, double& x) {
+#if defined (_STLP_EXACT_DOUBLE_ARITHMETIC)
+  if (w <= (ULL(1) << 53) && exp10 >= -22 && exp10 <= 22) {
+    x = (double)w;
+    if (exp10 < 0)
+      x /= _Stl_exact_tenpow[-exp10];
+    else
+      x *= _Stl_exact_tenpow[exp10];
+    return true;
+  }
+#endif
+
+  if (w == 0 || exp10 < _STLP_FAST_ATOD_MIN_EXP10 || exp10 > _STLP_FAST_ATOD_MAX_EXP10)
+    return false;
+
+  int lead0 = 0;
+  while ((w & _Stl_HIBITULL) == 0) {
+    w <<= 1;
+    ++lead0;
+  }
+
+  uint64 prodhi, prodlo;
+  _Stl_mult64(w, _Stl_tenpow_hi[exp10 - _STLP_FAST_ATOD_MIN_EXP10], prodhi, prodlo);
+  if ((prodhi & 0x1ff) == 0x1ff && prodlo + w < prodlo)
+    return false;
+
+  /* 217706 / 2^16 ~ log2(10), the shift is a floor also for negative values. */
+  int upperbit = (int)(prodhi >> 63);
+  uint64 mantissa = prodhi >> (upperbit + 9);
+  int bexp = ((217706 * exp10) >> 16) + 63 + 1023 - lead0 + upperbit;
+
+  if (prodlo == 0 && (prodhi & 0x1ff) == 0 && (mantissa & 3) == 1)
+    return false;
+
+  /* Round the 54 bits to 53 */
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if ((mantissa >> 53) != 0) {
+    mantissa >>= 1;
+    ++bexp;
+  }
+  if (bexp <= 0 || bexp >= 0x7ff)
+    return false;
+
+  union {
+    uint64 ival;
+    double val;
+  } drep;
+  drep.ival = ((uint64)bexp << 52) | (mantissa & ((ULL(1) << 52) - 1));
+  x = drep.val;
+  return true;
 }
 
 #if !defined (__linux__) || defined (__ANDROID__)
@@ -227,8 +538,6 @@ static const short _Stl_twoexp[80] = {
 #define  NUM_HI_P 11
 #define  NUM_HI_N 13
 
-#define _Stl_HIBITULL (ULL(1) << 63)
-
 static void _Stl_norm_and_round(uint64& p, int& norm, uint64 prodhi, uint64 prodlo) {
   norm = 0;
   if ((prodhi & _Stl_HIBITULL) == 0) {
@@ -651,6 +960,8 @@ static double _Stl_string_to_double(const char *s) {
   int exp;
   int dpchar;
   char digits[max_digits];
+  uint64 w = 0;  /* the first _STLP_FAST_ATOD_DIGITS significant digits */
+  int nsig = 0;  /* number of significant digits */
 
   c = *s++;
 
@@ -671,6 +982,11 @@ static double _Stl_string_to_double(const char *s) {
   for (;;) {
     c -= '0';
     if (c < 10) {
+      if (c != 0 || d != digits) {
+        if (nsig < _STLP_FAST_ATOD_DIGITS)
+          w = w * 10 + c;
+        ++nsig;
+      }
       if (d == digits + max_digits) {
         /* ignore more than max_digits digits, but adjust exponent */
         exp += (decimal_point ^ 1);
@@ -730,7 +1046,8 @@ static double _Stl_string_to_double(const char *s) {
     /* Let _Stl_atod diagnose under- and over-flows.
      * If the input was == 0.0, we have already returned,
      * so retval of +-Inf signals OVERFLOW, 0.0 UNDERFLOW */
-    x = _Stl_atod(digits, n, exp);
+    if (nsig > _STLP_FAST_ATOD_DIGITS || !_Stl_fast_atod(w, exp + (int)n - nsig, x))
+      x = _Stl_atod(digits, n, exp);
   }
 
   if (Negate) {
@@ -757,6 +1074,8 @@ D _Stl_string_to_doubleT(const char *s)
   D x;
   int dpchar;
   char digits[max_digits];
+  uint64 w = 0;  /* the first _STLP_FAST_ATOD_DIGITS significant digits */
+  int nsig = 0;  /* number of significant digits */
 
   c = *s++;
 
@@ -777,6 +1096,11 @@ D _Stl_string_to_doubleT(const char *s)
   for (;;) {
     c -= '0';
     if (c < 10) {
+      if (c != 0 || d != digits) {
+        if (nsig < _STLP_FAST_ATOD_DIGITS)
+          w = w * 10 + c;
+        ++nsig;
+      }
       if (d == digits + max_digits) {
         /* ignore more than max_digits digits, but adjust exponent */
         exp += (decimal_point ^ 1);
@@ -834,7 +1158,12 @@ D _Stl_string_to_doubleT(const char *s)
     /* if the input was == 0.0, we have already returned,
        so retval of +-Inf signals OVERFLOW, 0.0 UNDERFLOW
     */
-    x = _Stl_atodT<D,IEEE,M,BIAS>(digits, n, exp);
+    double fast_x;
+    if (limits::digits == numeric_limits<double>::digits && nsig <= _STLP_FAST_ATOD_DIGITS &&
+        _Stl_fast_atod(w, exp + (int)n - nsig, fast_x))
+      x = D(fast_x);
+    else
+      x = _Stl_atodT<D,IEEE,M,BIAS>(digits, n, exp);
   }
 
   return Negate ? -x : x;
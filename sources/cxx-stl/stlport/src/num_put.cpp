@@ -18,6 +18,7 @@
 
 #include "stlport_prefix.h"
 
+#include <cstring>
 #include <locale>
 #include <ostream>
 
@@ -161,6 +162,95 @@ __insert_grouping(__iowstring &str, size_t group_pos, const string& grouping,
 }
 #endif
 
+///-------------------------------------
+
+// Integer output of char streams using the classic locale: no grouping, no
+// ctype widening, and the decimal digits are produced two at a time.
+static const char __digit_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+template <class _Unsigned>
+static char* _STLP_CALL
+__write_classic_decimal_backward(char* ptr, _Unsigned x) {
+  while (x >= 100) {
+    const char* pair = __digit_pairs + 2 * (unsigned)(x % 100);
+    x /= 100;
+    *--ptr = pair[1];
+    *--ptr = pair[0];
+  }
+  if (x >= 10) {
+    const char* pair = __digit_pairs + 2 * (unsigned)x;
+    *--ptr = pair[1];
+    *--ptr = pair[0];
+  }
+  else
+    *--ptr = (char)('0' + (unsigned)x);
+  return ptr;
+}
+
+template <class _Unsigned>
+static bool _STLP_CALL
+__put_classic_decimal(ostream& os, _Unsigned x, bool negative, bool& failed) {
+  // Only the flags num_put would honor differently are checked: the
+  // classic numpunct facet has no grouping.
+  const ios_base::fmtflags flags = os.flags();
+  const ios_base::fmtflags base = flags & ios_base::basefield;
+  if (!os._M_is_classic() || base == ios_base::oct || base == ios_base::hex ||
+      (flags & ios_base::showpos) != 0 || os.width() != 0)
+    return false;
+
+  char buf[sizeof(_Unsigned) * 3 + 2];
+  char* const bufend = buf + sizeof(buf);
+  char* beg = __write_classic_decimal_backward(bufend, x);
+  if (negative)
+    *--beg = '-';
+
+  const ptrdiff_t len = bufend - beg;
+  streambuf* sb = os.rdbuf();
+  char* next = sb->_M_pptr();
+  if (sb->_M_epptr() - next >= len) {
+    memcpy(next, beg, len);
+    sb->_M_pbump((int)len);
+    failed = false;
+  }
+  else
+    failed = sb->sputn(beg, len) != len;
+  return true;
+}
+
+_STLP_DECLSPEC bool _STLP_CALL
+__put_classic_num(ostream& os, long x, bool& failed) {
+  const bool negative = x < 0;
+  const unsigned long ux = __STATIC_CAST(unsigned long, x);
+  return __put_classic_decimal(os, negative ? 0 - ux : ux, negative, failed);
+}
+
+_STLP_DECLSPEC bool _STLP_CALL
+__put_classic_num(ostream& os, unsigned long x, bool& failed)
+{ return __put_classic_decimal(os, x, false, failed); }
+
+#if defined (_STLP_LONG_LONG)
+_STLP_DECLSPEC bool _STLP_CALL
+__put_classic_num(ostream& os, _STLP_LONG_LONG x, bool& failed) {
+  const bool negative = x < 0;
+  const unsigned _STLP_LONG_LONG ux = __STATIC_CAST(unsigned _STLP_LONG_LONG, x);
+  return __put_classic_decimal(os, negative ? 0 - ux : ux, negative, failed);
+}
+
+_STLP_DECLSPEC bool _STLP_CALL
+__put_classic_num(ostream& os, unsigned _STLP_LONG_LONG x, bool& failed)
+{ return __put_classic_decimal(os, x, false, failed); }
+#endif
+
 _STLP_MOVE_TO_STD_NAMESPACE
 
 //----------------------------------------------------------------------
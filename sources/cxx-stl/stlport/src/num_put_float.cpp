@@ -88,6 +88,23 @@
 #  define snprintf _snprintf
 #endif
 
+/* The shortest digits generator below needs IEEE 754 doubles and 64-bit
+ * integers. It can be disabled with _STLP_NO_SHORTEST_FLOAT_DIGITS.
+ */
+#if !defined (_STLP_NO_SHORTEST_FLOAT_DIGITS) && !defined (_CRAY) && \
+    (defined (__GNUC__) || defined (_STLP_MSVC))
+#  define _STLP_USE_SHORTEST_FLOAT_DIGITS
+#  include <cstring>
+#  if defined (_STLP_MSVC)
+typedef unsigned __int64 uint64;
+#    define ULL(x) x##Ui64
+#  else
+#    include <stdint.h>
+typedef uint64_t uint64;
+#    define ULL(x) x##ULL
+#  endif
+#endif
+
 _STLP_BEGIN_NAMESPACE
 
 _STLP_MOVE_TO_PRIV_NAMESPACE
@@ -473,15 +490,19 @@ static char* _Stl_fcvtR(long double x, int n, int* pt, int* sign, char* buf) {
 }
 #endif
 
+#endif /* !USE_SPRINTF_INSTEAD */
+
+#if !defined (USE_SPRINTF_INSTEAD) || defined (_STLP_USE_SHORTEST_FLOAT_DIGITS)
+
 //----------------------------------------------------------------------
 // num_put
 
 // __format_float formats a mantissa and exponent as returned by
 // one of the conversion functions (ecvt_r, fcvt_r, qecvt_r, qfcvt_r)
-// according to the specified precision and format flags.  This is
-// based on doprnt but is much simpler since it is concerned only
-// with floating point input and does not consider all formats.  It
-// also does not deal with blank padding, which is handled by
+// or by _Stl_shortest_digits according to the specified precision and
+// format flags.  This is based on doprnt but is much simpler since it is
+// concerned only with floating point input and does not consider all
+// formats.  It also does not deal with blank padding, which is handled by
 // __copy_float_and_fill.
 
 static size_t __format_float_scientific( __iostring& buf, const char *bp,
@@ -582,7 +603,8 @@ static size_t __format_float_fixed( __iostring &buf, const char *bp,
   return __group_pos;
 }
 
-#if defined (_STLP_USE_SIGN_HELPER)
+#if !defined (USE_SPRINTF_INSTEAD)
+#  if defined (_STLP_USE_SIGN_HELPER)
 template<class _FloatT>
 struct float_sign_helper {
   float_sign_helper(_FloatT __x)
@@ -603,13 +625,13 @@ private:
   unsigned short get_word_lower() const _STLP_NOTHROW
   { return _M_number._Words[(sizeof(_FloatT) >= 12 ? 10 : sizeof(_FloatT)) / sizeof(unsigned short) - 1]; }
   unsigned short get_sign_word() const _STLP_NOTHROW
-#  if defined (_STLP_BIG_ENDIAN)
+#    if defined (_STLP_BIG_ENDIAN)
   { return get_word_higher(); }
-#  else /* _STLP_LITTLE_ENDIAN */
+#    else /* _STLP_LITTLE_ENDIAN */
   { return get_word_lower(); }
-#  endif
+#    endif
 };
-#endif
+#  endif
 
 template <class _FloatT>
 static size_t __format_nan_or_inf(__iostring& buf, _FloatT x, ios_base::fmtflags flags) {
@@ -647,6 +669,7 @@ static size_t __format_nan_or_inf(__iostring& buf, _FloatT x, ios_base::fmtflags
   buf += inf_or_nan[flags & ios_base::uppercase ? 1 : 0];
   return ret;
 }
+#endif /* !USE_SPRINTF_INSTEAD */
 
 static inline size_t __format_float(__iostring &buf, const char * bp,
                                     int decpt, int sign, bool is_zero,
@@ -696,6 +719,324 @@ static inline size_t __format_float(__iostring &buf, const char * bp,
   return __group_pos;
 }
 
+#if defined (_STLP_USE_SHORTEST_FLOAT_DIGITS)
+/* _Stl_shortest_digits computes the shortest decimal digits that read back
+ * to the same double, using the Grisu3 algorithm of Florian Loitsch
+ * ("Printing Floating-Point Numbers Quickly and Accurately with Integers",
+ * PLDI 2010).  It works on 64-bit integers only and needs no buffer larger
+ * than the 17 digits of a double.  Grisu3 detects the rare cases (about
+ * 0.5%) where it cannot prove its result shortest and correctly rounded,
+ * it then returns false and the caller falls back to the C library.
+ */
+struct _Stl_diy_fp {
+  uint64 _M_f;
+  int _M_e;
+};
+
+static inline _Stl_diy_fp _Stl_diy_fp_make(uint64 f, int e) {
+  _Stl_diy_fp r;
+  r._M_f = f;
+  r._M_e = e;
+  return r;
+}
+
+// Upper 64 bits of the 128-bit product, rounded.
+static inline _Stl_diy_fp _Stl_diy_fp_mul(const _Stl_diy_fp& x, const _Stl_diy_fp& y) {
+  const uint64 low_mask = ULL(0xffffffff);
+  const uint64 a = x._M_f >> 32, b = x._M_f & low_mask;
+  const uint64 c = y._M_f >> 32, d = y._M_f & low_mask;
+  const uint64 ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+  uint64 tmp = (bd >> 32) + (ad & low_mask) + (bc & low_mask);
+  tmp += ULL(1) << 31;
+  return _Stl_diy_fp_make(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x._M_e + y._M_e + 64);
+}
+
+static inline _Stl_diy_fp _Stl_diy_fp_normalize(_Stl_diy_fp x) {
+  while ((x._M_f & ULL(0xffc0000000000000)) == 0) {
+    x._M_f <<= 10;
+    x._M_e -= 10;
+  }
+  while ((x._M_f & ULL(0x8000000000000000)) == 0) {
+    x._M_f <<= 1;
+    --x._M_e;
+  }
+  return x;
+}
+
+// Normalized 64-bit approximations of 10^k for k = -348, -340, ..., 340.
+struct _Stl_cached_power {
+  uint64 _M_f;
+  short _M_e;
+  short _M_k;
+};
+
+static const _Stl_cached_power _Stl_cached_powers[] = {
+  { ULL(0xfa8fd5a0081c0288), -1220, -348 },
+  { ULL(0xbaaee17fa23ebf76), -1193, -340 },
+  { ULL(0x8b16fb203055ac76), -1166, -332 },
+  { ULL(0xcf42894a5dce35ea), -1140, -324 },
+  { ULL(0x9a6bb0aa55653b2d), -1113, -316 },
+  { ULL(0xe61acf033d1a45df), -1087, -308 },
+  { ULL(0xab70fe17c79ac6ca), -1060, -300 },
+  { ULL(0xff77b1fcbebcdc4f), -1034, -292 },
+  { ULL(0xbe5691ef416bd60c), -1007, -284 },
+  { ULL(0x8dd01fad907ffc3c), -980, -276 },
+  { ULL(0xd3515c2831559a83), -954, -268 },
+  { ULL(0x9d71ac8fada6c9b5), -927, -260 },
+  { ULL(0xea9c227723ee8bcb), -901, -252 },
+  { ULL(0xaecc49914078536d), -874, -244 },
+  { ULL(0x823c12795db6ce57), -847, -236 },
+  { ULL(0xc21094364dfb5637), -821, -228 },
+  { ULL(0x9096ea6f3848984f), -794, -220 },
+  { ULL(0xd77485cb25823ac7), -768, -212 },
+  { ULL(0xa086cfcd97bf97f4), -741, -204 },
+  { ULL(0xef340a98172aace5), -715, -196 },
+  { ULL(0xb23867fb2a35b28e), -688, -188 },
+  { ULL(0x84c8d4dfd2c63f3b), -661, -180 },
+  { ULL(0xc5dd44271ad3cdba), -635, -172 },
+  { ULL(0x936b9fcebb25c996), -608, -164 },
+  { ULL(0xdbac6c247d62a584), -582, -156 },
+  { ULL(0xa3ab66580d5fdaf6), -555, -148 },
+  { ULL(0xf3e2f893dec3f126), -529, -140 },
+  { ULL(0xb5b5ada8aaff80b8), -502, -132 },
+  { ULL(0x87625f056c7c4a8b), -475, -124 },
+  { ULL(0xc9bcff6034c13053), -449, -116 },
+  { ULL(0x964e858c91ba2655), -422, -108 },
+  { ULL(0xdff9772470297ebd), -396, -100 },
+  { ULL(0xa6dfbd9fb8e5b88f), -369, -92 },
+  { ULL(0xf8a95fcf88747d94), -343, -84 },
+  { ULL(0xb94470938fa89bcf), -316, -76 },
+  { ULL(0x8a08f0f8bf0f156b), -289, -68 },
+  { ULL(0xcdb02555653131b6), -263, -60 },
+  { ULL(0x993fe2c6d07b7fac), -236, -52 },
+  { ULL(0xe45c10c42a2b3b06), -210, -44 },
+  { ULL(0xaa242499697392d3), -183, -36 },
+  { ULL(0xfd87b5f28300ca0e), -157, -28 },
+  { ULL(0xbce5086492111aeb), -130, -20 },
+  { ULL(0x8cbccc096f5088cc), -103, -12 },
+  { ULL(0xd1b71758e219652c), -77, -4 },
+  { ULL(0x9c40000000000000), -50, 4 },
+  { ULL(0xe8d4a51000000000), -24, 12 },
+  { ULL(0xad78ebc5ac620000), 3, 20 },
+  { ULL(0x813f3978f8940984), 30, 28 },
+  { ULL(0xc097ce7bc90715b3), 56, 36 },
+  { ULL(0x8f7e32ce7bea5c70), 83, 44 },
+  { ULL(0xd5d238a4abe98068), 109, 52 },
+  { ULL(0x9f4f2726179a2245), 136, 60 },
+  { ULL(0xed63a231d4c4fb27), 162, 68 },
+  { ULL(0xb0de65388cc8ada8), 189, 76 },
+  { ULL(0x83c7088e1aab65db), 216, 84 },
+  { ULL(0xc45d1df942711d9a), 242, 92 },
+  { ULL(0x924d692ca61be758), 269, 100 },
+  { ULL(0xda01ee641a708dea), 295, 108 },
+  { ULL(0xa26da3999aef774a), 322, 116 },
+  { ULL(0xf209787bb47d6b85), 348, 124 },
+  { ULL(0xb454e4a179dd1877), 375, 132 },
+  { ULL(0x865b86925b9bc5c2), 402, 140 },
+  { ULL(0xc83553c5c8965d3d), 428, 148 },
+  { ULL(0x952ab45cfa97a0b3), 455, 156 },
+  { ULL(0xde469fbd99a05fe3), 481, 164 },
+  { ULL(0xa59bc234db398c25), 508, 172 },
+  { ULL(0xf6c69a72a3989f5c), 534, 180 },
+  { ULL(0xb7dcbf5354e9bece), 561, 188 },
+  { ULL(0x88fcf317f22241e2), 588, 196 },
+  { ULL(0xcc20ce9bd35c78a5), 614, 204 },
+  { ULL(0x98165af37b2153df), 641, 212 },
+  { ULL(0xe2a0b5dc971f303a), 667, 220 },
+  { ULL(0xa8d9d1535ce3b396), 694, 228 },
+  { ULL(0xfb9b7cd9a4a7443c), 720, 236 },
+  { ULL(0xbb764c4ca7a44410), 747, 244 },
+  { ULL(0x8bab8eefb6409c1a), 774, 252 },
+  { ULL(0xd01fef10a657842c), 800, 260 },
+  { ULL(0x9b10a4e5e9913129), 827, 268 },
+  { ULL(0xe7109bfba19c0c9d), 853, 276 },
+  { ULL(0xac2820d9623bf429), 880, 284 },
+  { ULL(0x80444b5e7aa7cf85), 907, 292 },
+  { ULL(0xbf21e44003acdd2d), 933, 300 },
+  { ULL(0x8e679c2f5e44ff8f), 960, 308 },
+  { ULL(0xd433179d9c8cb841), 986, 316 },
+  { ULL(0x9e19db92b4e31ba9), 1013, 324 },
+  { ULL(0xeb96bf6ebadf77d9), 1039, 332 },
+  { ULL(0xaf87023b9bf0ee6b), 1066, 340 },
+};
+
+// Returns 10^-k such that the product with a normalized number of binary
+// exponent e has a binary exponent in [-60, -32].
+static inline _Stl_diy_fp _Stl_cached_power_for(int e, int* mk) {
+  const int min_target_e = -60;
+  int k = __STATIC_CAST(int, ceil((min_target_e - (e + 64) + 63) * 0.30102999566398114));
+  const _Stl_cached_power& p = _Stl_cached_powers[(348 + k - 1) / 8 + 1];
+  *mk = p._M_k;
+  return _Stl_diy_fp_make(p._M_f, p._M_e);
+}
+
+// Moves the last digit of buf towards w while it stays in the safe interval,
+// and checks that the result is unambiguous.
+static bool _Stl_round_weed(char* buf, int len, uint64 dist_too_high_w,
+                            uint64 unsafe_interval, uint64 rest,
+                            uint64 ten_kappa, uint64 unit) {
+  const uint64 small_dist = dist_too_high_w - unit;
+  const uint64 big_dist = dist_too_high_w + unit;
+  while (rest < small_dist && unsafe_interval - rest >= ten_kappa &&
+         (rest + ten_kappa < small_dist ||
+          small_dist - rest >= rest + ten_kappa - small_dist)) {
+    --buf[len - 1];
+    rest += ten_kappa;
+  }
+  if (rest < big_dist && unsafe_interval - rest >= ten_kappa &&
+      (rest + ten_kappa < big_dist ||
+       big_dist - rest > rest + ten_kappa - big_dist)) {
+    return false;
+  }
+  return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+static bool _Stl_digit_gen(const _Stl_diy_fp& low, const _Stl_diy_fp& w,
+                           const _Stl_diy_fp& high, char* buf, int* len, int* kappa) {
+  uint64 unit = 1;
+  const uint64 too_low = low._M_f - unit;
+  const uint64 too_high = high._M_f + unit;
+  uint64 unsafe_interval = too_high - too_low;
+  const int shift = -w._M_e;
+  const uint64 one = ULL(1) << shift;
+  unsigned int integrals = __STATIC_CAST(unsigned int, too_high >> shift);
+  uint64 fractionals = too_high & (one - 1);
+
+  unsigned int divisor = 1;
+  *kappa = 0;
+  if (integrals != 0) {
+    *kappa = 1;
+    while (integrals / divisor >= 10) {
+      divisor *= 10;
+      ++*kappa;
+    }
+  }
+
+  *len = 0;
+  while (*kappa > 0) {
+    buf[(*len)++] = (char)todigit(integrals / divisor);
+    integrals %= divisor;
+    --*kappa;
+    uint64 rest = (__STATIC_CAST(uint64, integrals) << shift) + fractionals;
+    if (rest < unsafe_interval) {
+      return _Stl_round_weed(buf, *len, too_high - w._M_f, unsafe_interval, rest,
+                             __STATIC_CAST(uint64, divisor) << shift, unit);
+    }
+    divisor /= 10;
+  }
+  for (;;) {
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+    buf[(*len)++] = (char)todigit(fractionals >> shift);
+    fractionals &= one - 1;
+    --*kappa;
+    if (fractionals < unsafe_interval) {
+      return _Stl_round_weed(buf, *len, (too_high - w._M_f) * unit, unsafe_interval,
+                             fractionals, one, unit);
+    }
+  }
+}
+
+// x must be finite, normal and positive, buf must hold 18 chars.
+static bool _Stl_shortest_digits(double x, char* buf, int* len, int* decpt) {
+  uint64 bits;
+  memcpy(&bits, &x, sizeof(bits));
+  const uint64 hidden_bit = ULL(0x0010000000000000);
+  const int biased_e = __STATIC_CAST(int, (bits >> 52) & 0x7ff);
+  const uint64 f = (bits & (hidden_bit - 1)) + hidden_bit;
+  const int e = biased_e - 1075;
+
+  // Boundaries of the rounding interval of x, the lower one is closer when
+  // x is a power of two.
+  _Stl_diy_fp m_plus = _Stl_diy_fp_normalize(_Stl_diy_fp_make((f << 1) + 1, e - 1));
+  _Stl_diy_fp m_minus = (f == hidden_bit && biased_e > 1) ? _Stl_diy_fp_make((f << 2) - 1, e - 2)
+                                                          : _Stl_diy_fp_make((f << 1) - 1, e - 1);
+  m_minus._M_f <<= m_minus._M_e - m_plus._M_e;
+  m_minus._M_e = m_plus._M_e;
+  _Stl_diy_fp w = _Stl_diy_fp_normalize(_Stl_diy_fp_make(f, e));
+
+  int mk;
+  _Stl_diy_fp ten_mk = _Stl_cached_power_for(w._M_e, &mk);
+  int kappa;
+  if (!_Stl_digit_gen(_Stl_diy_fp_mul(m_minus, ten_mk), _Stl_diy_fp_mul(w, ten_mk),
+                      _Stl_diy_fp_mul(m_plus, ten_mk), buf, len, &kappa))
+    return false;
+  buf[*len] = 0;
+  *decpt = *len + kappa - mk;
+  return true;
+}
+
+/* Formats x from its shortest digits when they give the same result as the
+ * correctly rounded conversion: either there are more digits than needed and
+ * rounding them cannot be mistaken, or all of them fit in at most DBL_DIG
+ * requested digits, the exact value then being the shortest digits followed
+ * by zeros as far as DBL_DIG digits are concerned.  Returns false, with buf
+ * untouched, when the conversion must go through the C library.
+ */
+static bool __write_float_shortest(__iostring &buf, ios_base::fmtflags flags, int precision,
+                                   double x, size_t& group_pos) {
+  uint64 bits;
+  memcpy(&bits, &x, sizeof(bits));
+  const int biased_e = __STATIC_CAST(int, (bits >> 52) & 0x7ff);
+  const bool is_zero = bits == 0;
+  // NaN, infinity, denormals and -0 are left to the C library.
+  if (precision < 0 || biased_e == 0x7ff || (biased_e == 0 && !is_zero))
+    return false;
+
+  char digits[18];
+  int len, decpt;
+  if (is_zero) {
+    digits[0] = '0';
+    digits[1] = 0;
+    len = decpt = 1;
+  }
+  else if (!_Stl_shortest_digits(x < 0 ? -x : x, digits, &len, &decpt))
+    return false;
+
+  int wanted;
+  switch (flags & ios_base::floatfield) {
+    case ios_base::fixed:
+      wanted = decpt + precision;
+      break;
+    case ios_base::scientific:
+      wanted = precision + 1;
+      break;
+    default:
+      if (precision == 0)
+        return false;
+      wanted = precision;
+      break;
+  }
+
+  if (len > wanted) {
+    // An exact tie would need the exact value to be rounded to even.
+    if (wanted <= 0 || (digits[wanted] == '5' && wanted + 1 == len))
+      return false;
+    bool round_up = digits[wanted] >= '5';
+    digits[wanted] = 0;
+    if (round_up) {
+      int i = wanted - 1;
+      while (i >= 0 && digits[i] == '9')
+        digits[i--] = '0';
+      if (i >= 0)
+        ++digits[i];
+      else {
+        // 99.9 rounded to 100.
+        digits[0] = '1';
+        digits[1] = 0;
+        ++decpt;
+      }
+    }
+  }
+  else if (len < wanted && wanted > DBL_DIG && !is_zero)
+    return false;
+
+  group_pos = __format_float(buf, digits, decpt, (bits >> 63) != 0, is_zero, flags, precision);
+  return true;
+}
+#endif /* _STLP_USE_SHORTEST_FLOAT_DIGITS */
+
 #endif
 
 #if defined (USE_SPRINTF_INSTEAD) || defined (_STLP_EMULATE_LONG_DOUBLE_CVT)
@@ -822,6 +1163,11 @@ static size_t  __write_floatT(__iostring &buf, ios_base::fmtflags flags, int pre
 size_t  _STLP_CALL
 __write_float(__iostring &buf, ios_base::fmtflags flags, int precision,
               double x) {
+#if defined (_STLP_USE_SHORTEST_FLOAT_DIGITS)
+  size_t group_pos;
+  if (__write_float_shortest(buf, flags, precision, x, group_pos))
+    return group_pos;
+#endif
   return __write_floatT(buf, flags, precision, x
 #if defined (USE_SPRINTF_INSTEAD)
                                                , 0
@@ -833,6 +1179,15 @@ __write_float(__iostring &buf, ios_base::fmtflags flags, int precision,
 size_t _STLP_CALL
 __write_float(__iostring &buf, ios_base::fmtflags flags, int precision,
               long double x) {
+#  if defined (_STLP_USE_SHORTEST_FLOAT_DIGITS)
+  // Only when long double is just another name for double.
+  if (numeric_limits<long double>::digits == numeric_limits<double>::digits &&
+      numeric_limits<long double>::max_exponent == numeric_limits<double>::max_exponent) {
+    size_t group_pos;
+    if (__write_float_shortest(buf, flags, precision, __STATIC_CAST(double, x), group_pos))
+      return group_pos;
+  }
+#  endif
   return __write_floatT(buf, flags, precision, x
 #if defined (USE_SPRINTF_INSTEAD)
                                                , 'L'
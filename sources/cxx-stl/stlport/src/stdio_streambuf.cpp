@@ -24,6 +24,7 @@
 #  include <sys/stat.h>
 #endif
 
+#include <cstring>
 #include <fstream>
 #include <limits>
 
@@ -49,6 +50,12 @@ _STLP_MOVE_TO_PRIV_NAMESPACE
 #  define FPOS_T   fpos64_t
 #endif
 
+// Largest part of n characters a single fread or fwrite call can transfer.
+static size_t __chunk_size(streamsize n) {
+  return (sizeof(streamsize) > sizeof(size_t)) ? __STATIC_CAST(size_t, (min)(__STATIC_CAST(streamsize, (numeric_limits<size_t>::max)()), n))
+                                               : __STATIC_CAST(size_t, n);
+}
+
 //----------------------------------------------------------------------
 // Class stdio_streambuf_base
 
@@ -153,6 +160,9 @@ stdio_istreambuf::~stdio_istreambuf() {}
 streamsize stdio_istreambuf::showmanyc()
 { return 0; }
 
+// Without a get area, formatted extraction peeks and takes characters one
+// at a time, through underflow() and uflow(): each costs one or two calls
+// to the C library.
 stdio_istreambuf::int_type stdio_istreambuf::underflow()
 {
 #ifdef _STLP_WCE
@@ -177,6 +187,20 @@ stdio_istreambuf::int_type stdio_istreambuf::uflow() {
   return c != EOF ? c : traits_type::eof();
 }
 
+// A single fread takes the characters from the FILE buffer, and reads the
+// file in blocks when the buffer runs out, under one lock of the FILE.
+streamsize stdio_istreambuf::xsgetn(char* s, streamsize n) {
+  streamsize result = 0;
+  while (result < n) {
+    size_t chunk = __chunk_size(n - result);
+    size_t nread = _STLP_VENDOR_CSTD::fread(s + result, 1, chunk, _M_file);
+    result += nread;
+    if (nread != chunk)
+      break;
+  }
+  return result;
+}
+
 stdio_istreambuf::int_type stdio_istreambuf::pbackfail(int_type c) {
   if (c != traits_type::eof()) {
     int result = _STLP_VENDOR_CSTD::ungetc(c, _M_file);
@@ -230,6 +254,38 @@ stdio_ostreambuf::int_type stdio_ostreambuf::overflow(int_type c) {
   }
 }
 
+streamsize stdio_ostreambuf::xsputn(const char* s, streamsize n) {
+  streamsize result = 0;
+  while (result < n) {
+    size_t chunk = __chunk_size(n - result);
+    size_t nwritten = _STLP_VENDOR_CSTD::fwrite(s + result, 1, chunk, _M_file);
+    result += nwritten;
+    if (nwritten != chunk)
+      break;
+  }
+  return result;
+}
+
+// Padding is written in blocks as well.
+streamsize stdio_ostreambuf::_M_xsputnc(char c, streamsize n) {
+  if (n <= 0)
+    return 0;
+
+  char buf[64];
+  const streamsize buf_size = sizeof(buf);
+  memset(buf, c, (size_t)(min)(n, buf_size));
+
+  streamsize result = 0;
+  while (result < n) {
+    size_t chunk = (size_t)(min)(n - result, buf_size);
+    size_t nwritten = _STLP_VENDOR_CSTD::fwrite(buf, 1, chunk, _M_file);
+    result += nwritten;
+    if (nwritten != chunk)
+      break;
+  }
+  return result;
+}
+
 _STLP_MOVE_TO_STD_NAMESPACE
 _STLP_END_NAMESPACE
 
@@ -24,6 +24,12 @@
 // Note that neither stdio_istreambuf nor stdio_ostreambuf is a template;
 // both classes are derived from basic_streambuf<char, char_traits<char> >.
 
+// Neither class has a get or put area of its own: anything they buffered
+// would be invisible to, or reordered with, the C stdio calls made on the
+// same FILE.  The buffer they share with C stdio is the FILE's one, and
+// blocks of characters are moved to and from it with a single fread or
+// fwrite call rather than with one getc or putc call per character.
+
 // Note: the imbue() member function is a no-op.  In particular, these
 // classes assume that codecvt<char, char, mbstate_t> is always an identity
 // transformation.  This is true of the default locale, and of all locales
@@ -79,6 +85,7 @@ protected:                      // Virtual functions from basic_streambuf.
   streamsize showmanyc();
   int_type underflow();
   int_type uflow();
+  streamsize xsgetn(char_type*, streamsize);
   virtual int_type pbackfail(int_type c = traits_type::eof());
 };
 
@@ -90,6 +97,8 @@ public:                         // Constructor, destructor.
 protected:                      // Virtual functions from basic_streambuf.
   streamsize showmanyc();
   int_type overflow(int_type c = traits_type::eof());
+  streamsize xsputn(const char_type*, streamsize);
+  streamsize _M_xsputnc(char_type, streamsize);
 };
 
 _STLP_MOVE_TO_STD_NAMESPACE
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Substring and character set searches of basic_string<char>.
+//
+// A substring is looked for 16 positions at a time by comparing its first
+// and last characters with the ones of the string at these positions; only
+// the positions where both match are then compared with memcmp.  The sets
+// are matched with a comparison per character for the small ones, and with
+// the nibble tables of string_search.h for the ASCII ones when the CPU has
+// a byte shuffle (SSSE3 pshufb, NEON vtbl).
+//
+// SSE2 is part of the x86 ABI, SSSE3 and NEON are looked for at run time
+// with the cpufeatures library.  The scalar code is used everywhere else.
+
+#include "stlport_prefix.h"
+
+#include <string>
+
+#include "string_search.h"
+
+#if defined (__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+#if defined (__ANDROID__)
+#  include "cpu_features.h"
+#endif
+
+_STLP_BEGIN_NAMESPACE
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+// Sets up to this size are matched with a comparison per character.
+#define _STLP_SMALL_CHAR_SET 4
+
+const char* _STLP_CALL
+__str_search_scalar(const char* __first, const char* __last,
+                    const char* __s, size_t __n) {
+  const char* const __last_start = __last - __n;
+  for (;;) {
+    __first = __STATIC_CAST(const char*, memchr(__first, (unsigned char)*__s,
+                                                __last_start - __first + 1));
+    if (__first == 0)
+      return __last;
+    if (memcmp(__first + 1, __s + 1, __n - 1) == 0)
+      return __first;
+    if (__first++ == __last_start)
+      return __last;
+  }
+}
+
+const char* _STLP_CALL
+__str_find_set_scalar(const char* __first, const char* __last,
+                      const char* __s, size_t __n, bool __not_of) {
+  unsigned char __hints[32];
+  memset(__hints, 0, sizeof(__hints));
+  for (; __n != 0; --__n, ++__s) {
+    const unsigned char __c = (unsigned char)*__s;
+    __hints[__c >> 3] |= (unsigned char)(1 << (__c & 7));
+  }
+  for (; __first != __last; ++__first) {
+    const unsigned char __c = (unsigned char)*__first;
+    if (((__hints[__c >> 3] & (1 << (__c & 7))) != 0) != __not_of)
+      break;
+  }
+  return __first;
+}
+
+#if defined (__SSE2__)
+
+// Loads the __len < 16 characters at __p, padded with zeros.
+static inline __m128i __load_partial(const char* __p, size_t __len) {
+  char __buf[16];
+  memset(__buf, 0, sizeof(__buf));
+  memcpy(__buf, __p, __len);
+  return _mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __buf));
+}
+
+static const char* _STLP_CALL
+__str_search_sse2(const char* __first, const char* __last,
+                  const char* __s, size_t __n) {
+  const __m128i __c_first = _mm_set1_epi8(__s[0]);
+  const __m128i __c_last = _mm_set1_epi8(__s[__n - 1]);
+  // A block reads up to the last character of a match at its 16th position.
+  for (; __STATIC_CAST(size_t, __last - __first) >= __n + 15; __first += 16) {
+    const __m128i __b_first = _mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __first));
+    const __m128i __b_last = _mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __first + __n - 1));
+    unsigned int __mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(__b_first, __c_first),
+                                                          _mm_cmpeq_epi8(__b_last, __c_last)));
+    for (; __mask != 0; __mask &= __mask - 1) {
+      const char* __cand = __first + __builtin_ctz(__mask);
+      if (memcmp(__cand + 1, __s + 1, __n - 2) == 0)
+        return __cand;
+    }
+  }
+  return __STATIC_CAST(size_t, __last - __first) >= __n ? __str_search_scalar(__first, __last, __s, __n)
+                                                        : __last;
+}
+
+static inline unsigned int __in_small_set_sse2(__m128i __x, __m128i __c0, __m128i __c1,
+                                               __m128i __c2, __m128i __c3) {
+  const __m128i __eq01 = _mm_or_si128(_mm_cmpeq_epi8(__x, __c0), _mm_cmpeq_epi8(__x, __c1));
+  const __m128i __eq23 = _mm_or_si128(_mm_cmpeq_epi8(__x, __c2), _mm_cmpeq_epi8(__x, __c3));
+  return _mm_movemask_epi8(_mm_or_si128(__eq01, __eq23));
+}
+
+static const char* _STLP_CALL
+__str_find_small_set_sse2(const char* __first, const char* __last,
+                          const char* __s, size_t __n, bool __not_of) {
+  // The set is padded with its first character.
+  const __m128i __c0 = _mm_set1_epi8(__s[0]);
+  const __m128i __c1 = _mm_set1_epi8(__s[1]);
+  const __m128i __c2 = _mm_set1_epi8(__s[__n > 2 ? 2 : 0]);
+  const __m128i __c3 = _mm_set1_epi8(__s[__n > 3 ? 3 : 0]);
+  const unsigned int __flip = __not_of ? 0xffff : 0;
+  for (; __last - __first >= 16; __first += 16) {
+    const __m128i __x = _mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __first));
+    const unsigned int __mask = __in_small_set_sse2(__x, __c0, __c1, __c2, __c3) ^ __flip;
+    if (__mask != 0)
+      return __first + __builtin_ctz(__mask);
+  }
+  if (__first != __last) {
+    const size_t __len = __last - __first;
+    const __m128i __x = __load_partial(__first, __len);
+    const unsigned int __mask = (__in_small_set_sse2(__x, __c0, __c1, __c2, __c3) ^ __flip) &
+                                ((1u << __len) - 1);
+    if (__mask != 0)
+      return __first + __builtin_ctz(__mask);
+  }
+  return __last;
+}
+
+static const char* _STLP_CALL
+__str_find_set_sse2(const char* __first, const char* __last,
+                    const char* __s, size_t __n, bool __not_of) {
+  if (__n <= _STLP_SMALL_CHAR_SET)
+    return __str_find_small_set_sse2(__first, __last, __s, __n, __not_of);
+  return __str_find_set_scalar(__first, __last, __s, __n, __not_of);
+}
+
+#  if defined (__ANDROID__) || defined (__SSSE3__)
+// pshufb is written in assembly so that this file does not need to be
+// built with -mssse3, it is only run when the CPU has it.
+static inline __m128i __pshufb(__m128i __tbl, __m128i __idx) {
+  __asm__("pshufb %1, %0" : "+x" (__tbl) : "xm" (__idx));
+  return __tbl;
+}
+
+static inline unsigned int __in_ascii_set_ssse3(__m128i __x, __m128i __tbl, __m128i __bits) {
+  const __m128i __nibble = _mm_set1_epi8(0x0f);
+  const __m128i __lo = _mm_and_si128(__x, __nibble);
+  const __m128i __hi = _mm_and_si128(_mm_srli_epi16(__x, 4), __nibble);
+  const __m128i __hit = _mm_and_si128(__pshufb(__tbl, __lo), __pshufb(__bits, __hi));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(__hit, _mm_setzero_si128())) ^ 0xffff;
+}
+
+static const char* _STLP_CALL
+__str_find_set_ssse3(const char* __first, const char* __last,
+                     const char* __s, size_t __n, bool __not_of) {
+  unsigned char __table[16];
+  if (__n <= _STLP_SMALL_CHAR_SET || !__str_nibble_table(__s, __n, __table))
+    return __str_find_set_sse2(__first, __last, __s, __n, __not_of);
+
+  const __m128i __tbl = _mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __table));
+  // Bit of a high nibble, none for the ones of the non ASCII characters.
+  const __m128i __bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+  const unsigned int __flip = __not_of ? 0xffff : 0;
+  for (; __last - __first >= 16; __first += 16) {
+    const __m128i __x = _mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __first));
+    const unsigned int __mask = __in_ascii_set_ssse3(__x, __tbl, __bits) ^ __flip;
+    if (__mask != 0)
+      return __first + __builtin_ctz(__mask);
+  }
+  if (__first != __last) {
+    const size_t __len = __last - __first;
+    const __m128i __x = __load_partial(__first, __len);
+    const unsigned int __mask = (__in_ascii_set_ssse3(__x, __tbl, __bits) ^ __flip) &
+                                ((1u << __len) - 1);
+    if (__mask != 0)
+      return __first + __builtin_ctz(__mask);
+  }
+  return __last;
+}
+#  endif /* __ANDROID__ || __SSSE3__ */
+
+#endif /* __SSE2__ */
+
+struct _Str_search_kernels {
+  _Str_search_fn _M_search;
+  _Str_find_set_fn _M_find_set;
+};
+
+static _Str_search_kernels __select_str_search_kernels() {
+  _Str_search_kernels __k;
+#if defined (__SSE2__)
+  __k._M_search = __str_search_sse2;
+  __k._M_find_set = __str_find_set_sse2;
+#  if defined (__ANDROID__)
+  if (android_getCpuFamily() == ANDROID_CPU_FAMILY_X86 &&
+      (android_getCpuFeatures() & ANDROID_CPU_X86_FEATURE_SSSE3) != 0)
+    __k._M_find_set = __str_find_set_ssse3;
+#  elif defined (__SSSE3__)
+  __k._M_find_set = __str_find_set_ssse3;
+#  endif
+#else
+  __k._M_search = __str_search_scalar;
+  __k._M_find_set = __str_find_set_scalar;
+#  if defined (__arm__) && defined (__ARM_ARCH_7A__)
+#    if defined (__ANDROID__)
+  if (android_getCpuFamily() == ANDROID_CPU_FAMILY_ARM &&
+      (android_getCpuFeatures() & ANDROID_CPU_ARM_FEATURE_NEON) != 0)
+#    endif
+  {
+    __k._M_search = __str_search_neon;
+    __k._M_find_set = __str_find_set_neon;
+  }
+#  endif
+#endif
+  return __k;
+}
+
+static const _Str_search_kernels& __str_search_kernels() {
+  static const _Str_search_kernels __kernels = __select_str_search_kernels();
+  return __kernels;
+}
+
+_STLP_DECLSPEC const char* _STLP_CALL
+__str_search_char(const char* __first, const char* __last, const char* __s, size_t __n) {
+  if (__n == 0)
+    return __first;
+  if (__n == 1) {
+    const char* __p = __STATIC_CAST(const char*, memchr(__first, (unsigned char)*__s, __last - __first));
+    return __p != 0 ? __p : __last;
+  }
+  return __str_search_kernels()._M_search(__first, __last, __s, __n);
+}
+
+_STLP_DECLSPEC const char* _STLP_CALL
+__str_find_set_char(const char* __first, const char* __last,
+                    const char* __s, size_t __n, bool __not_of) {
+  if (__n == 0)
+    return __not_of ? __first : __last;
+  if (__n == 1 && !__not_of) {
+    const char* __p = __STATIC_CAST(const char*, memchr(__first, (unsigned char)*__s, __last - __first));
+    return __p != 0 ? __p : __last;
+  }
+  if (__n == 1) {
+    for (; __first != __last && *__first == *__s; ++__first) {}
+    return __first;
+  }
+  return __str_search_kernels()._M_find_set(__first, __last, __s, __n, __not_of);
+}
+
+#undef _STLP_SMALL_CHAR_SET
+
+_STLP_MOVE_TO_STD_NAMESPACE
+_STLP_END_NAMESPACE
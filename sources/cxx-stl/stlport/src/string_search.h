@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The kernels behind __str_search_char and __str_find_set_char, see
+// string_search.cpp which picks them for the CPU it runs on.
+//
+// _Str_search_fn looks for [s, s + n) in [first, last), with 2 <= n and
+// n <= last - first.  _Str_find_set_fn looks for the first character of
+// [first, last) that is (or, if not_of, is not) in [s, s + n), with 2 <= n.
+// Both return last when there is no such position.
+
+#ifndef _STLP_STRING_SEARCH_H
+#define _STLP_STRING_SEARCH_H
+
+#include "stlport_prefix.h"
+
+#include <string.h>
+
+_STLP_BEGIN_NAMESPACE
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+typedef const char* (_STLP_CALL *_Str_search_fn)(const char* __first, const char* __last,
+                                                 const char* __s, size_t __n);
+typedef const char* (_STLP_CALL *_Str_find_set_fn)(const char* __first, const char* __last,
+                                                   const char* __s, size_t __n, bool __not_of);
+
+// The sets of ASCII characters are matched 16 characters at a time with two
+// table lookups: the low nibble of a character selects a byte of __tbl
+// whose bit i is set when the character with this low nibble and the high
+// nibble i is in the set.  Returns false for a set with other characters.
+inline bool __str_nibble_table(const char* __s, size_t __n, unsigned char* __tbl) {
+  memset(__tbl, 0, 16);
+  for (; __n != 0; --__n, ++__s) {
+    const unsigned char __c = (unsigned char)*__s;
+    if (__c & 0x80)
+      return false;
+    __tbl[__c & 0x0f] |= (unsigned char)(1 << (__c >> 4));
+  }
+  return true;
+}
+
+// The portable kernels, also used by the vector ones for the cases they
+// don't handle.
+const char* _STLP_CALL __str_search_scalar(const char* __first, const char* __last,
+                                           const char* __s, size_t __n);
+const char* _STLP_CALL __str_find_set_scalar(const char* __first, const char* __last,
+                                             const char* __s, size_t __n, bool __not_of);
+
+#if defined (__arm__) && defined (__ARM_ARCH_7A__)
+// string_search_neon.cpp, built with NEON enabled.
+const char* _STLP_CALL __str_search_neon(const char* __first, const char* __last,
+                                         const char* __s, size_t __n);
+const char* _STLP_CALL __str_find_set_neon(const char* __first, const char* __last,
+                                           const char* __s, size_t __n, bool __not_of);
+#endif
+
+_STLP_MOVE_TO_STD_NAMESPACE
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_STRING_SEARCH_H */
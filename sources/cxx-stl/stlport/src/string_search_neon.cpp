@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// NEON versions of the string_search.cpp kernels.  This file is built with
+// NEON enabled for armeabi-v7a, and the kernels are only called when the
+// CPU has it.
+
+#include "stlport_prefix.h"
+
+#include <string>
+
+#include "string_search.h"
+
+#if defined (__arm__) && defined (__ARM_ARCH_7A__)
+
+#if !defined (__ARM_NEON__)
+#  error "string_search_neon.cpp must be built with NEON enabled (-mfpu=neon)"
+#endif
+
+#include <arm_neon.h>
+
+_STLP_BEGIN_NAMESPACE
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+// Bit i of the result is set when byte i of __v, made of 0x00 and 0xff
+// bytes, is 0xff: the equivalent of the SSE2 movemask.
+static inline unsigned int __movemask(uint8x16_t __v) {
+  static const unsigned char __bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128,
+                                            1, 2, 4, 8, 16, 32, 64, 128 };
+  const uint8x16_t __m = vandq_u8(__v, vld1q_u8(__bits));
+  uint8x8_t __p = vpadd_u8(vget_low_u8(__m), vget_high_u8(__m));
+  __p = vpadd_u8(__p, __p);
+  __p = vpadd_u8(__p, __p);
+  return vget_lane_u8(__p, 0) | (vget_lane_u8(__p, 1) << 8);
+}
+
+static inline bool __any(uint8x16_t __v) {
+  const uint32x2_t __or = vreinterpret_u32_u8(vorr_u8(vget_low_u8(__v), vget_high_u8(__v)));
+  return (vget_lane_u32(__or, 0) | vget_lane_u32(__or, 1)) != 0;
+}
+
+// Loads the __len < 16 characters at __p, padded with zeros.
+static inline uint8x16_t __load_partial(const char* __p, size_t __len) {
+  unsigned char __buf[16];
+  memset(__buf, 0, sizeof(__buf));
+  memcpy(__buf, __p, __len);
+  return vld1q_u8(__buf);
+}
+
+const char* _STLP_CALL
+__str_search_neon(const char* __first, const char* __last,
+                  const char* __s, size_t __n) {
+  const uint8x16_t __c_first = vdupq_n_u8((unsigned char)__s[0]);
+  const uint8x16_t __c_last = vdupq_n_u8((unsigned char)__s[__n - 1]);
+  for (; __STATIC_CAST(size_t, __last - __first) >= __n + 15; __first += 16) {
+    const uint8x16_t __b_first = vld1q_u8(__REINTERPRET_CAST(const unsigned char*, __first));
+    const uint8x16_t __b_last = vld1q_u8(__REINTERPRET_CAST(const unsigned char*, __first + __n - 1));
+    const uint8x16_t __eq = vandq_u8(vceqq_u8(__b_first, __c_first), vceqq_u8(__b_last, __c_last));
+    if (!__any(__eq))
+      continue;
+    for (unsigned int __mask = __movemask(__eq); __mask != 0; __mask &= __mask - 1) {
+      const char* __cand = __first + __builtin_ctz(__mask);
+      if (memcmp(__cand + 1, __s + 1, __n - 2) == 0)
+        return __cand;
+    }
+  }
+  if (__STATIC_CAST(size_t, __last - __first) < __n)
+    return __last;
+  return __str_search_scalar(__first, __last, __s, __n);
+}
+
+// Sets of ASCII characters, with the nibble tables of string_search.h, and
+// sets of up to 4 characters.
+struct _Neon_char_set {
+  bool _M_ascii;
+  uint8x8x2_t _M_tbl;
+  uint8x8x2_t _M_bits;
+  uint8x16_t _M_c[4];
+
+  uint8x16_t _M_match(uint8x16_t __x) const {
+    if (_M_ascii) {
+      const uint8x16_t __lo = vandq_u8(__x, vdupq_n_u8(0x0f));
+      const uint8x16_t __hi = vshrq_n_u8(__x, 4);
+      const uint8x8_t __hit_lo = vand_u8(vtbl2_u8(_M_tbl, vget_low_u8(__lo)),
+                                         vtbl2_u8(_M_bits, vget_low_u8(__hi)));
+      const uint8x8_t __hit_hi = vand_u8(vtbl2_u8(_M_tbl, vget_high_u8(__lo)),
+                                         vtbl2_u8(_M_bits, vget_high_u8(__hi)));
+      return vtstq_u8(vcombine_u8(__hit_lo, __hit_hi), vdupq_n_u8(0xff));
+    }
+    return vorrq_u8(vorrq_u8(vceqq_u8(__x, _M_c[0]), vceqq_u8(__x, _M_c[1])),
+                    vorrq_u8(vceqq_u8(__x, _M_c[2]), vceqq_u8(__x, _M_c[3])));
+  }
+};
+
+const char* _STLP_CALL
+__str_find_set_neon(const char* __first, const char* __last,
+                    const char* __s, size_t __n, bool __not_of) {
+  _Neon_char_set __set;
+  unsigned char __table[16];
+  __set._M_ascii = __str_nibble_table(__s, __n, __table);
+  if (__set._M_ascii) {
+    static const unsigned char __bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128,
+                                              0, 0, 0, 0, 0, 0, 0, 0 };
+    __set._M_tbl.val[0] = vld1_u8(__table);
+    __set._M_tbl.val[1] = vld1_u8(__table + 8);
+    __set._M_bits.val[0] = vld1_u8(__bits);
+    __set._M_bits.val[1] = vld1_u8(__bits + 8);
+  }
+  else if (__n <= 4) {
+    // The set is padded with its first character.
+    for (size_t __i = 0; __i < 4; ++__i)
+      __set._M_c[__i] = vdupq_n_u8((unsigned char)__s[__i < __n ? __i : 0]);
+  }
+  else {
+    // Large sets of any characters.
+    return __str_find_set_scalar(__first, __last, __s, __n, __not_of);
+  }
+
+  for (; __last - __first >= 16; __first += 16) {
+    uint8x16_t __m = __set._M_match(vld1q_u8(__REINTERPRET_CAST(const unsigned char*, __first)));
+    if (__not_of)
+      __m = vmvnq_u8(__m);
+    if (__any(__m))
+      return __first + __builtin_ctz(__movemask(__m));
+  }
+  if (__first != __last) {
+    const size_t __len = __last - __first;
+    uint8x16_t __m = __set._M_match(__load_partial(__first, __len));
+    if (__not_of)
+      __m = vmvnq_u8(__m);
+    const unsigned int __mask = __movemask(__m) & ((1u << __len) - 1);
+    if (__mask != 0)
+      return __first + __builtin_ctz(__mask);
+  }
+  return __last;
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+_STLP_END_NAMESPACE
+
+#endif /* __arm__ && __ARM_ARCH_7A__ */
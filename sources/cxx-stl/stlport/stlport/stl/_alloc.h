@@ -141,7 +141,22 @@ enum { _MAX_BYTES = 256 };
 enum { _MAX_BYTES = 32 * sizeof(void*) };
 #  endif
 
+// Number of size classes of the node allocator, _MAX_BYTES / _ALIGN.
+#define _STLP_NFREELISTS 16
+
 #if !defined (_STLP_USE_NO_IOSTREAMS)
+// Statistics of the node allocator, see __node_alloc::get_stats().
+// Nodes cached by threads are counted as allocated, not as free.
+struct __node_alloc_stats {
+  enum { size_classes = _STLP_NFREELISTS };
+  size_t node_size[size_classes];   // size of the nodes of each size class
+  size_t bytes[size_classes];       // bytes carved out of chunks for each size class
+  size_t free_nodes[size_classes];  // length of the shared free list of each size class
+  size_t chunk_count;               // number of chunks of memory
+  size_t heap_bytes;                // bytes in chunks
+  size_t heap_high_watermark;       // highest value of heap_bytes
+};
+
 // Default node allocator.
 // With a reasonable compiler, this should be roughly as fast as the
 // original STL class-specific allocators, but with less fragmentation.
@@ -159,6 +174,14 @@ public:
   /* __p may not be 0 */
   static void _STLP_CALL deallocate(void *__p, size_t __n)
   { if (__n > (size_t)_MAX_BYTES) __stl_delete(__p); else _M_deallocate(__p, __n); }
+
+  // Gives the chunks of memory that only contain free nodes back to the
+  // system, and returns the number of bytes released.
+  static size_t _STLP_CALL trim();
+  // Makes deallocations call trim() each time the shared free lists have
+  // grown by more than __bytes since the last trim. 0, the default, disables it.
+  static void _STLP_CALL set_trim_threshold(size_t __bytes);
+  static void _STLP_CALL get_stats(__node_alloc_stats& __stats);
 };
 
 #  if defined (_STLP_USE_TEMPLATE_EXPORT)
@@ -178,6 +178,17 @@ inline void _Move_Construct(_T1* __p, _T2& __val) {
   _Move_Construct_Aux(__p, __val, _Is_POD(__p)._Answer());
 }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+// In place construction from any arguments, used by the emplace members.
+template <class _T1, class... _Args>
+inline void _Construct_Forward(_T1* __p, _Args&&... __args) {
+#  if defined (_STLP_DEBUG_UNINITIALIZED)
+  memset((char*)__p, _STLP_SHRED_BYTE, sizeof(_T1));
+#  endif
+  new(__p) _T1(_STLP_STD::forward<_Args>(__args)...);
+}
+#endif
+
 #if defined(_STLP_NEW_REDEFINE)
 #  if defined (DEBUG_NEW)
 #    define new DEBUG_NEW
@@ -246,11 +246,19 @@ __iterator__ deque<_Tp,_Alloc>::_M_erase(iterator __pos,
   ++__next;
   difference_type __index = __pos - this->_M_start;
   if (size_type(__index) < this->size() >> 1) {
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+    _STLP_PRIV __move_assign_backward(this->_M_start, __pos, __next);
+#else
     copy_backward(this->_M_start, __pos, __next);
+#endif
     pop_front();
   }
   else {
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+    _STLP_PRIV __move_assign(__next, this->_M_finish, __pos);
+#else
     _STLP_STD::copy(__next, this->_M_finish, __pos);
+#endif
     pop_back();
   }
   return this->_M_start + __index;
@@ -326,14 +334,22 @@ __iterator__ deque<_Tp,_Alloc>::_M_erase(iterator __first, iterator __last,
   difference_type __n = __last - __first;
   difference_type __elems_before = __first - this->_M_start;
   if (__elems_before <= difference_type(this->size() - __n) / 2) {
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+    _STLP_PRIV __move_assign_backward(this->_M_start, __first, __last);
+#else
     copy_backward(this->_M_start, __first, __last);
+#endif
     iterator __new_start = this->_M_start + __n;
     _STLP_STD::_Destroy_Range(this->_M_start, __new_start);
     this->_M_destroy_nodes(this->_M_start._M_node, __new_start._M_node);
     this->_M_start = __new_start;
   }
   else {
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+    _STLP_PRIV __move_assign(__last, this->_M_finish, __first);
+#else
     _STLP_STD::copy(__last, this->_M_finish, __first);
+#endif
     iterator __new_finish = this->_M_finish - __n;
     _STLP_STD::_Destroy_Range(__new_finish, this->_M_finish);
     this->_M_destroy_nodes(__new_finish._M_node + 1, this->_M_finish._M_node + 1);
@@ -438,6 +454,66 @@ void deque<_Tp,_Alloc>::_M_push_front_aux() {
 }
 #endif /*_STLP_DONT_SUP_DFLT_PARAM && !_STLP_NO_ANACHRONISMS*/
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+// Called only if this->_M_finish._M_cur == this->_M_finish._M_last - 1.
+template <class _Tp, class _Alloc >
+template <class... _Args>
+void deque<_Tp,_Alloc>::_M_emplace_back_aux(_Args&&... __args) {
+  _M_reserve_map_at_back();
+  *(this->_M_finish._M_node + 1) = this->_M_map_size.allocate(this->buffer_size());
+  _STLP_TRY {
+    _Construct_Forward(this->_M_finish._M_cur, _STLP_STD::forward<_Args>(__args)...);
+    this->_M_finish._M_set_node(this->_M_finish._M_node + 1);
+    this->_M_finish._M_cur = this->_M_finish._M_first;
+  }
+  _STLP_UNWIND(this->_M_map_size.deallocate(*(this->_M_finish._M_node + 1),
+                                            this->buffer_size()))
+}
+
+// Called only if this->_M_start._M_cur == this->_M_start._M_first.
+template <class _Tp, class _Alloc >
+template <class... _Args>
+void deque<_Tp,_Alloc>::_M_emplace_front_aux(_Args&&... __args) {
+  _M_reserve_map_at_front();
+  *(this->_M_start._M_node - 1) = this->_M_map_size.allocate(this->buffer_size());
+  _STLP_TRY {
+    this->_M_start._M_set_node(this->_M_start._M_node - 1);
+    this->_M_start._M_cur = this->_M_start._M_last - 1;
+    _Construct_Forward(this->_M_start._M_cur, _STLP_STD::forward<_Args>(__args)...);
+  }
+  _STLP_UNWIND((++this->_M_start,
+                this->_M_map_size.deallocate(*(this->_M_start._M_node - 1), this->buffer_size())))
+}
+
+// Inserts __x in the middle of the deque, moving the elements of the
+// shorter side one place towards the end they are closest to.
+template <class _Tp, class _Alloc >
+__iterator__ deque<_Tp,_Alloc>::_M_emplace_aux(iterator __pos, value_type& __x) {
+  const difference_type __index = __pos - this->_M_start;
+  if (size_type(__index) < this->size() / 2) {
+    emplace_front(_STLP_STD::move(front()));
+    __pos = this->_M_start + __index;
+    iterator __dst = this->_M_start;
+    for (++__dst; __dst != __pos; ++__dst) {
+      iterator __src = __dst;
+      *__dst = _STLP_STD::move(*++__src);
+    }
+  }
+  else {
+    emplace_back(_STLP_STD::move(back()));
+    __pos = this->_M_start + __index;
+    iterator __dst = this->_M_finish;
+    --__dst;
+    for (--__dst; __dst != __pos; --__dst) {
+      iterator __src = __dst;
+      *__dst = _STLP_STD::move(*--__src);
+    }
+  }
+  *__pos = _STLP_STD::move(__x);
+  return __pos;
+}
+#endif
+
 // Called only if this->_M_finish._M_cur == this->_M_finish._M_first.
 template <class _Tp, class _Alloc >
 void deque<_Tp,_Alloc>::_M_pop_back_aux() {
@@ -563,10 +563,24 @@ public:
   {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  // An empty deque owns a map, the source gets the one allocated here.
+  deque(_Self&& __x)
+    : _STLP_PRIV _Deque_base<_Tp, _Alloc>(__x.get_allocator(), 0)
+  { swap(__x); }
+#endif
+
   ~deque()
   { _STLP_STD::_Destroy_Range(this->_M_start, this->_M_finish); }
 
   _Self& operator= (const _Self& __x);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator= (_Self&& __x) {
+    swap(__x);
+    __x.clear();
+    return *this;
+  }
+#endif
 
   void swap(_Self& __x) {
     _STLP_STD::swap(this->_M_start, __x._M_start);
@@ -708,6 +722,32 @@ public:                         // push_* and pop_*
   }
 #endif /*_STLP_DONT_SUP_DFLT_PARAM && !_STLP_NO_ANACHRONISMS*/
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  void push_back(value_type&& __t)
+  { emplace_back(_STLP_STD::move(__t)); }
+  void push_front(value_type&& __t)
+  { emplace_front(_STLP_STD::move(__t)); }
+
+  template <class... _Args>
+  void emplace_back(_Args&&... __args) {
+    if (this->_M_finish._M_cur != this->_M_finish._M_last - 1) {
+      _Construct_Forward(this->_M_finish._M_cur, _STLP_STD::forward<_Args>(__args)...);
+      ++this->_M_finish._M_cur;
+    }
+    else
+      _M_emplace_back_aux(_STLP_STD::forward<_Args>(__args)...);
+  }
+  template <class... _Args>
+  void emplace_front(_Args&&... __args) {
+    if (this->_M_start._M_cur != this->_M_start._M_first) {
+      _Construct_Forward(this->_M_start._M_cur - 1, _STLP_STD::forward<_Args>(__args)...);
+      --this->_M_start._M_cur;
+    }
+    else
+      _M_emplace_front_aux(_STLP_STD::forward<_Args>(__args)...);
+  }
+#endif
+
   void pop_back() {
     if (this->_M_finish._M_cur != this->_M_finish._M_first) {
       --this->_M_finish._M_cur;
@@ -757,6 +797,30 @@ public:                         // Insert
   void insert(iterator __pos, size_type __n, const value_type& __x)
   { _M_fill_insert(__pos, __n, __x); }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  iterator insert(iterator __pos, value_type&& __x)
+  { return emplace(__pos, _STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  iterator emplace(iterator __pos, _Args&&... __args) {
+    if (__pos._M_cur == this->_M_start._M_cur) {
+      emplace_front(_STLP_STD::forward<_Args>(__args)...);
+      return this->_M_start;
+    }
+    else if (__pos._M_cur == this->_M_finish._M_cur) {
+      emplace_back(_STLP_STD::forward<_Args>(__args)...);
+      iterator __tmp = this->_M_finish;
+      --__tmp;
+      return __tmp;
+    }
+    else {
+      // The arguments might be elements that are about to be shifted.
+      value_type __x_copy(_STLP_STD::forward<_Args>(__args)...);
+      return _M_emplace_aux(__pos, __x_copy);
+    }
+  }
+#endif
+
 protected:
   iterator _M_fill_insert_aux(iterator __pos, size_type __n, const value_type& __x, const __true_type& /*_Movable*/);
   iterator _M_fill_insert_aux(iterator __pos, size_type __n, const value_type& __x, const __false_type& /*_Movable*/);
@@ -894,6 +958,13 @@ protected:                        // Internal push_* and pop_*
 
   void _M_push_back_aux_v(const value_type&);
   void _M_push_front_aux_v(const value_type&);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  template <class... _Args>
+  void _M_emplace_back_aux(_Args&&... __args);
+  template <class... _Args>
+  void _M_emplace_front_aux(_Args&&... __args);
+  iterator _M_emplace_aux(iterator __pos, value_type& __x);
+#endif
 #if defined (_STLP_DONT_SUP_DFLT_PARAM) && !defined (_STLP_NO_ANACHRONISMS)
   void _M_push_back_aux();
   void _M_push_front_aux();
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2013
+ * The Android Open Source Project
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+#ifndef _STLP_FLAT_HASHTABLE_C
+#define _STLP_FLAT_HASHTABLE_C
+
+#ifndef _STLP_INTERNAL_FLAT_HASHTABLE_H
+#  include <stl/_flat_hashtable.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+#define __flat_hashtable__ _Flat_hashtable<_Val, _Key, _HF, _Traits, _ExK, _EqK, _All>
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+size_t
+__flat_hashtable__::_M_find_free_slot(size_t __h) const {
+  const _Flat_hash_ctrl* __ctrl = _M_ctrl._M_data;
+  size_type __offset = (__h >> 7) & _M_capacity;
+  for (size_type __index = 0; ; ) {
+    unsigned int __m = _Group(__ctrl + __offset)._M_match_empty_or_deleted();
+    if (__m != 0)
+      return (__offset + __flat_hash_lowest_bit(__m)) & _M_capacity;
+    __index += _S_width;
+    __offset = (__offset + __index) & _M_capacity;
+  }
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+size_t
+__flat_hashtable__::_M_prepare_insert(size_t __h) {
+  size_type __i = _M_capacity != 0 ? _M_find_free_slot(__h) : 0;
+  if (_M_growth_left == 0 &&
+      (_M_capacity == 0 || _M_ctrl._M_data[__i] != _S_flat_hash_deleted)) {
+    if (_M_capacity > _S_width && _M_num_elements * 32 <= _M_capacity * 25) {
+      // Mostly deleted slots: rehash in place to get rid of them.
+      _M_rehash(_M_capacity);
+    } else {
+      _M_rehash(_M_capacity * 2 + 1);
+    }
+    __i = _M_find_free_slot(__h);
+  }
+  if (_M_ctrl._M_data[__i] == _S_flat_hash_empty)
+    --_M_growth_left;
+  return __i;
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::_M_initialize(size_type __capacity) {
+  _M_capacity = __capacity;
+  _M_growth_left = 0;
+  _M_ctrl._M_data = 0;
+  _M_slots._M_data = 0;
+  if (__capacity == 0)
+    return;
+  _M_ctrl._M_data = _M_ctrl.allocate(__capacity + _S_width);
+  _STLP_TRY {
+    _M_slots._M_data = _M_slots.allocate(__capacity);
+  }
+  _STLP_UNWIND((_M_ctrl.deallocate(_M_ctrl._M_data, __capacity + _S_width),
+                _M_ctrl._M_data = 0, _M_capacity = 0))
+  memset(_M_ctrl._M_data, _S_flat_hash_empty, __capacity + _S_width);
+  _M_ctrl._M_data[__capacity] = _S_flat_hash_sentinel;
+  _M_growth_left = _S_capacity_to_growth(__capacity) - _M_num_elements;
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::_M_rehash(size_type __new_capacity) {
+  _Flat_hash_ctrl* __old_ctrl = _M_ctrl._M_data;
+  _Val* __old_slots = _M_slots._M_data;
+  size_type __old_capacity = _M_capacity;
+  size_type __old_growth_left = _M_growth_left;
+
+  _STLP_TRY {
+    _M_initialize(__new_capacity);
+  }
+  _STLP_UNWIND((_M_ctrl._M_data = __old_ctrl, _M_slots._M_data = __old_slots,
+                _M_capacity = __old_capacity, _M_growth_left = __old_growth_left))
+  for (size_type __i = 0; __i < __old_capacity; ++__i) {
+    if (_S_is_full(__old_ctrl[__i])) {
+      size_t __h = _S_mix(_M_hash(_M_get_key(__old_slots[__i])));
+      size_type __j = _M_find_free_slot(__h);
+      _Move_Construct(_M_slots._M_data + __j, __old_slots[__i]);
+      _Destroy_Moved(__old_slots + __i);
+      _M_set_ctrl(__j, _S_h2(__h));
+    }
+  }
+  if (__old_capacity != 0) {
+    _M_slots.deallocate(__old_slots, __old_capacity);
+    _M_ctrl.deallocate(__old_ctrl, __old_capacity + _S_width);
+  }
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::_M_erase_at(size_type __i) {
+  _Destroy(_M_slots._M_data + __i);
+  --_M_num_elements;
+
+  // The slot can be marked empty, rather than deleted, if no probe sequence
+  // ever went past it: there was an empty slot within a group width around.
+  size_type __before = (__i - _S_width) & _M_capacity;
+  unsigned int __empty_after = _Group(_M_ctrl._M_data + __i)._M_match_empty();
+  unsigned int __empty_before = _Group(_M_ctrl._M_data + __before)._M_match_empty();
+  bool __was_never_full = __empty_before != 0 && __empty_after != 0 &&
+    __flat_hash_lowest_bit(__empty_after) +
+    (_S_width - 1 - __flat_hash_highest_bit(__empty_before)) < (unsigned int)_S_width;
+
+  _M_set_ctrl(__i, __was_never_full ? _S_flat_hash_empty : _S_flat_hash_deleted);
+  if (__was_never_full)
+    ++_M_growth_left;
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::_M_destroy_slots() {
+  for (size_type __i = 0; __i < _M_capacity; ++__i) {
+    if (_S_is_full(_M_ctrl._M_data[__i]))
+      _Destroy(_M_slots._M_data + __i);
+  }
+  _M_num_elements = 0;
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::_M_deallocate_storage() {
+  if (_M_capacity != 0) {
+    _M_slots.deallocate(_M_slots._M_data, _M_capacity);
+    _M_ctrl.deallocate(_M_ctrl._M_data, _M_capacity + _S_width);
+  }
+  _M_ctrl._M_data = 0;
+  _M_slots._M_data = 0;
+  _M_capacity = _M_growth_left = 0;
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::_M_copy_from(const _Self& __ht) {
+  // The table is empty, elements are inserted in a table of the right size
+  // without checking for duplicates.
+  if (__ht._M_num_elements == 0)
+    return;
+  _M_deallocate_storage();
+  _M_initialize(_S_growth_to_capacity(__ht._M_num_elements));
+  _STLP_TRY {
+    for (size_type __i = 0; __i < __ht._M_capacity; ++__i) {
+      if (_S_is_full(__ht._M_ctrl._M_data[__i])) {
+        size_t __h = _S_mix(_M_hash(_M_get_key(__ht._M_slots._M_data[__i])));
+        size_type __j = _M_find_free_slot(__h);
+        _Copy_Construct(_M_slots._M_data + __j, __ht._M_slots._M_data[__i]);
+        _M_set_ctrl(__j, _S_h2(__h));
+        ++_M_num_elements;
+        --_M_growth_left;
+      }
+    }
+  }
+  _STLP_UNWIND(clear())
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::clear() {
+  if (_M_num_elements == 0 && _M_growth_left == _S_capacity_to_growth(_M_capacity))
+    return;
+  _M_destroy_slots();
+  if (_M_capacity != 0) {
+    memset(_M_ctrl._M_data, _S_flat_hash_empty, _M_capacity + _S_width);
+    _M_ctrl._M_data[_M_capacity] = _S_flat_hash_sentinel;
+  }
+  _M_growth_left = _S_capacity_to_growth(_M_capacity);
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+void __flat_hashtable__::resize(size_type __num_elements_hint) {
+  if (__num_elements_hint > _M_num_elements + _M_growth_left) {
+    _M_rehash(_S_growth_to_capacity(__num_elements_hint));
+  }
+}
+
+#undef __flat_hashtable__
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /*  _STLP_FLAT_HASHTABLE_C */
+
+// Local Variables:
+// mode:C++
+// End:
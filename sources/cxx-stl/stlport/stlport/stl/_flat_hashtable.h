@@ -0,0 +1,605 @@
+/*
+ * Copyright (c) 2013
+ * The Android Open Source Project
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_FLAT_HASHTABLE_H
+#define _STLP_INTERNAL_FLAT_HASHTABLE_H
+
+#ifndef _STLP_INTERNAL_ALLOC_H
+#  include <stl/_alloc.h>
+#endif
+
+#ifndef _STLP_INTERNAL_CONSTRUCT_H
+#  include <stl/_construct.h>
+#endif
+
+#ifndef _STLP_INTERNAL_ITERATOR_BASE_H
+#  include <stl/_iterator_base.h>
+#endif
+
+#ifndef _STLP_INTERNAL_FUNCTION_BASE_H
+#  include <stl/_function_base.h>
+#endif
+
+#ifndef _STLP_INTERNAL_ALGOBASE_H
+#  include <stl/_algobase.h>
+#endif
+
+#ifndef _STLP_HASH_FUN_H
+#  include <stl/_hash_fun.h>
+#endif
+
+#ifndef _STLP_INTERNAL_CSTRING
+#  include <stl/_cstring.h>
+#endif
+
+/*
+ * Open addressing hashtable, used to implement the flat_hash_set and
+ * flat_hash_map extension containers.
+ *
+ * The elements are stored in a single array of slots, and a parallel array
+ * holds one control byte per slot: empty, deleted, or the 7 low bits of the
+ * hash of the element. A lookup compares the control bytes of a group of
+ * slots at once (16 slots with SSE2, 8 with NEON or with the portable
+ * implementation) and only looks at the slots whose control byte matches,
+ * until a group with an empty slot is found.
+ *
+ * The capacity is always 0 or a power of 2 minus 1. The control array has
+ * a sentinel after the last slot, followed by a copy of its first group, so
+ * that a group can be read from any slot without wrapping around.
+ *
+ * Inserting or erasing an element invalidates the iterators, references
+ * and pointers to the other elements when the table is rehashed. Unlike
+ * hashtable, the elements do not have a stable address.
+ */
+
+#if defined (__SSE2__)
+#  include <emmintrin.h>
+#  define _STLP_FLAT_HASH_GROUP_SSE2
+#elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+#  include <arm_neon.h>
+#  define _STLP_FLAT_HASH_GROUP_NEON
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+typedef signed char _Flat_hash_ctrl;
+
+// Control byte values, full slots have the 7 low bits of the hash.
+enum {
+  _S_flat_hash_empty = -128,
+  _S_flat_hash_deleted = -2,
+  _S_flat_hash_sentinel = -1
+};
+
+inline unsigned int __flat_hash_lowest_bit(unsigned int __mask) {
+#if defined (__GNUC__)
+  return __builtin_ctz(__mask);
+#else
+  unsigned int __n = 0;
+  for (; (__mask & 1) == 0; __mask >>= 1) ++__n;
+  return __n;
+#endif
+}
+
+inline unsigned int __flat_hash_highest_bit(unsigned int __mask) {
+#if defined (__GNUC__)
+  return sizeof(unsigned int) * 8 - 1 - __builtin_clz(__mask);
+#else
+  unsigned int __n = 0;
+  for (; __mask >>= 1; ) ++__n;
+  return __n;
+#endif
+}
+
+// Control bytes of a group of slots. The _M_match functions return a mask
+// with bit i set when the control byte of slot i matches.
+struct _Flat_hash_group {
+#if defined (_STLP_FLAT_HASH_GROUP_SSE2)
+  enum { _S_width = 16 };
+
+  explicit _Flat_hash_group(const _Flat_hash_ctrl* __ctrl)
+    : _M_ctrl(_mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __ctrl))) {}
+
+  unsigned int _M_match(_Flat_hash_ctrl __h) const
+  { return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(__h), _M_ctrl)); }
+  unsigned int _M_match_empty() const
+  { return _M_match(_S_flat_hash_empty); }
+  unsigned int _M_match_empty_or_deleted() const
+  { return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(_S_flat_hash_sentinel), _M_ctrl)); }
+
+private:
+  __m128i _M_ctrl;
+#else
+  enum { _S_width = 8 };
+  typedef unsigned _STLP_LONG_LONG _Word;
+
+#  if defined (_STLP_FLAT_HASH_GROUP_NEON)
+  explicit _Flat_hash_group(const _Flat_hash_ctrl* __ctrl)
+    : _M_ctrl(vld1_s8(__ctrl)) {}
+
+  unsigned int _M_match(_Flat_hash_ctrl __h) const
+  { return _S_compress(vget_lane_u64(vreinterpret_u64_u8(vceq_s8(_M_ctrl, vdup_n_s8(__h))), 0)); }
+  unsigned int _M_match_empty() const
+  { return _M_match(_S_flat_hash_empty); }
+  unsigned int _M_match_empty_or_deleted() const
+  { return _S_compress(vget_lane_u64(vreinterpret_u64_u8(vclt_s8(_M_ctrl, vdup_n_s8(_S_flat_hash_sentinel))), 0)); }
+
+private:
+  int8x8_t _M_ctrl;
+#  else
+  explicit _Flat_hash_group(const _Flat_hash_ctrl* __ctrl) : _M_ctrl(0) {
+    // Slot i in byte i, whatever the endianness.
+    for (int __i = _S_width - 1; __i >= 0; --__i)
+      _M_ctrl = (_M_ctrl << 8) | __STATIC_CAST(unsigned char, __ctrl[__i]);
+  }
+
+  // May report false positives, but never misses a matching slot.
+  unsigned int _M_match(_Flat_hash_ctrl __h) const {
+    _Word __x = _M_ctrl ^ (_S_lsbs() * __STATIC_CAST(unsigned char, __h));
+    return _S_compress((__x - _S_lsbs()) & ~__x);
+  }
+  // Empty is the only control byte with bit 7 set and bit 1 clear.
+  unsigned int _M_match_empty() const
+  { return _S_compress(_M_ctrl & ~(_M_ctrl << 6)); }
+  // Empty and deleted are the only ones with bit 7 set and bit 0 clear.
+  unsigned int _M_match_empty_or_deleted() const
+  { return _S_compress(_M_ctrl & ~(_M_ctrl << 7)); }
+
+private:
+  static _Word _S_lsbs()
+  { return (__STATIC_CAST(_Word, 0x01010101) << 32) | 0x01010101; }
+
+  _Word _M_ctrl;
+#  endif
+
+  // Gathers the most significant bit of each byte.
+  static unsigned int _S_compress(_Word __x) {
+    const _Word __msbs = (__STATIC_CAST(_Word, 0x80808080) << 32) | 0x80808080;
+    const _Word __gather = (__STATIC_CAST(_Word, 0x01020408) << 32) | 0x10204080;
+    return __STATIC_CAST(unsigned int, (((__x & __msbs) >> 7) * __gather) >> 56);
+  }
+#endif
+};
+
+template <class _Dummy>
+struct _Flat_hash_empty_group {
+  // Control bytes of a table without slots.
+  static const _Flat_hash_ctrl _S_ctrl[_Flat_hash_group::_S_width];
+};
+
+template <class _Dummy>
+const _Flat_hash_ctrl _Flat_hash_empty_group<_Dummy>::_S_ctrl[_Flat_hash_group::_S_width] = {
+  _S_flat_hash_sentinel,
+  _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty,
+  _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty
+#if defined (_STLP_FLAT_HASH_GROUP_SSE2)
+  , _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty,
+  _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty, _S_flat_hash_empty
+#endif
+};
+
+template <class _Val, class _Traits>
+struct _Flat_ht_iterator {
+  typedef typename _Traits::_ConstTraits _ConstTraits;
+  typedef typename _Traits::_NonConstTraits _NonConstTraits;
+
+  typedef _Flat_ht_iterator<_Val, _Traits> _Self;
+
+  typedef _Val value_type;
+  typedef forward_iterator_tag iterator_category;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+  typedef typename _Traits::reference reference;
+  typedef typename _Traits::pointer   pointer;
+
+  typedef _Flat_ht_iterator<_Val, _NonConstTraits> iterator;
+  typedef _Flat_ht_iterator<_Val, _ConstTraits> const_iterator;
+
+  _Flat_ht_iterator() : _M_ctrl(0), _M_slot(0) {}
+  _Flat_ht_iterator(const _Flat_hash_ctrl* __ctrl, _Val* __slot)
+    : _M_ctrl(__ctrl), _M_slot(__slot) {}
+  //copy constructor for iterator and constructor from iterator for const_iterator
+  _Flat_ht_iterator(const iterator& __it)
+    : _M_ctrl(__it._M_ctrl), _M_slot(__it._M_slot) {}
+
+  reference operator*() const { return *_M_slot; }
+  _STLP_DEFINE_ARROW_OPERATOR
+
+  _Self& operator++() {
+    ++_M_ctrl;
+    ++_M_slot;
+    _M_skip_free_slots();
+    return *this;
+  }
+  _Self operator++(int) {
+    _Self __tmp = *this;
+    ++*this;
+    return __tmp;
+  }
+
+  bool operator == (const_iterator const& __rhs) const
+  { return _M_ctrl == __rhs._M_ctrl; }
+  bool operator != (const_iterator const& __rhs) const
+  { return _M_ctrl != __rhs._M_ctrl; }
+
+  // Moves to the next full slot, or to the sentinel.
+  void _M_skip_free_slots() {
+    while (*_M_ctrl < _S_flat_hash_sentinel) {
+      ++_M_ctrl;
+      ++_M_slot;
+    }
+  }
+
+  const _Flat_hash_ctrl* _M_ctrl;
+  _Val* _M_slot;
+};
+
+#if defined (_STLP_CLASS_PARTIAL_SPECIALIZATION)
+_STLP_MOVE_TO_STD_NAMESPACE
+template <class _Val, class _Traits>
+struct __type_traits<_STLP_PRIV _Flat_ht_iterator<_Val, _Traits> > {
+  typedef __false_type   has_trivial_default_constructor;
+  typedef __true_type    has_trivial_copy_constructor;
+  typedef __true_type    has_trivial_assignment_operator;
+  typedef __true_type    has_trivial_destructor;
+  typedef __false_type   is_POD_type;
+};
+_STLP_MOVE_TO_PRIV_NAMESPACE
+#endif /* _STLP_CLASS_PARTIAL_SPECIALIZATION */
+
+#if defined (_STLP_USE_OLD_HP_ITERATOR_QUERIES)
+_STLP_MOVE_TO_STD_NAMESPACE
+template <class _Val, class _Traits>
+inline _Val* value_type(const _STLP_PRIV _Flat_ht_iterator<_Val, _Traits>&) { return (_Val*) 0; }
+template <class _Val, class _Traits>
+inline forward_iterator_tag iterator_category(const _STLP_PRIV _Flat_ht_iterator<_Val, _Traits>&)
+{ return forward_iterator_tag(); }
+template <class _Val, class _Traits>
+inline ptrdiff_t* distance_type(const _STLP_PRIV _Flat_ht_iterator<_Val, _Traits>&)
+{ return (ptrdiff_t*) 0; }
+_STLP_MOVE_TO_PRIV_NAMESPACE
+#endif
+
+// Unique keys only: _ExK extracts the key of a value, like for hashtable.
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+class _Flat_hashtable {
+  typedef _Flat_hashtable<_Val, _Key, _HF, _Traits, _ExK, _EqK, _All> _Self;
+  typedef typename _Traits::_NonConstTraits _NonConstTraits;
+  typedef typename _Traits::_ConstTraits _ConstTraits;
+
+public:
+  typedef _Key key_type;
+  typedef _Val value_type;
+  typedef _HF hasher;
+  typedef _EqK key_equal;
+
+  typedef size_t            size_type;
+  typedef ptrdiff_t         difference_type;
+  typedef typename _NonConstTraits::pointer pointer;
+  typedef const value_type* const_pointer;
+  typedef typename _NonConstTraits::reference reference;
+  typedef const value_type& const_reference;
+
+  typedef _Flat_ht_iterator<_Val, _NonConstTraits> iterator;
+  typedef _Flat_ht_iterator<_Val, _ConstTraits> const_iterator;
+
+  hasher hash_funct() const { return _M_hash; }
+  key_equal key_eq() const { return _M_equals; }
+
+private:
+  _STLP_FORCE_ALLOCATORS(_Val, _All)
+  typedef typename _Alloc_traits<_Val, _All>::allocator_type _SlotAllocType;
+  typedef typename _Alloc_traits<_Flat_hash_ctrl, _All>::allocator_type _CtrlAllocType;
+  typedef _Flat_hash_group _Group;
+  enum { _S_width = _Group::_S_width };
+
+  hasher    _M_hash;
+  key_equal _M_equals;
+  _STLP_alloc_proxy<_Flat_hash_ctrl*, _Flat_hash_ctrl, _CtrlAllocType> _M_ctrl;
+  _STLP_alloc_proxy<_Val*, _Val, _SlotAllocType> _M_slots;
+  size_type _M_capacity;
+  size_type _M_num_elements;
+  // Number of empty slots that can still be filled before rehashing.
+  size_type _M_growth_left;
+  _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
+
+  static const key_type& _M_get_key(const value_type& __val) {
+    _ExK __k;
+    return __k(__val);
+  }
+
+  // The hash functions of STLport often are the identity: spreads the bits
+  // with a multiplication, folding the high half of the product, which
+  // depends on all the bits of the hash, onto the low half. The 7 low bits
+  // are stored in the control byte, the others select the first group.
+  static size_t _S_mix(size_t __h) {
+    typedef unsigned _STLP_LONG_LONG _Ull;
+    _Ull __x = __STATIC_CAST(_Ull, __h) * ((__STATIC_CAST(_Ull, 0x9e3779b9) << 32) | 0x7f4a7c15);
+    return __STATIC_CAST(size_t, __x ^ (__x >> 32));
+  }
+  static _Flat_hash_ctrl _S_h2(size_t __h)
+  { return __STATIC_CAST(_Flat_hash_ctrl, __h & 0x7f); }
+
+  // Maximum number of elements for a capacity, the load factor is 7/8 but
+  // a probe must always find an empty slot.
+  static size_type _S_capacity_to_growth(size_type __capacity)
+  { return (_S_width == 8 && __capacity == 7) ? 6 : __capacity - __capacity / 8; }
+
+  static bool _S_is_full(_Flat_hash_ctrl __c) { return __c >= 0; }
+
+  const _Flat_hash_ctrl* _M_ctrl_bytes() const
+  { return _M_capacity != 0 ? _M_ctrl._M_data : _Flat_hash_empty_group<bool>::_S_ctrl; }
+
+  void _M_set_ctrl(size_type __i, _Flat_hash_ctrl __c) {
+    _M_ctrl._M_data[__i] = __c;
+    // Keep the copy of the first group after the sentinel up to date.
+    _M_ctrl._M_data[((__i - (_S_width - 1)) & _M_capacity) + ((_S_width - 1) & _M_capacity)] = __c;
+  }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_find_index(const _KT& __key, size_t __h) const {
+    const _Flat_hash_ctrl* __ctrl = _M_ctrl_bytes();
+    _Flat_hash_ctrl __h2 = _S_h2(__h);
+    size_type __offset = (__h >> 7) & _M_capacity;
+    for (size_type __index = 0; ; ) {
+      _Group __g(__ctrl + __offset);
+      for (unsigned int __m = __g._M_match(__h2); __m != 0; __m &= __m - 1) {
+        size_type __i = (__offset + __flat_hash_lowest_bit(__m)) & _M_capacity;
+        if (_S_is_full(__ctrl[__i]) && _M_equals(_M_get_key(_M_slots._M_data[__i]), __key))
+          return __i;
+      }
+      if (__g._M_match_empty() != 0)
+        return _M_capacity;
+      __index += _S_width;
+      __offset = (__offset + __index) & _M_capacity;
+    }
+  }
+
+  // Returns the first empty or deleted slot on the probe sequence of __h.
+  size_type _M_find_free_slot(size_t __h) const;
+  // Finds the slot for a new element, growing the table if needed.
+  size_type _M_prepare_insert(size_t __h);
+  void _M_rehash(size_type __new_capacity);
+  void _M_initialize(size_type __capacity);
+  void _M_destroy_slots();
+  void _M_deallocate_storage();
+  void _M_copy_from(const _Self& __ht);
+  void _M_erase_at(size_type __i);
+
+  static size_type _S_normalize_capacity(size_type __n) {
+    size_type __capacity = 1;
+    while (__capacity < __n) __capacity = __capacity * 2 + 1;
+    return __capacity;
+  }
+  // Capacity needed to hold __n elements.
+  static size_type _S_growth_to_capacity(size_type __n) {
+    if (__n == 0) return 0;
+    if (_S_width == 8 && __n == 7) return 15;
+    return _S_normalize_capacity(__n + (__n - 1) / 7);
+  }
+
+public:
+  typedef _All allocator_type;
+  allocator_type get_allocator() const
+  { return _STLP_CONVERT_ALLOCATOR((const _SlotAllocType&)_M_slots, _Val); }
+
+  _Flat_hashtable(size_type __n,
+                  const _HF&    __hf,
+                  const _EqK&   __eql,
+                  const allocator_type& __a)
+    : _M_hash(__hf),
+      _M_equals(__eql),
+      _M_ctrl(_STLP_CONVERT_ALLOCATOR(__a, _Flat_hash_ctrl), (_Flat_hash_ctrl*)0),
+      _M_slots(_STLP_CONVERT_ALLOCATOR(__a, _Val), (_Val*)0),
+      _M_capacity(0), _M_num_elements(0), _M_growth_left(0)
+  { _M_initialize(_S_growth_to_capacity(__n)); }
+
+  _Flat_hashtable(const _Self& __ht)
+    : _M_hash(__ht._M_hash),
+      _M_equals(__ht._M_equals),
+      _M_ctrl(__ht._M_ctrl, (_Flat_hash_ctrl*)0),
+      _M_slots(__ht._M_slots, (_Val*)0),
+      _M_capacity(0), _M_num_elements(0), _M_growth_left(0)
+  { _M_copy_from(__ht); }
+
+#if !defined (_STLP_NO_MOVE_SEMANTIC)
+  _Flat_hashtable(__move_source<_Self> src)
+    : _M_hash(_STLP_PRIV _AsMoveSource(src.get()._M_hash)),
+      _M_equals(_STLP_PRIV _AsMoveSource(src.get()._M_equals)),
+      _M_ctrl(__move_source<_STLP_alloc_proxy<_Flat_hash_ctrl*, _Flat_hash_ctrl, _CtrlAllocType> >(src.get()._M_ctrl)),
+      _M_slots(__move_source<_STLP_alloc_proxy<_Val*, _Val, _SlotAllocType> >(src.get()._M_slots)),
+      _M_capacity(src.get()._M_capacity),
+      _M_num_elements(src.get()._M_num_elements),
+      _M_growth_left(src.get()._M_growth_left) {
+    _Self& __src = src.get();
+    __src._M_ctrl._M_data = 0;
+    __src._M_slots._M_data = 0;
+    __src._M_capacity = __src._M_num_elements = __src._M_growth_left = 0;
+  }
+#endif
+
+  _Self& operator= (const _Self& __ht) {
+    if (&__ht != this) {
+      clear();
+      _M_hash = __ht._M_hash;
+      _M_equals = __ht._M_equals;
+      _M_copy_from(__ht);
+    }
+    return *this;
+  }
+
+  ~_Flat_hashtable() {
+    _M_destroy_slots();
+    _M_deallocate_storage();
+  }
+
+  size_type size() const { return _M_num_elements; }
+  size_type max_size() const { return size_type(-1) / (sizeof(_Val) + 1); }
+  bool empty() const { return size() == 0; }
+
+  void swap(_Self& __ht) {
+    _STLP_STD::swap(_M_hash, __ht._M_hash);
+    _STLP_STD::swap(_M_equals, __ht._M_equals);
+    _M_ctrl._M_swap_alloc(__ht._M_ctrl);
+    _M_slots._M_swap_alloc(__ht._M_slots);
+    _STLP_STD::swap(_M_ctrl._M_data, __ht._M_ctrl._M_data);
+    _STLP_STD::swap(_M_slots._M_data, __ht._M_slots._M_data);
+    _STLP_STD::swap(_M_capacity, __ht._M_capacity);
+    _STLP_STD::swap(_M_num_elements, __ht._M_num_elements);
+    _STLP_STD::swap(_M_growth_left, __ht._M_growth_left);
+  }
+
+  iterator begin() {
+    iterator __it(_M_ctrl_bytes(), _M_slots._M_data);
+    __it._M_skip_free_slots();
+    return __it;
+  }
+  iterator end() { return iterator(_M_ctrl_bytes() + _M_capacity, _M_slots._M_data + _M_capacity); }
+  const_iterator begin() const { return __CONST_CAST(_Self*, this)->begin(); }
+  const_iterator end() const { return __CONST_CAST(_Self*, this)->end(); }
+
+  pair<iterator, bool> insert_unique(const value_type& __obj) {
+    const key_type& __key = _M_get_key(__obj);
+    size_t __h = _S_mix(_M_hash(__key));
+    size_type __i = _M_find_index(__key, __h);
+    if (__i != _M_capacity)
+      return pair<iterator, bool>(_M_iterator_at(__i), false);
+    __i = _M_prepare_insert(__h);
+    _Copy_Construct(_M_slots._M_data + __i, __obj);
+    _M_set_ctrl(__i, _S_h2(__h));
+    ++_M_num_elements;
+    return pair<iterator, bool>(_M_iterator_at(__i), true);
+  }
+
+#if defined (_STLP_MEMBER_TEMPLATES)
+  template <class _InputIterator>
+  void insert_unique(_InputIterator __f, _InputIterator __l) {
+    for ( ; __f != __l; ++__f)
+      insert_unique(*__f);
+  }
+#else
+  void insert_unique(const value_type* __f, const value_type* __l) {
+    for ( ; __f != __l; ++__f)
+      insert_unique(*__f);
+  }
+  void insert_unique(const_iterator __f, const_iterator __l) {
+    for ( ; __f != __l; ++__f)
+      insert_unique(*__f);
+  }
+#endif
+
+  // Returns the element with key __key, inserting __obj if there is none.
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  reference _M_find_or_insert(const _KT& __key, const value_type& __obj) {
+    size_t __h = _S_mix(_M_hash(__key));
+    size_type __i = _M_find_index(__key, __h);
+    if (__i == _M_capacity) {
+      __i = _M_prepare_insert(__h);
+      _Copy_Construct(_M_slots._M_data + __i, __obj);
+      _M_set_ctrl(__i, _S_h2(__h));
+      ++_M_num_elements;
+    }
+    return _M_slots._M_data[__i];
+  }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator find(const _KT& __key) {
+    size_type __i = _M_find_index(__key, _S_mix(_M_hash(__key)));
+    return __i == _M_capacity ? end() : _M_iterator_at(__i);
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator find(const _KT& __key) const
+  { return __CONST_CAST(_Self*, this)->find(__key); }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type count(const _KT& __key) const
+  { return _M_find_index(__key, _S_mix(_M_hash(__key))) != _M_capacity ? 1 : 0; }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<iterator, iterator> equal_range(const _KT& __key) {
+    iterator __it = find(__key);
+    iterator __last = __it;
+    if (__it != end())
+      ++__last;
+    return pair<iterator, iterator>(__it, __last);
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<const_iterator, const_iterator> equal_range(const _KT& __key) const {
+    pair<iterator, iterator> __p = __CONST_CAST(_Self*, this)->equal_range(__key);
+    return pair<const_iterator, const_iterator>(__p.first, __p.second);
+  }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type erase(const _KT& __key) {
+    size_type __i = _M_find_index(__key, _S_mix(_M_hash(__key)));
+    if (__i == _M_capacity)
+      return 0;
+    _M_erase_at(__i);
+    return 1;
+  }
+  void erase(const_iterator __it)
+  { _M_erase_at(__it._M_slot - _M_slots._M_data); }
+  void erase(const_iterator __first, const_iterator __last) {
+    // Erasing does not move the other elements.
+    for ( ; __first != __last; ++__first)
+      _M_erase_at(__first._M_slot - _M_slots._M_data);
+  }
+
+  void clear();
+
+  // Makes room for __num_elements_hint elements without rehashing.
+  void resize(size_type __num_elements_hint);
+  size_type bucket_count() const { return _M_capacity; }
+  size_type max_bucket_count() const { return max_size(); }
+  float load_factor() const
+  { return _M_capacity == 0 ? 0.0f : __STATIC_CAST(float, _M_num_elements) / __STATIC_CAST(float, _M_capacity); }
+
+private:
+  iterator _M_iterator_at(size_type __i)
+  { return iterator(_M_ctrl._M_data + __i, _M_slots._M_data + __i); }
+};
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#if !defined (_STLP_LINK_TIME_INSTANTIATION)
+#  include <stl/_flat_hashtable.c>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+#if defined (_STLP_CLASS_PARTIAL_SPECIALIZATION) && !defined (_STLP_NO_MOVE_SEMANTIC)
+template <class _Val, class _Key, class _HF, class _Traits, class _ExK, class _EqK, class _All>
+struct __move_traits<_STLP_PRIV _Flat_hashtable<_Val, _Key, _HF, _Traits, _ExK, _EqK, _All> > {
+  typedef __true_type implemented;
+  typedef __false_type complete;
+};
+#endif
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_FLAT_HASHTABLE_H */
+
+// Local Variables:
+// mode:C++
+// End:
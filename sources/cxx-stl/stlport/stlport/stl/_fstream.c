@@ -255,6 +255,24 @@ basic_filebuf<_CharT, _Traits>::overflow(int_type __c) {
   return traits_type::not_eof(__c);
 }
 
+// Writes at least as large as the internal buffer do not go through it
+// when no conversion is needed: the characters already in the buffer and
+// the new ones are handed to the system at once.
+template <class _CharT, class _Traits>
+streamsize
+basic_filebuf<_CharT, _Traits>::xsputn(const char_type* __s, streamsize __n) {
+  if (!_M_always_noconv || !(_M_in_output_mode || _M_switch_to_output_mode()) ||
+      __n < _M_int_buf_EOS - _M_int_buf)
+    return _Base::xsputn(__s, __n);
+
+  if (!_Noconv_output<_Traits>::_M_doit(this, this->pbase(), this->pptr(), __s, __n)) {
+    _M_output_error();
+    return 0;
+  }
+  this->setp(_M_int_buf, _M_int_buf_EOS - 1);
+  return __n;
+}
+
 // This member function must be called before any I/O has been
 // performed on the stream, otherwise it has no effect.
 //
@@ -263,6 +281,9 @@ basic_filebuf<_CharT, _Traits>::overflow(int_type __c) {
 // buffer, rather than the buffer that would otherwise be allocated
 // automatically.  __buf must be a pointer to an array of _CharT whose
 // size is at least __n.
+// __buf == 0 && __n > 0 means to allocate an internal buffer of __n
+// characters rather than of the default size.  For char files that are
+// memory mapped, it is also the minimum size of the mapped windows.
 template <class _CharT, class _Traits>
 basic_streambuf<_CharT, _Traits>*
 basic_filebuf<_CharT, _Traits>::setbuf(_CharT* __buf, streamsize __n) {
@@ -270,7 +291,7 @@ basic_filebuf<_CharT, _Traits>::setbuf(_CharT* __buf, streamsize __n) {
       _M_int_buf == 0) {
     if (__buf == 0 && __n == 0)
       _M_allocate_buffers(0, 1);
-    else if (__buf != 0 && __n > 0)
+    else if (__n > 0)
       _M_allocate_buffers(__buf, __n);
   }
   return this;
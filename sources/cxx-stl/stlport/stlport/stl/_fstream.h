@@ -69,6 +69,9 @@ public:                      // Low-level I/O, like Unix read/write
   streamoff _M_seek(streamoff __offset, ios_base::seekdir __dir);
   streamoff _M_file_size();
   bool _M_write(char* __buf,  ptrdiff_t __n);
+  // Writes [__buf1, __buf1 + __n1) then [__buf2, __buf2 + __n2), with a
+  // single system call when possible.
+  bool _M_write(char* __buf1, ptrdiff_t __n1, const char* __buf2, ptrdiff_t __n2);
 
 public:                      // Memory-mapped I/O.
   void* _M_mmap(streamoff __offset, streamoff __len);
@@ -202,6 +205,7 @@ protected:                      // Virtual functions from basic_streambuf.
 
   virtual int_type pbackfail(int_type = traits_type::eof());
   virtual int_type overflow(int_type = traits_type::eof());
+  virtual streamsize xsputn(const char_type*, streamsize);
 
   virtual basic_streambuf<_CharT, _Traits>* setbuf(char_type*, streamsize);
   virtual pos_type seekoff(off_type, ios_base::seekdir,
@@ -320,6 +324,8 @@ private:                        // Data members used only in putback mode.
   // for _Noconv_output
 public:
   bool _M_write(char* __buf,  ptrdiff_t __n) {return _M_base._M_write(__buf, __n); }
+  bool _M_write(char* __buf1, ptrdiff_t __n1, const char* __buf2, ptrdiff_t __n2)
+  { return _M_base._M_write(__buf1, __n1, __buf2, __n2); }
 
 public:
   int_type
@@ -348,6 +354,9 @@ public:
   static bool  _STLP_CALL _M_doit(basic_filebuf<char_type, _Traits >*,
                                   char_type*, char_type*)
   { return false; }
+  static bool  _STLP_CALL _M_doit(basic_filebuf<char_type, _Traits >*,
+                                  char_type*, char_type*, const char_type*, streamsize)
+  { return false; }
 };
 
 _STLP_TEMPLATE_NULL
@@ -359,6 +368,13 @@ public:
     ptrdiff_t __n = __last - __first;
     return (__buf->_M_write(__first, __n));
   }
+  // Writes the buffered characters [__first, __last) followed by
+  // [__s, __s + __n) that bypassed the buffer.
+  static bool  _STLP_CALL
+  _M_doit(basic_filebuf<char, char_traits<char> >* __buf,
+          char* __first, char* __last, const char* __s, streamsize __n) {
+    return (__buf->_M_write(__first, __last - __first, __s, __STATIC_CAST(ptrdiff_t, __n)));
+  }
 };
 
 //----------------------------------------------------------------------
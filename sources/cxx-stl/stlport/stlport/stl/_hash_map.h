@@ -100,6 +100,17 @@ public:
   }
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  hash_map(const _Self& __x)
+    : _M_ht(__x._M_ht) {}
+  hash_map(_Self&& __x)
+    : _M_ht(_STLP_STD::move(__x._M_ht)) {}
+  _Self& operator = (const _Self& __x)
+  { _M_ht = __x._M_ht; return *this; }
+  _Self& operator = (_Self&& __x)
+  { _M_ht = _STLP_STD::move(__x._M_ht); return *this; }
+#endif
+
 #ifdef _STLP_MEMBER_TEMPLATES
   template <class _InputIterator>
   hash_map(_InputIterator __f, _InputIterator __l)
@@ -178,6 +189,13 @@ public:
 public:
   pair<iterator,bool> insert(const value_type& __obj)
   { return _M_ht.insert_unique(__obj); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  pair<iterator, bool> insert(value_type&& __obj)
+  { return _M_ht.insert_unique(_STLP_STD::move(__obj)); }
+  template <class... _Args>
+  pair<iterator, bool> emplace(_Args&&... __args)
+  { return _M_ht.emplace_unique(_STLP_STD::forward<_Args>(__args)...); }
+#endif
 #ifdef _STLP_MEMBER_TEMPLATES
   template <class _InputIterator>
   void insert(_InputIterator __f, _InputIterator __l)
@@ -291,6 +309,17 @@ public:
   }
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  hash_multimap(const _Self& __x)
+    : _M_ht(__x._M_ht) {}
+  hash_multimap(_Self&& __x)
+    : _M_ht(_STLP_STD::move(__x._M_ht)) {}
+  _Self& operator = (const _Self& __x)
+  { _M_ht = __x._M_ht; return *this; }
+  _Self& operator = (_Self&& __x)
+  { _M_ht = _STLP_STD::move(__x._M_ht); return *this; }
+#endif
+
 #ifdef _STLP_MEMBER_TEMPLATES
   template <class _InputIterator>
   hash_multimap(_InputIterator __f, _InputIterator __l)
@@ -370,6 +399,13 @@ public:
 public:
   iterator insert(const value_type& __obj)
     { return _M_ht.insert_equal(__obj); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  iterator insert(value_type&& __obj)
+  { return _M_ht.insert_equal(_STLP_STD::move(__obj)); }
+  template <class... _Args>
+  iterator emplace(_Args&&... __args)
+  { return _M_ht.emplace_equal(_STLP_STD::forward<_Args>(__args)...); }
+#endif
 #ifdef _STLP_MEMBER_TEMPLATES
   template <class _InputIterator>
   void insert(_InputIterator __f, _InputIterator __l)
@@ -102,6 +102,17 @@ public:
     : _M_ht(__move_source<_Ht>(src.get()._M_ht)) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  hash_set(const _Self& __x)
+    : _M_ht(__x._M_ht) {}
+  hash_set(_Self&& __x)
+    : _M_ht(_STLP_STD::move(__x._M_ht)) {}
+  _Self& operator = (const _Self& __x)
+  { _M_ht = __x._M_ht; return *this; }
+  _Self& operator = (_Self&& __x)
+  { _M_ht = _STLP_STD::move(__x._M_ht); return *this; }
+#endif
+
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   hash_set(_InputIterator __f, _InputIterator __l)
@@ -180,6 +191,13 @@ public:
 public:
   pair<iterator, bool> insert(const value_type& __obj)
   { return _M_ht.insert_unique(__obj); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  pair<iterator, bool> insert(value_type&& __obj)
+  { return _M_ht.insert_unique(_STLP_STD::move(__obj)); }
+  template <class... _Args>
+  pair<iterator, bool> emplace(_Args&&... __args)
+  { return _M_ht.emplace_unique(_STLP_STD::forward<_Args>(__args)...); }
+#endif
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   void insert(_InputIterator __f, _InputIterator __l)
@@ -283,6 +301,17 @@ public:
     : _M_ht(__move_source<_Ht>(src.get()._M_ht)) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  hash_multiset(const _Self& __x)
+    : _M_ht(__x._M_ht) {}
+  hash_multiset(_Self&& __x)
+    : _M_ht(_STLP_STD::move(__x._M_ht)) {}
+  _Self& operator = (const _Self& __x)
+  { _M_ht = __x._M_ht; return *this; }
+  _Self& operator = (_Self&& __x)
+  { _M_ht = _STLP_STD::move(__x._M_ht); return *this; }
+#endif
+
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   hash_multiset(_InputIterator __f, _InputIterator __l)
@@ -361,6 +390,13 @@ public:
 
 public:
   iterator insert(const value_type& __obj) { return _M_ht.insert_equal(__obj); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  iterator insert(value_type&& __obj)
+  { return _M_ht.insert_equal(_STLP_STD::move(__obj)); }
+  template <class... _Args>
+  iterator emplace(_Args&&... __args)
+  { return _M_ht.emplace_equal(_STLP_STD::forward<_Args>(__args)...); }
+#endif
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   void insert(_InputIterator __f, _InputIterator __l)
@@ -247,6 +247,99 @@ hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
   return _M_insert_noresize(__n, __obj);
 }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+pair<__iterator__, bool>
+hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
+  ::insert_unique(value_type&& __obj) {
+  // Unlike emplace_unique, the key is looked for before the node is built
+  // so that __obj is left alone when it is not inserted.
+  _M_enlarge(_M_num_elements + 1);
+  const size_type __n = _M_bkt_num(__obj);
+  _ElemsIte __cur = _M_find_in_bucket(__n, _M_get_key(__obj));
+  if (__cur != _ElemsIte(_M_buckets[__n + 1]))
+    return pair<iterator, bool>(iterator(__cur), false);
+
+  _ElemsCont __tmp(_M_elems.get_allocator());
+  __tmp.emplace_front(_STLP_STD::move(__obj));
+  return pair<iterator, bool>(_M_splice_unique_noresize(__n, __tmp), true);
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+_STLP_TYPENAME_ON_RETURN_TYPE hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>::_ElemsIte
+hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
+  ::_M_find_in_bucket(size_type __n, const key_type& __key) {
+  _ElemsIte __cur(_M_buckets[__n]);
+  _ElemsIte __last(_M_buckets[__n + 1]);
+  for (; __cur != __last; ++__cur) {
+    if (_M_equals(_M_get_key(*__cur), __key))
+      break;
+  }
+  return __cur;
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+__iterator__
+hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
+  ::_M_splice_noresize(size_type __n, _ElemsCont& __node) {
+  //Same as _M_insert_noresize: the node goes first in the bucket.
+  size_type __prev = __n;
+  _ElemsIte __pos = _M_before_begin(__prev)._M_ite;
+  _M_elems.splice_after(__pos, __node, __node.before_begin());
+  fill(_M_buckets.begin() + __prev, _M_buckets.begin() + __n + 1, (++__pos)._M_node);
+  ++_M_num_elements;
+  return iterator(__pos);
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+__iterator__
+hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
+  ::_M_splice_unique_noresize(size_type __n, _ElemsCont& __node) {
+  //Same as insert_unique_noresize: with no equivalent element in the bucket
+  //the node can go after its first element.
+  _ElemsIte __first(_M_buckets[__n]);
+  if (__first == _ElemsIte(_M_buckets[__n + 1]))
+    return _M_splice_noresize(__n, __node);
+  _M_elems.splice_after(__first, __node, __node.before_begin());
+  ++_M_num_elements;
+  return iterator(++__first);
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+pair<__iterator__, bool>
+hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
+  ::_M_insert_unique_node(_ElemsCont& __node) {
+  const value_type& __obj = __node.front();
+  const size_type __n = _M_bkt_num(__obj);
+  _ElemsIte __cur = _M_find_in_bucket(__n, _M_get_key(__obj));
+  if (__cur != _ElemsIte(_M_buckets[__n + 1]))
+    return pair<iterator, bool>(iterator(__cur), false);
+  return pair<iterator, bool>(_M_splice_unique_noresize(__n, __node), true);
+}
+
+template <class _Val, class _Key, class _HF,
+          class _Traits, class _ExK, class _EqK, class _All>
+__iterator__
+hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>
+  ::_M_insert_equal_node(_ElemsCont& __node) {
+  const value_type& __obj = __node.front();
+  const size_type __n = _M_bkt_num(__obj);
+  _ElemsIte __cur = _M_find_in_bucket(__n, _M_get_key(__obj));
+  if (__cur != _ElemsIte(_M_buckets[__n + 1])) {
+    //Equivalent elements are kept next to each other.
+    ++_M_num_elements;
+    _M_elems.splice_after(__cur, __node, __node.before_begin());
+    return iterator(++__cur);
+  }
+  return _M_splice_noresize(__n, __node);
+}
+#endif
+
 template <class _Val, class _Key, class _HF,
           class _Traits, class _ExK, class _EqK, class _All>
 __reference__
@@ -348,6 +348,20 @@ public:
       _M_max_load_factor(src.get()._M_max_load_factor) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  // The source keeps a bucket vector of its own so that it stays usable.
+  hashtable(_Self&& __ht)
+    : _M_hash(__ht._M_hash),
+      _M_equals(__ht._M_equals),
+      _M_elems(__ht.get_allocator()),
+      _M_buckets(_STLP_CONVERT_ALLOCATOR(__ht.get_allocator(), _BucketType*)),
+      _M_num_elements(0),
+      _M_max_load_factor(1.0f) {
+    _M_initialize_buckets(0);
+    swap(__ht);
+  }
+#endif
+
   _Self& operator= (const _Self& __ht) {
     if (&__ht != this) {
       clear();
@@ -358,6 +372,14 @@ public:
     return *this;
   }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator= (_Self&& __ht) {
+    swap(__ht);
+    __ht.clear();
+    return *this;
+  }
+#endif
+
   ~hashtable() { clear(); }
 
   size_type size() const { return _M_num_elements; }
@@ -414,6 +436,40 @@ public:
     return insert_equal_noresize(__obj);
   }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  pair<iterator, bool> insert_unique(value_type&& __obj);
+
+  iterator insert_equal(value_type&& __obj)
+  { return emplace_equal(_STLP_STD::move(__obj)); }
+
+  // The value is built in a node of its own first as its key is needed to
+  // find where it goes; the node is then spliced in, or freed if the key is
+  // already there.
+  template <class... _Args>
+  pair<iterator, bool> emplace_unique(_Args&&... __args) {
+    _ElemsCont __tmp(_M_elems.get_allocator());
+    __tmp.emplace_front(_STLP_STD::forward<_Args>(__args)...);
+    _M_enlarge(_M_num_elements + 1);
+    return _M_insert_unique_node(__tmp);
+  }
+
+  template <class... _Args>
+  iterator emplace_equal(_Args&&... __args) {
+    _ElemsCont __tmp(_M_elems.get_allocator());
+    __tmp.emplace_front(_STLP_STD::forward<_Args>(__args)...);
+    _M_enlarge(_M_num_elements + 1);
+    return _M_insert_equal_node(__tmp);
+  }
+
+private:
+  _ElemsIte _M_find_in_bucket(size_type __n, const key_type& __key);
+  iterator _M_splice_noresize(size_type __n, _ElemsCont& __node);
+  iterator _M_splice_unique_noresize(size_type __n, _ElemsCont& __node);
+  pair<iterator, bool> _M_insert_unique_node(_ElemsCont& __node);
+  iterator _M_insert_equal_node(_ElemsCont& __node);
+public:
+#endif
+
 protected:
   iterator _M_insert_noresize(size_type __n, const value_type& __obj);
 public:
@@ -38,7 +38,8 @@ _STLP_BEGIN_NAMESPACE
 template <class _CharT, class _Traits>
 basic_ios<_CharT, _Traits>
   ::basic_ios(basic_streambuf<_CharT, _Traits>* __streambuf)
-    : ios_base(), _M_cached_ctype(0),
+    : ios_base(), _M_cached_ctype(0), _M_cached_classic(false),
+      _M_cached_num_put(0), _M_cached_num_get(0),
       _M_fill(_STLP_NULL_CHAR_INIT(_CharT)), _M_streambuf(0), _M_tied_ostream(0) {
   basic_ios<_CharT, _Traits>::init(__streambuf);
 }
@@ -58,6 +59,9 @@ basic_ios<_CharT, _Traits>::copyfmt(const basic_ios<_CharT, _Traits>& __x) {
   _M_invoke_callbacks(erase_event);
   _M_copy_state(__x);           // Inherited from ios_base.
   _M_cached_ctype = __x._M_cached_ctype;
+  _M_cached_classic = __x._M_cached_classic;
+  _M_cached_num_put = __x._M_cached_num_put;
+  _M_cached_num_get = __x._M_cached_num_get;
   _M_fill = __x._M_fill;
   _M_tied_ostream = __x._M_tied_ostream;
   _M_invoke_callbacks(copyfmt_event);
@@ -74,6 +78,9 @@ locale basic_ios<_CharT, _Traits>::imbue(const locale& __loc) {
 
     // no throwing here
     _M_cached_ctype = &use_facet<ctype<char_type> >(__loc);
+    _M_cached_classic = (__loc == locale::classic());
+    _M_cached_num_put = 0;
+    _M_cached_num_get = 0;
   }
   _STLP_CATCH_ALL {
     __tmp = ios_base::imbue(__tmp);
@@ -88,7 +95,8 @@ locale basic_ios<_CharT, _Traits>::imbue(const locale& __loc) {
 
 template <class _CharT, class _Traits>
 basic_ios<_CharT, _Traits>::basic_ios()
-  : ios_base(),
+  : ios_base(), _M_cached_classic(false),
+    _M_cached_num_put(0), _M_cached_num_get(0),
     _M_fill(_STLP_NULL_CHAR_INIT(_CharT)), _M_streambuf(0), _M_tied_ostream(0)
 {}
 
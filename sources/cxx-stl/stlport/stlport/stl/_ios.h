@@ -115,10 +115,23 @@ public:                         // Locale-related member functions.
 protected:
   // Cached copy of the curent locale's ctype facet.  Set by init() and imbue().
   const ctype<char_type>* _M_cached_ctype;
+  // Whether the current locale is the classic one.  Set by init() and imbue().
+  bool _M_cached_classic;
+  // The current locale's num_put and num_get facets, looked up by the first
+  // numeric inserter or extractor that needs them.  Reset by init() and imbue().
+  const locale::facet* _M_cached_num_put;
+  const locale::facet* _M_cached_num_get;
 
 public:
   // Equivalent to &use_facet< Facet >(getloc()), but faster.
   const ctype<char_type>* _M_ctype_facet() const { return _M_cached_ctype; }
+  // Equivalent to getloc() == locale::classic(), but faster.
+  bool _M_is_classic() const { return _M_cached_classic; }
+  // Null until _M_set_num_put_facet/_M_set_num_get_facet is called.
+  const locale::facet* _M_num_put_facet() const { return _M_cached_num_put; }
+  void _M_set_num_put_facet(const locale::facet* __f) { _M_cached_num_put = __f; }
+  const locale::facet* _M_num_get_facet() const { return _M_cached_num_get; }
+  void _M_set_num_get_facet(const locale::facet* __f) { _M_cached_num_get = __f; }
 
 protected:
   basic_ios();
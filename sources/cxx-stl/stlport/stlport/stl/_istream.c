@@ -180,6 +180,24 @@ __pushback(basic_streambuf<_CharT, _Traits>* __buf, _CharT __c) {
 //----------------------------------------------------------------------
 // Definitions of basic_istream<>'s noninline member functions.
 
+// Shortcut for the decimal integer input of char streams using the classic
+// locale: the number is parsed straight from the get area.  Returns false,
+// without extracting anything, when the num_get facet has to be used.
+#if !defined (_STLP_NO_CLASSIC_NUM_SHORTCUT)
+_STLP_DECLSPEC bool _STLP_CALL __get_classic_num(basic_istream<char, char_traits<char> >&, long&, ios_base::iostate&);
+_STLP_DECLSPEC bool _STLP_CALL __get_classic_num(basic_istream<char, char_traits<char> >&, unsigned int&, ios_base::iostate&);
+_STLP_DECLSPEC bool _STLP_CALL __get_classic_num(basic_istream<char, char_traits<char> >&, unsigned long&, ios_base::iostate&);
+#  if defined (_STLP_LONG_LONG)
+_STLP_DECLSPEC bool _STLP_CALL __get_classic_num(basic_istream<char, char_traits<char> >&, _STLP_LONG_LONG&, ios_base::iostate&);
+_STLP_DECLSPEC bool _STLP_CALL __get_classic_num(basic_istream<char, char_traits<char> >&, unsigned _STLP_LONG_LONG&, ios_base::iostate&);
+#  endif
+#endif
+
+template <class _CharT, class _Traits, class _Number>
+inline bool _STLP_CALL
+__get_classic_num(basic_istream<_CharT, _Traits>&, _Number&, ios_base::iostate&)
+{ return false; }
+
 // Helper function for formatted input of numbers.
 template <class _CharT, class _Traits, class _Number>
 ios_base::iostate _STLP_CALL
@@ -190,10 +208,17 @@ __get_num(basic_istream<_CharT, _Traits>& __that, _Number& __val) {
   if (__sentry) {
     typedef num_get<_CharT, istreambuf_iterator<_CharT, _Traits> > _Num_get;
     _STLP_TRY {
-      // Do not remove additional parenthesis around use_facet instanciation, some compilers (VC6)
-      // require it when building the library.
-      (use_facet<_Num_get>(__that.getloc())).get(istreambuf_iterator<_CharT, _Traits>(__that.rdbuf()),
-                                               0, __that, __err, __val);
+      if (!__get_classic_num(__that, __val, __err)) {
+        const _Num_get* __ng = __STATIC_CAST(const _Num_get*, __that._M_num_get_facet());
+        if (__ng == 0) {
+          // Do not remove additional parenthesis around use_facet instanciation, some compilers (VC6)
+          // require it when building the library.
+          __ng = &(use_facet<_Num_get>(__that.getloc()));
+          __that._M_set_num_get_facet(__ng);
+        }
+        __ng->get(istreambuf_iterator<_CharT, _Traits>(__that.rdbuf()),
+                  0, __that, __err, __val);
+      }
     }
     _STLP_CATCH_ALL {
       __that._M_handle_exception(ios_base::badbit);
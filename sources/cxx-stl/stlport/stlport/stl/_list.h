@@ -301,6 +301,18 @@ protected:
   }
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  template <class... _Args>
+  _Node_base* _M_emplace_node(_Args&&... __args) {
+    _Node* __p = this->_M_node.allocate(1);
+    _STLP_TRY {
+      _Construct_Forward(&__p->_M_data, _STLP_STD::forward<_Args>(__args)...);
+    }
+    _STLP_UNWIND(this->_M_node.deallocate(__p, 1))
+    return __p;
+  }
+#endif
+
 public:
 #if !defined (_STLP_DONT_SUP_DFLT_PARAM)
   explicit list(size_type __n, const_reference __val = _STLP_DEFAULT_CONSTRUCTED(value_type),
@@ -360,9 +372,21 @@ public:
     : _STLP_PRIV _List_base<_Tp, _Alloc>(__move_source<_Base>(src.get())) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  list(_Self&& __x) noexcept
+    : _STLP_PRIV _List_base<_Tp, _Alloc>(__move_source<_Base>(__x)) {}
+#endif
+
   ~list() {}
 
   _Self& operator = (const _Self& __x);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator = (_Self&& __x) {
+    swap(__x);
+    __x.clear();
+    return *this;
+  }
+#endif
 
   iterator begin()                      { return iterator(this->_M_node._M_data._M_next); }
   const_iterator begin() const          { return const_iterator(this->_M_node._M_data._M_next); }
@@ -508,6 +532,28 @@ public:
   void push_front(const_reference __x) { insert(begin(), __x); }
   void push_back (const_reference __x) { insert(end(), __x); }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  template <class... _Args>
+  iterator emplace(iterator __pos, _Args&&... __args) {
+    _Node_base* __tmp = _M_emplace_node(_STLP_STD::forward<_Args>(__args)...);
+    _Node_base* __n = __pos._M_node;
+    _Node_base* __p = __n->_M_prev;
+    __tmp->_M_next = __n;
+    __tmp->_M_prev = __p;
+    __p->_M_next = __tmp;
+    __n->_M_prev = __tmp;
+    return iterator(__tmp);
+  }
+  template <class... _Args>
+  void emplace_front(_Args&&... __args) { emplace(begin(), _STLP_STD::forward<_Args>(__args)...); }
+  template <class... _Args>
+  void emplace_back(_Args&&... __args) { emplace(end(), _STLP_STD::forward<_Args>(__args)...); }
+
+  iterator insert(iterator __pos, value_type&& __x) { return emplace(__pos, _STLP_STD::move(__x)); }
+  void push_front(value_type&& __x) { emplace(begin(), _STLP_STD::move(__x)); }
+  void push_back (value_type&& __x) { emplace(end(), _STLP_STD::move(__x)); }
+#endif
+
 #if defined (_STLP_DONT_SUP_DFLT_PARAM) && !defined (_STLP_NO_ANACHRONISMS)
   iterator insert(iterator __pos)
   { return insert(__pos, _STLP_DEFAULT_CONSTRUCTED(value_type)); }
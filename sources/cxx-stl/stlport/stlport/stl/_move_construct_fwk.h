@@ -152,7 +152,84 @@ struct __move_traits_help2 {
                           typename _MoveTraits2::complete>::_Ret complete;
 };
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+/*************************************************************
+ * Rvalue references:
+ *With a C++11 compiler the containers also have real move
+ *constructors and assignments, implemented on top of the
+ *__move_source ones, and construct elements in place.
+ *************************************************************/
+template <class _Tp>
+struct __remove_ref { typedef _Tp _Ret; };
+template <class _Tp>
+struct __remove_ref<_Tp&> { typedef _Tp _Ret; };
+template <class _Tp>
+struct __remove_ref<_Tp&&> { typedef _Tp _Ret; };
+
+template <class _Tp>
+_Tp&& __declval() noexcept;
+
+template <bool _Cond, class _Tp = void>
+struct __enable_if {};
+template <class _Tp>
+struct __enable_if<true, _Tp> { typedef _Tp _Ret; };
+
+template <class _From, class _To>
+struct __is_convertible {
+  static char _S_test(_To);
+  static char (&_S_test(...))[2];
+  enum { _Ret = sizeof(_S_test(_STLP_PRIV __declval<_From>())) == 1 };
+};
+
+/*
+ * Elements are only moved instead of copied when the vector grows if their
+ * move constructor cannot throw, otherwise the strong exception guarantee
+ * of the insertion would be lost.
+ */
+template <class _Tp>
+struct __is_nothrow_movable {
+  typedef typename __bool2type<noexcept(_Tp(_STLP_PRIV __declval<_Tp>()))>::_Ret _Ret;
+};
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+template <class _Tp>
+inline typename _STLP_PRIV __remove_ref<_Tp>::_Ret&& move(_Tp&& __t) noexcept
+{ return static_cast<typename _STLP_PRIV __remove_ref<_Tp>::_Ret&&>(__t); }
+
+template <class _Tp>
+inline _Tp&& forward(typename _STLP_PRIV __remove_ref<_Tp>::_Ret& __t) noexcept
+{ return static_cast<_Tp&&>(__t); }
+
+template <class _Tp>
+inline _Tp&& forward(typename _STLP_PRIV __remove_ref<_Tp>::_Ret&& __t) noexcept
+{ return static_cast<_Tp&&>(__t); }
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * Same as copy and copy_backward, but move assigning the elements, used
+ * by the containers to close the gap left by erased elements.
+ */
+template <class _InputIter, class _OutputIter>
+inline _OutputIter __move_assign(_InputIter __first, _InputIter __last, _OutputIter __result) {
+  for (; __first != __last; ++__first, ++__result)
+    *__result = _STLP_STD::move(*__first);
+  return __result;
+}
+
+template <class _BidirectionalIter1, class _BidirectionalIter2>
+inline _BidirectionalIter2 __move_assign_backward(_BidirectionalIter1 __first, _BidirectionalIter1 __last,
+                                                  _BidirectionalIter2 __result) {
+  while (__first != __last)
+    *--__result = _STLP_STD::move(*--__last);
+  return __result;
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+#else
 _STLP_MOVE_TO_STD_NAMESPACE
+#endif
 
 _STLP_END_NAMESPACE
 
@@ -159,6 +159,10 @@ __get_integer(_InputIter& __first, _InputIter& __last,
      *__group_sizes_end++ = __current_group_size;
    }
 
+   // The magnitude of the minimum value cannot be negated.
+   if (!__is_negative && __result == (numeric_limits<_Integer>::min)())
+     __ovflow = true;
+
    // fbp : added to not modify value if nothing was read
    if (__got > 0) {
        __val = __ovflow ? __is_negative ? (numeric_limits<_Integer>::min)()
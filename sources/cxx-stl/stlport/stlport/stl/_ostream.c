@@ -188,6 +188,23 @@ bool basic_ostream<_CharT, _Traits>
 
 _STLP_MOVE_TO_PRIV_NAMESPACE
 
+// Shortcut for the integer output of char streams using the classic
+// locale: the digits are written straight into the put area.  Returns
+// false when the num_put facet has to be used.
+#if !defined (_STLP_NO_CLASSIC_NUM_SHORTCUT)
+_STLP_DECLSPEC bool _STLP_CALL __put_classic_num(basic_ostream<char, char_traits<char> >&, long, bool&);
+_STLP_DECLSPEC bool _STLP_CALL __put_classic_num(basic_ostream<char, char_traits<char> >&, unsigned long, bool&);
+#  if defined (_STLP_LONG_LONG)
+_STLP_DECLSPEC bool _STLP_CALL __put_classic_num(basic_ostream<char, char_traits<char> >&, _STLP_LONG_LONG, bool&);
+_STLP_DECLSPEC bool _STLP_CALL __put_classic_num(basic_ostream<char, char_traits<char> >&, unsigned _STLP_LONG_LONG, bool&);
+#  endif
+#endif
+
+template <class _CharT, class _Traits, class _Number>
+inline bool _STLP_CALL
+__put_classic_num(basic_ostream<_CharT, _Traits>&, _Number, bool&)
+{ return false; }
+
 // Helper function for numeric output.
 template <class _CharT, class _Traits, class _Number>
 basic_ostream<_CharT, _Traits>&  _STLP_CALL
@@ -198,10 +215,16 @@ __put_num(basic_ostream<_CharT, _Traits>& __os, _Number __x) {
 
   if (__sentry) {
     _STLP_TRY {
-      typedef num_put<_CharT, ostreambuf_iterator<_CharT, _Traits> > _NumPut;
-      __failed = (use_facet<_NumPut>(__os.getloc())).put(ostreambuf_iterator<_CharT, _Traits>(__os.rdbuf()),
-                                                         __os, __os.fill(),
-                                                         __x).failed();
+      if (!__put_classic_num(__os, __x, __failed)) {
+        typedef num_put<_CharT, ostreambuf_iterator<_CharT, _Traits> > _NumPut;
+        const _NumPut* __np = __STATIC_CAST(const _NumPut*, __os._M_num_put_facet());
+        if (__np == 0) {
+          __np = &(use_facet<_NumPut>(__os.getloc()));
+          __os._M_set_num_put_facet(__np);
+        }
+        __failed = __np->put(ostreambuf_iterator<_CharT, _Traits>(__os.rdbuf()),
+                             __os, __os.fill(), __x).failed();
+      }
     }
     _STLP_CATCH_ALL {
       __os._M_handle_exception(ios_base::badbit);
@@ -74,6 +74,36 @@ struct pair {
   {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  // Only takes part when both arguments convert, so that pair<int*, int*>(0, 0)
+  // still goes through the const reference constructor.
+  template <class _U1, class _U2,
+            class = typename _STLP_PRIV __enable_if<_STLP_PRIV __is_convertible<_U1, _T1>::_Ret &&
+                                                    _STLP_PRIV __is_convertible<_U2, _T2>::_Ret>::_Ret>
+  pair(_U1&& __a, _U2&& __b)
+    : first(_STLP_STD::forward<_U1>(__a)), second(_STLP_STD::forward<_U2>(__b)) {}
+
+  template <class _U1, class _U2>
+  pair(pair<_U1, _U2>&& __p)
+    : first(_STLP_STD::forward<_U1>(__p.first)), second(_STLP_STD::forward<_U2>(__p.second)) {}
+
+  pair(pair<_T1, _T2>&& __o)
+    noexcept(noexcept(_T1(_STLP_PRIV __declval<_T1>())) && noexcept(_T2(_STLP_PRIV __declval<_T2>())))
+    : first(_STLP_STD::forward<_T1>(__o.first)), second(_STLP_STD::forward<_T2>(__o.second)) {}
+
+  // The move constructor hides the implicit assignment operators.
+  pair& operator=(const pair<_T1, _T2>& __o) {
+    first = __o.first;
+    second = __o.second;
+    return *this;
+  }
+  pair& operator=(pair<_T1, _T2>&& __o) {
+    first = _STLP_STD::forward<_T1>(__o.first);
+    second = _STLP_STD::forward<_T2>(__o.second);
+    return *this;
+  }
+#endif
+
   __TRIVIAL_DESTRUCTOR(pair)
 };
 
@@ -126,7 +156,11 @@ inline pair<_T1 const*, _T2 const*> make_pair(_T1 const (&__x)[_Sz1],
 
 template <class _T1, class _T2>
 inline pair<_T1, _T2> _STLP_CALL make_pair(_T1 __x, _T2 __y)
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+{ return pair<_T1, _T2>(_STLP_STD::move(__x), _STLP_STD::move(__y)); }
+#else
 { return pair<_T1, _T2>(__x, __y); }
+#endif
 
 _STLP_END_NAMESPACE
 
@@ -138,6 +138,15 @@ public:
     : _M_t(__move_source<_Rep_type>(src.get()._M_t)) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  set(_Self&& __x) : _M_t(_STLP_STD::move(__x._M_t)) {}
+
+  _Self& operator=(_Self&& __x) {
+    _M_t = _STLP_STD::move(__x._M_t);
+    return *this;
+  }
+#endif
+
   _Self& operator=(const _Self& __x) {
     _M_t = __x._M_t;
     return *this;
@@ -169,6 +178,19 @@ public:
   { return _M_t.insert_unique(__x); }
   iterator insert(iterator __pos, const value_type& __x)
   { return _M_t.insert_unique( __pos , __x); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  pair<iterator,bool> insert(value_type&& __x)
+  { return _M_t.insert_unique(_STLP_STD::move(__x)); }
+  iterator insert(iterator __pos, value_type&& __x)
+  { return _M_t.insert_unique(__pos, _STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  pair<iterator,bool> emplace(_Args&&... __args)
+  { return _M_t.emplace_unique(_STLP_STD::forward<_Args>(__args)...); }
+  template <class... _Args>
+  iterator emplace_hint(iterator __pos, _Args&&... __args)
+  { return _M_t.emplace_hint_unique(__pos, _STLP_STD::forward<_Args>(__args)...); }
+#endif
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   void insert(_InputIterator __first, _InputIterator __last)
@@ -314,6 +336,15 @@ public:
     : _M_t(__move_source<_Rep_type>(src.get()._M_t)) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  multiset(_Self&& __x) : _M_t(_STLP_STD::move(__x._M_t)) {}
+
+  _Self& operator=(_Self&& __x) {
+    _M_t = _STLP_STD::move(__x._M_t);
+    return *this;
+  }
+#endif
+
   // accessors:
   key_compare key_comp() const { return _M_t.key_comp(); }
   value_compare value_comp() const { return _M_t.key_comp(); }
@@ -340,6 +371,19 @@ public:
   { return _M_t.insert_equal(__x); }
   iterator insert(iterator __pos, const value_type& __x)
   { return _M_t.insert_equal(__pos, __x); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  iterator insert(value_type&& __x)
+  { return _M_t.insert_equal(_STLP_STD::move(__x)); }
+  iterator insert(iterator __pos, value_type&& __x)
+  { return _M_t.insert_equal(__pos, _STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  iterator emplace(_Args&&... __args)
+  { return _M_t.emplace_equal(_STLP_STD::forward<_Args>(__args)...); }
+  template <class... _Args>
+  iterator emplace_hint(iterator __pos, _Args&&... __args)
+  { return _M_t.emplace_hint_equal(__pos, _STLP_STD::forward<_Args>(__args)...); }
+#endif
 
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
@@ -272,6 +272,19 @@ private:
   }
 #endif /*_STLP_DONT_SUP_DFLT_PARAM*/
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  template <class... _Args>
+  _Node* _M_emplace_node(_Args&&... __args) {
+    _Node* __node = this->_M_head.allocate(1);
+    _STLP_TRY {
+      _Construct_Forward(&__node->_M_data, _STLP_STD::forward<_Args>(__args)...);
+      __node->_M_next = 0;
+    }
+    _STLP_UNWIND(this->_M_head.deallocate(__node, 1))
+    return __node;
+  }
+#endif
+
 public:
 
   allocator_type get_allocator() const { return _Base::get_allocator(); }
@@ -335,7 +348,19 @@ public:
     : _STLP_PRIV _Slist_base<_Tp, _Alloc>(__move_source<_Base>(src.get())) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  slist(_Self&& __x) noexcept
+    : _STLP_PRIV _Slist_base<_Tp, _Alloc>(__move_source<_Base>(__x)) {}
+#endif
+
   _Self& operator= (const _Self& __x);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator= (_Self&& __x) {
+    swap(__x);
+    __x.clear();
+    return *this;
+  }
+#endif
 
   ~slist() {}
 
@@ -448,6 +473,17 @@ public:
   void push_front() { _STLP_PRIV __slist_make_link(&this->_M_head._M_data, _M_create_node());}
 #endif /*_STLP_DONT_SUP_DFLT_PARAM && !_STLP_NO_ANACHRONISMS*/
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  void push_front(value_type&& __x)
+  { emplace_front(_STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  void emplace_front(_Args&&... __args) {
+    _STLP_PRIV __slist_make_link(&this->_M_head._M_data,
+                                 _M_emplace_node(_STLP_STD::forward<_Args>(__args)...));
+  }
+#endif
+
   void pop_front() {
     _Node* __node = __STATIC_CAST(_Node*, this->_M_head._M_data._M_next);
     this->_M_head._M_data._M_next = __node->_M_next;
@@ -611,6 +647,17 @@ public:
   }
 #endif /*_STLP_DONT_SUP_DFLT_PARAM*/
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  iterator insert_after(iterator __pos, value_type&& __x)
+  { return emplace_after(__pos, _STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  iterator emplace_after(iterator __pos, _Args&&... __args) {
+    return iterator(_STLP_PRIV __slist_make_link(__pos._M_node,
+                                                 _M_emplace_node(_STLP_STD::forward<_Args>(__args)...)));
+  }
+#endif
+
   void insert_after(iterator __pos, size_type __n, const value_type& __x) {
     _M_insert_after_fill(__pos._M_node, __n, __x);
   }
@@ -264,10 +264,13 @@ basic_stringbuf<_CharT, _Traits, _Alloc>::setbuf(_CharT*, streamsize __n) {
     bool __do_get_area = false;
     bool __do_put_area = false;
     ptrdiff_t __offg = 0;
+    ptrdiff_t __offb = 0;
     ptrdiff_t __offp = 0;
 
-    if (this->pbase() == _S_start(_M_str)) {
+    // In the app and ate modes the put area starts at the end of the string.
+    if (this->pbase() == _S_start(_M_str) || this->pbase() == _S_finish(_M_str)) {
       __do_put_area = true;
+      __offb = this->pbase() - _S_start(_M_str);
       __offp = this->pptr() - this->pbase();
     }
 
@@ -286,7 +289,7 @@ basic_stringbuf<_CharT, _Traits, _Alloc>::setbuf(_CharT*, streamsize __n) {
     }
 
     if (__do_put_area) {
-      this->setp(__data_ptr, _S_finish(_M_str));
+      this->setp(__data_ptr + __offb, _S_finish(_M_str));
       this->pbump((int)__offp);
     }
   }
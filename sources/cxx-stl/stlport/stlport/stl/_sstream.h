@@ -75,6 +75,21 @@ public:                         // Get or set the string.
   _String str() const { return _M_str; }
   void str(const _String& __s);
 
+#if !defined (_STLP_NO_EXTENSIONS)
+  // These are extensions.  swap_str() exchanges the string with __s
+  // without copying it, leaving the stringbuf as str(__s) would; view()
+  // gives the characters of str() without copying them, until the next
+  // modification of the stringbuf; reserve() preallocates the string.
+  void swap_str(_String& __s) {
+    _M_str.swap(__s);
+    _M_set_ptrs();
+  }
+  pair<const _CharT*, size_t> view() const
+  { return pair<const _CharT*, size_t>(_M_str.data(), _M_str.size()); }
+  void reserve(size_t __n)
+  { _Self::setbuf(0, __STATIC_CAST(streamsize, __n)); }
+#endif
+
 protected:                      // Overridden virtual member functions.
   virtual int_type underflow();
   virtual int_type uflow();
@@ -141,6 +156,11 @@ public:                         // Member functions
   _String str() const { return _M_buf.str(); }
   void str(const _String& __s) { _M_buf.str(__s); }
 
+#if !defined (_STLP_NO_EXTENSIONS)
+  void swap_str(_String& __s) { _M_buf.swap_str(__s); }
+  pair<const _CharT*, size_t> view() const { return _M_buf.view(); }
+#endif
+
 private:
   basic_stringbuf<_CharT, _Traits, _Alloc> _M_buf;
 
@@ -184,6 +204,11 @@ public:                         // Member functions.
   _String str() const { return _M_buf.str(); }
     void str(const _String& __s) { _M_buf.str(__s); } // dwa 02/07/00 - BUG STOMPER DAVE
 
+#if !defined (_STLP_NO_EXTENSIONS)
+  void swap_str(_String& __s) { _M_buf.swap_str(__s); }
+  pair<const _CharT*, size_t> view() const { return _M_buf.view(); }
+  void reserve(size_t __n) { _M_buf.reserve(__n); }
+#endif
 
 private:
   basic_stringbuf<_CharT, _Traits, _Alloc> _M_buf;
@@ -230,6 +255,12 @@ public:                         // Member functions.
   _String str() const { return _M_buf.str(); }
     void str(const _String& __s) { _M_buf.str(__s); }
 
+#if !defined (_STLP_NO_EXTENSIONS)
+  void swap_str(_String& __s) { _M_buf.swap_str(__s); }
+  pair<const _CharT*, size_t> view() const { return _M_buf.view(); }
+  void reserve(size_t __n) { _M_buf.reserve(__n); }
+#endif
+
 private:
   basic_stringbuf<_CharT, _Traits, _Alloc> _M_buf;
 
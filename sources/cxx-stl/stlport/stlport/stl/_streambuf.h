@@ -119,6 +119,12 @@ protected:                      // Protected interface to the put area
     _M_pend   = __pend;
   }
 
+public:
+  // Same alternate public interface for the put area.
+  char_type* _M_pptr()  const { return pptr(); }
+  char_type* _M_epptr() const { return epptr(); }
+  void _M_pbump(int __n)      { pbump(__n); }
+
 protected:                      // Virtual buffer management functions.
 
   virtual basic_streambuf<_CharT, _Traits>* setbuf(char_type*, streamsize);
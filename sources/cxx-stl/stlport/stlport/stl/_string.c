@@ -70,6 +70,36 @@ struct _Not_within_traits : public unary_function<typename _Traits::char_type, b
   }
 };
 
+// Searches of char strings with the STLport char_traits, defined in the
+// library where they use the SIMD instructions the CPU has.  They return
+// __last when nothing is found.  __str_search_char needs
+// __n <= __last - __first, __str_find_set_char looks for the first
+// character that is (or, if __not, is not) in [__s, __s + __n).
+_STLP_DECLSPEC const char* _STLP_CALL
+__str_search_char(const char* __first, const char* __last, const char* __s, size_t __n);
+_STLP_DECLSPEC const char* _STLP_CALL
+__str_find_set_char(const char* __first, const char* __last,
+                    const char* __s, size_t __n, bool __not);
+
+template <class _CharT, class _Traits>
+inline const _CharT* __str_search(const _CharT* __first, const _CharT* __last,
+                                  const _CharT* __s, size_t __n, _Traits*)
+{ return _STLP_STD::search(__first, __last, __s, __s + __n, _STLP_PRIV _Eq_traits<_Traits>()); }
+
+inline const char* __str_search(const char* __first, const char* __last,
+                                const char* __s, size_t __n, char_traits<char>*)
+{ return __str_search_char(__first, __last, __s, __n); }
+
+inline const char* __str_find_first_of(const char* __first1, const char* __last1,
+                                       const char* __first2, const char* __last2,
+                                       char_traits<char>*)
+{ return __str_find_set_char(__first1, __last1, __first2, __last2 - __first2, false); }
+
+inline const char* __str_find_first_not_of(const char* __first1, const char* __last1,
+                                           const char* __first2, const char* __last2,
+                                           char_traits<char>*)
+{ return __str_find_set_char(__first1, __last1, __first2, __last2 - __first2, true); }
+
 template <class _InputIter, class _CharT, class _Traits>
 inline _InputIter __str_find_first_of_aux(_InputIter __first1, _InputIter __last1,
                                           const _CharT* __first2, const _CharT* __last2,
@@ -429,8 +459,8 @@ __size_type__ basic_string<_CharT,_Traits,_Alloc>::find( const _CharT* __s, size
   }
 
   const_pointer __result =
-    _STLP_STD::search(this->_M_Start() + __pos, this->_M_Finish(),
-                      __s, __s + __n, _STLP_PRIV _Eq_traits<_Traits>());
+    _STLP_PRIV __str_search(this->_M_Start() + __pos, this->_M_Finish(),
+                            __s, __n, __STATIC_CAST(_Traits*, 0));
   return __result != this->_M_Finish() ? __result - this->_M_Start() : npos;
 }
 
@@ -441,10 +471,8 @@ __size_type__ basic_string<_CharT,_Traits,_Alloc>::find(_CharT __c, size_type __
     return npos;
   }
 
-  const_pointer __result =
-    _STLP_STD::find_if(this->_M_Start() + __pos, this->_M_Finish(),
-                       _STLP_PRIV _Eq_char_bound<_Traits>(__c));
-  return __result != this->_M_Finish() ? __result - this->_M_Start() : npos;
+  const_pointer __result = _Traits::find(this->_M_Start() + __pos, size() - __pos, __c);
+  return __result != 0 ? __result - this->_M_Start() : npos;
 }
 
 template <class _CharT, class _Traits, class _Alloc>
@@ -254,6 +254,19 @@ public:                         // Constructor, destructor, assignment.
     : _STLP_PRIV _String_base<_CharT,_Alloc>(__move_source<_Base>(src.get())) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  // The source is left empty, which takes a block of its own unless the
+  // short string optimization is used.
+  basic_string(_Self&& __s)
+#  if defined (_STLP_USE_SHORT_STRING_OPTIM)
+    noexcept
+#  endif
+    : _STLP_PRIV _String_base<_CharT,_Alloc>(__s.get_allocator(), _Base::_DEFAULT_SIZE) {
+    _M_terminate_string();
+    this->_M_swap(__s);
+  }
+#endif
+
   // Check to see if _InputIterator is an integer type.  If so, then
   // it can't be an iterator.
 #if defined (_STLP_MEMBER_TEMPLATES) && !defined (_STLP_USE_MSVC6_MEM_T_BUG_WORKAROUND)
@@ -350,6 +363,16 @@ public:
     return *this;
   }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator=(_Self&& __s) {
+    if (&__s != this) {
+      this->_M_swap(__s);
+      __s.clear();
+    }
+    return *this;
+  }
+#endif
+
   _Self& operator=(const _CharT* __s) {
     _STLP_FIX_LITERAL_BUG(__s)
     return _M_assign(__s, __s + traits_type::length(__s));
@@ -123,6 +123,18 @@ inline long _STLP_atomic_decrement_gcc_x86(long volatile* p) {
 #        define _STLP_ATOMIC_DECREMENT(__x) (_STLP_atomic_decrement_gcc_x86((long volatile*)__x))
 #      endif
 typedef long __stl_atomic_t;
+#    elif defined (__GNUC__) && \
+          ((__SIZEOF_SIZE_T__ == 4 && defined (__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)) || \
+           (__SIZEOF_SIZE_T__ == 8 && defined (__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)))
+/* The gcc builtins, when the target implements them inline.  Without them
+ * every reference count (locales, facets) would be guarded by a mutex. */
+#      if !defined (_STLP_ATOMIC_INCREMENT)
+#        define _STLP_ATOMIC_INCREMENT(__x) __sync_add_and_fetch(__x, 1)
+#      endif
+#      if !defined (_STLP_ATOMIC_DECREMENT)
+#        define _STLP_ATOMIC_DECREMENT(__x) __sync_sub_and_fetch(__x, 1)
+#      endif
+typedef size_t __stl_atomic_t;
 #    else
 typedef size_t __stl_atomic_t;
 #    endif /* if defined(__GNUC__) && defined(__i386__) */
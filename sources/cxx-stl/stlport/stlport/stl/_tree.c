@@ -381,6 +381,120 @@ _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Traits,_Alloc> ::_M_insert(_Rb_tree_n
   return iterator(__new_node);
 }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+template <class _Key, class _Compare,
+          class _Value, class _KeyOfValue, class _Traits, class _Alloc>
+__iterator__
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Traits,_Alloc> ::_M_insert_node(_Rb_tree_node_base * __parent,
+                                                                           _Rb_tree_node_base * __new_node,
+                                                                           _Rb_tree_node_base * __on_left,
+                                                                           _Rb_tree_node_base * __on_right) {
+  if ( __parent == &this->_M_header._M_data ) {
+    _S_left(__parent) = __new_node;   // also makes _M_leftmost() = __new_node
+    _M_root() = __new_node;
+    _M_rightmost() = __new_node;
+  }
+  else if ( __on_right == 0 &&     // If __on_right != 0, the remainder fails to false
+           ( __on_left != 0 ||     // If __on_left != 0, the remainder succeeds to true
+             _M_key_compare( _S_key(__new_node), _S_key(__parent) ) ) ) {
+    _S_left(__parent) = __new_node;
+    if (__parent == _M_leftmost())
+      _M_leftmost() = __new_node;   // maintain _M_leftmost() pointing to min node
+  }
+  else {
+    _S_right(__parent) = __new_node;
+    if (__parent == _M_rightmost())
+      _M_rightmost() = __new_node;  // maintain _M_rightmost() pointing to max node
+  }
+  _S_parent(__new_node) = __parent;
+  _Rb_global_inst::_Rebalance(__new_node, this->_M_header._M_data._M_parent);
+  ++_M_node_count;
+  return iterator(__new_node);
+}
+
+template <class _Key, class _Compare,
+          class _Value, class _KeyOfValue, class _Traits, class _Alloc>
+__iterator__
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Traits,_Alloc> ::_M_insert_equal_node(_Rb_tree_node_base * __new_node) {
+  _Base_ptr __y = &this->_M_header._M_data;
+  _Base_ptr __x = _M_root();
+  while (__x != 0) {
+    __y = __x;
+    if (_M_key_compare(_S_key(__new_node), _S_key(__x))) {
+      __x = _S_left(__x);
+    }
+    else
+      __x = _S_right(__x);
+  }
+  return _M_insert_node(__y, __new_node, __x);
+}
+
+template <class _Key, class _Compare,
+          class _Value, class _KeyOfValue, class _Traits, class _Alloc>
+pair<__iterator__, bool>
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Traits,_Alloc> ::_M_insert_unique_node(_Rb_tree_node_base * __new_node) {
+  _Base_ptr __y = &this->_M_header._M_data;
+  _Base_ptr __x = _M_root();
+  bool __comp = true;
+  while (__x != 0) {
+    __y = __x;
+    __comp = _M_key_compare(_S_key(__new_node), _S_key(__x));
+    __x = __comp ? _S_left(__x) : _S_right(__x);
+  }
+  iterator __j = iterator(__y);
+  if (__comp) {
+    if (__j == begin())
+      return pair<iterator,bool>(_M_insert_node(__y, __new_node, /* __x*/ __y), true);
+    else
+      --__j;
+  }
+  if (_M_key_compare(_S_key(__j._M_node), _S_key(__new_node))) {
+    return pair<iterator,bool>(_M_insert_node(__y, __new_node, __x), true);
+  }
+  return pair<iterator,bool>(__j, false);
+}
+
+template <class _Key, class _Compare,
+          class _Value, class _KeyOfValue, class _Traits, class _Alloc>
+pair<__iterator__, bool>
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Traits,_Alloc> ::insert_unique(_Value&& __val) {
+  _Base_ptr __y = &this->_M_header._M_data;
+  _Base_ptr __x = _M_root();
+  bool __comp = true;
+  while (__x != 0) {
+    __y = __x;
+    __comp = _M_key_compare(_KeyOfValue()(__val), _S_key(__x));
+    __x = __comp ? _S_left(__x) : _S_right(__x);
+  }
+  iterator __j = iterator(__y);
+  if (__comp) {
+    if (__j == begin())
+      return pair<iterator,bool>(_M_insert_node(__y, _M_emplace_node(_STLP_STD::move(__val)), /* __x*/ __y), true);
+    else
+      --__j;
+  }
+  if (_M_key_compare(_S_key(__j._M_node), _KeyOfValue()(__val))) {
+    // The side of __y is already known: the built node is not compared again,
+    // as the comparison could throw.
+    _Base_ptr __on_left = __comp ? __y : 0;
+    _Base_ptr __on_right = __comp ? 0 : __y;
+    return pair<iterator,bool>(_M_insert_node(__y, _M_emplace_node(_STLP_STD::move(__val)), __on_left, __on_right), true);
+  }
+  return pair<iterator,bool>(__j, false);
+}
+
+// Of the hints only end() is used, as in emplace_hint_unique.
+template <class _Key, class _Compare,
+          class _Value, class _KeyOfValue, class _Traits, class _Alloc>
+__iterator__
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Traits,_Alloc> ::insert_unique(iterator __pos, _Value&& __val) {
+  if (__pos._M_node == &this->_M_header._M_data && !empty() &&
+      _M_key_compare(_S_key(_M_rightmost()), _KeyOfValue()(__val)))
+    return _M_insert_node(_M_rightmost(), _M_emplace_node(_STLP_STD::move(__val)), 0, __pos._M_node);
+  return insert_unique(_STLP_STD::move(__val)).first;
+}
+#endif
+
 template <class _Key, class _Compare,
           class _Value, class _KeyOfValue, class _Traits, class _Alloc>
 __iterator__
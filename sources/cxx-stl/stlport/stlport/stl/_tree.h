@@ -323,6 +323,25 @@ protected:
     return __tmp;
   }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  template <class... _Args>
+  _Base_ptr _M_emplace_node(_Args&&... __args) {
+    _Link_type __tmp = this->_M_header.allocate(1);
+    _STLP_TRY {
+      _Construct_Forward(&__tmp->_M_value_field, _STLP_STD::forward<_Args>(__args)...);
+    }
+    _STLP_UNWIND(this->_M_header.deallocate(__tmp,1))
+    _S_left(__tmp) = 0;
+    _S_right(__tmp) = 0;
+    return __tmp;
+  }
+
+  void _M_destroy_node(_Base_ptr __x) {
+    _STLP_STD::_Destroy(&_S_value(__x));
+    this->_M_header.deallocate(__STATIC_CAST(_Link_type, __x), 1);
+  }
+#endif
+
   _Base_ptr _M_clone_node(_Base_ptr __x) {
     _Base_ptr __tmp = _M_create_node(_S_value(__x));
     _S_color(__tmp) = _S_color(__x);
@@ -374,6 +393,12 @@ public:
 
 private:
   iterator _M_insert(_Base_ptr __parent, const value_type& __val, _Base_ptr __on_left = 0, _Base_ptr __on_right = 0);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  // Same as above for a node whose value is already built.
+  iterator _M_insert_node(_Base_ptr __parent, _Base_ptr __new_node, _Base_ptr __on_left = 0, _Base_ptr __on_right = 0);
+  pair<iterator,bool> _M_insert_unique_node(_Base_ptr __new_node);
+  iterator _M_insert_equal_node(_Base_ptr __new_node);
+#endif
   _Base_ptr _M_copy(_Base_ptr __x, _Base_ptr __p);
   void _M_erase(_Base_ptr __x);
 
@@ -411,8 +436,23 @@ public:
   { src.get()._M_node_count = 0; }
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Rb_tree(_Self&& __x)
+    : _Rb_tree_base<_Value, _Alloc>(__move_source<_Base>(__x)),
+      _M_node_count(__x._M_node_count),
+      _M_key_compare(_AsMoveSource(__x._M_key_compare))
+  { __x._M_node_count = 0; }
+#endif
+
   ~_Rb_tree() { clear(); }
   _Self& operator=(const _Self& __x);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator=(_Self&& __x) {
+    clear();
+    swap(__x);
+    return *this;
+  }
+#endif
 
 public:
                                 // accessors:
@@ -461,6 +501,74 @@ public:
   iterator insert_unique(iterator __pos, const value_type& __x);
   iterator insert_equal(iterator __pos, const value_type& __x);
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  // The key is looked up before __x is moved into a new node, so that __x
+  // is left alone if an equivalent key is already there.
+  pair<iterator,bool> insert_unique(value_type&& __x);
+  iterator insert_equal(value_type&& __x)
+  { return emplace_equal(_STLP_STD::move(__x)); }
+
+  iterator insert_unique(iterator __pos, value_type&& __x);
+  iterator insert_equal(iterator __pos, value_type&& __x)
+  { return emplace_hint_equal(__pos, _STLP_STD::move(__x)); }
+
+  // The value is built in its node before looking for its place, the node
+  // is released if an equivalent key is already there.
+  template <class... _Args>
+  pair<iterator,bool> emplace_unique(_Args&&... __args) {
+    _Base_ptr __z = _M_emplace_node(_STLP_STD::forward<_Args>(__args)...);
+    pair<iterator,bool> __res;
+    _STLP_TRY {
+      __res = _M_insert_unique_node(__z);
+    }
+    _STLP_UNWIND(_M_destroy_node(__z))
+    if (!__res.second)
+      _M_destroy_node(__z);
+    return __res;
+  }
+
+  template <class... _Args>
+  iterator emplace_equal(_Args&&... __args) {
+    _Base_ptr __z = _M_emplace_node(_STLP_STD::forward<_Args>(__args)...);
+    _STLP_TRY {
+      return _M_insert_equal_node(__z);
+    }
+    _STLP_UNWIND(_M_destroy_node(__z))
+    _STLP_RET_AFTER_THROW(end())
+  }
+
+  // Of the hints only end() is used, to append values coming in order.
+  template <class... _Args>
+  iterator emplace_hint_unique(iterator __pos, _Args&&... __args) {
+    _Base_ptr __z = _M_emplace_node(_STLP_STD::forward<_Args>(__args)...);
+    pair<iterator,bool> __res;
+    _STLP_TRY {
+      if (__pos._M_node == &this->_M_header._M_data && !empty() &&
+          _M_key_compare(_S_key(_M_rightmost()), _S_key(__z)))
+        __res = pair<iterator,bool>(_M_insert_node(_M_rightmost(), __z, 0, __pos._M_node), true);
+      else
+        __res = _M_insert_unique_node(__z);
+    }
+    _STLP_UNWIND(_M_destroy_node(__z))
+    if (!__res.second)
+      _M_destroy_node(__z);
+    return __res.first;
+  }
+
+  template <class... _Args>
+  iterator emplace_hint_equal(iterator __pos, _Args&&... __args) {
+    _Base_ptr __z = _M_emplace_node(_STLP_STD::forward<_Args>(__args)...);
+    _STLP_TRY {
+      if (__pos._M_node == &this->_M_header._M_data && !empty() &&
+          !_M_key_compare(_S_key(__z), _S_key(_M_rightmost())))
+        return _M_insert_node(_M_rightmost(), __z, 0, __pos._M_node);
+      return _M_insert_equal_node(__z);
+    }
+    _STLP_UNWIND(_M_destroy_node(__z))
+    _STLP_RET_AFTER_THROW(end())
+  }
+#endif
+
 #if defined (_STLP_MEMBER_TEMPLATES)
   template<class _II> void insert_equal(_II __first, _II __last) {
     for ( ; __first != __last; ++__first)
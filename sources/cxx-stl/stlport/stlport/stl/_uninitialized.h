@@ -410,6 +410,44 @@ __uninitialized_copy_fill(_Iter __first1, _Iter __last1, _Iter __first2, _Iter _
   _STLP_UNWIND(_STLP_STD::_Destroy_Range(__first2, __mid2))
 }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+/* __umove_ptrs:
+ * Relocation of the elements of a type that is not aware of the move
+ * framework: its own move constructor is used if it cannot throw.
+ */
+template <class _InputIter, class _ForwardIter>
+_STLP_INLINE_LOOP
+_ForwardIter
+__umove_nothrow_ptrs(_InputIter __first, _InputIter __last, _ForwardIter __result,
+                     const __true_type& /*_NoThrowMove*/) {
+  for (ptrdiff_t __n = __last - __first ; __n > 0; --__n) {
+    _Construct_Forward(&*__result, _STLP_STD::move(*__first));
+    ++__first; ++__result;
+  }
+  return __result;
+}
+
+template <class _InputIter, class _ForwardIter>
+inline _ForwardIter
+__umove_nothrow_ptrs(_InputIter __first, _InputIter __last, _ForwardIter __result,
+                     const __false_type& /*_NoThrowMove*/)
+{ return __ucopy_ptrs(__first, __last, __result, __false_type()); }
+
+template <class _InputIter, class _ForwardIter, class _Tp>
+inline _ForwardIter
+__umove_ptrs(_InputIter __first, _InputIter __last, _ForwardIter __result,
+             const __true_type& /*_TrivialUCpy*/, _Tp*)
+{ return __ucopy_ptrs(__first, __last, __result, __true_type()); }
+
+template <class _InputIter, class _ForwardIter, class _Tp>
+inline _ForwardIter
+__umove_ptrs(_InputIter __first, _InputIter __last, _ForwardIter __result,
+             const __false_type& /*_TrivialUCpy*/, _Tp*) {
+  typedef typename __is_nothrow_movable<_Tp>::_Ret _NoThrowMove;
+  return __umove_nothrow_ptrs(__first, __last, __result, _NoThrowMove());
+}
+#endif
+
 /* __uninitialized_move:
  * This function is used internaly and only with pointers as iterators.
  */
@@ -417,7 +455,11 @@ template <class _InputIter, class _ForwardIter, class _TrivialUCpy>
 inline _ForwardIter
 __uninitialized_move(_InputIter __first, _InputIter __last, _ForwardIter __result,
                      _TrivialUCpy __trivial_ucpy, const __false_type& /*_Movable*/)
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+{ return __umove_ptrs(__first, __last, __result, __trivial_ucpy, _STLP_VALUE_TYPE(__result, _ForwardIter)); }
+#else
 { return __ucopy_ptrs(__first, __last, __result, __trivial_ucpy); }
+#endif
 
 template <class _InputIter, class _ForwardIter, class _TrivialUCpy>
 _STLP_INLINE_LOOP
@@ -84,6 +84,15 @@ public:
     : _M_ht(__move_source<_Ht>(src.get()._M_ht)) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  unordered_set(const _Self& __x)
+    : _M_ht(__x._M_ht) {}
+  unordered_set(_Self&& __x)
+    : _M_ht(_STLP_STD::move(__x._M_ht)) {}
+  _Self& operator = (_Self&& __x)
+  { _M_ht = _STLP_STD::move(__x._M_ht); return *this; }
+#endif
+
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   unordered_set(_InputIterator __f, _InputIterator __l,
@@ -128,6 +137,18 @@ public:
   { return _M_ht.insert_unique(__obj); }
   iterator insert(const_iterator /*__hint*/, const value_type& __obj)
   { return _M_ht.insert_unique(__obj); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  pair<iterator, bool> insert(value_type&& __obj)
+  { return _M_ht.insert_unique(_STLP_STD::move(__obj)); }
+  iterator insert(const_iterator /*__hint*/, value_type&& __obj)
+  { return _M_ht.insert_unique(_STLP_STD::move(__obj)).first; }
+  template <class... _Args>
+  pair<iterator, bool> emplace(_Args&&... __args)
+  { return _M_ht.emplace_unique(_STLP_STD::forward<_Args>(__args)...); }
+  template <class... _Args>
+  iterator emplace_hint(const_iterator /*__hint*/, _Args&&... __args)
+  { return _M_ht.emplace_unique(_STLP_STD::forward<_Args>(__args)...).first; }
+#endif
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   void insert(_InputIterator __f, _InputIterator __l)
@@ -234,6 +255,15 @@ public:
     : _M_ht(__move_source<_Ht>(src.get()._M_ht)) {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  unordered_multiset(const _Self& __x)
+    : _M_ht(__x._M_ht) {}
+  unordered_multiset(_Self&& __x)
+    : _M_ht(_STLP_STD::move(__x._M_ht)) {}
+  _Self& operator = (_Self&& __x)
+  { _M_ht = _STLP_STD::move(__x._M_ht); return *this; }
+#endif
+
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   unordered_multiset(_InputIterator __f, _InputIterator __l,
@@ -278,6 +308,18 @@ public:
   { return _M_ht.insert_equal(__obj); }
   iterator insert(const_iterator /*__hint*/, const value_type& __obj)
   { return _M_ht.insert_equal(__obj); }
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  iterator insert(value_type&& __obj)
+  { return _M_ht.insert_equal(_STLP_STD::move(__obj)); }
+  iterator insert(const_iterator /*__hint*/, value_type&& __obj)
+  { return _M_ht.insert_equal(_STLP_STD::move(__obj)); }
+  template <class... _Args>
+  iterator emplace(_Args&&... __args)
+  { return _M_ht.emplace_equal(_STLP_STD::forward<_Args>(__args)...); }
+  template <class... _Args>
+  iterator emplace_hint(const_iterator /*__hint*/, _Args&&... __args)
+  { return _M_ht.emplace_equal(_STLP_STD::forward<_Args>(__args)...); }
+#endif
 #if defined (_STLP_MEMBER_TEMPLATES)
   template <class _InputIterator>
   void insert(_InputIterator __f, _InputIterator __l)
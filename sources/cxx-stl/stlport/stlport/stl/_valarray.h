@@ -39,6 +39,10 @@
 #  include <stl/_limits.h>
 #endif
 
+#ifndef _STLP_VALARRAY_EXPR_H
+#  include <stl/_valarray_expr.h>
+#endif
+
 _STLP_BEGIN_NAMESPACE
 
 class slice;
@@ -114,6 +118,14 @@ public:
   valarray(const mask_array<_Tp>&);
   valarray(const indirect_array<_Tp>&);
 
+  // Constructor from an expression, computed in a single pass.
+  template <class _Clos>
+  valarray(const _Valarray_expr<_Tp, _Clos>& __x) : _Valarray_base<_Tp>(__x.size()) {
+    typedef typename __type_traits<_Tp>::has_trivial_default_constructor _Is_Trivial;
+    _M_initialize(_Is_Trivial());
+    _STLP_PRIV __va_evaluate(this->_M_first, this->_M_size, __x._M_closure());
+  }
+
   // Destructor
   ~valarray() { _STLP_STD::_Destroy_Range(this->_M_first, this->_M_first + this->_M_size); }
 
@@ -152,6 +164,14 @@ public:                         // Assignment
   valarray<_Tp>& operator=(const mask_array<_Tp>&);
   valarray<_Tp>& operator=(const indirect_array<_Tp>&);
 
+  // Assignment of an expression, which may refer to *this.
+  template <class _Clos>
+  valarray<_Tp>& operator=(const _Valarray_expr<_Tp, _Clos>& __x) {
+    _STLP_ASSERT(__x.size() == this->size())
+    _STLP_PRIV __va_evaluate(this->_M_first, this->_M_size, __x._M_closure());
+    return *this;
+  }
+
 public:                         // Element access
   value_type  operator[](size_t __n) const {
     _STLP_ASSERT(__n < this->size())
@@ -163,6 +183,9 @@ public:                         // Element access
   }
   size_t size() const { return this->_M_size; }
 
+  // Extension: the elements, for the expression templates.
+  const value_type* _M_data() const { return this->_M_first; }
+
 public:                         // Subsetting operations with auxiliary type
   valarray<_Tp>       operator[](slice) const;
   slice_array<_Tp>    operator[](slice);
@@ -176,172 +199,80 @@ public:                         // Subsetting operations with auxiliary type
 public:                         // Unary operators.
   valarray<_Tp> operator+() const { return *this; }
 
-  valarray<_Tp> operator-() const {
-    valarray<_Tp> __tmp(this->size(), _NoInit());
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      __tmp[__i] = -(*this)[__i];
-    return __tmp;
-  }
-
-  valarray<_Tp> operator~() const {
-    valarray<_Tp> __tmp(this->size(), _NoInit());
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      __tmp[__i] = ~(*this)[__i];
-    return __tmp;
-  }
-
-  _Valarray_bool operator!() const;
-
-public:                         // Scalar computed assignment.
-  valarray<_Tp>& operator*= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] *= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator/= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] /= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator%= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] %= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator+= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] += __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator-= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] -= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator^= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] ^= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator&= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] &= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator|= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] |= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator<<= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] <<= __x;
-    return *this;
-  }
-
-  valarray<_Tp>& operator>>= (const value_type& __x) {
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] >>= __x;
-    return *this;
-  }
-
-public:                         // Array computed assignment.
-  valarray<_Tp>& operator*= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] *= __x[__i];
-    return *this;
-  }
-
-  valarray<_Tp>& operator/= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] /= __x[__i];
-    return *this;
-  }
-
-  valarray<_Tp>& operator%= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] %= __x[__i];
-    return *this;
-  }
-
-  valarray<_Tp>& operator+= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] += __x[__i];
-    return *this;
+  typename _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_negate<_Tp>, _STLP_PRIV _Va_array<_Tp> >::_Ret
+  operator-() const {
+    return _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_negate<_Tp>, _STLP_PRIV _Va_array<_Tp> >::
+      _S_make(_STLP_PRIV _Va_array<_Tp>(*this));
   }
 
-  valarray<_Tp>& operator-= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] -= __x[__i];
-    return *this;
+  typename _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_bitwise_not<_Tp>, _STLP_PRIV _Va_array<_Tp> >::_Ret
+  operator~() const {
+    return _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_bitwise_not<_Tp>, _STLP_PRIV _Va_array<_Tp> >::
+      _S_make(_STLP_PRIV _Va_array<_Tp>(*this));
   }
 
-  valarray<_Tp>& operator^= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] ^= __x[__i];
-    return *this;
+  typename _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_logical_not<_Tp>, _STLP_PRIV _Va_array<_Tp> >::_Ret
+  operator!() const {
+    return _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_logical_not<_Tp>, _STLP_PRIV _Va_array<_Tp> >::
+      _S_make(_STLP_PRIV _Va_array<_Tp>(*this));
   }
 
-  valarray<_Tp>& operator&= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] &= __x[__i];
-    return *this;
-  }
-
-  valarray<_Tp>& operator|= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] |= __x[__i];
-    return *this;
-  }
-
-  valarray<_Tp>& operator<<= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] <<= __x[__i];
+private:
+  // Computed assignment: *this = *this op __x, in a single pass.
+  template <class _Op, class _Clos>
+  valarray<_Tp>& _M_compute(const _Clos& __x) {
+    _STLP_PRIV __va_evaluate(this->_M_first, this->_M_size,
+                             _STLP_PRIV _Va_binary<_Op, _STLP_PRIV _Va_array<_Tp>, _Clos>(_STLP_PRIV _Va_array<_Tp>(*this), __x));
     return *this;
   }
 
-  valarray<_Tp>& operator>>= (const valarray<_Tp>& __x) {
-    _STLP_ASSERT(__x.size() == this->size())
-    for (size_t __i = 0; __i < this->size(); ++__i)
-      (*this)[__i] >>= __x[__i];
-    return *this;
-  }
+public:                         // Computed assignment.
+#define _STLP_VALARRAY_COMPUTED_ASSIGN(_Op, _Name) \
+  valarray<_Tp>& operator _Op (const value_type& __x) \
+  { return _M_compute<_STLP_PRIV _Name<_Tp> >(_STLP_PRIV _Va_scalar<_Tp>(__x)); } \
+  valarray<_Tp>& operator _Op (const valarray<_Tp>& __x) { \
+    _STLP_ASSERT(__x.size() == this->size()) \
+    return _M_compute<_STLP_PRIV _Name<_Tp> >(_STLP_PRIV _Va_array<_Tp>(__x)); \
+  } \
+  template <class _Clos> \
+  valarray<_Tp>& operator _Op (const _Valarray_expr<_Tp, _Clos>& __x) { \
+    _STLP_ASSERT(__x.size() == this->size()) \
+    return _M_compute<_STLP_PRIV _Name<_Tp> >(__x._M_closure()); \
+  }
+
+  _STLP_VALARRAY_COMPUTED_ASSIGN(*=, _Va_multiplies)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(/=, _Va_divides)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(%=, _Va_modulus)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(+=, _Va_plus)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(-=, _Va_minus)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(^=, _Va_bitwise_xor)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(&=, _Va_bitwise_and)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(|=, _Va_bitwise_or)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(<<=, _Va_shift_left)
+  _STLP_VALARRAY_COMPUTED_ASSIGN(>>=, _Va_shift_right)
+
+#undef _STLP_VALARRAY_COMPUTED_ASSIGN
 
 public:                         // Other member functions.
 
   // The result is undefined for zero-length arrays
   value_type sum() const {
     _STLP_ASSERT(this->size() != 0)
-    return accumulate(this->_M_first + 1, this->_M_first + this->_M_size,
-                      (*this)[0]);
+    return _STLP_PRIV __va_reduce(this->_M_first, this->_M_size,
+                                  __STATIC_CAST(_STLP_PRIV _Va_plus<_Tp>*, 0));
   }
 
   // The result is undefined for zero-length arrays
   value_type (min) () const {
     _STLP_ASSERT(this->size() != 0)
-    return *min_element(this->_M_first + 0, this->_M_first + this->_M_size);
+    return _STLP_PRIV __va_reduce(this->_M_first, this->_M_size,
+                                  __STATIC_CAST(_STLP_PRIV _Va_min<_Tp>*, 0));
   }
 
   value_type (max) () const {
     _STLP_ASSERT(this->size() != 0)
-    return *max_element(this->_M_first + 0, this->_M_first + this->_M_size);
+    return _STLP_PRIV __va_reduce(this->_M_first, this->_M_size,
+                                  __STATIC_CAST(_STLP_PRIV _Va_max<_Tp>*, 0));
   }
 
   valarray<_Tp> shift(int __n) const;
@@ -370,705 +301,138 @@ public:                         // Other member functions.
 
 //----------------------------------------------------------------------
 // valarray non-member functions.
-
-// Binary arithmetic operations between two arrays.  Behavior is
-// undefined if the two arrays do not have the same length.
-
-template <class _Tp>
-inline valarray<_Tp>  _STLP_CALL operator*(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] * __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp>  _STLP_CALL operator/(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] / __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp>  _STLP_CALL operator%(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] % __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp>  _STLP_CALL operator+(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] + __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp>  _STLP_CALL operator-(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] - __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator^(const valarray<_Tp>& __x,
-                                          const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] ^ __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator&(const valarray<_Tp>& __x,
-                                          const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] & __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator|(const valarray<_Tp>& __x,
-                                          const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] | __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator<<(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] << __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator>>(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] >> __y[__i];
-  return __tmp;
-}
-
-// Binary arithmetic operations between an array and a scalar.
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator*(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  * __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator*(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c * __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator/(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  / __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator/(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c / __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator%(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  % __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator%(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c % __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator+(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  + __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator+(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c + __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator-(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  - __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator-(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c - __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator^(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  ^ __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator^(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c ^ __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator&(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  & __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator&(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c & __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator|(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  | __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator|(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c | __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator<<(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  << __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator<<(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c << __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator>>(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  >> __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> _STLP_CALL operator>>(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c >> __x[__i];
-  return __tmp;
-}
-
-// Binary logical operations between two arrays.  Behavior is undefined
-// if the two arrays have different lengths.  Note that operator== does
-// not do what you might at first expect.
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator==(const valarray<_Tp>& __x,
-                                            const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] == __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator<(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] < __y[__i];
-  return __tmp;
-}
+//
+// They return expressions, see _valarray_expr.h, and accept valarrays and
+// expressions as operands.
+
+#define _STLP_VA_ARRAY _STLP_PRIV _Va_array<_Tp>
+#define _STLP_VA_SCALAR _STLP_PRIV _Va_scalar<_Tp>
+#define _STLP_VA_BINARY(_Name, _Left, _Right) _STLP_PRIV _Va_binary_expr<_STLP_PRIV _Name<_Tp>, _Left, _Right >
+#define _STLP_VA_UNARY(_Name, _Arg) _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Name<_Tp>, _Arg >
+
+// Function of two arrays, behavior is undefined if they do not have the
+// same length.
+#define _STLP_VALARRAY_ARRAY_FUNCTION(_Func, _Name) \
+template <class _Tp> \
+inline typename _STLP_VA_BINARY(_Name, _STLP_VA_ARRAY, _STLP_VA_ARRAY)::_Ret _STLP_CALL \
+_Func(const valarray<_Tp>& __x, const valarray<_Tp>& __y) { \
+  _STLP_ASSERT(__x.size() == __y.size()) \
+  return _STLP_VA_BINARY(_Name, _STLP_VA_ARRAY, _STLP_VA_ARRAY)::_S_make(_STLP_VA_ARRAY(__x), _STLP_VA_ARRAY(__y)); \
+} \
+template <class _Tp, class _Clos> \
+inline typename _STLP_VA_BINARY(_Name, _STLP_VA_ARRAY, _Clos)::_Ret _STLP_CALL \
+_Func(const valarray<_Tp>& __x, const _Valarray_expr<_Tp, _Clos>& __y) { \
+  _STLP_ASSERT(__x.size() == __y.size()) \
+  return _STLP_VA_BINARY(_Name, _STLP_VA_ARRAY, _Clos)::_S_make(_STLP_VA_ARRAY(__x), __y._M_closure()); \
+} \
+template <class _Tp, class _Clos> \
+inline typename _STLP_VA_BINARY(_Name, _Clos, _STLP_VA_ARRAY)::_Ret _STLP_CALL \
+_Func(const _Valarray_expr<_Tp, _Clos>& __x, const valarray<_Tp>& __y) { \
+  _STLP_ASSERT(__x.size() == __y.size()) \
+  return _STLP_VA_BINARY(_Name, _Clos, _STLP_VA_ARRAY)::_S_make(__x._M_closure(), _STLP_VA_ARRAY(__y)); \
+} \
+template <class _Tp, class _Clos1, class _Clos2> \
+inline typename _STLP_VA_BINARY(_Name, _Clos1, _Clos2)::_Ret _STLP_CALL \
+_Func(const _Valarray_expr<_Tp, _Clos1>& __x, const _Valarray_expr<_Tp, _Clos2>& __y) { \
+  _STLP_ASSERT(__x.size() == __y.size()) \
+  return _STLP_VA_BINARY(_Name, _Clos1, _Clos2)::_S_make(__x._M_closure(), __y._M_closure()); \
+}
+
+// Function of an array and a scalar.
+#define _STLP_VALARRAY_SCALAR_FUNCTION(_Func, _Name) \
+template <class _Tp> \
+inline typename _STLP_VA_BINARY(_Name, _STLP_VA_ARRAY, _STLP_VA_SCALAR)::_Ret _STLP_CALL \
+_Func(const valarray<_Tp>& __x, const _Tp& __c) \
+{ return _STLP_VA_BINARY(_Name, _STLP_VA_ARRAY, _STLP_VA_SCALAR)::_S_make(_STLP_VA_ARRAY(__x), _STLP_VA_SCALAR(__c)); } \
+template <class _Tp> \
+inline typename _STLP_VA_BINARY(_Name, _STLP_VA_SCALAR, _STLP_VA_ARRAY)::_Ret _STLP_CALL \
+_Func(const _Tp& __c, const valarray<_Tp>& __x) \
+{ return _STLP_VA_BINARY(_Name, _STLP_VA_SCALAR, _STLP_VA_ARRAY)::_S_make(_STLP_VA_SCALAR(__c), _STLP_VA_ARRAY(__x)); } \
+template <class _Tp, class _Clos> \
+inline typename _STLP_VA_BINARY(_Name, _Clos, _STLP_VA_SCALAR)::_Ret _STLP_CALL \
+_Func(const _Valarray_expr<_Tp, _Clos>& __x, const _Tp& __c) \
+{ return _STLP_VA_BINARY(_Name, _Clos, _STLP_VA_SCALAR)::_S_make(__x._M_closure(), _STLP_VA_SCALAR(__c)); } \
+template <class _Tp, class _Clos> \
+inline typename _STLP_VA_BINARY(_Name, _STLP_VA_SCALAR, _Clos)::_Ret _STLP_CALL \
+_Func(const _Tp& __c, const _Valarray_expr<_Tp, _Clos>& __x) \
+{ return _STLP_VA_BINARY(_Name, _STLP_VA_SCALAR, _Clos)::_S_make(_STLP_VA_SCALAR(__c), __x._M_closure()); }
+
+#define _STLP_VALARRAY_BINARY_FUNCTION(_Func, _Name) \
+_STLP_VALARRAY_ARRAY_FUNCTION(_Func, _Name) \
+_STLP_VALARRAY_SCALAR_FUNCTION(_Func, _Name)
+
+#define _STLP_VALARRAY_UNARY_FUNCTION(_Func, _Name) \
+template <class _Tp> \
+inline typename _STLP_VA_UNARY(_Name, _STLP_VA_ARRAY)::_Ret \
+_Func(const valarray<_Tp>& __x) \
+{ return _STLP_VA_UNARY(_Name, _STLP_VA_ARRAY)::_S_make(_STLP_VA_ARRAY(__x)); } \
+template <class _Tp, class _Clos> \
+inline typename _STLP_VA_UNARY(_Name, _Clos)::_Ret \
+_Func(const _Valarray_expr<_Tp, _Clos>& __x) \
+{ return _STLP_VA_UNARY(_Name, _Clos)::_S_make(__x._M_closure()); }
+
+// Binary arithmetic operations.
+
+_STLP_VALARRAY_BINARY_FUNCTION(operator*, _Va_multiplies)
+_STLP_VALARRAY_BINARY_FUNCTION(operator/, _Va_divides)
+_STLP_VALARRAY_BINARY_FUNCTION(operator%, _Va_modulus)
+_STLP_VALARRAY_BINARY_FUNCTION(operator+, _Va_plus)
+_STLP_VALARRAY_BINARY_FUNCTION(operator-, _Va_minus)
+_STLP_VALARRAY_BINARY_FUNCTION(operator^, _Va_bitwise_xor)
+_STLP_VALARRAY_BINARY_FUNCTION(operator&, _Va_bitwise_and)
+_STLP_VALARRAY_BINARY_FUNCTION(operator|, _Va_bitwise_or)
+_STLP_VALARRAY_BINARY_FUNCTION(operator<<, _Va_shift_left)
+_STLP_VALARRAY_BINARY_FUNCTION(operator>>, _Va_shift_right)
+
+// Binary logical operations. Note that operator== does not do what you
+// might at first expect.
+
+_STLP_VALARRAY_BINARY_FUNCTION(operator==, _Va_equal_to)
+_STLP_VALARRAY_BINARY_FUNCTION(operator<, _Va_less)
 
 #ifdef _STLP_USE_SEPARATE_RELOPS_NAMESPACE
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator!=(const valarray<_Tp>& __x,
-                                            const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] != __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator>(const valarray<_Tp>& __x,
-                                           const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] > __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator<=(const valarray<_Tp>& __x,
-                                            const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] <= __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator>=(const valarray<_Tp>& __x,
-                                            const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] >= __y[__i];
-  return __tmp;
-}
-
+_STLP_VALARRAY_ARRAY_FUNCTION(operator!=, _Va_not_equal_to)
+_STLP_VALARRAY_ARRAY_FUNCTION(operator>, _Va_greater)
+_STLP_VALARRAY_ARRAY_FUNCTION(operator<=, _Va_less_equal)
+_STLP_VALARRAY_ARRAY_FUNCTION(operator>=, _Va_greater_equal)
 #endif /* _STLP_USE_SEPARATE_RELOPS_NAMESPACE */
-// fbp : swap ?
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator&&(const valarray<_Tp>& __x,
-                                            const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] && __y[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator||(const valarray<_Tp>& __x,
-                                            const valarray<_Tp>& __y) {
-  _STLP_ASSERT(__x.size() == __y.size())
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] || __y[__i];
-  return __tmp;
-}
-
-// Logical operations between an array and a scalar.
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator==(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] == __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator==(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c == __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator!=(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] != __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator!=(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c != __x[__i];
-  return __tmp;
-}
 
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator<(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] < __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator<(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c < __x[__i];
-  return __tmp;
-}
+_STLP_VALARRAY_SCALAR_FUNCTION(operator!=, _Va_not_equal_to)
+_STLP_VALARRAY_SCALAR_FUNCTION(operator>, _Va_greater)
+_STLP_VALARRAY_SCALAR_FUNCTION(operator<=, _Va_less_equal)
+_STLP_VALARRAY_SCALAR_FUNCTION(operator>=, _Va_greater_equal)
 
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator>(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] > __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator>(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c > __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator<=(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i]  <= __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator<=(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c <= __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator>=(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] >= __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator>=(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c >= __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator&&(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] && __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator&&(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c && __x[__i];
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator||(const valarray<_Tp>& __x, const _Tp& __c) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __x[__i] || __c;
-  return __tmp;
-}
-
-template <class _Tp>
-inline _Valarray_bool _STLP_CALL operator||(const _Tp& __c, const valarray<_Tp>& __x) {
-  _Valarray_bool __tmp(__x.size(), _Valarray_bool::_NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = __c || __x[__i];
-  return __tmp;
-}
+_STLP_VALARRAY_BINARY_FUNCTION(operator&&, _Va_logical_and)
+_STLP_VALARRAY_BINARY_FUNCTION(operator||, _Va_logical_or)
 
 // valarray "transcendentals" (the list includes abs and sqrt, which,
 // of course, are not transcendental).
 
-template <class _Tp>
-inline valarray<_Tp> abs(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::abs(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> acos(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::acos(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> asin(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::asin(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> atan(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::atan(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> atan2(const valarray<_Tp>& __x,
-                           const valarray<_Tp>& __y) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::atan2(__x[__i], __y[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> atan2(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::atan2(__x[__i], __c);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> atan2(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::atan2(__c, __x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> cos(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::cos(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> cosh(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::cosh(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> exp(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::exp(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> log(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::log(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> log10(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::log10(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> pow(const valarray<_Tp>& __x,
-                         const valarray<_Tp>& __y) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::pow(__x[__i], __y[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> pow(const valarray<_Tp>& __x, const _Tp& __c) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::pow(__x[__i], __c);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> pow(const _Tp& __c, const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::pow(__c, __x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> sin(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::sin(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> sinh(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::sinh(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> sqrt(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::sqrt(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> tan(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::tan(__x[__i]);
-  return __tmp;
-}
-
-template <class _Tp>
-inline valarray<_Tp> tanh(const valarray<_Tp>& __x) {
-  typedef typename valarray<_Tp>::_NoInit _NoInit;
-  valarray<_Tp> __tmp(__x.size(), _NoInit());
-  for (size_t __i = 0; __i < __x.size(); ++__i)
-    __tmp[__i] = ::tanh(__x[__i]);
-  return __tmp;
-}
+_STLP_VALARRAY_UNARY_FUNCTION(abs, _Va_abs)
+_STLP_VALARRAY_UNARY_FUNCTION(acos, _Va_acos)
+_STLP_VALARRAY_UNARY_FUNCTION(asin, _Va_asin)
+_STLP_VALARRAY_UNARY_FUNCTION(atan, _Va_atan)
+_STLP_VALARRAY_BINARY_FUNCTION(atan2, _Va_atan2)
+_STLP_VALARRAY_UNARY_FUNCTION(cos, _Va_cos)
+_STLP_VALARRAY_UNARY_FUNCTION(cosh, _Va_cosh)
+_STLP_VALARRAY_UNARY_FUNCTION(exp, _Va_exp)
+_STLP_VALARRAY_UNARY_FUNCTION(log, _Va_log)
+_STLP_VALARRAY_UNARY_FUNCTION(log10, _Va_log10)
+_STLP_VALARRAY_BINARY_FUNCTION(pow, _Va_pow)
+_STLP_VALARRAY_UNARY_FUNCTION(sin, _Va_sin)
+_STLP_VALARRAY_UNARY_FUNCTION(sinh, _Va_sinh)
+_STLP_VALARRAY_UNARY_FUNCTION(sqrt, _Va_sqrt)
+_STLP_VALARRAY_UNARY_FUNCTION(tan, _Va_tan)
+_STLP_VALARRAY_UNARY_FUNCTION(tanh, _Va_tanh)
+
+#undef _STLP_VALARRAY_UNARY_FUNCTION
+#undef _STLP_VALARRAY_BINARY_FUNCTION
+#undef _STLP_VALARRAY_SCALAR_FUNCTION
+#undef _STLP_VALARRAY_ARRAY_FUNCTION
+#undef _STLP_VA_UNARY
+#undef _STLP_VA_BINARY
+#undef _STLP_VA_SCALAR
+#undef _STLP_VA_ARRAY
 
 //----------------------------------------------------------------------
 // slice and slice_array
@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2013
+ * The Android Open Source Project
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_VALARRAY_EXPR_H
+#define _STLP_VALARRAY_EXPR_H
+
+#ifndef _STLP_INTERNAL_CMATH
+#  include <stl/_cmath.h>
+#endif
+
+#ifndef _STLP_TYPE_MANIPS_H
+#  include <stl/type_manips.h>
+#endif
+
+/*
+ * Expression templates of valarray.
+ *
+ * The valarray operators and functions return a _Valarray_expr holding a
+ * closure instead of a valarray: the closure computes an element of the
+ * result on demand from the elements of its operands, so that an expression
+ * such as a * b + c is computed in a single pass, without temporary arrays,
+ * when it is assigned to a valarray. The closures keep a pointer to the
+ * elements of the valarrays of the expression, which must outlive it.
+ *
+ * The closures of float and double expressions made of +, -, * and / also
+ * compute packets of elements with SSE2 or NEON when they are available at
+ * compile time. Note that NEON flushes denormals to zero, and that it has no
+ * division: the expressions with a division are not vectorized on ARM. The
+ * sum, min and max reductions of these valarrays use the same packets, so
+ * sum adds the elements in a different order than the scalar code, and min
+ * and max return an unspecified element when the array contains a NaN.
+ */
+
+#if defined (__SSE2__)
+#  include <emmintrin.h>
+#  define _STLP_VALARRAY_SSE2
+#elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+#  include <arm_neon.h>
+#  define _STLP_VALARRAY_NEON
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+template <class _Tp> class valarray;
+template <class _Tp, class _Clos> class _Valarray_expr;
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+//----------------------------------------------------------------------
+// Packets of elements
+
+// _Is_packet is set for the types that have packets of _Size elements, the
+// other types have packets of a single element and no operations.
+template <class _Tp>
+struct _Va_packet_traits {
+  enum { _Is_packet = 0, _Has_div = 0, _Size = 1 };
+  typedef _Tp _Packet;
+};
+
+#if defined (_STLP_VALARRAY_SSE2)
+_STLP_TEMPLATE_NULL
+struct _Va_packet_traits<float> {
+  enum { _Is_packet = 1, _Has_div = 1, _Size = 4 };
+  typedef __m128 _Packet;
+
+  static _Packet _S_load(const float* __p) { return _mm_loadu_ps(__p); }
+  static void _S_store(float* __p, _Packet __x) { _mm_storeu_ps(__p, __x); }
+  static _Packet _S_set(float __x) { return _mm_set1_ps(__x); }
+  static _Packet _S_add(_Packet __x, _Packet __y) { return _mm_add_ps(__x, __y); }
+  static _Packet _S_sub(_Packet __x, _Packet __y) { return _mm_sub_ps(__x, __y); }
+  static _Packet _S_mul(_Packet __x, _Packet __y) { return _mm_mul_ps(__x, __y); }
+  static _Packet _S_div(_Packet __x, _Packet __y) { return _mm_div_ps(__x, __y); }
+  static _Packet _S_neg(_Packet __x) { return _mm_xor_ps(__x, _mm_set1_ps(-0.0f)); }
+  static _Packet _S_min(_Packet __x, _Packet __y) { return _mm_min_ps(__x, __y); }
+  static _Packet _S_max(_Packet __x, _Packet __y) { return _mm_max_ps(__x, __y); }
+};
+
+_STLP_TEMPLATE_NULL
+struct _Va_packet_traits<double> {
+  enum { _Is_packet = 1, _Has_div = 1, _Size = 2 };
+  typedef __m128d _Packet;
+
+  static _Packet _S_load(const double* __p) { return _mm_loadu_pd(__p); }
+  static void _S_store(double* __p, _Packet __x) { _mm_storeu_pd(__p, __x); }
+  static _Packet _S_set(double __x) { return _mm_set1_pd(__x); }
+  static _Packet _S_add(_Packet __x, _Packet __y) { return _mm_add_pd(__x, __y); }
+  static _Packet _S_sub(_Packet __x, _Packet __y) { return _mm_sub_pd(__x, __y); }
+  static _Packet _S_mul(_Packet __x, _Packet __y) { return _mm_mul_pd(__x, __y); }
+  static _Packet _S_div(_Packet __x, _Packet __y) { return _mm_div_pd(__x, __y); }
+  static _Packet _S_neg(_Packet __x) { return _mm_xor_pd(__x, _mm_set1_pd(-0.0)); }
+  static _Packet _S_min(_Packet __x, _Packet __y) { return _mm_min_pd(__x, __y); }
+  static _Packet _S_max(_Packet __x, _Packet __y) { return _mm_max_pd(__x, __y); }
+};
+#elif defined (_STLP_VALARRAY_NEON)
+_STLP_TEMPLATE_NULL
+struct _Va_packet_traits<float> {
+  enum { _Is_packet = 1, _Has_div = 0, _Size = 4 };
+  typedef float32x4_t _Packet;
+
+  static _Packet _S_load(const float* __p) { return vld1q_f32(__p); }
+  static void _S_store(float* __p, _Packet __x) { vst1q_f32(__p, __x); }
+  static _Packet _S_set(float __x) { return vdupq_n_f32(__x); }
+  static _Packet _S_add(_Packet __x, _Packet __y) { return vaddq_f32(__x, __y); }
+  static _Packet _S_sub(_Packet __x, _Packet __y) { return vsubq_f32(__x, __y); }
+  static _Packet _S_mul(_Packet __x, _Packet __y) { return vmulq_f32(__x, __y); }
+  static _Packet _S_neg(_Packet __x) { return vnegq_f32(__x); }
+  static _Packet _S_min(_Packet __x, _Packet __y) { return vminq_f32(__x, __y); }
+  static _Packet _S_max(_Packet __x, _Packet __y) { return vmaxq_f32(__x, __y); }
+};
+#endif
+
+//----------------------------------------------------------------------
+// Operations
+//
+// _S_apply computes an element of the result, and _S_packet a packet of
+// elements when _Vectorizable is set.
+
+template <class _Tp>
+struct _Va_plus {
+  typedef _Tp result_type;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Is_packet };
+  static _Tp _S_apply(const _Tp& __x, const _Tp& __y) { return __x + __y; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x, typename _Va_packet_traits<_Tp>::_Packet __y)
+  { return _Va_packet_traits<_Tp>::_S_add(__x, __y); }
+};
+
+template <class _Tp>
+struct _Va_minus {
+  typedef _Tp result_type;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Is_packet };
+  static _Tp _S_apply(const _Tp& __x, const _Tp& __y) { return __x - __y; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x, typename _Va_packet_traits<_Tp>::_Packet __y)
+  { return _Va_packet_traits<_Tp>::_S_sub(__x, __y); }
+};
+
+template <class _Tp>
+struct _Va_multiplies {
+  typedef _Tp result_type;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Is_packet };
+  static _Tp _S_apply(const _Tp& __x, const _Tp& __y) { return __x * __y; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x, typename _Va_packet_traits<_Tp>::_Packet __y)
+  { return _Va_packet_traits<_Tp>::_S_mul(__x, __y); }
+};
+
+template <class _Tp>
+struct _Va_divides {
+  typedef _Tp result_type;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Has_div };
+  static _Tp _S_apply(const _Tp& __x, const _Tp& __y) { return __x / __y; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x, typename _Va_packet_traits<_Tp>::_Packet __y)
+  { return _Va_packet_traits<_Tp>::_S_div(__x, __y); }
+};
+
+template <class _Tp>
+struct _Va_negate {
+  typedef _Tp result_type;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Is_packet };
+  static _Tp _S_apply(const _Tp& __x) { return -__x; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x)
+  { return _Va_packet_traits<_Tp>::_S_neg(__x); }
+};
+
+// min and max, for the reductions only.
+template <class _Tp>
+struct _Va_min {
+  static _Tp _S_apply(const _Tp& __x, const _Tp& __y) { return __y < __x ? __y : __x; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x, typename _Va_packet_traits<_Tp>::_Packet __y)
+  { return _Va_packet_traits<_Tp>::_S_min(__x, __y); }
+};
+
+template <class _Tp>
+struct _Va_max {
+  static _Tp _S_apply(const _Tp& __x, const _Tp& __y) { return __x < __y ? __y : __x; }
+  static typename _Va_packet_traits<_Tp>::_Packet
+  _S_packet(typename _Va_packet_traits<_Tp>::_Packet __x, typename _Va_packet_traits<_Tp>::_Packet __y)
+  { return _Va_packet_traits<_Tp>::_S_max(__x, __y); }
+};
+
+#define _STLP_VALARRAY_UNARY_OP(_Name, _Res, _Expr) \
+template <class _Tp> \
+struct _Name { \
+  typedef _Res result_type; \
+  enum { _Vectorizable = 0 }; \
+  static result_type _S_apply(const _Tp& __x) { return _Expr; } \
+};
+
+#define _STLP_VALARRAY_BINARY_OP(_Name, _Res, _Expr) \
+template <class _Tp> \
+struct _Name { \
+  typedef _Res result_type; \
+  enum { _Vectorizable = 0 }; \
+  static result_type _S_apply(const _Tp& __x, const _Tp& __y) { return _Expr; } \
+};
+
+_STLP_VALARRAY_UNARY_OP(_Va_bitwise_not, _Tp, ~__x)
+_STLP_VALARRAY_UNARY_OP(_Va_logical_not, bool, !__x)
+_STLP_VALARRAY_UNARY_OP(_Va_abs, _Tp, ::abs(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_acos, _Tp, ::acos(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_asin, _Tp, ::asin(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_atan, _Tp, ::atan(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_cos, _Tp, ::cos(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_cosh, _Tp, ::cosh(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_exp, _Tp, ::exp(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_log, _Tp, ::log(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_log10, _Tp, ::log10(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_sin, _Tp, ::sin(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_sinh, _Tp, ::sinh(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_sqrt, _Tp, ::sqrt(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_tan, _Tp, ::tan(__x))
+_STLP_VALARRAY_UNARY_OP(_Va_tanh, _Tp, ::tanh(__x))
+
+_STLP_VALARRAY_BINARY_OP(_Va_modulus, _Tp, __x % __y)
+_STLP_VALARRAY_BINARY_OP(_Va_bitwise_xor, _Tp, __x ^ __y)
+_STLP_VALARRAY_BINARY_OP(_Va_bitwise_and, _Tp, __x & __y)
+_STLP_VALARRAY_BINARY_OP(_Va_bitwise_or, _Tp, __x | __y)
+_STLP_VALARRAY_BINARY_OP(_Va_shift_left, _Tp, __x << __y)
+_STLP_VALARRAY_BINARY_OP(_Va_shift_right, _Tp, __x >> __y)
+_STLP_VALARRAY_BINARY_OP(_Va_equal_to, bool, __x == __y)
+_STLP_VALARRAY_BINARY_OP(_Va_not_equal_to, bool, __x != __y)
+_STLP_VALARRAY_BINARY_OP(_Va_less, bool, __x < __y)
+_STLP_VALARRAY_BINARY_OP(_Va_greater, bool, __x > __y)
+_STLP_VALARRAY_BINARY_OP(_Va_less_equal, bool, __x <= __y)
+_STLP_VALARRAY_BINARY_OP(_Va_greater_equal, bool, __x >= __y)
+_STLP_VALARRAY_BINARY_OP(_Va_logical_and, bool, __x && __y)
+_STLP_VALARRAY_BINARY_OP(_Va_logical_or, bool, __x || __y)
+_STLP_VALARRAY_BINARY_OP(_Va_atan2, _Tp, ::atan2(__x, __y))
+_STLP_VALARRAY_BINARY_OP(_Va_pow, _Tp, ::pow(__x, __y))
+
+#undef _STLP_VALARRAY_UNARY_OP
+#undef _STLP_VALARRAY_BINARY_OP
+
+//----------------------------------------------------------------------
+// Closures
+//
+// A closure has the value_type and the size() of the result, and computes
+// its elements with operator[] and, when _Vectorizable is set, its packets
+// of elements with _M_packet.
+
+template <class _Tp>
+struct _Va_array {
+  typedef _Tp value_type;
+  typedef typename _Va_packet_traits<_Tp>::_Packet _Packet;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Is_packet };
+
+  explicit _Va_array(const valarray<_Tp>& __x) : _M_first(__x._M_data()), _M_size(__x.size()) {}
+
+  size_t size() const { return _M_size; }
+  _Tp operator[](size_t __i) const { return _M_first[__i]; }
+  _Packet _M_packet(size_t __i) const { return _Va_packet_traits<_Tp>::_S_load(_M_first + __i); }
+
+  const _Tp* _M_first;
+  size_t _M_size;
+};
+
+template <class _Tp>
+struct _Va_scalar {
+  typedef _Tp value_type;
+  typedef typename _Va_packet_traits<_Tp>::_Packet _Packet;
+  enum { _Vectorizable = _Va_packet_traits<_Tp>::_Is_packet };
+
+  explicit _Va_scalar(const _Tp& __x) : _M_value(__x) {}
+
+  _Tp operator[](size_t) const { return _M_value; }
+  _Packet _M_packet(size_t) const { return _Va_packet_traits<_Tp>::_S_set(_M_value); }
+
+  _Tp _M_value;
+};
+
+template <class _Op, class _Arg>
+struct _Va_unary {
+  typedef typename _Op::result_type value_type;
+  typedef typename _Va_packet_traits<value_type>::_Packet _Packet;
+  enum { _Vectorizable = _Op::_Vectorizable && _Arg::_Vectorizable };
+
+  explicit _Va_unary(const _Arg& __x) : _M_arg(__x) {}
+
+  size_t size() const { return _M_arg.size(); }
+  value_type operator[](size_t __i) const { return _Op::_S_apply(_M_arg[__i]); }
+  _Packet _M_packet(size_t __i) const { return _Op::_S_packet(_M_arg._M_packet(__i)); }
+
+  _Arg _M_arg;
+};
+
+// The size of a binary closure is the one of its array operand.
+template <class _Left, class _Right>
+inline size_t __va_size(const _Left& __x, const _Right&) { return __x.size(); }
+template <class _Tp, class _Right>
+inline size_t __va_size(const _Va_scalar<_Tp>&, const _Right& __y) { return __y.size(); }
+
+template <class _Op, class _Left, class _Right>
+struct _Va_binary {
+  typedef typename _Op::result_type value_type;
+  typedef typename _Va_packet_traits<value_type>::_Packet _Packet;
+  enum { _Vectorizable = _Op::_Vectorizable && _Left::_Vectorizable && _Right::_Vectorizable };
+
+  _Va_binary(const _Left& __x, const _Right& __y) : _M_left(__x), _M_right(__y) {}
+
+  size_t size() const { return __va_size(_M_left, _M_right); }
+  value_type operator[](size_t __i) const { return _Op::_S_apply(_M_left[__i], _M_right[__i]); }
+  _Packet _M_packet(size_t __i) const
+  { return _Op::_S_packet(_M_left._M_packet(__i), _M_right._M_packet(__i)); }
+
+  _Left _M_left;
+  _Right _M_right;
+};
+
+// The expressions of an operation on closures.
+template <class _Op, class _Arg>
+struct _Va_unary_expr {
+  typedef _Va_unary<_Op, _Arg> _Clos;
+  typedef _Valarray_expr<typename _Op::result_type, _Clos> _Ret;
+  static _Ret _S_make(const _Arg& __x) { return _Ret(_Clos(__x)); }
+};
+
+template <class _Op, class _Left, class _Right>
+struct _Va_binary_expr {
+  typedef _Va_binary<_Op, _Left, _Right> _Clos;
+  typedef _Valarray_expr<typename _Op::result_type, _Clos> _Ret;
+  static _Ret _S_make(const _Left& __x, const _Right& __y) { return _Ret(_Clos(__x, __y)); }
+};
+
+//----------------------------------------------------------------------
+// Evaluation
+
+template <class _Tp, class _Clos>
+inline void __va_evaluate(_Tp* __first, size_t __n, const _Clos& __x, const __false_type& /*_Vectorizable*/) {
+  for (size_t __i = 0; __i < __n; ++__i)
+    __first[__i] = __x[__i];
+}
+
+template <class _Tp, class _Clos>
+inline void __va_evaluate(_Tp* __first, size_t __n, const _Clos& __x, const __true_type& /*_Vectorizable*/) {
+  typedef _Va_packet_traits<_Tp> _Traits;
+  size_t __i = 0;
+  for (; __i + _Traits::_Size <= __n; __i += _Traits::_Size)
+    _Traits::_S_store(__first + __i, __x._M_packet(__i));
+  for (; __i < __n; ++__i)
+    __first[__i] = __x[__i];
+}
+
+// Stores the __n elements of __x in [__first, __first + __n). The elements
+// of __x may depend on the element of the same index in this range only.
+template <class _Tp, class _Clos>
+inline void __va_evaluate(_Tp* __first, size_t __n, const _Clos& __x) {
+  typedef typename __bool2type<_Clos::_Vectorizable>::_Ret _Vectorizable;
+  __va_evaluate(__first, __n, __x, _Vectorizable());
+}
+
+template <class _Tp, class _Op>
+inline _Tp __va_reduce(const _Tp* __first, size_t __n, _Op*, const __false_type& /*_Is_packet*/) {
+  _Tp __result = __first[0];
+  for (size_t __i = 1; __i < __n; ++__i)
+    __result = _Op::_S_apply(__result, __first[__i]);
+  return __result;
+}
+
+template <class _Tp, class _Op>
+_Tp __va_reduce(const _Tp* __first, size_t __n, _Op* __op, const __true_type& /*_Is_packet*/) {
+  typedef _Va_packet_traits<_Tp> _Traits;
+  if (__n < 2 * _Traits::_Size)
+    return __va_reduce(__first, __n, __op, __false_type());
+  typename _Traits::_Packet __acc = _Traits::_S_load(__first);
+  size_t __i = _Traits::_Size;
+  for (; __i + _Traits::_Size <= __n; __i += _Traits::_Size)
+    __acc = _Op::_S_packet(__acc, _Traits::_S_load(__first + __i));
+  _Tp __lanes[_Traits::_Size];
+  _Traits::_S_store(__lanes, __acc);
+  _Tp __result = __va_reduce(__lanes, _Traits::_Size, __op, __false_type());
+  for (; __i < __n; ++__i)
+    __result = _Op::_S_apply(__result, __first[__i]);
+  return __result;
+}
+
+// Folds the __n > 0 elements of [__first, __first + __n) with _Op.
+template <class _Tp, class _Op>
+inline _Tp __va_reduce(const _Tp* __first, size_t __n, _Op* __op) {
+  typedef typename __bool2type<_Va_packet_traits<_Tp>::_Is_packet>::_Ret _Is_packet;
+  return __va_reduce(__first, __n, __op, _Is_packet());
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+//----------------------------------------------------------------------
+// class _Valarray_expr
+
+// An expression of valarray elements of type _Tp, with the const member
+// functions of valarray. It is in the std namespace, so that its operators
+// are found by argument dependent lookup.
+template <class _Tp, class _Clos>
+class _Valarray_expr {
+  typedef _Valarray_expr<_Tp, _Clos> _Self;
+
+public:
+  typedef _Tp value_type;
+
+  explicit _Valarray_expr(const _Clos& __x) : _M_clos(__x) {}
+
+  const _Clos& _M_closure() const { return _M_clos; }
+
+  value_type operator[](size_t __i) const { return _M_clos[__i]; }
+  size_t size() const { return _M_clos.size(); }
+
+  typename _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_negate<_Tp>, _Clos>::_Ret operator-() const
+  { return _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_negate<_Tp>, _Clos>::_S_make(_M_clos); }
+  typename _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_bitwise_not<_Tp>, _Clos>::_Ret operator~() const
+  { return _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_bitwise_not<_Tp>, _Clos>::_S_make(_M_clos); }
+  typename _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_logical_not<_Tp>, _Clos>::_Ret operator!() const
+  { return _STLP_PRIV _Va_unary_expr<_STLP_PRIV _Va_logical_not<_Tp>, _Clos>::_S_make(_M_clos); }
+  _Self operator+() const { return *this; }
+
+  // The result is undefined for zero-length arrays
+  value_type sum() const {
+    _STLP_ASSERT(this->size() != 0)
+    value_type __result = _M_clos[0];
+    for (size_t __i = 1; __i < this->size(); ++__i)
+      __result += _M_clos[__i];
+    return __result;
+  }
+
+  value_type (min) () const {
+    _STLP_ASSERT(this->size() != 0)
+    value_type __result = _M_clos[0];
+    for (size_t __i = 1; __i < this->size(); ++__i)
+      __result = _STLP_PRIV _Va_min<_Tp>::_S_apply(__result, _M_clos[__i]);
+    return __result;
+  }
+
+  value_type (max) () const {
+    _STLP_ASSERT(this->size() != 0)
+    value_type __result = _M_clos[0];
+    for (size_t __i = 1; __i < this->size(); ++__i)
+      __result = _STLP_PRIV _Va_max<_Tp>::_S_apply(__result, _M_clos[__i]);
+    return __result;
+  }
+
+  valarray<_Tp> shift(int __n) const { return valarray<_Tp>(*this).shift(__n); }
+  valarray<_Tp> cshift(int __n) const { return valarray<_Tp>(*this).cshift(__n); }
+  valarray<_Tp> apply(value_type __f(value_type)) const { return valarray<_Tp>(*this).apply(__f); }
+  valarray<_Tp> apply(value_type __f(const value_type&)) const { return valarray<_Tp>(*this).apply(__f); }
+
+private:
+  _Clos _M_clos;
+};
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_VALARRAY_EXPR_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -68,8 +68,16 @@ void vector<_Tp, _Alloc>::reserve(size_type __n) {
     const size_type __old_size = size();
     pointer __tmp;
     if (this->_M_start) {
-      __tmp = _M_allocate_and_copy(__n, this->_M_start, this->_M_finish);
-      _M_clear();
+      typedef typename __type_traits<_Tp>::has_trivial_copy_constructor _TrivialUCopy;
+#if !defined (_STLP_NO_MOVE_SEMANTIC)
+      typedef typename __move_traits<_Tp>::implemented _Movable;
+#endif
+      __tmp = this->_M_end_of_storage.allocate(__n, __n);
+      _STLP_TRY {
+        _STLP_PRIV __uninitialized_move(this->_M_start, this->_M_finish, __tmp, _TrivialUCopy(), _Movable());
+      }
+      _STLP_UNWIND(this->_M_end_of_storage.deallocate(__tmp, __n))
+      _M_clear_after_move();
     } else {
       __tmp = this->_M_end_of_storage.allocate(__n, __n);
     }
@@ -104,6 +112,34 @@ void vector<_Tp, _Alloc>::_M_insert_overflow_aux(pointer __pos, const _Tp& __x,
   _M_set(__new_start, __new_finish, __new_start + __len);
 }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+template <class _Tp, class _Alloc>
+template <class... _Args>
+void vector<_Tp, _Alloc>::_M_emplace_overflow(pointer __pos, _Args&&... __args) {
+  typedef typename __type_traits<_Tp>::has_trivial_copy_constructor _TrivialUCopy;
+  typedef typename __move_traits<_Tp>::implemented _Movable;
+  size_type __len = _M_compute_next_size(1);
+  pointer __new_start = this->_M_end_of_storage.allocate(__len, __len);
+  pointer __new_pos = __new_start + (__pos - this->_M_start);
+  // The new element is built first as the arguments might be elements of
+  // this vector.
+  _STLP_TRY {
+    _Construct_Forward(__new_pos, _STLP_STD::forward<_Args>(__args)...);
+  }
+  _STLP_UNWIND(this->_M_end_of_storage.deallocate(__new_start, __len))
+  pointer __new_finish = __new_start;
+  _STLP_TRY {
+    __new_finish = _STLP_PRIV __uninitialized_move(this->_M_start, __pos, __new_start, _TrivialUCopy(), _Movable());
+    __new_finish = _STLP_PRIV __uninitialized_move(__pos, this->_M_finish, __new_pos + 1, _TrivialUCopy(), _Movable());
+  }
+  _STLP_UNWIND((_STLP_STD::_Destroy_Range(__new_start, __new_finish),
+                _STLP_STD::_Destroy(__new_pos),
+                this->_M_end_of_storage.deallocate(__new_start, __len)))
+  _M_clear_after_move();
+  _M_set(__new_start, __new_finish, __new_start + __len);
+}
+#endif
+
 template <class _Tp, class _Alloc>
 void vector<_Tp, _Alloc>::_M_insert_overflow(pointer __pos, const _Tp& __x, const __true_type& /*_TrivialCopy*/,
                                              size_type __fill_len, bool __atend ) {
@@ -226,6 +262,31 @@ vector<_Tp, _Alloc>::insert(iterator __pos, const _Tp& __x) {
   return begin() + __n;
 }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+template <class _Tp, class _Alloc>
+template <class... _Args>
+__iterator__
+vector<_Tp, _Alloc>::emplace(iterator __pos, _Args&&... __args) {
+  size_type __n = __pos - begin();
+  if (this->_M_finish == this->_M_end_of_storage._M_data)
+    _M_emplace_overflow(__pos, _STLP_STD::forward<_Args>(__args)...);
+  else if (__pos == this->_M_finish) {
+    _Construct_Forward(this->_M_finish, _STLP_STD::forward<_Args>(__args)...);
+    ++this->_M_finish;
+  }
+  else {
+    // The arguments might be elements that are about to be shifted.
+    _Tp __x_copy(_STLP_STD::forward<_Args>(__args)...);
+    _Construct_Forward(this->_M_finish, _STLP_STD::move(*(this->_M_finish - 1)));
+    ++this->_M_finish;
+    for (pointer __p = this->_M_finish - 2; __p != __pos; --__p)
+      *__p = _STLP_STD::move(*(__p - 1));
+    *__pos = _STLP_STD::move(__x_copy);
+  }
+  return begin() + __n;
+}
+#endif
+
 #undef __iterator__
 
 #if defined (vector)
@@ -168,6 +168,11 @@ private:
       this->_M_throw_out_of_range();
   }
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  template <class... _Args>
+  void _M_emplace_overflow(pointer __pos, _Args&&... __args);
+#endif
+
   size_type _M_compute_next_size(size_type __n) {
     const size_type __size = size();
     if (__n > max_size() - __size)
@@ -255,6 +260,12 @@ public:
   {}
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  vector(_Self&& __x) noexcept
+    : _STLP_PRIV _Vector_base<_Tp, _Alloc>(__move_source<_Base>(__x))
+  {}
+#endif
+
 #if defined (_STLP_MEMBER_TEMPLATES)
 private:
   template <class _Integer>
@@ -304,6 +315,13 @@ public:
   ~vector() { _STLP_STD::_Destroy_Range(rbegin(), rend()); }
 
   _Self& operator=(const _Self& __x);
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  _Self& operator=(_Self&& __x) {
+    _Self __tmp(_STLP_STD::move(__x));
+    swap(__tmp);
+    return *this;
+  }
+#endif
 
   void reserve(size_type __n);
 
@@ -398,6 +416,27 @@ public:
   iterator insert(iterator __pos) { return insert(__pos, _STLP_DEFAULT_CONSTRUCTED(_Tp)); }
 #endif
 
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+  void push_back(_Tp&& __x)
+  { emplace_back(_STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  void emplace_back(_Args&&... __args) {
+    if (this->_M_finish != this->_M_end_of_storage._M_data) {
+      _Construct_Forward(this->_M_finish, _STLP_STD::forward<_Args>(__args)...);
+      ++this->_M_finish;
+    }
+    else
+      _M_emplace_overflow(this->_M_finish, _STLP_STD::forward<_Args>(__args)...);
+  }
+
+  iterator insert(iterator __pos, _Tp&& __x)
+  { return emplace(__pos, _STLP_STD::move(__x)); }
+
+  template <class... _Args>
+  iterator emplace(iterator __pos, _Args&&... __args);
+#endif
+
   void swap(_Self& __x) {
     _STLP_STD::swap(this->_M_start, __x._M_start);
     _STLP_STD::swap(this->_M_finish, __x._M_finish);
@@ -565,6 +604,19 @@ public:
   }
 
 private:
+  // Assigns the elements following erased ones to their new place.
+  static pointer _S_shift_down(pointer __first, pointer __last, pointer __result,
+                               const __true_type& __trivial_copy)
+  { return _STLP_PRIV __copy_ptrs(__first, __last, __result, __trivial_copy); }
+  static pointer _S_shift_down(pointer __first, pointer __last, pointer __result,
+                               const __false_type& /*_TrivialCopy*/) {
+#if defined (_STLP_HAS_RVALUE_REFERENCES)
+    return _STLP_PRIV __move_assign(__first, __last, __result);
+#else
+    return _STLP_PRIV __copy_ptrs(__first, __last, __result, __false_type());
+#endif
+  }
+
   iterator _M_erase(iterator __pos, const __true_type& /*_Movable*/) {
     _STLP_STD::_Destroy(__pos);
     iterator __dst = __pos, __src = __dst + 1;
@@ -579,7 +631,7 @@ private:
   iterator _M_erase(iterator __pos, const __false_type& /*_Movable*/) {
     if (__pos + 1 != end()) {
       typedef typename __type_traits<_Tp>::has_trivial_assignment_operator _TrivialCopy;
-      _STLP_PRIV __copy_ptrs(__pos + 1, this->_M_finish, __pos, _TrivialCopy());
+      _S_shift_down(__pos + 1, this->_M_finish, __pos, _TrivialCopy());
     }
     --this->_M_finish;
     _STLP_STD::_Destroy(this->_M_finish);
@@ -610,7 +662,7 @@ private:
   }
   iterator _M_erase(iterator __first, iterator __last, const __false_type& /*_Movable*/) {
     typedef typename __type_traits<_Tp>::has_trivial_assignment_operator _TrivialCopy;
-    pointer __i = _STLP_PRIV __copy_ptrs(__last, this->_M_finish, __first, _TrivialCopy());
+    pointer __i = _S_shift_down(__last, this->_M_finish, __first, _TrivialCopy());
     _STLP_STD::_Destroy_Range(__i, this->_M_finish);
     this->_M_finish = __i;
     return __first;
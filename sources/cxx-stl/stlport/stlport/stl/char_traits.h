@@ -228,6 +228,9 @@ public:
   static size_t _STLP_CALL length(const char* __s)
   { return strlen(__s); }
 
+  static const char* _STLP_CALL find(const char* __s, size_t __n, const char& __c)
+  { return __STATIC_CAST(const char*, memchr(__s, (unsigned char)__c, __n)); }
+
   static void _STLP_CALL assign(char& __c1, const char& __c2)
   { __c1 = __c2; }
 
@@ -180,8 +180,8 @@ typedef unsigned int wint_t;
 #undef _STLP_NO_UNCAUGHT_EXCEPT_SUPPORT
 #undef _STLP_NO_UNEXPECTED_EXCEPT_SUPPORT
 
-/* strict ANSI prohibits "long long" ( gcc) */
-#if defined ( __STRICT_ANSI__ )
+/* strict ANSI prohibits "long long" ( gcc), C++11 has it */
+#if defined ( __STRICT_ANSI__ ) && !defined (__GXX_EXPERIMENTAL_CXX0X__) && (__cplusplus < 201103L)
 #  undef _STLP_LONG_LONG 
 #endif
 
@@ -196,3 +196,12 @@ typedef unsigned int wint_t;
  */
 #  define _STLP_NO_FORCE_INSTANTIATE
 #endif
+
+/* Rvalue references and variadic templates, both available since gcc 4.6
+ * in C++0x mode; clang also uses this file. They give the containers their
+ * move constructors and assignments and the emplace members.
+ */
+#if (defined (__GXX_EXPERIMENTAL_CXX0X__) || (__cplusplus >= 201103L)) && \
+    (defined (__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 6)))
+#  define _STLP_HAS_RVALUE_REFERENCES 1
+#endif
@@ -62,6 +62,10 @@
  */
 #include <stl/config/user_config.h>
 
+#if defined (_STLP_DEBUG_LIGHT) && !defined (_STLP_DEBUG)
+#  define _STLP_DEBUG 1
+#endif
+
 #if defined (_STLP_DEBUG) && !defined (_STLP_DEBUG_LEVEL)
 #  define _STLP_DEBUG_LEVEL _STLP_STLPORT_DBG_LEVEL
 #endif
@@ -1033,6 +1037,15 @@ typedef int bool;
 #  define _STLP_USE_PARTIAL_SPEC_WORKAROUND
 #endif
 
+/* The rvalue reference members of the containers are built on top of the
+ * move constructor framework.
+ */
+#if defined (_STLP_HAS_RVALUE_REFERENCES) && \
+   (defined (_STLP_NO_RVALUE_REFERENCES) || defined (_STLP_NO_MOVE_SEMANTIC) || \
+    !defined (_STLP_CLASS_PARTIAL_SPECIALIZATION))
+#  undef _STLP_HAS_RVALUE_REFERENCES
+#endif
+
 #ifdef _STLP_USE_SEPARATE_RELOPS_NAMESPACE
 #  define _STLP_RELOPS_OPERATORS(_TMPL, _TP) \
 _TMPL inline bool _STLP_CALL operator!=(const _TP& __x, const _TP& __y) {return !(__x == __y);}\
@@ -65,6 +65,20 @@
 #define   _STLP_DEBUG_LEVEL _STLP_STLPORT_DBG_LEVEL
 #define   _STLP_DEBUG_LEVEL _STLP_STANDARD_DBG_LEVEL
 */
+/*
+ * Set _STLP_DEBUG_LIGHT (it implies _STLP_DEBUG) for a faster "Debug Mode"
+ * in which iterators are not registered in their container: each container
+ * has a generation number, changed by the operations invalidating all its
+ * iterators, that is checked when an iterator is used. Invalidations of only
+ * some iterators (a vector::insert without reallocation, a list::erase...)
+ * are not detected, the iterators moved to another container by a swap
+ * or a splice are not checked anymore, and the use of an iterator after the
+ * destruction of its container is not reliably detected. Code built with it
+ * cannot be linked with code built with the full debug mode.
+ */
+/*
+#define _STLP_DEBUG_LIGHT 1
+*/
 /* When an inconsistency is detected by the 'safe STL' the program will abort.
  * If you prefer an exception define the following macro. The thrown exception
  * will be the Standard runtime_error exception.
@@ -181,6 +195,15 @@
 #define _STLP_NO_EXTENSIONS 1
 */
 
+/*
+ *  Define this macro to compile the containers without their rvalue reference
+ *  constructors, assignments and emplace members even when the compiler is in
+ *  C++11 mode.
+ */
+/*
+#define _STLP_NO_RVALUE_REFERENCES 1
+*/
+
 /*
  * You should define this macro if compiling with MFC - STLport <stl/config/_windows.h>
  * then include <afx.h> instead of <windows.h> to get synchronisation primitives
@@ -117,6 +117,7 @@ bool _STLP_CALL __check_ptr_range(const _Tp* __first, const _Tp* __last) {
 }
 
 //===============================================================
+#if !defined (_STLP_DEBUG_LIGHT)
 template <class _Iterator>
 void _STLP_CALL __invalidate_range(const __owned_list* __base,
                                    const _Iterator& __first,
@@ -243,6 +244,41 @@ void _STLP_CALL __change_ite_owner(const _Iterator& __it,
   //_STLP_RELEASE_LOCK(__base->_M_lock)
 }
 
+#else /* _STLP_DEBUG_LIGHT */
+
+// Only the invalidation of the whole container, from begin() to end(), is
+// recorded, it is how the node based containers report a clear().
+template <class _Iterator>
+void _STLP_CALL __invalidate_range(const __owned_list* __base,
+                                   const _Iterator& __first,
+                                   const _Iterator& __last) {
+  typedef typename _Iterator::_Container_type _Container;
+  _Container* __c = __STATIC_CAST(_Container*, __CONST_CAST(void*, __base->_Owner()));
+  if (__first._M_iterator == __c->begin() && __last._M_iterator == __c->end())
+    __CONST_CAST(__owned_list*, __base)->_Invalidate_all();
+}
+
+template <class _Iterator>
+void _STLP_CALL __invalidate_iterator(const __owned_list*, const _Iterator&)
+{}
+
+template <class _Iterator>
+void _STLP_CALL __change_range_owner(const _Iterator& __first,
+                                     const _Iterator&,
+                                     const __owned_list* __dst) {
+  if (__first._Owner() != __dst)
+    __CONST_CAST(__owned_list*, __first._Owner())->_Untrack();
+}
+
+template <class _Iterator>
+void _STLP_CALL __change_ite_owner(const _Iterator& __it,
+                                   const __owned_list* __dst) {
+  if (__it._Owner() != __dst)
+    __CONST_CAST(__owned_list*, __it._Owner())->_Untrack();
+}
+
+#endif /* _STLP_DEBUG_LIGHT */
+
 _STLP_MOVE_TO_STD_NAMESPACE
 _STLP_END_NAMESPACE
 
@@ -446,6 +482,7 @@ _STLP_MOVE_TO_PRIV_NAMESPACE
 //  owned_list non-inline methods
 //==========================================================
 
+#    if !defined (_STLP_DEBUG_LIGHT)
 template <class _Dummy>
 void  _STLP_CALL
 __stl_debug_engine<_Dummy>::_Invalidate_all(__owned_list* __l) {
@@ -567,6 +604,7 @@ __stl_debug_engine<_Dummy>::_M_attach(__owned_list* __l, __owned_link* __c_node)
     _STLP_RELEASE_LOCK(__l->_M_lock)
   }
 }
+#    endif /* _STLP_DEBUG_LIGHT */
 
 template <class _Dummy>
 void* _STLP_CALL
@@ -578,6 +616,7 @@ __stl_debug_engine<_Dummy>::_Get_container_ptr(const __owned_link* __l) {
   return __ret;
 }
 
+#    if !defined (_STLP_DEBUG_LIGHT)
 template <class _Dummy>
 bool _STLP_CALL
 __stl_debug_engine<_Dummy>::_Check_same_owner(const __owned_link& __i1,
@@ -614,6 +653,49 @@ __stl_debug_engine<_Dummy>::_Check_if_not_owner( const __owned_list * __l, const
   return true;
 }
 
+#    else /* _STLP_DEBUG_LIGHT */
+
+// The owner of an untracked iterator may be the container it was swapped or
+// spliced from, it is not compared.
+template <class _Dummy>
+bool _STLP_CALL
+__stl_debug_engine<_Dummy>::_Check_same_owner(const __owned_link& __i1,
+                                              const __owned_link& __i2) {
+  _STLP_VERBOSE_RETURN(__i1._Current(), _StlMsg_INVALID_LEFTHAND_ITERATOR)
+  _STLP_VERBOSE_RETURN(__i2._Current(), _StlMsg_INVALID_RIGHTHAND_ITERATOR)
+  _STLP_VERBOSE_RETURN(__i1._Untracked() || __i2._Untracked() ||
+                       __i1._Owner() == __i2._Owner(), _StlMsg_DIFFERENT_OWNERS)
+  return true;
+}
+
+template <class _Dummy>
+bool _STLP_CALL
+__stl_debug_engine<_Dummy>::_Check_same_or_null_owner(const __owned_link& __i1,
+                                                      const __owned_link& __i2) {
+  _STLP_VERBOSE_RETURN(__i1._Untracked() || __i2._Untracked() ||
+                       __i1._Owner() == __i2._Owner(), _StlMsg_DIFFERENT_OWNERS)
+  return true;
+}
+
+template <class _Dummy>
+bool _STLP_CALL
+__stl_debug_engine<_Dummy>::_Check_if_owner( const __owned_list * __l, const __owned_link& __it) {
+  const __owned_list* __owner_ptr = __it._Owner();
+  _STLP_VERBOSE_RETURN(__owner_ptr != 0, _StlMsg_INVALID_ITERATOR)
+  _STLP_VERBOSE_RETURN(__it._Untracked() || __l == __owner_ptr, _StlMsg_NOT_OWNER)
+  return true;
+}
+
+template <class _Dummy>
+bool _STLP_CALL
+__stl_debug_engine<_Dummy>::_Check_if_not_owner( const __owned_list * __l, const __owned_link& __it) {
+  const __owned_list* __owner_ptr = __it._Owner();
+  _STLP_VERBOSE_RETURN(__owner_ptr != 0, _StlMsg_INVALID_ITERATOR)
+  _STLP_VERBOSE_RETURN(__it._Untracked() || __l != __owner_ptr, _StlMsg_SHOULD_NOT_OWNER)
+  return true;
+}
+#    endif /* _STLP_DEBUG_LIGHT */
+
 _STLP_MOVE_TO_STD_NAMESPACE
 _STLP_END_NAMESPACE
 
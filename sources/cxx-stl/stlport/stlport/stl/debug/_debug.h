@@ -122,6 +122,10 @@ public:
 
   static bool _STLP_CALL  _Check_if_not_owner( const __owned_list*, const __owned_link&);
 
+  // accessor : check and get pointer to the container
+  static void* _STLP_CALL  _Get_container_ptr(const __owned_link*);
+
+#    if !defined (_STLP_DEBUG_LIGHT)
   static void _STLP_CALL  _Verify(const __owned_list*);
 
   static void _STLP_CALL  _Swap_owners(__owned_list&, __owned_list&);
@@ -135,9 +139,7 @@ public:
   static void _STLP_CALL  _M_detach(__owned_list*, __owned_link*);
 
   static void _STLP_CALL  _M_attach(__owned_list*, __owned_link*);
-
-  // accessor : check and get pointer to the container
-  static void* _STLP_CALL  _Get_container_ptr(const __owned_link*);
+#    endif
 #  endif
 
   // debug messages and formats
@@ -274,6 +276,7 @@ inline bool  _STLP_CALL stlp_in_range(const _Iterator& __first, const _Iterator&
 { return __valid_range(__first,__last) && __valid_range(__start,__first) && __valid_range(__last,__finish); }
 
 //==========================================================
+#  if !defined (_STLP_DEBUG_LIGHT)
 class _STLP_CLASS_DECLSPEC __owned_link {
 public:
   // Note: This and the following special defines for compiling under Windows CE under ARM
@@ -378,6 +381,85 @@ private:
   friend class __stl_debug_engine<bool>;
 };
 
+#  else /* _STLP_DEBUG_LIGHT */
+
+/*
+ * Light debug mode: iterators are not registered in the list of their
+ * container, so copying or destroying them costs nothing and no lock is
+ * ever taken.  Instead the container has a generation number, incremented
+ * by the operations invalidating all its iterators, that an iterator
+ * records when it is created and that is checked when it is used.
+ *
+ * Swap and splice cannot retarget the iterators to their new container:
+ * they start a new generation and the iterators of the previous ones are
+ * not checked anymore (_Untracked).  Operations invalidating only some of
+ * the iterators of a container are not detected.
+ *
+ * An iterator reads the generation through the __owned_list of its container,
+ * so the use of an iterator that outlives its container reads freed memory:
+ * it is only detected as long as this memory is not reused, thanks to the
+ * generation the destructor of __owned_list starts.
+ */
+class _STLP_CLASS_DECLSPEC __owned_list {
+public:
+  __owned_list(void* __o) : _M_owner(__o), _M_gen(0), _M_tracked_gen(0) {}
+  ~__owned_list() {
+    _M_owner = 0;
+    ++_M_gen;
+  }
+  const void* _Owner() const { return _M_owner; }
+  void* _Owner() { return _M_owner; }
+  bool  _Valid() const { return _M_owner != 0; }
+  void _Invalidate() { _M_owner = 0; }
+
+  void _Verify() const {}
+  void _Swap_owners(__owned_list& __y) {
+    _Untrack();
+    __y._Untrack();
+  }
+  void _Invalidate_all() { ++_M_gen; }
+  void _Set_owner(__owned_list& __y) {
+    if (this != &__y)
+      _Untrack();
+  }
+  void _Untrack() { _M_tracked_gen = ++_M_gen; }
+
+  void* _M_owner;
+  size_t _M_gen;
+  // Iterators older than this generation may belong to another container.
+  size_t _M_tracked_gen;
+
+private:
+  __owned_list(const __owned_list&) {}
+  __owned_list& operator = (const __owned_list&) { return *this; }
+};
+
+class _STLP_CLASS_DECLSPEC __owned_link {
+public:
+  __owned_link() : _M_owner(0), _M_gen(0) {}
+  __owned_link(const __owned_list* __c)
+    : _M_owner(__CONST_CAST(__owned_list*, __c)), _M_gen(__c != 0 ? __c->_M_gen : 0) {}
+
+  const __owned_list* _Owner() const { return _M_owner; }
+  __owned_list* _Owner() { return _M_owner; }
+  void _Set_owner(const __owned_list* __o) {
+    _M_owner = __CONST_CAST(__owned_list*, __o);
+    _M_gen = __o != 0 ? __o->_M_gen : 0;
+  }
+  bool _Valid() const { return _M_owner != 0; }
+  void _Invalidate() { _M_owner = 0; }
+
+  bool _Untracked() const
+  { return _M_owner != 0 && _M_gen < _M_owner->_M_tracked_gen; }
+  bool _Current() const
+  { return _M_owner != 0 && (_M_gen == _M_owner->_M_gen || _M_gen < _M_owner->_M_tracked_gen); }
+
+  __owned_list* _M_owner;
+  size_t _M_gen;
+};
+
+#  endif /* _STLP_DEBUG_LIGHT */
+
 
 //==========================================================
 
@@ -421,10 +503,20 @@ inline bool _STLP_CALL
 __check_same_or_null_owner(const __owned_link& __i1, const __owned_link& __i2)
 { return __stl_debugger::_Check_same_or_null_owner(__i1,__i2); }
 
+#  if !defined (_STLP_DEBUG_LIGHT)
 template <class _Iterator>
 inline bool _STLP_CALL  __check_if_owner( const __owned_list* __owner,
                                           const _Iterator& __it)
 { return __stl_debugger::_Check_if_owner(__owner, (const __owned_link&)__it); }
+#  else
+// Also checks the generation of the iterator given as a position.
+template <class _Iterator>
+inline bool _STLP_CALL  __check_if_owner( const __owned_list* __owner,
+                                          const _Iterator& __it) {
+  return __stl_debugger::_Check_if_owner(__owner, (const __owned_link&)__it) &&
+         __it._Get_container_ptr() != 0;
+}
+#  endif
 
 template <class _Iterator>
 inline bool _STLP_CALL __check_if_not_owner( const __owned_list* __owner,
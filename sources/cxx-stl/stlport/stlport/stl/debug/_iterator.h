@@ -90,8 +90,11 @@ bool _CompareIt(const _Iterator& __x, const _Iterator& __y, const random_access_
 { return __x < __y; }
 
 template <class _Iterator>
-bool _Dereferenceable(const _Iterator& __it)
-{ return (__it._Get_container_ptr() != 0) && !(__it._M_iterator == (__it._Get_container_ptr())->end()); }
+bool _Dereferenceable(const _Iterator& __it) {
+  typedef typename _Iterator::_Container_type __container_type;
+  __container_type* __c = __it._Get_container_ptr();
+  return (__c != 0) && !(__it._M_iterator == __c->end());
+}
 
 template <class _Iterator>
 bool _Incrementable(const _Iterator& __it, ptrdiff_t __n, const forward_iterator_tag &)
@@ -110,6 +113,10 @@ bool _Incrementable(const _Iterator& __it, ptrdiff_t __n, const random_access_it
   typedef typename _Iterator::_Container_type __container_type;
   __container_type* __c = __it._Get_container_ptr();
   if (__c == 0) return false;
+#if defined (_STLP_DEBUG_LIGHT)
+  // After a swap the container of an untracked iterator may be another one.
+  if (__it._Untracked()) return true;
+#endif
   ptrdiff_t __new_pos = (__it._M_iterator - __c->begin()) + __n;
   return  (__new_pos >= 0) && (__STATIC_CAST(typename __container_type::size_type, __new_pos) <= __c->size());
 }
@@ -141,9 +148,32 @@ public:
 #else
     __owned_link(__c), _M_iterator(*(const _Nonconst_iterator*)&__it) {}
 #endif
+#if !defined (_STLP_DEBUG_LIGHT)
   _Container* _Get_container_ptr() const {
     return (_Container*)__stl_debugger::_Get_container_ptr(this);
   }
+#else
+  // An iterator of a previous generation is only still valid if it is the
+  // past-the-end one, that a clear() of a node based container keeps.
+  _Container* _Get_container_ptr() const {
+    const __owned_list* __owner = this->_Owner();
+    _STLP_VERBOSE_RETURN_0(__owner != 0, _StlMsg_INVALID_ITERATOR)
+    _Container* __c = (_Container*)__CONST_CAST(void*, __owner->_Owner());
+    _STLP_VERBOSE_RETURN_0(__c != 0, _StlMsg_INVALID_CONTAINER)
+    _STLP_VERBOSE_RETURN_0(this->_Current() || _M_iterator == __c->end(), _StlMsg_INVALID_ITERATOR)
+    return __c;
+  }
+
+  // Moves a past-the-end iterator of a previous generation to the current
+  // one, before it leaves end() and could not be told apart anymore.
+  void _M_update_end_gen() {
+    if (this->_Owner() != 0 && !this->_Current()) {
+      const _Container* __c = (const _Container*)this->_Owner()->_Owner();
+      if (__c != 0 && _M_iterator == __c->end())
+        this->_Set_owner(this->_Owner());
+    }
+  }
+#endif
 
   void __increment();
   void __decrement();
@@ -155,18 +185,27 @@ public:
 
 template <class _Container>
 inline void _DBG_iter_base<_Container>::__increment() {
+#if defined (_STLP_DEBUG_LIGHT)
+  _M_update_end_gen();
+#endif
   _STLP_DEBUG_CHECK(_Incrementable(*this, 1, _Iterator_category()))
   ++_M_iterator;
 }
 
 template <class _Container>
 inline void _DBG_iter_base<_Container>::__decrement() {
+#if defined (_STLP_DEBUG_LIGHT)
+  _M_update_end_gen();
+#endif
   _STLP_DEBUG_CHECK(_Incrementable(*this, -1, _Iterator_category()))
   _Decrement(_M_iterator, _Iterator_category());
 }
 
 template <class _Container>
 inline void _DBG_iter_base<_Container>::__advance(ptrdiff_t __n) {
+#if defined (_STLP_DEBUG_LIGHT)
+  _M_update_end_gen();
+#endif
   _STLP_DEBUG_CHECK(_Incrementable(*this, __n, _Iterator_category()))
   _Advance(_M_iterator, __n, _Iterator_category());
 }
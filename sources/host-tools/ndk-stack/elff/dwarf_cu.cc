@@ -15,8 +15,8 @@
  * unit in the .debug_info section of the mapped ELF file.
  */
 
-#include "string.h"
-#include "stdio.h"
+#include <string.h>
+#include <stdio.h>
 #include "elf_file.h"
 #include "dwarf_cu.h"
 #include "dwarf_utils.h"
@@ -45,7 +45,7 @@ DwarfCU* DwarfCU::create_instance(ElfFile* elf, const void* hdr) {
     ret = new(elf) DwarfCUImpl<Dwarf32_CUHdr, Dwarf32_Off>
                       (elf, reinterpret_cast<const Dwarf32_CUHdr*>(hdr));
   }
-  assert(ret != NULL);
+  /* Allocation may legitimately fail when ELF's allocator is limited. */
   if (ret == NULL) {
     _set_errno(ENOMEM);
   }
@@ -354,6 +354,7 @@ const Elf_Byte* DwarfCUImpl<Dwarf_CUHdr, Dwarf_Off>::process_DIE(
 
     /* Instantiate DIE object for this DIE, and get list of properties,
      * that should be collected while processing that DIE. */
+    _set_errno(0);
     DIEObject* die_obj =
       create_die_object(parse_context, die, parent_obj, die_tag);
     if (die_obj == NULL && errno != 0) {
@@ -403,8 +404,13 @@ const Elf_Byte* DwarfCUImpl<Dwarf_CUHdr, Dwarf_Off>::process_DIE(
     /* Next DIE immediately follows last property for the current DIE. */
     die = reinterpret_cast<const Dwarf_DIE*>(die_attr);
     if (sibling_off != 0) {
-      // Process child DIE.
-      process_DIE(parse_context, die, die_obj != NULL ? die_obj : parent_obj);
+      // Process child DIE. Running out of memory there is fatal for the CU.
+      _set_errno(0);
+      if (process_DIE(parse_context, die,
+                      die_obj != NULL ? die_obj : parent_obj) == NULL &&
+          errno == ENOMEM) {
+        return NULL;
+      }
       // Next sibling DIE offset is relative to this CU's header beginning.
       die = INC_CPTR_T(Dwarf_DIE, cu_header_, sibling_off);
     }
@@ -424,7 +430,7 @@ DIEObject* DwarfCUImpl<Dwarf_CUHdr, Dwarf_Off>::create_die_object(
   /* We will always create a DIE object for CU DIE. */
   if (tag == DW_TAG_compile_unit || collect_die(parse_context, tag)) {
     ret = new(elf_file_) DIEObject(die, this, parent);
-    assert(ret != NULL);
+    /* Allocation may legitimately fail when ELF's allocator is limited. */
     if (ret == NULL) {
       _set_errno(ENOMEM);
     }
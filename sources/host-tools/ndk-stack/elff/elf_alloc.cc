@@ -19,16 +19,24 @@
 #include "elf_file.h"
 
 ElfAllocator::ElfAllocator()
-    : current_chunk_(NULL) {
+    : current_chunk_(NULL),
+      allocated_bytes_(0),
+      limit_(0) {
 }
 
 ElfAllocator::~ElfAllocator() {
+  reset();
+}
+
+void ElfAllocator::reset() {
   ElfAllocatorChunk* chunk_to_free = current_chunk_;
   while (chunk_to_free != NULL) {
     ElfAllocatorChunk* next_chunk = chunk_to_free->prev;
     free(chunk_to_free);
     chunk_to_free = next_chunk;
   }
+  current_chunk_ = NULL;
+  allocated_bytes_ = 0;
 }
 
 void* ElfAllocator::alloc(size_t size) {
@@ -36,15 +44,25 @@ void* ElfAllocator::alloc(size_t size) {
   size = (size + ELFALLOC_ALIGNMENT_MASK) & ~ELFALLOC_ALIGNMENT_MASK;
 
   if (current_chunk_ == NULL || current_chunk_->remains < size) {
-    /* Allocate new chunk. */
+    /* Allocate new chunk. Blocks that don't fit into a regular chunk get
+     * a chunk of their own. */
+    size_t chunk_size = ELF_ALLOC_CHUNK_SIZE;
+    if (size > chunk_size - sizeof(ElfAllocatorChunk)) {
+      chunk_size = size + sizeof(ElfAllocatorChunk);
+    }
+    if (limit_ != 0 && allocated_bytes_ + chunk_size > limit_) {
+      _set_errno(ENOMEM);
+      return NULL;
+    }
     ElfAllocatorChunk* new_chunk =
-        reinterpret_cast<ElfAllocatorChunk*>(malloc(ELF_ALLOC_CHUNK_SIZE));
+        reinterpret_cast<ElfAllocatorChunk*>(malloc(chunk_size));
     assert(new_chunk != NULL);
     if (new_chunk == NULL) {
       _set_errno(ENOMEM);
       return NULL;
     }
-    new_chunk->size = ELF_ALLOC_CHUNK_SIZE;
+    allocated_bytes_ += chunk_size;
+    new_chunk->size = chunk_size;
     new_chunk->avail = INC_PTR(new_chunk, sizeof(ElfAllocatorChunk));
     new_chunk->remains = new_chunk->size - sizeof(ElfAllocatorChunk);
     new_chunk->prev = current_chunk_;
@@ -57,6 +75,6 @@ void* ElfAllocator::alloc(size_t size) {
   return ret;
 }
 
-void* DwarfAllocBase::operator new(size_t size, const ElfFile* elf) {
+void* DwarfAllocBase::operator new(size_t size, const ElfFile* elf) throw() {
   return elf->allocator()->alloc(size);
 }
@@ -74,6 +74,10 @@ typedef struct ElfAllocatorChunk {
  *
  * Instance (always one) of this class is created by ElfFile object when it is
  * initializing.
+ *
+ * Allocator may be given a limit on the total number of bytes it may hold.
+ * Allocations that would exceed that limit fail with ENOMEM, so ElfFile can
+ * drop its parsed DWARF objects (see reset()) instead of growing unbounded.
  */
 class ElfAllocator {
  public:
@@ -94,11 +98,46 @@ class ElfAllocator {
    */
   void* alloc(size_t size);
 
+  /* Frees all chunks allocated by this allocator.
+   * NOTE: this invalidates all blocks obtained with alloc(), so it's up to the
+   * caller to make sure that no objects allocated from this allocator are
+   * referenced after this call.
+   */
+  void reset();
+
+  /* Gets total number of bytes held by this allocator. */
+  size_t allocated_bytes() const {
+    return allocated_bytes_;
+  }
+
+  /* Gets limit on the total number of bytes held by this allocator, or zero
+   * if allocator is not limited. */
+  size_t limit() const {
+    return limit_;
+  }
+
+  /* Sets limit on the total number of bytes held by this allocator.
+   * Param:
+   *  limit - Maximum number of bytes this allocator may hold, or zero to
+   *    remove the limit. Chunks that have been allocated already are not
+   *    affected by a new limit.
+   */
+  void set_limit(size_t limit) {
+    limit_ = limit;
+  }
+
  protected:
   /* Current chunk to allocate memory from. NOTE: chunks are listed here
    * in reverse order (relatively to the chunk allocation sequence).
    */
   ElfAllocatorChunk*  current_chunk_;
+
+  /* Total number of bytes held in chunks allocated by this allocator. */
+  size_t              allocated_bytes_;
+
+  /* Maximum number of bytes this allocator may hold, or zero if allocator
+   * is not limited. */
+  size_t              limit_;
 };
 
 /* Base class for all WDARF objects that will use ElfAllocator class for
@@ -124,9 +163,11 @@ class DwarfAllocBase {
    *  size - Number of bytes to allocate for an instance of the derived class.
    *  elf - ELF file instance that owns the allocating object.
    * Return:
-   *  Pointer to the allocated memory on success, or NULL on failure.
+   *  Pointer to the allocated memory on success, or NULL on failure. Note that
+   *  this operator is declared as non-throwing, so the compiler checks for
+   *  NULL before running constructor of the allocated object.
    */
-  void* operator new(size_t size, const ElfFile* elf);
+  void* operator new(size_t size, const ElfFile* elf) throw();
 
   /* Overwitten operator delete.
    * Since deleting for chunk-allocated objects is a "no-op", we don't do
@@ -14,13 +14,15 @@
  * Contains implementation of ElfFile classes that encapsulate an ELF file.
  */
 
-#include "string.h"
+#include <string.h>
 #include "elf_file.h"
 #include "elf_alloc.h"
 #include "dwarf_cu.h"
 #include "dwarf_utils.h"
+#include "zinflate.h"
 
 #include <fcntl.h>
+#include <stdlib.h>
 #ifndef O_BINARY
 #define O_BINARY 0
 #endif
@@ -35,13 +37,35 @@ static const Dwarf_Tag parse_rt_tags[] = {
 };
 static const DwarfParseContext parse_rt_context = { parse_rt_tags };
 
+/* Compares two routine symbols by their addresses, for qsort. Symbols at the
+ * same address are ordered by their sizes, so the largest one is found by the
+ * lookup. */
+static int compare_symbols(const void* a, const void* b) {
+  const ElfSymbol* sym_a = reinterpret_cast<const ElfSymbol*>(a);
+  const ElfSymbol* sym_b = reinterpret_cast<const ElfSymbol*>(b);
+  if (sym_a->address != sym_b->address) {
+    return sym_a->address < sym_b->address ? -1 : 1;
+  }
+  if (sym_a->size != sym_b->size) {
+    return sym_a->size < sym_b->size ? -1 : 1;
+  }
+  return 0;
+}
+
 //=============================================================================
 // Base ElfFile implementation
 //=============================================================================
 
 ElfFile::ElfFile()
-    : fixed_base_address_(0),
+    : symbols_(NULL),
+      symbol_count_(0),
+      fixed_base_address_(0),
       elf_handle_((MapFile*)-1),
+      mapped_at_(NULL),
+      mapped_size_(0),
+      file_data_(NULL),
+      file_size_(0),
+      decompressed_bytes_(0),
       elf_file_path_(NULL),
       allocator_(NULL),
       sec_table_(NULL),
@@ -49,7 +73,12 @@ ElfFile::ElfFile()
       sec_entry_size_(0),
       last_cu_(NULL),
       cu_count_(0),
-      is_exec_(0) {
+      is_DWARF_64_(false),
+      is_exec_(0),
+      is_arm_(false),
+      symbols_indexed_(false),
+      dwarf_failed_(false),
+      dwarf_failed_limit_(0) {
 }
 
 ElfFile::~ElfFile() {
@@ -60,6 +89,10 @@ ElfFile::~ElfFile() {
     cu_to_del = next_cu_to_del;
   }
 
+  if (mapped_at_ != NULL) {
+    mapfile_unmap(mapped_at_, mapped_size_);
+  }
+
   if (mapfile_is_valid(elf_handle_)) {
     mapfile_close(elf_handle_);
   }
@@ -68,8 +101,8 @@ ElfFile::~ElfFile() {
     delete[] elf_file_path_;
   }
 
-  if (sec_table_ != NULL) {
-    delete[] reinterpret_cast<Elf_Byte*>(sec_table_);
+  if (symbols_ != NULL) {
+    delete[] symbols_;
   }
 
   /* Must be deleted last! */
@@ -80,9 +113,6 @@ ElfFile::~ElfFile() {
 
 ElfFile* ElfFile::Create(const char* path) {
   ElfFile* ret = NULL;
-  /* Allocate enough space on the stack to fit the largest ELF file header. */
-  Elf64_FHdr header;
-  const Elf_CommonHdr* elf_hdr = &header.common;
 
   assert(path != NULL && *path != '\0');
   if (path == NULL || *path == '\0') {
@@ -91,25 +121,45 @@ ElfFile* ElfFile::Create(const char* path) {
   }
 
   /*
-   * Open ELF file, and read its header (the largest one possible).
+   * Open ELF file, and map all of it to memory. All sections, that we're
+   * going to look at, are then views of this mapping.
    */
   MapFile* file_handle = mapfile_open(path, O_RDONLY | O_BINARY, 0);
   if (!mapfile_is_valid(file_handle)) {
     return NULL;
   }
-  const ssize_t read_bytes = mapfile_read(file_handle, &header, sizeof(header));
-  mapfile_close(file_handle);
-  assert(read_bytes != -1 && read_bytes == sizeof(header));
-  if (read_bytes == -1 || read_bytes != sizeof(header)) {
-    if (read_bytes != -1) {
-      _set_errno(EINVAL);
-    }
+  uint64_t file_size;
+  if (mapfile_size(file_handle, &file_size) != 0) {
+    mapfile_close(file_handle);
     return NULL;
   }
+  /* Make sure that file can fit the largest ELF file header. */
+  if (file_size < sizeof(Elf64_FHdr)) {
+    mapfile_close(file_handle);
+    _set_errno(ENOEXEC);
+    return NULL;
+  }
+  if (file_size != static_cast<size_t>(file_size)) {
+    mapfile_close(file_handle);
+    _set_errno(EFBIG);
+    return NULL;
+  }
+  void* file_data;
+  size_t mapped_size;
+  void* mapped_at = mapfile_map(file_handle, 0, static_cast<size_t>(file_size),
+                                PROT_READ, &file_data, &mapped_size);
+  if (mapped_at == NULL) {
+    mapfile_close(file_handle);
+    return NULL;
+  }
+  const Elf_CommonHdr* elf_hdr =
+      reinterpret_cast<const Elf_CommonHdr*>(file_data);
 
   /* Lets see if this is an ELF file at all. */
   if (memcmp(elf_hdr->e_ident, ELFMAG, SELFMAG) != 0) {
     /* File is not an ELF file. */
+    mapfile_unmap(mapped_at, mapped_size);
+    mapfile_close(file_handle);
     _set_errno(ENOEXEC);
     return NULL;
   }
@@ -120,6 +170,8 @@ ElfFile* ElfFile::Create(const char* path) {
   if (elf_hdr->ei_info.ei_class != ELFCLASS32 &&
       elf_hdr->ei_info.ei_class != ELFCLASS64) {
     /* Neither 32, or 64-bit ELF file. Something wrong here. */
+    mapfile_unmap(mapped_at, mapped_size);
+    mapfile_close(file_handle);
     _set_errno(EBADF);
     return NULL;
   }
@@ -132,11 +184,19 @@ ElfFile* ElfFile::Create(const char* path) {
   }
   assert(ret != NULL);
   if (ret != NULL) {
+    /* From now on the instance owns the file and its mapping. */
+    ret->elf_handle_ = file_handle;
+    ret->mapped_at_ = mapped_at;
+    ret->mapped_size_ = mapped_size;
+    ret->file_data_ = file_data;
+    ret->file_size_ = file_size;
     if (!ret->initialize(elf_hdr, path)) {
       delete ret;
       ret = NULL;
     }
   } else {
+    mapfile_unmap(mapped_at, mapped_size);
+    mapfile_close(file_handle);
     _set_errno(ENOMEM);
   }
 
@@ -167,10 +227,35 @@ bool ElfFile::initialize(const Elf_CommonHdr* elf_hdr, const char* path) {
   is_elf_big_endian_ = elf_hdr->ei_info.ei_data == ELFDATA2MSB;
   same_endianness_ = is_elf_little_endian() == is_little_endian_cpu();
   is_exec_ = elf_hdr->e_type == 2;
+  is_arm_ = pull_val(elf_hdr->e_machine) == EM_ARM;
+
+  return true;
+}
+
+size_t ElfFile::memory_usage() const {
+  size_t ret = sizeof(*this) + decompressed_bytes_;
+  if (allocator_ != NULL) {
+    ret += allocator_->allocated_bytes();
+  }
+  ret += static_cast<size_t>(symbol_count_) * sizeof(ElfSymbol);
+  return ret;
+}
 
-  /* Reopen file for further reads and mappings. */
-  elf_handle_ = mapfile_open(elf_file_path_, O_RDONLY | O_BINARY, 0);
-  return mapfile_is_valid(elf_handle_);
+void ElfFile::release_compilation_units() {
+  DwarfCU* cu_to_del = last_cu_;
+  while (cu_to_del != NULL) {
+    DwarfCU* next_cu_to_del = cu_to_del->prev_cu_;
+    delete cu_to_del;
+    cu_to_del = next_cu_to_del;
+  }
+  last_cu_ = NULL;
+  cu_count_ = 0;
+  dwarf_failed_ = false;
+  dwarf_failed_limit_ = 0;
+
+  /* All DWARF objects live in the allocator, so it's safe to drop its
+   * chunks now. */
+  allocator_->reset();
 }
 
 bool ElfFile::get_pc_address_info(Elf_Xword address,
@@ -181,14 +266,33 @@ bool ElfFile::get_pc_address_info(Elf_Xword address,
     return false;
   }
 
-  /* Collect routine information for all CUs in this file. */
+  address_info->inline_stack = NULL;
+  address_info->routine_offset = 0;
+
+  /* Collect routine information for all CUs in this file. If file has been
+   * stripped of DWARF information, resort to the symbol table. */
+  if (dwarf_failed_ && dwarf_failed_limit_ != 0 &&
+      (allocator_->limit() == 0 || allocator_->limit() > dwarf_failed_limit_)) {
+    /* DWARF didn't fit into a lower limit than the current one: retry. */
+    dwarf_failed_ = false;
+    dwarf_failed_limit_ = 0;
+  }
+  if (!debug_info_.is_mapped() || dwarf_failed_) {
+    return get_pc_symbol_info(address, address_info);
+  }
   if (parse_compilation_units(&parse_rt_context) == -1) {
-    return false;
+    const bool out_of_memory = errno == ENOMEM;
+    /* Don't keep partially parsed CUs (and their memory) around. */
+    release_compilation_units();
+    dwarf_failed_ = true;
+    if (out_of_memory) {
+      dwarf_failed_limit_ = allocator_->limit();
+    }
+    return get_pc_symbol_info(address, address_info);
   }
 
   /* Iterate through the collected CUs looking for the one that
    * contains the given address. */
-  address_info->inline_stack = NULL;
   DwarfCU* cu = last_cu();
   while (cu != NULL) {
     /* Find a leaf DIE object in the current CU that contains the address. */
@@ -308,13 +412,66 @@ bool ElfFile::get_pc_address_info(Elf_Xword address,
     cu = cu->prev_cu();
   }
 
-  return false;
+  /* Address is not covered by DWARF information (e.g. it belongs to a routine
+   * that has been compiled without debug info). Lets try the symbol table. */
+  return get_pc_symbol_info(address, address_info);
+}
+
+bool ElfFile::get_pc_symbol_info(Elf_Xword address,
+                                 Elf_AddressInfo* address_info) {
+  const ElfSymbol* sym = find_symbol(address);
+  if (sym == NULL) {
+    return false;
+  }
+
+  address_info->routine_name = sym->name;
+  address_info->routine_offset = address - sym->address;
+  address_info->file_name = NULL;
+  address_info->dir_name = NULL;
+  address_info->line_number = 0;
+  address_info->inline_stack = NULL;
+  return true;
+}
+
+const ElfSymbol* ElfFile::find_symbol(Elf_Xword address) {
+  if (!symbols_indexed_) {
+    symbols_indexed_ = true;
+    if (!build_symbol_index()) {
+      return NULL;
+    }
+  }
+
+  /* Binary search for the last symbol that begins at, or below the
+   * given address. */
+  Elf_Xword low = 0;
+  Elf_Xword high = symbol_count_;
+  while (low < high) {
+    const Elf_Xword mid = low + (high - low) / 2;
+    if (symbols_[mid].address <= address) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == 0) {
+    _set_errno(ENOENT);
+    return NULL;
+  }
+
+  /* Make sure that the address doesn't fall past the end of the routine. For
+   * symbols with unknown size we have to trust the nearest one. */
+  const ElfSymbol* sym = &symbols_[low - 1];
+  if (sym->size != 0 && address - sym->address >= sym->size) {
+    _set_errno(ENOENT);
+    return NULL;
+  }
+  return sym;
 }
 
 void ElfFile::free_pc_address_info(Elf_AddressInfo* address_info) const {
   assert(address_info != NULL);
   if (address_info != NULL && address_info->inline_stack != NULL) {
-    delete address_info->inline_stack;
+    delete[] address_info->inline_stack;
     address_info->inline_stack = NULL;
   }
 }
@@ -338,24 +495,21 @@ bool ElfFileImpl<Elf_Addr, Elf_Off>::initialize(const Elf_CommonHdr* elf_hdr,
   sec_entry_size_ = pull_val(header->e_shentsize);
   fixed_base_address_ = pull_val(header->e_entry) & ~0xFFF;
 
-  /* Cache section table (must have one!) */
+  /* Locate section table in the mapped file (must have one!) */
   const Elf_Off sec_table_off = pull_val(header->e_shoff);
   assert(sec_table_off != 0 && sec_count_ != 0);
-  if (sec_table_off == 0 || sec_count_ == 0) {
+  if (sec_table_off == 0 || sec_count_ == 0 ||
+      sec_entry_size_ < sizeof(Elf_SHdr<Elf_Addr, Elf_Off>)) {
     _set_errno(EBADF);
     return false;
   }
-  const size_t sec_table_size = sec_count_ * sec_entry_size_;
-  sec_table_ = new Elf_Byte[sec_table_size];
-  assert(sec_table_ != NULL);
-  if (sec_table_ == NULL) {
-    _set_errno(ENOMEM);
+  const Elf_Xword sec_table_size =
+      static_cast<Elf_Xword>(sec_count_) * sec_entry_size_;
+  if (sec_table_off > file_size_ || sec_table_size > file_size_ - sec_table_off) {
+    _set_errno(EBADF);
     return false;
   }
-  if (mapfile_read_at(elf_handle_, sec_table_off, sec_table_,
-                      sec_table_size) < 0) {
-      return false;
-  }
+  sec_table_ = INC_CPTR(file_data_, sec_table_off);
 
   /* Map ELF's string section (must have one!). */
   const Elf_Half str_sec_index = pull_val(header->e_shstrndx);
@@ -372,17 +526,24 @@ bool ElfFileImpl<Elf_Addr, Elf_Off>::initialize(const Elf_CommonHdr* elf_hdr,
     _set_errno(EBADF);
     return false;
   }
-  if (!string_section_.map(elf_handle_, pull_val(str_sec->sh_offset),
+  if (!string_section_.map(file_data_, file_size_,
+                           pull_val(str_sec->sh_offset),
                            pull_val(str_sec->sh_size))) {
     return false;
   }
 
   /* Lets determine DWARF format. According to the docs, DWARF is 64 bit, if
    * first 4 bytes in the compilation unit header are set to 0xFFFFFFFF.
-   * .debug_info section of the ELF file begins with the first CU header. */
+   * .debug_info section of the ELF file begins with the first CU header.
+   * Files without DWARF are still usable, as long as they have a symbol
+   * table to look routines up in. */
   if (!map_section_by_name(".debug_info", &debug_info_)) {
-    _set_errno(EBADF);
-    return false;
+    if (get_section_by_type(SHT_SYMTAB) == NULL &&
+        get_section_by_type(SHT_DYNSYM) == NULL) {
+      _set_errno(EBADF);
+      return false;
+    }
+    return true;
   }
 
   /* Note that we don't care about endianness here, since 0xFFFFFFFF is an
@@ -438,24 +599,24 @@ int ElfFileImpl<Elf_Addr, Elf_Off>::parse_compilation_units(
 }
 
 template <typename Elf_Addr, typename Elf_Off>
-bool ElfFileImpl<Elf_Addr, Elf_Off>::get_section_info_by_name(const char* name,
-                                                              Elf_Off* offset,
-                                                              Elf_Word* size) {
+const Elf_SHdr<Elf_Addr, Elf_Off>*
+ElfFileImpl<Elf_Addr, Elf_Off>::get_section_by_name(const char* name) const {
   const Elf_SHdr<Elf_Addr, Elf_Off>* cur_section =
       reinterpret_cast<const Elf_SHdr<Elf_Addr, Elf_Off>*>(sec_table_);
 
   for (Elf_Half sec = 0; sec < sec_count_; sec++) {
-    const char* sec_name = get_str_sec_str(pull_val(cur_section->sh_name));
-    if (sec_name != NULL && strcmp(name, sec_name) == 0) {
-      *offset = pull_val(cur_section->sh_offset);
-      *size = pull_val(cur_section->sh_size);
-      return true;
+    const Elf_Word name_index = pull_val(cur_section->sh_name);
+    if (name_index < string_section_.size()) {
+      const char* sec_name = get_str_sec_str(name_index);
+      if (sec_name != NULL && strcmp(name, sec_name) == 0) {
+        return cur_section;
+      }
     }
     cur_section = reinterpret_cast<const Elf_SHdr<Elf_Addr, Elf_Off>*>
                                   (INC_CPTR(cur_section, sec_entry_size_));
   }
   _set_errno(EINVAL);
-  return false;
+  return NULL;
 }
 
 template <typename Elf_Addr, typename Elf_Off>
@@ -466,11 +627,205 @@ bool ElfFileImpl<Elf_Addr, Elf_Off>::map_section_by_name(
     return true;
   }
 
-  Elf_Off offset;
-  Elf_Word size;
-  if (!get_section_info_by_name(name, &offset, &size)) {
+  const Elf_SHdr<Elf_Addr, Elf_Off>* sec = get_section_by_name(name);
+  if (sec != NULL) {
+    return map_section(sec, false, section);
+  }
+
+  /* Older toolchains compress debug sections into .zdebug_xxx ones. */
+  if (strncmp(name, ".debug_", 7) == 0) {
+    char zname[64];
+    if (strlen(name) + 2 <= sizeof(zname)) {
+      zname[0] = '.';
+      zname[1] = 'z';
+      strcpy(zname + 2, name + 1);
+      sec = get_section_by_name(zname);
+      if (sec != NULL) {
+        return map_section(sec, true, section);
+      }
+    }
+  }
+  return false;
+}
+
+template <typename Elf_Addr, typename Elf_Off>
+bool ElfFileImpl<Elf_Addr, Elf_Off>::map_section(
+    const Elf_SHdr<Elf_Addr, Elf_Off>* sec,
+    bool zdebug,
+    ElfMappedSection* section) {
+  if (!section->map(file_data_, file_size_, pull_val(sec->sh_offset),
+                    pull_val(sec->sh_size))) {
+    return false;
+  }
+
+  if ((pull_val(sec->sh_flags) & SHF_COMPRESSED) != 0) {
+    /* Section data begin with compression header, followed by zlib stream. */
+    typedef Elf_Chdr<Elf_Addr, Elf_Off> Chdr;
+    if (section->size() < sizeof(Chdr)) {
+      _set_errno(EBADF);
+      return false;
+    }
+    const Chdr* chdr = reinterpret_cast<const Chdr*>(section->data());
+    if (pull_val(chdr->ch_type) != ELFCOMPRESS_ZLIB) {
+      _set_errno(EINVAL);
+      return false;
+    }
+    return decompress_section(INC_CPTR(section->data(), sizeof(Chdr)),
+                              section->size() - sizeof(Chdr),
+                              pull_val(chdr->ch_size), section);
+  }
+
+  if (zdebug) {
+    /* Section data begin with "ZLIB" magic, followed by big-endian 64-bit
+     * size of the uncompressed data, and zlib stream. */
+    if (section->size() < ZDEBUG_HDR_SIZE ||
+        memcmp(section->data(), ZDEBUG_MAGIC, 4) != 0) {
+      _set_errno(EBADF);
+      return false;
+    }
+    const Elf_Byte* size_bytes = INC_CPTR_T(Elf_Byte, section->data(), 4);
+    Elf_Xword size = 0;
+    for (int n = 0; n < 8; n++) {
+      size = (size << 8) | size_bytes[n];
+    }
+    return decompress_section(INC_CPTR(section->data(), ZDEBUG_HDR_SIZE),
+                              section->size() - ZDEBUG_HDR_SIZE,
+                              size, section);
+  }
+
+  return true;
+}
+
+template <typename Elf_Addr, typename Elf_Off>
+bool ElfFileImpl<Elf_Addr, Elf_Off>::decompress_section(
+    const void* data,
+    Elf_Xword data_size,
+    Elf_Xword size,
+    ElfMappedSection* section) {
+  if (size == 0 || size != static_cast<Elf_Word>(size)) {
+    _set_errno(EBADF);
+    return false;
+  }
+
+  Elf_Byte* buffer = new Elf_Byte[size];
+  assert(buffer != NULL);
+  if (buffer == NULL) {
+    _set_errno(ENOMEM);
+    return false;
+  }
+  size_t inflated;
+  if (zinflate(buffer, static_cast<size_t>(size), data,
+               static_cast<size_t>(data_size), &inflated) != 0 ||
+      inflated != size) {
+    delete[] buffer;
+    _set_errno(EBADF);
+    return false;
+  }
+
+  section->adopt(buffer, static_cast<Elf_Word>(size));
+  decompressed_bytes_ += static_cast<size_t>(size);
+  return true;
+}
+
+template <typename Elf_Addr, typename Elf_Off>
+const Elf_SHdr<Elf_Addr, Elf_Off>*
+ElfFileImpl<Elf_Addr, Elf_Off>::get_section_by_type(Elf_Word type) const {
+  const Elf_SHdr<Elf_Addr, Elf_Off>* cur_section =
+      reinterpret_cast<const Elf_SHdr<Elf_Addr, Elf_Off>*>(sec_table_);
+
+  for (Elf_Half sec = 0; sec < sec_count_; sec++) {
+    if (pull_val(cur_section->sh_type) == type) {
+      return cur_section;
+    }
+    cur_section = reinterpret_cast<const Elf_SHdr<Elf_Addr, Elf_Off>*>
+                                  (INC_CPTR(cur_section, sec_entry_size_));
+  }
+  return NULL;
+}
+
+template <typename Elf_Addr, typename Elf_Off>
+bool ElfFileImpl<Elf_Addr, Elf_Off>::build_symbol_index() {
+  typedef Elf_Sym<Elf_Addr, Elf_Off> Sym;
+
+  /* Prefer the full symbol table, and fall back to the dynamic one, that
+   * survives stripping. */
+  const Elf_SHdr<Elf_Addr, Elf_Off>* sym_sec = get_section_by_type(SHT_SYMTAB);
+  if (sym_sec == NULL) {
+    sym_sec = get_section_by_type(SHT_DYNSYM);
+  }
+  if (sym_sec == NULL) {
+    _set_errno(ENOENT);
+    return false;
+  }
+
+  const Elf_Xword entry_size = pull_val(sym_sec->sh_entsize);
+  const Elf_Xword sec_size = pull_val(sym_sec->sh_size);
+  if (entry_size < sizeof(Sym) || sec_size < entry_size) {
+    _set_errno(EBADF);
+    return false;
+  }
+
+  /* Map the symbol string table. It stays mapped for the lifetime of this
+   * instance, since collected symbols reference names in it. */
+  const Elf_SHdr<Elf_Addr, Elf_Off>* str_sec =
+      reinterpret_cast<const Elf_SHdr<Elf_Addr, Elf_Off>*>
+          (get_section_by_index(pull_val(sym_sec->sh_link)));
+  if (str_sec == NULL ||
+      !symbol_strings_.map(file_data_, file_size_,
+                           pull_val(str_sec->sh_offset),
+                           pull_val(str_sec->sh_size))) {
+    return false;
+  }
+
+  /* Symbol entries are needed only while we build the index. */
+  ElfMappedSection sym_table;
+  if (!sym_table.map(file_data_, file_size_, pull_val(sym_sec->sh_offset),
+                     sec_size)) {
+    return false;
+  }
+
+  /* Count routine symbols, so we can allocate the index at once. */
+  const Elf_Xword entry_count = sec_size / entry_size;
+  Elf_Xword routine_count = 0;
+  for (Elf_Xword n = 0; n < entry_count; n++) {
+    const Sym* sym = INC_CPTR_T(Sym, sym_table.data(), n * entry_size);
+    const Elf_Byte type = ELF_ST_TYPE(pull_val(sym->st_info));
+    if ((type == STT_FUNC || type == STT_GNU_IFUNC) &&
+        pull_val(sym->st_shndx) != SHN_UNDEF &&
+        pull_val(sym->st_name) < symbol_strings_.size()) {
+      routine_count++;
+    }
+  }
+  if (routine_count == 0) {
+    _set_errno(ENOENT);
     return false;
   }
 
-  return section->map(elf_handle_, offset, size);
+  symbols_ = new ElfSymbol[routine_count];
+  assert(symbols_ != NULL);
+  if (symbols_ == NULL) {
+    _set_errno(ENOMEM);
+    return false;
+  }
+
+  for (Elf_Xword n = 0; n < entry_count; n++) {
+    const Sym* sym = INC_CPTR_T(Sym, sym_table.data(), n * entry_size);
+    const Elf_Byte type = ELF_ST_TYPE(pull_val(sym->st_info));
+    if ((type == STT_FUNC || type == STT_GNU_IFUNC) &&
+        pull_val(sym->st_shndx) != SHN_UNDEF &&
+        pull_val(sym->st_name) < symbol_strings_.size()) {
+      ElfSymbol* entry = &symbols_[symbol_count_++];
+      entry->address = pull_val(sym->st_value);
+      if (is_arm_) {
+        /* Bit 0 flags Thumb routines. */
+        entry->address &= ~static_cast<Elf_Xword>(1);
+      }
+      entry->size = pull_val(sym->st_size);
+      entry->name = INC_CPTR_T(char, symbol_strings_.data(),
+                               pull_val(sym->st_name));
+    }
+  }
+
+  qsort(symbols_, symbol_count_, sizeof(ElfSymbol), compare_symbols);
+  return true;
 }
@@ -22,6 +22,19 @@
 #include "elff_api.h"
 #include "mapfile.h"
 
+/* Describes a routine symbol, collected from the ELF's symbol table. */
+typedef struct ElfSymbol {
+  /* Address of the beginning of the routine. */
+  Elf_Xword     address;
+
+  /* Byte size of the routine, or zero if size is unknown. */
+  Elf_Xword     size;
+
+  /* Routine name. NOTE: this pointer points to a mapped string table section
+   * of the ELF file. */
+  const char*   name;
+} ElfSymbol;
+
 /* Encapsulates architecture-independent functionality of an ELF file.
  *
  * This class is a base class for templated ElfFileImpl. This class implements
@@ -30,6 +43,10 @@
  * architecture (namely, 32 or 64-bit), for which ELF file has been built.
  *
  * NOTE: This class operates on ELF sections that have been mapped to memory.
+ * The whole ELF file is mapped once, when instance is created, and sections
+ * are views of that mapping. Compressed debug sections (SHF_COMPRESSED, or
+ * GNU-style .zdebug_xxx) are decompressed when they are first needed, and
+ * kept for the lifetime of the instance.
  *
  */
 class ElfFile {
@@ -108,13 +125,28 @@ class ElfFile {
       return is_exec_;
   }
 
+  /* Gets number of heap bytes held by this instance for the parsed DWARF
+   * objects, decompressed debug sections, and the symbol index. The mapped
+   * ELF file is not accounted here, since it is backed by the file itself.
+   */
+  size_t memory_usage() const;
+
+  /* Releases DWARF objects collected while parsing compilation units of this
+   * file, and returns their memory back to the heap. Compilation units will
+   * be parsed again on the next call to get_pc_address_info().
+   * NOTE: this invalidates all address information obtained from this
+   * instance, that has not been freed with free_pc_address_info() yet.
+   */
+  void release_compilation_units();
+
  protected:
   /* Initializes ElfFile instance. This method is called from Create method of
    * this class after appropriate ElfFileImpl instance has been created. Note,
    * that Create() method will validate that requested file is an ELF file,
-   * prior to instantiating of an ElfFileImpl object, and calling this method.
+   * and map it to memory prior to instantiating of an ElfFileImpl object, and
+   * calling this method.
    * Param:
-   *  elf_hdr - Address of the common ELF file header.
+   *  elf_hdr - Address of the common ELF file header in the mapped file.
    *  path - See Create().
    * Return:
    *  true on success, or false on failure, with errno containing extended
@@ -348,6 +380,33 @@ class ElfFile {
    */
   virtual int parse_compilation_units(const DwarfParseContext* parse_context) = 0;
 
+//=============================================================================
+// Symbol table management.
+//=============================================================================
+
+ protected:
+  /* Builds routine symbol index for this ELF file.
+   * Routine symbols are collected from the .symtab section of the ELF file, or
+   * from the .dynsym section, if .symtab has been stripped out, and saved into
+   * symbols_ array, sorted by routine address.
+   * This is ELF format - dependent method.
+   * Return:
+   *  true on success, or false on failure, with errno containing extended
+   *  error information.
+   */
+  virtual bool build_symbol_index() = 0;
+
+  /* Finds a routine symbol containing the given address.
+   * Symbol index is built on the first call to this method, and is cached
+   * for the lifetime of this instance.
+   * Param:
+   *  address - Address to find routine symbol for.
+   * Return:
+   *  Routine symbol that contains the given address, or NULL if no such
+   *  symbol has been found.
+   */
+  const ElfSymbol* find_symbol(Elf_Xword address);
+
  public:
   /* Gets PC address information.
    * Param:
@@ -364,6 +423,22 @@ class ElfFile {
    */
   bool get_pc_address_info(Elf_Xword address, Elf_AddressInfo* address_info);
 
+  /* Gets PC address information from the ELF's symbol table.
+   * This method is used when ELF file doesn't contain DWARF information for
+   * the address, in which case only the name of the routine containing the
+   * address, and address offset in that routine are available.
+   * Param:
+   *  address - PC address to get information for. The address must be relative
+   *    to the beginning of ELF file represented by this class.
+   *  address_info - Upon success contains information about routine that
+   *    contains the given address.
+   * Return:
+   *  true if routine containing the given address has been found in the
+   *  symbol table, or false otherwise, with errno containing extended error
+   *  information.
+   */
+  bool get_pc_symbol_info(Elf_Xword address, Elf_AddressInfo* address_info);
+
   /* Frees resources aqcuired for address information in successful call to
    * get_pc_address_info().
    * Param:
@@ -506,6 +581,15 @@ class ElfFile {
   /* Mapped .debug_ranges section. */
   ElfMappedSection    debug_ranges_;
 
+  /* Mapped string table for the symbol table, used for the symbol index. */
+  ElfMappedSection    symbol_strings_;
+
+  /* Routine symbols, sorted by their addresses. */
+  ElfSymbol*          symbols_;
+
+  /* Number of entries in symbols_ array. */
+  Elf_Xword           symbol_count_;
+
   /* Base address of the loaded module (if fixed), or 0 if module doesn't get
    * loaded at fixed address. */
   Elf_Xword           fixed_base_address_;
@@ -513,14 +597,29 @@ class ElfFile {
   /* Handle to the ELF file represented with this instance. */
   MapFile*            elf_handle_;
 
+  /* Beginning of the memory mapping, containing the whole ELF file. */
+  void*               mapped_at_;
+
+  /* Size of the memory mapping, containing the whole ELF file. */
+  size_t              mapped_size_;
+
+  /* Beginning of the ELF file data in the mapping. */
+  const void*         file_data_;
+
+  /* Size of the ELF file. */
+  Elf_Xword           file_size_;
+
+  /* Number of bytes held in decompressed debug sections. */
+  size_t              decompressed_bytes_;
+
   /* Path to the ELF file represented with this instance. */
   char*               elf_file_path_;
 
   /* DWARF objects allocator for this instance. */
   class ElfAllocator* allocator_;
 
-  /* Beginning of the cached ELF's section table. */
-  void*               sec_table_;
+  /* Beginning of the ELF's section table in the mapped file. */
+  const void*         sec_table_;
 
   /* Number of sections in the ELF file wrapped by this instance. */
   Elf_Half            sec_count_;
@@ -558,6 +657,23 @@ class ElfFile {
    * instance is an executable. If this member is 0, file is a shared library.
    */
   bool                is_exec_;
+
+  /* Flags ARM ELF file, where bit 0 of a routine symbol value is set for
+   * Thumb routines, and must be masked out to get routine address. */
+  bool                is_arm_;
+
+  /* Flags that build_symbol_index() has been called for this instance. */
+  bool                symbols_indexed_;
+
+  /* Flags that parsing of DWARF for this file has failed, so addresses in
+   * this file are looked up in the symbol table only, until
+   * release_compilation_units() is called. */
+  bool                dwarf_failed_;
+
+  /* Limit of the allocator under which DWARF for this file didn't fit, or
+   * zero if parsing failed for another reason (e.g. malformed DWARF). Parsing
+   * is retried once the allocator's limit is raised above this value. */
+  size_t              dwarf_failed_limit_;
 };
 
 /* Encapsulates architecture-dependent functionality of an ELF file.
@@ -595,20 +711,33 @@ friend class ElfFile;
    */
   virtual int parse_compilation_units(const DwarfParseContext* parse_context);
 
-  /* Gets section information by section name.
+  /* Gets section header by section name.
    * Param:
-   *  name - Name of the section to get information for.
-   *  offset - Upon success contains offset of the section data in ELF file.
-   *  size - Upon success contains size of the section data in ELF file.
+   *  name - Name of the section to get header for.
    * Return:
-   *  true on sucess, or false if section with such name doesn't exist in
-   *  this ELF file.
+   *  Pointer to the section header, or NULL if section with such name doesn't
+   *  exist in this ELF file.
+   */
+  const Elf_SHdr<Elf_Addr, Elf_Off>* get_section_by_name(const char* name) const;
+
+  /* Gets header of the first section of the given type.
+   * Param:
+   *  type - Type of the section to get header for (one of SHT_XXX values).
+   * Return:
+   *  Pointer to the section header, or NULL if section of such type doesn't
+   *  exist in this ELF file.
+   */
+  const Elf_SHdr<Elf_Addr, Elf_Off>* get_section_by_type(Elf_Word type) const;
+
+  /* Builds routine symbol index for this ELF file. This is an implementation
+   * of the base class' abstract method.
+   * See ElfFile::build_symbol_index().
    */
-  bool get_section_info_by_name(const char* name,
-                                Elf_Off* offset,
-                                Elf_Word* size);
+  virtual bool build_symbol_index();
 
   /* Maps section by its name.
+   * If a .debug_xxx section doesn't exist in this ELF file, this method looks
+   * for GNU-style compressed .zdebug_xxx section instead.
    * Param:
    *  name - Name of the section to map.
    *  section - Upon success contains section's mapping information.
@@ -617,6 +746,34 @@ friend class ElfFile;
    *  this ELF file, or mapping has failed.
    */
   bool map_section_by_name(const char* name, ElfMappedSection* section);
+
+  /* Maps section by its header, decompressing section data, if needed.
+   * Param:
+   *  sec - Header of the section to map.
+   *  zdebug - Flags GNU-style compressed .zdebug_xxx section.
+   *  section - Upon success contains section's mapping information.
+   * Return:
+   *  true on sucess, or false if section data is not contained in the ELF
+   *  file, or decompression has failed.
+   */
+  bool map_section(const Elf_SHdr<Elf_Addr, Elf_Off>* sec,
+                   bool zdebug,
+                   ElfMappedSection* section);
+
+  /* Decompresses section data into a buffer owned by the section.
+   * Param:
+   *  data - Compressed zlib stream.
+   *  data_size - Size of the compressed zlib stream.
+   *  size - Size of the decompressed data.
+   *  section - Upon success owns the decompressed data.
+   * Return:
+   *  true on sucess, or false on failure, with errno providing extended
+   *  error information.
+   */
+  bool decompress_section(const void* data,
+                          Elf_Xword data_size,
+                          Elf_Xword size,
+                          ElfMappedSection* section);
 };
 
 #endif  // ELFF_ELF_FILE_H_
@@ -19,30 +19,39 @@
 #include "elf_mapped_section.h"
 
 ElfMappedSection::ElfMappedSection()
-    : mapped_at_(NULL),
+    : buffer_(NULL),
       data_(NULL),
       size_(0) {
 }
 
 ElfMappedSection::~ElfMappedSection() {
-  if (mapped_at_ != NULL) {
-    mapfile_unmap(mapped_at_, diff_ptr(mapped_at_, data_) + size_);
+  if (buffer_ != NULL) {
+    delete[] buffer_;
   }
 }
 
-bool ElfMappedSection::map(MapFile* handle,
+bool ElfMappedSection::map(const void* file_data,
+                           Elf_Xword file_size,
                            Elf_Xword offset,
-                           Elf_Word size) {
-    void* section_ptr;
-    size_t mapped_bytes;
-    mapped_at_ = mapfile_map(handle, offset, size, PROT_READ,
-                             &section_ptr, &mapped_bytes);
-    if (mapped_at_ == NULL) {
-        return false;
-    }
+                           Elf_Xword size) {
+  /* Section size is encoded with 32-bit value in 32-bit ELF files, and in
+   * practice debug sections never exceed it in 64-bit ELF files as well. */
+  if (offset > file_size || size > file_size - offset ||
+      size != static_cast<Elf_Word>(size)) {
+    _set_errno(EBADF);
+    return false;
+  }
 
-    data_ = section_ptr;
-    size_ = (Elf_Word)mapped_bytes;
+  data_ = INC_CPTR(file_data, offset);
+  size_ = static_cast<Elf_Word>(size);
+  return true;
+}
 
-    return true;
+void ElfMappedSection::adopt(Elf_Byte* buffer, Elf_Word size) {
+  if (buffer_ != NULL) {
+    delete[] buffer_;
+  }
+  buffer_ = buffer;
+  data_ = buffer;
+  size_ = size;
 }
@@ -19,9 +19,13 @@
 #define ELFF_ELF_MAPPED_SECTION_H_
 
 #include "elf_defs.h"
-#include "mapfile.h"
 
-/* Encapsulates a section of an ELF file, mapped to memory. */
+/* Encapsulates a section of an ELF file, mapped to memory.
+ * The whole ELF file is mapped to memory once by ElfFile, and instances of
+ * this class are views (slices) of that mapping. Compressed sections are
+ * decompressed into a buffer owned by the instance, so decompression happens
+ * only once for the lifetime of the instance.
+ */
 class ElfMappedSection {
  public:
   /* Constructs ElfMappedSection instance. */
@@ -30,27 +34,36 @@ class ElfMappedSection {
   /* Destructs ElfMappedSection instance. */
   ~ElfMappedSection();
 
-  /* Maps ELF file section to memory.
+  /* Initializes section as a view of the mapped ELF file.
    * Param:
-   *  handle - Handle to an opened ELF file.
+   *  file_data - Beginning of the ELF file mapping.
+   *  file_size - Size of the ELF file mapping.
    *  offset - Offset of the beginning of the section data in ELF file.
-   *    NOTE: we explicitly use 64-bit type for this parameter, since we may
-   *    still allow 32-bit library to process 64 bits ELF/DWARF formats. We
-   *    really only care about section size being small enough to fit in 32
-   *    bits value in this case (which seems to be always true for ELF files,
-   *    as section size is encoded with 32-bit value even in 64-bit ELF file).
    *  size - Section byte size in ELF file.
    * Return:
-   *  true on success, or false on failure, with errno providing extended
-   *  error information.
-   *  NOTE: if section has already been mapped, this method immediately
-   *  returns with success.
+   *  true on success, or false if section is not fully contained in the
+   *  ELF file, with errno set to EBADF.
+   */
+  bool map(const void* file_data, Elf_Xword file_size,
+           Elf_Xword offset, Elf_Xword size);
+
+  /* Initializes section with a buffer containing decompressed section data.
+   * Param:
+   *  buffer - Buffer, allocated with new[]. Ownership of the buffer is
+   *    transferred to this instance.
+   *  size - Size of decompressed data in the buffer.
    */
-  bool map(MapFile* handle, Elf_Xword offset, Elf_Word size);
+  void adopt(Elf_Byte* buffer, Elf_Word size);
 
   /* Checks if section has been mapped. */
   bool is_mapped() const {
-    return mapped_at_ != NULL;
+    return data_ != NULL;
+  }
+
+  /* Checks if section data has been decompressed into a buffer owned by
+   * this instance. */
+  bool is_decompressed() const {
+    return buffer_ != NULL;
   }
 
   /* Gets address of the beginning of the mapped section. */
@@ -72,12 +85,9 @@ class ElfMappedSection {
   }
 
  protected:
-  /* Beginning of the memory mapping, containing the section.
-   * NOTE: due to page alignment requirements of the mapping API, mapping
-   * address may differ from the address where the actual section data
-   * starts inside that mapping.
-   */
-  void*         mapped_at_;
+  /* Buffer with decompressed section data, owned by this instance, or NULL
+   * if section is a view of the mapped ELF file. */
+  Elf_Byte*     buffer_;
 
   /* Address of the beginning of the mapped section. */
   const void*   data_;
@@ -93,6 +93,12 @@ typedef struct Elf_AddressInfo {
    * structure is NULL, content of this field is not defined. */
   uint32_t          line_number;
 
+  /* Byte offset of the address from the beginning of the routine. This field
+   * is set only when routine information has been obtained from the ELF's
+   * symbol table (file has no DWARF information for the address), in which
+   * case file_name field is always NULL. Otherwise this field is zero. */
+  uint64_t          routine_offset;
+
   /* If routine that contains the given address has been inlined (or it is part
    * of even deeper inline branch) this array lists information about that
    * inline branch rooting to the first routine that has not been inlined. The
@@ -148,6 +154,9 @@ int elff_is_exec(ELFF_HANDLE handle);
  *  address has been found, or there was a memory error when collecting
  *  routine(s) information. In case of failure, errno provides extended
  *  error information.
+ *  NOTE: If ELF file has no DWARF information for the address, routine
+ *  information is looked up in the ELF's symbol table (.symtab, or .dynsym if
+ *  .symtab has been stripped), and only routine name and offset are reported.
  *  NOTE: Successful call to this routine must be complimented with a call
  *  to free_pc_address_info, so ELFF API can release resources aquired for
  *  address_info.
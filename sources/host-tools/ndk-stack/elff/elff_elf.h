@@ -200,6 +200,9 @@ typedef Elf_FHdr<Elf64_Addr, Elf64_Off> Elf64_FHdr;
  * Template param:
  *  Elf_Addr - Actual type for address encoding (Elf32_Addr, or Elf64_Addr).
  *  Elf_Off - Actual type for offset encoding (Elf32_Off, or Elf64_Off).
+ * NOTE: flags, size, alignment and entry size fields are word-sized in 32-bit
+ * ELF files, and extended to 64 bits in 64-bit ELF files, so we use Elf_Addr
+ * type for them, which matches that in both cases.
  */
 template <typename Elf_Addr, typename Elf_Off>
 struct Elf_SHdr {
@@ -210,7 +213,7 @@ struct Elf_SHdr {
   Elf_Word    sh_type;
 
   /* Section flags and attributes. */
-  Elf_Word    sh_flags;
+  Elf_Addr    sh_flags;
 
   /* Section address in the memory image of the process. */
   Elf_Addr    sh_addr;
@@ -221,7 +224,7 @@ struct Elf_SHdr {
   Elf_Off     sh_offset;
 
   /* Section size in bytes. */
-  Elf_Word    sh_size;
+  Elf_Addr    sh_size;
 
   /* Section header table index link. Depends on section type. */
   Elf_Word    sh_link;
@@ -232,10 +235,10 @@ struct Elf_SHdr {
   /* Address alignment constrains. 0 and 1 means that section has no
    * alignment constrains.
    */
-  Elf_Word    sh_addralign;
+  Elf_Addr    sh_addralign;
 
   /* Entry size for sections that hold some kind of a table. */
-  Elf_Word    sh_entsize;
+  Elf_Addr    sh_entsize;
 };
 /* 32-bit section header. */
 typedef Elf_SHdr<Elf32_Addr, Elf32_Off> Elf32_SHdr;
@@ -278,4 +281,146 @@ typedef Elf_SHdr<Elf64_Addr, Elf64_Off> Elf64_SHdr;
 #define SHT_SYMTAB_SHNDX    18
 #define SHT_NUM             19
 
+/*
+ * Values for sh_flags
+ */
+#define SHF_WRITE           0x1
+#define SHF_ALLOC           0x2
+#define SHF_EXECINSTR       0x4
+#define SHF_COMPRESSED      0x800
+
+//=============================================================================
+// ELF compressed section header
+//=============================================================================
+
+/* Templated (architecture dependent) header of a compressed section (section
+ * with SHF_COMPRESSED flag set). Compressed section data immediately follows
+ * this header. Layout of this header differs between 32 and 64-bit ELF files,
+ * so only specializations for these two cases are defined.
+ * Template param:
+ *  Elf_Addr - Actual type for address encoding (Elf32_Addr, or Elf64_Addr).
+ *  Elf_Off - Actual type for offset encoding (Elf32_Off, or Elf64_Off).
+ */
+template <typename Elf_Addr, typename Elf_Off>
+struct Elf_Chdr;
+
+/* 32-bit compressed section header. */
+template <>
+struct Elf_Chdr<Elf32_Addr, Elf32_Off> {
+  /* Compression algorithm. See ELFCOMPRESS_XXX bellow. */
+  Elf_Word    ch_type;
+
+  /* Size of the section data when decompressed. */
+  Elf_Word    ch_size;
+
+  /* Alignment of the decompressed section data. */
+  Elf_Word    ch_addralign;
+};
+typedef Elf_Chdr<Elf32_Addr, Elf32_Off> Elf32_Chdr;
+
+/* 64-bit compressed section header. */
+template <>
+struct Elf_Chdr<Elf64_Addr, Elf64_Off> {
+  /* Compression algorithm. See ELFCOMPRESS_XXX bellow. */
+  Elf_Word    ch_type;
+
+  /* Reserved. */
+  Elf_Word    ch_reserved;
+
+  /* Size of the section data when decompressed. */
+  Elf_Xword   ch_size;
+
+  /* Alignment of the decompressed section data. */
+  Elf_Xword   ch_addralign;
+};
+typedef Elf_Chdr<Elf64_Addr, Elf64_Off> Elf64_Chdr;
+
+/* Section data is compressed with zlib. */
+#define ELFCOMPRESS_ZLIB    1
+
+/* GNU-style compressed debug sections (named .zdebug_xxx instead of
+ * .debug_xxx) begin with "ZLIB" signature, followed by 8-byte big-endian
+ * size of decompressed data, followed by zlib stream. */
+#define ZDEBUG_MAGIC        "ZLIB"
+#define ZDEBUG_HDR_SIZE     12
+
+//=============================================================================
+// ELF symbol table
+//=============================================================================
+
+/* Templated (architecture dependent) symbol table entry for ELF file.
+ * Layout of this entry differs between 32 and 64-bit ELF files, so only
+ * specializations for these two cases are defined.
+ * Template param:
+ *  Elf_Addr - Actual type for address encoding (Elf32_Addr, or Elf64_Addr).
+ *  Elf_Off - Actual type for offset encoding (Elf32_Off, or Elf64_Off).
+ */
+template <typename Elf_Addr, typename Elf_Off>
+struct Elf_Sym;
+
+/* 32-bit symbol table entry. */
+template <>
+struct Elf_Sym<Elf32_Addr, Elf32_Off> {
+  /* Index (byte offset) of symbol name in the symbol string table. */
+  Elf_Word    st_name;
+
+  /* Symbol value (address of a routine for function symbols). */
+  Elf32_Addr  st_value;
+
+  /* Size of the object associated with the symbol, or zero if unknown. */
+  Elf_Word    st_size;
+
+  /* Symbol type and binding. See ELF_ST_TYPE and ELF_ST_BIND bellow. */
+  Elf_Byte    st_info;
+
+  /* Symbol visibility. */
+  Elf_Byte    st_other;
+
+  /* Index of the section this symbol is defined in. */
+  Elf_Half    st_shndx;
+};
+typedef Elf_Sym<Elf32_Addr, Elf32_Off> Elf32_Sym;
+
+/* 64-bit symbol table entry. */
+template <>
+struct Elf_Sym<Elf64_Addr, Elf64_Off> {
+  /* Index (byte offset) of symbol name in the symbol string table. */
+  Elf_Word    st_name;
+
+  /* Symbol type and binding. See ELF_ST_TYPE and ELF_ST_BIND bellow. */
+  Elf_Byte    st_info;
+
+  /* Symbol visibility. */
+  Elf_Byte    st_other;
+
+  /* Index of the section this symbol is defined in. */
+  Elf_Half    st_shndx;
+
+  /* Symbol value (address of a routine for function symbols). */
+  Elf64_Addr  st_value;
+
+  /* Size of the object associated with the symbol, or zero if unknown. */
+  Elf_Xword   st_size;
+};
+typedef Elf_Sym<Elf64_Addr, Elf64_Off> Elf64_Sym;
+
+/* Extracts symbol binding and type from st_info field of a symbol. */
+#define ELF_ST_BIND(i)    ((i) >> 4)
+#define ELF_ST_TYPE(i)    ((i) & 0xf)
+
+/*
+ * Values for symbol type
+ */
+#define STT_NOTYPE          0
+#define STT_OBJECT          1
+#define STT_FUNC            2
+#define STT_SECTION         3
+#define STT_FILE            4
+#define STT_GNU_IFUNC       10
+
+/*
+ * Values for e_machine, that require special handling of symbol values.
+ */
+#define EM_ARM              40
+
 #endif  // ELFF_ELH_H_
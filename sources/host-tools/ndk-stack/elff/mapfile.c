@@ -16,6 +16,7 @@
  */
 
 #include "stddef.h"
+#include "stdint.h"
 #include "sys/types.h"
 #include "errno.h"
 #ifdef  WIN32
@@ -147,6 +148,27 @@ mapfile_read_at(MapFile* handle, size_t offset, void* buf, size_t nbyte)
 #endif  // WIN32
 }
 
+int
+mapfile_size(MapFile* handle, uint64_t* size)
+{
+#ifdef WIN32
+    LARGE_INTEGER converter;
+    if (!GetFileSizeEx(handle, &converter)) {
+        errno = GetLastError();
+        return -1;
+    }
+    *size = (uint64_t)converter.QuadPart;
+    return 0;
+#else   // WIN32
+    struct stat st;
+    if (fstat((int)(ptrdiff_t)handle, &st) != 0) {
+        return -1;
+    }
+    *size = (uint64_t)st.st_size;
+    return 0;
+#endif  // WIN32
+}
+
 void*
 mapfile_map(MapFile* handle,
             size_t offset,
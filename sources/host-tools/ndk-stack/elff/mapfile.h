@@ -85,6 +85,16 @@ extern ssize_t mapfile_read_at(MapFile* handle,
                                void* buf,
                                size_t nbyte);
 
+/* Gets size of a file opened with mapfile_open routine.
+ * Param:
+ *  handle - A handle to a file previously obtained via successful call to
+ *      mapfile_open routine.
+ *  size - Upon success, contains file size in bytes.
+ * Return:
+ *  0 on success, or -1 on failure with errno containing the error code.
+ */
+extern int mapfile_size(MapFile* handle, uint64_t* size);
+
 /* Maps a section of a file to memory.
  * Param:
  *  handle - A handle to a file previously obtained via successful call to
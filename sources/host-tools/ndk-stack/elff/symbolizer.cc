@@ -0,0 +1,301 @@
+/* Copyright (C) 2013 The Android Open Source Project
+**
+** This software is licensed under the terms of the GNU General Public
+** License version 2, as published by the Free Software Foundation, and
+** may be copied, distributed, and modified under those terms.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+/*
+ * Contains implementation of class Symbolizer, that implements thread-safe
+ * symbolization of addresses in a set of ELF files, with bounded memory.
+ */
+
+#include <string.h>
+#include "symbolizer.h"
+#include "elf_file.h"
+#include "elf_alloc.h"
+
+/* Computes number of bytes required to save a copy of a string. */
+static size_t string_space(const char* str) {
+  return str != NULL ? strlen(str) + 1 : 0;
+}
+
+/* Saves a copy of a string into the strings buffer.
+ * Param:
+ *  str - String to copy. Can be NULL.
+ *  buf - Address of the current position in the strings buffer. Upon return
+ *    is advanced past the copied string.
+ * Return:
+ *  Address of the string copy, or NULL if str was NULL.
+ */
+static const char* copy_string(const char* str, char** buf) {
+  if (str == NULL) {
+    return NULL;
+  }
+  const size_t len = strlen(str) + 1;
+  char* ret = *buf;
+  memcpy(ret, str, len);
+  *buf += len;
+  return ret;
+}
+
+Symbolizer::Symbolizer(size_t memory_budget)
+    : mru_(NULL),
+      lru_(NULL),
+      memory_budget_(memory_budget),
+      memory_usage_(0) {
+}
+
+Symbolizer::~Symbolizer() {
+  Module* module = mru_;
+  while (module != NULL) {
+    Module* next_module = module->next;
+    assert(module->users == 0);
+    delete_module(module);
+    module = next_module;
+  }
+}
+
+int Symbolizer::symbolize(const char* module_path,
+                          const uint64_t* addresses,
+                          int count,
+                          SymbolizerResult* results) {
+  assert(module_path != NULL && (count == 0 || (addresses != NULL && results != NULL)));
+  if (module_path == NULL || count < 0 ||
+      (count != 0 && (addresses == NULL || results == NULL))) {
+    _set_errno(EINVAL);
+    return -1;
+  }
+
+  for (int n = 0; n < count; n++) {
+    results[n].address = addresses[n];
+    results[n].frames = NULL;
+    results[n].frame_count = 0;
+    results[n].strings = NULL;
+  }
+
+  lock_.lock();
+  Module* module = find_module(module_path);
+  size_t memory_budget = memory_budget_;
+  lock_.unlock();
+  if (module == NULL) {
+    /* Open the file without holding lock_, so queries for the other modules
+     * don't wait for it. */
+    ElfFile* elf = ElfFile::Create(module_path);
+    if (elf == NULL) {
+      return -1;
+    }
+    lock_.lock();
+    module = find_module(module_path);
+    if (module == NULL) {
+      module = add_module(module_path, elf);
+      elf = NULL;
+    }
+    memory_budget = memory_budget_;
+    lock_.unlock();
+    /* Another query has opened the module in the meantime. */
+    if (elf != NULL) {
+      delete elf;
+    }
+  }
+
+  int resolved = 0;
+  module->lock.lock();
+  /* Limit DWARF objects of the module to the budget, so a single module
+   * never grows past it. The limit is used by the queries under the module's
+   * lock, so it is only changed under this lock. */
+  module->elf->allocator()->set_limit(memory_budget);
+  for (int n = 0; n < count; n++) {
+    if (symbolize_address(module->elf, addresses[n], &results[n])) {
+      resolved++;
+    }
+  }
+  const size_t usage = module->elf->memory_usage();
+  module->lock.unlock();
+
+  lock_.lock();
+  release_module(module, usage);
+  enforce_budget();
+  lock_.unlock();
+
+  return resolved;
+}
+
+void Symbolizer::free_results(SymbolizerResult* results, int count) {
+  for (int n = 0; n < count; n++) {
+    if (results[n].frames != NULL) {
+      delete[] results[n].frames;
+      results[n].frames = NULL;
+    }
+    if (results[n].strings != NULL) {
+      delete[] results[n].strings;
+      results[n].strings = NULL;
+    }
+    results[n].frame_count = 0;
+  }
+}
+
+size_t Symbolizer::memory_usage() {
+  lock_.lock();
+  const size_t ret = memory_usage_;
+  lock_.unlock();
+  return ret;
+}
+
+size_t Symbolizer::memory_budget() {
+  lock_.lock();
+  const size_t ret = memory_budget_;
+  lock_.unlock();
+  return ret;
+}
+
+void Symbolizer::set_memory_budget(size_t memory_budget) {
+  lock_.lock();
+  memory_budget_ = memory_budget;
+  enforce_budget();
+  lock_.unlock();
+}
+
+Symbolizer::Module* Symbolizer::find_module(const char* path) {
+  Module* module = mru_;
+  while (module != NULL && strcmp(module->path, path) != 0) {
+    module = module->next;
+  }
+  if (module != NULL) {
+    unlink_module(module);
+    use_module(module);
+  }
+  return module;
+}
+
+Symbolizer::Module* Symbolizer::add_module(const char* path, ElfFile* elf) {
+  Module* module = new Module;
+  const size_t path_len = strlen(path) + 1;
+  module->path = new char[path_len];
+  memcpy(module->path, path, path_len);
+  module->elf = elf;
+  module->users = 0;
+  module->usage = 0;
+  module->prev = NULL;
+  module->next = NULL;
+  use_module(module);
+  return module;
+}
+
+void Symbolizer::use_module(Module* module) {
+  /* Move module to the head of the list. */
+  module->next = mru_;
+  if (mru_ != NULL) {
+    mru_->prev = module;
+  }
+  mru_ = module;
+  if (lru_ == NULL) {
+    lru_ = module;
+  }
+
+  module->users++;
+}
+
+void Symbolizer::release_module(Module* module, size_t usage) {
+  assert(module->users > 0);
+  module->users--;
+  memory_usage_ -= module->usage;
+  module->usage = usage;
+  memory_usage_ += module->usage;
+}
+
+void Symbolizer::enforce_budget() {
+  if (memory_budget_ == 0) {
+    return;
+  }
+
+  Module* module = lru_;
+  while (module != NULL && memory_usage_ > memory_budget_) {
+    Module* prev_module = module->prev;
+    if (module->users == 0) {
+      unlink_module(module);
+      memory_usage_ -= module->usage;
+      delete_module(module);
+    }
+    module = prev_module;
+  }
+}
+
+void Symbolizer::unlink_module(Module* module) {
+  if (module->prev != NULL) {
+    module->prev->next = module->next;
+  } else {
+    mru_ = module->next;
+  }
+  if (module->next != NULL) {
+    module->next->prev = module->prev;
+  } else {
+    lru_ = module->prev;
+  }
+  module->prev = NULL;
+  module->next = NULL;
+}
+
+void Symbolizer::delete_module(Module* module) {
+  delete module->elf;
+  delete[] module->path;
+  delete module;
+}
+
+bool Symbolizer::symbolize_address(ElfFile* elf,
+                                   uint64_t address,
+                                   SymbolizerResult* result) {
+  Elf_AddressInfo info;
+  if (!elf->get_pc_address_info(address, &info)) {
+    return false;
+  }
+
+  /* Count frames in the inline chain, and space required for their strings. */
+  int frame_count = 1;
+  size_t strings_size = string_space(info.routine_name) +
+                        string_space(info.file_name) +
+                        string_space(info.dir_name);
+  if (info.inline_stack != NULL) {
+    for (const Elf_InlineInfo* inl = info.inline_stack;
+         !elfinlineinfo_is_last_entry(inl); inl++) {
+      frame_count++;
+      strings_size += string_space(inl->routine_name) +
+                      string_space(inl->inlined_in_file) +
+                      string_space(inl->inlined_in_file_dir);
+    }
+  }
+
+  result->frames = new SymbolizerFrame[frame_count];
+  result->strings = new char[strings_size];
+  result->frame_count = frame_count;
+
+  /* First frame is the routine containing the address. */
+  char* buf = result->strings;
+  SymbolizerFrame* frame = result->frames;
+  frame->routine_name = copy_string(info.routine_name, &buf);
+  frame->file_name = copy_string(info.file_name, &buf);
+  frame->dir_name = copy_string(info.dir_name, &buf);
+  frame->line_number = info.line_number;
+  frame->routine_offset = info.routine_offset;
+
+  /* Following frames are routines, where the previous one has been inlined. */
+  if (info.inline_stack != NULL) {
+    for (const Elf_InlineInfo* inl = info.inline_stack;
+         !elfinlineinfo_is_last_entry(inl); inl++) {
+      frame++;
+      frame->routine_name = copy_string(inl->routine_name, &buf);
+      frame->file_name = copy_string(inl->inlined_in_file, &buf);
+      frame->dir_name = copy_string(inl->inlined_in_file_dir, &buf);
+      frame->line_number = inl->inlined_at_line;
+      frame->routine_offset = 0;
+    }
+  }
+
+  elf->free_pc_address_info(&info);
+  return true;
+}
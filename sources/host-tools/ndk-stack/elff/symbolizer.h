@@ -0,0 +1,266 @@
+/* Copyright (C) 2013 The Android Open Source Project
+**
+** This software is licensed under the terms of the GNU General Public
+** License version 2, as published by the Free Software Foundation, and
+** may be copied, distributed, and modified under those terms.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+/*
+ * Contains declaration of class Symbolizer, that implements thread-safe
+ * symbolization of addresses in a set of ELF files, with bounded memory.
+ */
+
+#ifndef ELFF_SYMBOLIZER_H_
+#define ELFF_SYMBOLIZER_H_
+
+#include <stdint.h>
+#include "elff-common.h"
+#ifndef WIN32
+#include <pthread.h>
+#endif  // WIN32
+
+class ElfFile;
+
+/* Describes one routine in the inline chain for a symbolized address. */
+typedef struct SymbolizerFrame {
+  /* Name of the routine. This field is never NULL. If name of the routine
+   * was not available, this field is set to "<unknown>". */
+  const char*   routine_name;
+
+  /* Name of the source file for this frame, or NULL if source location is
+   * not available. If this field is NULL, content of dir_name and line_number
+   * fields is not defined. */
+  const char*   file_name;
+
+  /* Path to the source file directory, or NULL if not available. */
+  const char*   dir_name;
+
+  /* Line number in the source file. For the first frame in the chain this is
+   * the line for the address itself. For the other frames this is the line,
+   * where the previous frame's routine has been inlined. */
+  uint32_t      line_number;
+
+  /* Offset of the address from the beginning of the routine, if routine has
+   * been found in the symbol table only. Zero otherwise. */
+  uint64_t      routine_offset;
+} SymbolizerFrame;
+
+/* Describes result of symbolization of one address. */
+typedef struct SymbolizerResult {
+  /* Address that has been symbolized. */
+  uint64_t          address;
+
+  /* Inline chain for the address. The first frame describes the routine
+   * containing the address, and each following frame describes the routine
+   * where the previous one has been inlined. NULL if address has not been
+   * resolved. */
+  SymbolizerFrame*  frames;
+
+  /* Number of entries in frames array. */
+  int               frame_count;
+
+  /* Buffer containing copies of all strings referenced by frames. */
+  char*             strings;
+} SymbolizerResult;
+
+/* Encapsulates a mutex, used by Symbolizer. */
+class SymbolizerMutex {
+ public:
+  SymbolizerMutex() {
+#ifdef WIN32
+    InitializeCriticalSection(&mutex_);
+#else   // WIN32
+    pthread_mutex_init(&mutex_, NULL);
+#endif  // WIN32
+  }
+
+  ~SymbolizerMutex() {
+#ifdef WIN32
+    DeleteCriticalSection(&mutex_);
+#else   // WIN32
+    pthread_mutex_destroy(&mutex_);
+#endif  // WIN32
+  }
+
+  void lock() {
+#ifdef WIN32
+    EnterCriticalSection(&mutex_);
+#else   // WIN32
+    pthread_mutex_lock(&mutex_);
+#endif  // WIN32
+  }
+
+  void unlock() {
+#ifdef WIN32
+    LeaveCriticalSection(&mutex_);
+#else   // WIN32
+    pthread_mutex_unlock(&mutex_);
+#endif  // WIN32
+  }
+
+ private:
+#ifdef WIN32
+  CRITICAL_SECTION  mutex_;
+#else   // WIN32
+  pthread_mutex_t   mutex_;
+#endif  // WIN32
+};
+
+/* Implements symbolization of batches of addresses in ELF files.
+ *
+ * Symbolizer keeps an ElfFile instance for every module it has been queried
+ * for, so DWARF information parsed for a module is reused by the following
+ * queries. Total memory held by these instances is kept under the memory
+ * budget given to the symbolizer: each module's ElfAllocator is limited to
+ * the budget (modules that don't fit are served from their symbol tables),
+ * and least recently used modules are dropped when the total exceeds it.
+ *
+ * All public methods of this class are thread-safe. Queries for different
+ * modules run concurrently, while queries for the same module are serialized,
+ * since ElfFile parses DWARF lazily.
+ */
+class Symbolizer {
+ public:
+  /* Constructs Symbolizer instance.
+   * Param:
+   *  memory_budget - Maximum number of bytes the symbolizer may hold for the
+   *    cached modules, or zero for no limit.
+   */
+  explicit Symbolizer(size_t memory_budget);
+
+  /* Destructs Symbolizer instance. */
+  ~Symbolizer();
+
+  /* Symbolizes a batch of addresses in a module.
+   * Param:
+   *  module_path - Full path to the module's ELF file.
+   *  addresses - Addresses to symbolize. Addresses must be relative to the
+   *    beginning of the module.
+   *  count - Number of entries in addresses array.
+   *  results - Upon return contains results for every address in addresses
+   *    array. Must have room for at least count entries. Results must be
+   *    freed with free_results() routine.
+   * Return:
+   *  Number of addresses that have been resolved, or -1 if module could not
+   *  be opened, with errno providing extended error information.
+   */
+  int symbolize(const char* module_path,
+                const uint64_t* addresses,
+                int count,
+                SymbolizerResult* results);
+
+  /* Frees results obtained with symbolize() method.
+   * Param:
+   *  results - Results to free.
+   *  count - Number of entries in results array.
+   */
+  static void free_results(SymbolizerResult* results, int count);
+
+  /* Gets number of bytes held for the cached modules. */
+  size_t memory_usage();
+
+  /* Gets memory budget for this instance. */
+  size_t memory_budget();
+
+  /* Sets memory budget for this instance.
+   * Param:
+   *  memory_budget - Maximum number of bytes the symbolizer may hold for the
+   *    cached modules, or zero for no limit.
+   */
+  void set_memory_budget(size_t memory_budget);
+
+ protected:
+  /* Describes a module cached by the symbolizer. */
+  typedef struct Module {
+    /* Path to the module's ELF file. */
+    char*             path;
+
+    /* ELF file for the module. */
+    ElfFile*          elf;
+
+    /* Serializes queries to elf. */
+    SymbolizerMutex   lock;
+
+    /* Number of queries that currently use this module. Modules that are in
+     * use are never dropped. */
+    int               users;
+
+    /* Memory held by elf, as of the end of the last query. */
+    size_t            usage;
+
+    /* Neighbours in the list of modules, ordered by last use. */
+    struct Module*    prev;
+    struct Module*    next;
+  } Module;
+
+  /* Finds a cached module for the given path, and marks it as used. Must be
+   * called with lock_ held.
+   * Return:
+   *  Module, or NULL if there is no module cached for the path.
+   */
+  Module* find_module(const char* path);
+
+  /* Creates a module for the given path, and marks it as used. Must be called
+   * with lock_ held.
+   * Param:
+   *  path - Path to the module's ELF file.
+   *  elf - ELF file opened for the path. The module takes its ownership.
+   * Return:
+   *  Created module.
+   */
+  Module* add_module(const char* path, ElfFile* elf);
+
+  /* Moves module to the head of the list of modules, and marks it as used.
+   * Must be called with lock_ held, and module unlinked from the list.
+   */
+  void use_module(Module* module);
+
+  /* Marks module as no longer used by a query, and updates memory accounting
+   * for it. Must be called with lock_ held.
+   * Param:
+   *  module - Module to release.
+   *  usage - Memory held by module's ELF file at the end of the query.
+   */
+  void release_module(Module* module, size_t usage);
+
+  /* Drops least recently used modules that are not in use until memory usage
+   * fits into the budget. Must be called with lock_ held.
+   */
+  void enforce_budget();
+
+  /* Unlinks module from the list of modules. Must be called with lock_ held. */
+  void unlink_module(Module* module);
+
+  /* Deletes module and its ELF file. */
+  static void delete_module(Module* module);
+
+  /* Symbolizes one address in an ELF file.
+   * Return:
+   *  true if address has been resolved, or false otherwise.
+   */
+  static bool symbolize_address(ElfFile* elf,
+                                uint64_t address,
+                                SymbolizerResult* result);
+
+  /* Guards the list of modules, and memory accounting. */
+  SymbolizerMutex   lock_;
+
+  /* Most recently used module. */
+  Module*           mru_;
+
+  /* Least recently used module. */
+  Module*           lru_;
+
+  /* Memory budget, or zero if memory is not limited. */
+  size_t            memory_budget_;
+
+  /* Total memory held by cached modules. */
+  size_t            memory_usage_;
+};
+
+#endif  // ELFF_SYMBOLIZER_H_
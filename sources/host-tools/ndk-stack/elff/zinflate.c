@@ -0,0 +1,488 @@
+/* Copyright (C) 2013 The Android Open Source Project
+**
+** This software is licensed under the terms of the GNU General Public
+** License version 2, as published by the Free Software Foundation, and
+** may be copied, distributed, and modified under those terms.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+/*
+ * Contains implementation of a routine that decompresses zlib streams.
+ * Huffman codes are decoded canonically, one bit at a time. This is not the
+ * fastest possible decoder, but debug sections are decompressed only once
+ * per ELF file, and then cached.
+ */
+
+#include "stddef.h"
+#include "stdint.h"
+#include "string.h"
+#include "errno.h"
+
+#include "zinflate.h"
+
+/* Maximum number of bits in a Huffman code. */
+#define ZMAXBITS        15
+
+/* Maximum number of literal / length codes. */
+#define ZMAXLCODES      286
+
+/* Maximum number of distance codes. */
+#define ZMAXDCODES      30
+
+/* Number of codes in the fixed literal / length code. */
+#define ZFIXLCODES      288
+
+/* Decompression state. */
+typedef struct ZState {
+    /* Output buffer, its size, and number of bytes written so far. */
+    uint8_t*        out;
+    size_t          out_size;
+    size_t          out_pos;
+
+    /* Input buffer, its size, and number of bytes read so far. */
+    const uint8_t*  in;
+    size_t          in_size;
+    size_t          in_pos;
+
+    /* Bits read from input, that have not been consumed yet. */
+    uint32_t        bit_buf;
+    int             bit_count;
+} ZState;
+
+/* Canonical Huffman code, described by number of codes of each length, and
+ * symbols ordered by their codes. */
+typedef struct ZHuffman {
+    short   count[ZMAXBITS + 1];
+    short*  symbol;
+} ZHuffman;
+
+/* Base lengths, and number of extra bits for length codes 257..285. */
+static const short _len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const short _len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+/* Base distances, and number of extra bits for distance codes 0..29. */
+static const short _dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577 };
+static const short _dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* Order of code length code lengths in a dynamic block header. */
+static const short _code_order[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/* Reads requested number of bits from the input.
+ * Return:
+ *  Bits value on success, or -1 if input is exhausted.
+ */
+static int
+zbits(ZState* s, int need)
+{
+    uint32_t val = s->bit_buf;
+    while (s->bit_count < need) {
+        if (s->in_pos == s->in_size) {
+            return -1;
+        }
+        val |= (uint32_t)s->in[s->in_pos++] << s->bit_count;
+        s->bit_count += 8;
+    }
+    s->bit_buf = val >> need;
+    s->bit_count -= need;
+    return (int)(val & ((1U << need) - 1));
+}
+
+/* Decodes one symbol using the given Huffman code.
+ * Return:
+ *  Decoded symbol on success, or -1 on error.
+ */
+static int
+zdecode(ZState* s, const ZHuffman* h)
+{
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    int len;
+    for (len = 1; len <= ZMAXBITS; len++) {
+        const int bit = zbits(s, 1);
+        if (bit < 0) {
+            return -1;
+        }
+        code |= bit;
+        const int count = h->count[len];
+        if (code - count < first) {
+            return h->symbol[index + (code - first)];
+        }
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+/* Builds canonical Huffman code from code lengths.
+ * Return:
+ *  0 for a complete code, negative value for an over-subscribed code, or
+ *  positive value for an incomplete code.
+ */
+static int
+zconstruct(ZHuffman* h, const short* length, int n)
+{
+    short offs[ZMAXBITS + 1];
+    int left;
+    int len;
+    int sym;
+
+    for (len = 0; len <= ZMAXBITS; len++) {
+        h->count[len] = 0;
+    }
+    for (sym = 0; sym < n; sym++) {
+        h->count[length[sym]]++;
+    }
+    if (h->count[0] == n) {
+        /* No codes at all. */
+        return 0;
+    }
+
+    left = 1;
+    for (len = 1; len <= ZMAXBITS; len++) {
+        left <<= 1;
+        left -= h->count[len];
+        if (left < 0) {
+            return left;
+        }
+    }
+
+    offs[1] = 0;
+    for (len = 1; len < ZMAXBITS; len++) {
+        offs[len + 1] = offs[len] + h->count[len];
+    }
+    for (sym = 0; sym < n; sym++) {
+        if (length[sym] != 0) {
+            h->symbol[offs[length[sym]]++] = (short)sym;
+        }
+    }
+    return left;
+}
+
+/* Decompresses literal / length and distance codes of a block. */
+static int
+zcodes(ZState* s, const ZHuffman* lencode, const ZHuffman* distcode)
+{
+    int sym;
+    do {
+        sym = zdecode(s, lencode);
+        if (sym < 0) {
+            return -1;
+        }
+        if (sym < 256) {
+            /* Literal byte. */
+            if (s->out_pos == s->out_size) {
+                return -1;
+            }
+            s->out[s->out_pos++] = (uint8_t)sym;
+        } else if (sym > 256) {
+            /* Length / distance pair. */
+            int extra;
+            size_t len;
+            size_t dist;
+            sym -= 257;
+            if (sym >= 29) {
+                return -1;
+            }
+            extra = zbits(s, _len_extra[sym]);
+            if (extra < 0) {
+                return -1;
+            }
+            len = (size_t)(_len_base[sym] + extra);
+
+            sym = zdecode(s, distcode);
+            if (sym < 0 || sym >= 30) {
+                return -1;
+            }
+            extra = zbits(s, _dist_extra[sym]);
+            if (extra < 0) {
+                return -1;
+            }
+            dist = (size_t)(_dist_base[sym] + extra);
+
+            if (dist > s->out_pos || len > s->out_size - s->out_pos) {
+                return -1;
+            }
+            /* Source and destination may overlap, so copy byte by byte. */
+            while (len-- != 0) {
+                s->out[s->out_pos] = s->out[s->out_pos - dist];
+                s->out_pos++;
+            }
+        }
+    } while (sym != 256);
+    return 0;
+}
+
+/* Processes a stored (uncompressed) block. */
+static int
+zstored(ZState* s)
+{
+    size_t len;
+    size_t nlen;
+
+    /* Discard bits left in the current byte. */
+    s->bit_buf = 0;
+    s->bit_count = 0;
+
+    if (s->in_size - s->in_pos < 4) {
+        return -1;
+    }
+    /* LEN is followed by its one's complement NLEN. */
+    len = s->in[s->in_pos] | ((size_t)s->in[s->in_pos + 1] << 8);
+    nlen = s->in[s->in_pos + 2] | ((size_t)s->in[s->in_pos + 3] << 8);
+    if (nlen != (len ^ 0xffff)) {
+        return -1;
+    }
+    s->in_pos += 4;
+
+    if (len > s->in_size - s->in_pos || len > s->out_size - s->out_pos) {
+        return -1;
+    }
+    memcpy(s->out + s->out_pos, s->in + s->in_pos, len);
+    s->in_pos += len;
+    s->out_pos += len;
+    return 0;
+}
+
+/* Processes a block compressed with fixed Huffman codes. */
+static int
+zfixed(ZState* s)
+{
+    short lensym[ZFIXLCODES];
+    short distsym[ZMAXDCODES];
+    short lengths[ZFIXLCODES];
+    ZHuffman lencode;
+    ZHuffman distcode;
+    int sym;
+
+    lencode.symbol = lensym;
+    distcode.symbol = distsym;
+
+    for (sym = 0; sym < 144; sym++) {
+        lengths[sym] = 8;
+    }
+    for (; sym < 256; sym++) {
+        lengths[sym] = 9;
+    }
+    for (; sym < 280; sym++) {
+        lengths[sym] = 7;
+    }
+    for (; sym < ZFIXLCODES; sym++) {
+        lengths[sym] = 8;
+    }
+    zconstruct(&lencode, lengths, ZFIXLCODES);
+
+    for (sym = 0; sym < ZMAXDCODES; sym++) {
+        lengths[sym] = 5;
+    }
+    zconstruct(&distcode, lengths, ZMAXDCODES);
+
+    return zcodes(s, &lencode, &distcode);
+}
+
+/* Processes a block compressed with dynamic Huffman codes. */
+static int
+zdynamic(ZState* s)
+{
+    short lensym[ZMAXLCODES];
+    short distsym[ZMAXDCODES];
+    short lengths[ZMAXLCODES + ZMAXDCODES];
+    ZHuffman lencode;
+    ZHuffman distcode;
+    int nlen;
+    int ndist;
+    int ncode;
+    int index;
+    int err;
+
+    lencode.symbol = lensym;
+    distcode.symbol = distsym;
+
+    nlen = zbits(s, 5);
+    ndist = zbits(s, 5);
+    ncode = zbits(s, 4);
+    if (nlen < 0 || ndist < 0 || ncode < 0) {
+        return -1;
+    }
+    nlen += 257;
+    ndist += 1;
+    ncode += 4;
+    if (nlen > ZMAXLCODES || ndist > ZMAXDCODES) {
+        return -1;
+    }
+
+    /* Read code length code lengths, and build code length code. */
+    for (index = 0; index < 19; index++) {
+        int len = 0;
+        if (index < ncode) {
+            len = zbits(s, 3);
+            if (len < 0) {
+                return -1;
+            }
+        }
+        lengths[_code_order[index]] = (short)len;
+    }
+    if (zconstruct(&lencode, lengths, 19) != 0) {
+        return -1;
+    }
+
+    /* Read literal / length and distance code lengths. */
+    index = 0;
+    while (index < nlen + ndist) {
+        int sym = zdecode(s, &lencode);
+        if (sym < 0) {
+            return -1;
+        }
+        if (sym < 16) {
+            lengths[index++] = (short)sym;
+        } else {
+            short len = 0;
+            int rep;
+            if (sym == 16) {
+                if (index == 0) {
+                    return -1;
+                }
+                len = lengths[index - 1];
+                rep = zbits(s, 2);
+                rep = rep < 0 ? rep : rep + 3;
+            } else if (sym == 17) {
+                rep = zbits(s, 3);
+                rep = rep < 0 ? rep : rep + 3;
+            } else {
+                rep = zbits(s, 7);
+                rep = rep < 0 ? rep : rep + 11;
+            }
+            if (rep < 0 || index + rep > nlen + ndist) {
+                return -1;
+            }
+            while (rep-- != 0) {
+                lengths[index++] = len;
+            }
+        }
+    }
+
+    /* There must be a code for the end of block. */
+    if (lengths[256] == 0) {
+        return -1;
+    }
+
+    /* Incomplete codes are allowed only for a single length. */
+    err = zconstruct(&lencode, lengths, nlen);
+    if (err < 0 || (err > 0 && nlen - lencode.count[0] != 1)) {
+        return -1;
+    }
+    err = zconstruct(&distcode, lengths + nlen, ndist);
+    if (err < 0 || (err > 0 && ndist - distcode.count[0] != 1)) {
+        return -1;
+    }
+
+    return zcodes(s, &lencode, &distcode);
+}
+
+/* Computes Adler-32 checksum of a buffer. */
+static uint32_t
+zadler32(const uint8_t* buf, size_t size)
+{
+    uint32_t a = 1;
+    uint32_t b = 0;
+    while (size != 0) {
+        /* 5552 is the largest n, for which b doesn't overflow 32 bits. */
+        size_t chunk = size < 5552 ? size : 5552;
+        size -= chunk;
+        while (chunk-- != 0) {
+            a += *buf++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+int
+zinflate(void* dst,
+         size_t dst_size,
+         const void* src,
+         size_t src_size,
+         size_t* out_size)
+{
+    ZState s;
+    int last;
+    int err = 0;
+
+    s.out = (uint8_t*)dst;
+    s.out_size = dst_size;
+    s.out_pos = 0;
+    s.in = (const uint8_t*)src;
+    s.in_size = src_size;
+    s.in_pos = 0;
+    s.bit_buf = 0;
+    s.bit_count = 0;
+
+    /* Validate zlib header: deflate method, valid window size, check bits,
+     * and no preset dictionary. */
+    if (src_size < 6 ||
+        (s.in[0] & 0x0F) != 8 || (s.in[0] >> 4) > 7 ||
+        ((s.in[0] << 8) | s.in[1]) % 31 != 0 ||
+        (s.in[1] & 0x20) != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    s.in_pos = 2;
+
+    do {
+        int type;
+        last = zbits(&s, 1);
+        type = zbits(&s, 2);
+        if (last < 0 || type < 0) {
+            err = -1;
+        } else if (type == 0) {
+            err = zstored(&s);
+        } else if (type == 1) {
+            err = zfixed(&s);
+        } else if (type == 2) {
+            err = zdynamic(&s);
+        } else {
+            err = -1;
+        }
+    } while (err == 0 && !last);
+
+    /* Verify Adler-32 checksum of the decompressed data, that follows the
+     * last block, starting at the byte boundary. */
+    if (err == 0) {
+        if (s.in_size - s.in_pos < 4) {
+            err = -1;
+        } else {
+            const uint32_t adler = ((uint32_t)s.in[s.in_pos] << 24) |
+                                   ((uint32_t)s.in[s.in_pos + 1] << 16) |
+                                   ((uint32_t)s.in[s.in_pos + 2] << 8) |
+                                   (uint32_t)s.in[s.in_pos + 3];
+            if (adler != zadler32(s.out, s.out_pos)) {
+                err = -1;
+            }
+        }
+    }
+
+    if (err != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    *out_size = s.out_pos;
+    return 0;
+}
@@ -0,0 +1,50 @@
+/* Copyright (C) 2013 The Android Open Source Project
+**
+** This software is licensed under the terms of the GNU General Public
+** License version 2, as published by the Free Software Foundation, and
+** may be copied, distributed, and modified under those terms.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+/*
+ * Contains declaration of a routine that decompresses zlib streams, used to
+ * decompress compressed debug sections of ELF files. This is a minimal
+ * implementation of the "inflate" algorithm (RFC 1950, RFC 1951), so ELFF
+ * doesn't depend on zlib being available on the host.
+ */
+
+#ifndef ELFF_ZINFLATE_H_
+#define ELFF_ZINFLATE_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Decompresses zlib stream.
+ * Param:
+ *  dst - Buffer where to save decompressed data.
+ *  dst_size - Size of the dst buffer. Decompressed data must fit into it.
+ *  src - Compressed zlib stream (including zlib header and trailer).
+ *  src_size - Size of the compressed stream.
+ *  out_size - Upon success contains number of bytes saved into dst buffer.
+ * Return:
+ *  0 on success, or -1 if stream is corrupted, or decompressed data doesn't
+ *  fit into the dst buffer. In case of failure errno is set to EINVAL.
+ */
+extern int zinflate(void* dst,
+                    size_t dst_size,
+                    const void* src,
+                    size_t src_size,
+                    size_t* out_size);
+
+#ifdef __cplusplus
+}   /* end of extern "C" */
+#endif
+
+#endif  // ELFF_ZINFLATE_H_
@@ -340,7 +340,11 @@ ParseFrame(NdkCrashParser* parser, const char* frame)
   }
   // Extract address info from the symbol file.
   if (!elff_get_pc_address_info(elff_handle, address, &pc_info)) {
-    if (pc_info.dir_name != NULL) {
+    if (pc_info.file_name == NULL) {
+      // Routine has been found in the symbol table only.
+      fprintf(parser->out_handle, ": Routine %s+0x%x\n",
+              pc_info.routine_name, (uint32_t)pc_info.routine_offset);
+    } else if (pc_info.dir_name != NULL) {
       fprintf(parser->out_handle, ": Routine %s in %s/%s:%d\n",
               pc_info.routine_name, pc_info.dir_name, pc_info.file_name,
               pc_info.line_number);
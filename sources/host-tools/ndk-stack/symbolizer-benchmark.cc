@@ -0,0 +1,221 @@
+/* Copyright (C) 2013 The Android Open Source Project
+**
+** This software is licensed under the terms of the GNU General Public
+** License version 2, as published by the Free Software Foundation, and
+** may be copied, distributed, and modified under those terms.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+/*
+ * Measures throughput (queries per second) and resident memory of the ELFF
+ * Symbolizer on a module, using a list of addresses to symbolize.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include "elff/symbolizer.h"
+
+static const char* _usage_str =
+"Usage: symbolizer-benchmark <module> <address-file> [options]\n"
+"  <address-file> lists hex addresses, relative to the module, one per line.\n"
+"Options:\n"
+"  -threads <n>   Number of querying threads (default 4).\n"
+"  -rounds <n>    Number of passes over the address list per thread\n"
+"                 (default 10).\n"
+"  -batch <n>     Number of addresses per query (default 16).\n"
+"  -budget <kb>   Symbolizer memory budget in KB (default 0, unlimited).\n";
+
+/* Benchmark parameters, shared by all threads. */
+typedef struct BenchmarkParams {
+  Symbolizer*     symbolizer;
+  const char*     module;
+  const uint64_t* addresses;
+  int             address_count;
+  int             rounds;
+  int             batch;
+  long            resolved;
+} BenchmarkParams;
+
+/* Gets current time in microseconds. */
+static double now_us(void) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+/* Gets current resident set size of the process in KB, or peak resident set
+ * size, if current one is not available on this host. */
+static long resident_kb(void) {
+  FILE* status = fopen("/proc/self/status", "r");
+  if (status != NULL) {
+    char line[256];
+    long rss = -1;
+    while (fgets(line, sizeof(line), status) != NULL) {
+      if (strncmp(line, "VmRSS:", 6) == 0) {
+        rss = strtol(line + 6, NULL, 10);
+        break;
+      }
+    }
+    fclose(status);
+    if (rss >= 0) {
+      return rss;
+    }
+  }
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+/* Loads list of addresses from a file. */
+static uint64_t* load_addresses(const char* path, int* count) {
+  FILE* file = fopen(path, "r");
+  if (file == NULL) {
+    return NULL;
+  }
+  int capacity = 1024;
+  uint64_t* addresses = (uint64_t*)malloc(capacity * sizeof(uint64_t));
+  char line[64];
+  *count = 0;
+  while (addresses != NULL && fgets(line, sizeof(line), file) != NULL) {
+    char* end;
+    const uint64_t address = strtoull(line, &end, 16);
+    if (end == line) {
+      continue;
+    }
+    if (*count == capacity) {
+      capacity *= 2;
+      addresses = (uint64_t*)realloc(addresses, capacity * sizeof(uint64_t));
+      if (addresses == NULL) {
+        break;
+      }
+    }
+    addresses[(*count)++] = address;
+  }
+  fclose(file);
+  return addresses;
+}
+
+static void* benchmark_thread(void* arg) {
+  BenchmarkParams* params = reinterpret_cast<BenchmarkParams*>(arg);
+  SymbolizerResult* results = new SymbolizerResult[params->batch];
+  long resolved = 0;
+
+  for (int round = 0; round < params->rounds; round++) {
+    for (int n = 0; n < params->address_count; n += params->batch) {
+      int count = params->address_count - n;
+      if (count > params->batch) {
+        count = params->batch;
+      }
+      const int ret = params->symbolizer->symbolize(params->module,
+                                                    params->addresses + n,
+                                                    count, results);
+      if (ret < 0) {
+        fprintf(stderr, "Unable to open module %s: %s\n",
+                params->module, strerror(errno));
+        delete[] results;
+        return reinterpret_cast<void*>(-1);
+      }
+      resolved += ret;
+      Symbolizer::free_results(results, count);
+    }
+  }
+
+  delete[] results;
+  __sync_fetch_and_add(&params->resolved, resolved);
+  return NULL;
+}
+
+int main(int argc, char** argv) {
+  int threads = 4;
+  int rounds = 10;
+  int batch = 16;
+  long budget_kb = 0;
+
+  if (argc < 3) {
+    fprintf(stdout, "%s", _usage_str);
+    return 0;
+  }
+  for (int n = 3; n < argc; n++) {
+    if (n + 1 >= argc) {
+      fprintf(stdout, "%s", _usage_str);
+      return -1;
+    }
+    if (!strcmp(argv[n], "-threads")) {
+      threads = atoi(argv[++n]);
+    } else if (!strcmp(argv[n], "-rounds")) {
+      rounds = atoi(argv[++n]);
+    } else if (!strcmp(argv[n], "-batch")) {
+      batch = atoi(argv[++n]);
+    } else if (!strcmp(argv[n], "-budget")) {
+      budget_kb = atol(argv[++n]);
+    } else {
+      fprintf(stdout, "%s", _usage_str);
+      return -1;
+    }
+  }
+  if (threads <= 0 || rounds <= 0 || batch <= 0 || budget_kb < 0) {
+    fprintf(stdout, "%s", _usage_str);
+    return -1;
+  }
+
+  int address_count;
+  uint64_t* addresses = load_addresses(argv[2], &address_count);
+  if (addresses == NULL || address_count == 0) {
+    fprintf(stderr, "Unable to load addresses from %s\n", argv[2]);
+    return -1;
+  }
+
+  const long rss_before = resident_kb();
+  Symbolizer symbolizer(static_cast<size_t>(budget_kb) * 1024);
+  BenchmarkParams params;
+  params.symbolizer = &symbolizer;
+  params.module = argv[1];
+  params.addresses = addresses;
+  params.address_count = address_count;
+  params.rounds = rounds;
+  params.batch = batch;
+  params.resolved = 0;
+
+  pthread_t* tids = new pthread_t[threads];
+  const double start = now_us();
+  for (int n = 0; n < threads; n++) {
+    pthread_create(&tids[n], NULL, benchmark_thread, &params);
+  }
+  int failed = 0;
+  for (int n = 0; n < threads; n++) {
+    void* ret;
+    pthread_join(tids[n], &ret);
+    failed |= ret != NULL;
+  }
+  const double elapsed = now_us() - start;
+  delete[] tids;
+  if (failed) {
+    free(addresses);
+    return -1;
+  }
+
+  const double queries = static_cast<double>(address_count) * rounds * threads;
+  printf("module:             %s\n", argv[1]);
+  printf("addresses:          %d (%ld resolved)\n", address_count,
+         params.resolved / rounds / threads);
+  printf("threads:            %d\n", threads);
+  printf("queries:            %.0f in %.3f s\n", queries, elapsed / 1e6);
+  printf("queries per second: %.0f\n", queries * 1e6 / elapsed);
+  printf("symbolizer memory:  %lu KB (budget %ld KB)\n",
+         static_cast<unsigned long>(symbolizer.memory_usage() / 1024),
+         budget_kb);
+  printf("resident memory:    %ld KB (%+ld KB)\n", resident_kb(),
+         resident_kb() - rss_before);
+
+  free(addresses);
+  return 0;
+}
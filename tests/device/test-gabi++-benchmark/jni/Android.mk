@@ -0,0 +1,51 @@
+LOCAL_PATH := $(call my-dir)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_static_benchmark
+LOCAL_SRC_FILES := test_gabixx_benchmark.cpp
+LOCAL_STATIC_LIBRARIES := gabi++_static
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_shared_benchmark
+LOCAL_SRC_FILES := test_gabixx_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_static_guard_benchmark
+LOCAL_SRC_FILES := test_gabixx_guard_benchmark.cpp
+LOCAL_STATIC_LIBRARIES := gabi++_static
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_shared_guard_benchmark
+LOCAL_SRC_FILES := test_gabixx_guard_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_static_dynamic_cast_benchmark
+LOCAL_SRC_FILES := test_gabixx_dynamic_cast_benchmark.cpp
+LOCAL_STATIC_LIBRARIES := gabi++_static
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_shared_dynamic_cast_benchmark
+LOCAL_SRC_FILES := test_gabixx_dynamic_cast_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_static_new_benchmark
+LOCAL_SRC_FILES := test_gabixx_new_benchmark.cpp
+LOCAL_STATIC_LIBRARIES := gabi++_static
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_shared_new_benchmark
+LOCAL_SRC_FILES := test_gabixx_new_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_EXECUTABLE)
+
+$(call import-module,cxx-stl/gabi++)
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program measures the hot paths of the GAbi++ runtime:
+ *
+ *  - throwing an exception through 0 to 64 frames with cleanups,
+ *  - catching an exception by a base class of a hierarchy with multiple
+ *    and virtual inheritance, after several non-matching handlers,
+ *  - rethrowing an exception through several handlers,
+ *  - std::uncaught_exception(), outside and during unwinding.
+ *
+ * Function-local statics and dynamic_cast<> are measured by
+ * test_gabixx_guard_benchmark.cpp and test_gabixx_dynamic_cast_benchmark.cpp.
+ *
+ * It checks the results along the way. If GAbi++ was built with
+ * GABIXX_EH_COUNTERS=1, it also prints the exception handling counters
+ * (frames unwound, LSDA bytes decoded, exceptions allocated) per
+ * exception, and checks that they are consistent.
+ */
+
+#include <cxxabi.h>
+#include <exception>
+#include <stdio.h>
+#include <time.h>
+
+#define NUM_THROWS      20000
+#define NUM_CALLS       1000000
+
+static int fail = 0;
+
+#define CHECK(cond)  \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "KO: Assertion failure: %s\n", #cond); \
+            fail++;\
+        }\
+    } while (0)
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Prints the exception handling counters per exception since the last
+// call, if the runtime maintains them.
+static void print_counters(const char* what, int exceptions)
+{
+    __gabixx::__eh_counters counters;
+    if (!__gabixx::__get_eh_counters(&counters))
+        return;
+    printf("  %s: %.1f frames searched, %.1f unwound, "
+           "%.1f LSDA bytes, %.1f cache hits, %.2f allocations, "
+           "%.2f cached buffers per exception\n", what,
+           (double)counters.frames_searched / exceptions,
+           (double)counters.frames_unwound / exceptions,
+           (double)counters.lsda_bytes_decoded / exceptions,
+           (double)counters.call_site_cache_hits / exceptions,
+           (double)counters.exceptions_allocated / exceptions,
+           (double)counters.cached_buffers / exceptions);
+    CHECK(counters.exceptions_allocated == counters.exceptions_thrown);
+    CHECK(counters.frames_searched >= counters.exceptions_thrown);
+    CHECK(counters.frames_unwound >= counters.exceptions_thrown);
+    __gabixx::__reset_eh_counters();
+}
+
+// Throw/catch through |depth| frames, each with a cleanup.
+
+static int sCleanups;
+
+struct Cleanup {
+    ~Cleanup() { sCleanups++; }
+};
+
+static void __attribute__((noinline)) throw_at_depth(int depth)
+{
+    Cleanup cleanup;
+    if (depth == 0)
+        throw depth;
+    throw_at_depth(depth - 1);
+}
+
+static void bench_depth(void)
+{
+    static const int kDepths[] = { 0, 4, 16, 64 };
+    for (size_t n = 0; n < sizeof(kDepths) / sizeof(kDepths[0]); n++) {
+        int depth = kDepths[n];
+        int caught = 0;
+        sCleanups = 0;
+        __gabixx::__reset_eh_counters();
+        double start = now_ns();
+        for (int nn = 0; nn < NUM_THROWS; nn++) {
+            try {
+                throw_at_depth(depth);
+            } catch (int value) {
+                caught += (value == 0);
+            }
+        }
+        double elapsed = now_ns() - start;
+        CHECK(caught == NUM_THROWS);
+        CHECK(sCleanups == NUM_THROWS * (depth + 1));
+        printf("throw, depth %2d:     %8.0f ns/throw\n",
+               depth, elapsed / NUM_THROWS);
+        print_counters("counters", NUM_THROWS);
+    }
+}
+
+// Catch by a base class through a hierarchy with multiple and virtual
+// inheritance.
+
+struct Error            { virtual ~Error() {} int code; };
+struct IoError          : virtual Error {};
+struct FormatError      : virtual Error {};
+struct Transient        { virtual ~Transient() {} };
+struct NetworkError     : IoError, Transient {};
+struct ProtocolError    : NetworkError, FormatError {};
+struct Unrelated1       { virtual ~Unrelated1() {} };
+struct Unrelated2       { virtual ~Unrelated2() {} };
+
+static void __attribute__((noinline)) throw_protocol_error(void)
+{
+    ProtocolError error;
+    error.code = 42;
+    throw error;
+}
+
+static void bench_vmi_catch(void)
+{
+    int caught = 0;
+    __gabixx::__reset_eh_counters();
+    double start = now_ns();
+    for (int nn = 0; nn < NUM_THROWS; nn++) {
+        try {
+            throw_protocol_error();
+        } catch (const Unrelated1&) {
+        } catch (const Unrelated2&) {
+        } catch (const std::exception&) {
+        } catch (const Transient& e) {
+            caught += (dynamic_cast<const Error&>(e).code == 42);
+        }
+    }
+    double elapsed = now_ns() - start;
+    CHECK(caught == NUM_THROWS);
+    printf("catch by vmi base:   %8.0f ns/throw\n", elapsed / NUM_THROWS);
+    print_counters("counters", NUM_THROWS);
+
+    // Catching the virtual base needs the type tree walk as well.
+    caught = 0;
+    start = now_ns();
+    for (int nn = 0; nn < NUM_THROWS; nn++) {
+        try {
+            throw_protocol_error();
+        } catch (const Error& e) {
+            caught += (e.code == 42);
+        }
+    }
+    elapsed = now_ns() - start;
+    CHECK(caught == NUM_THROWS);
+    printf("catch virtual base:  %8.0f ns/throw\n", elapsed / NUM_THROWS);
+    print_counters("counters", NUM_THROWS);
+}
+
+// Rethrow through |levels| handlers.
+
+static void __attribute__((noinline)) rethrow_levels(int levels)
+{
+    if (levels == 0)
+        throw IoError();
+    try {
+        rethrow_levels(levels - 1);
+    } catch (const Error&) {
+        throw;
+    }
+}
+
+static void bench_rethrow(void)
+{
+    const int kLevels = 4;
+    int caught = 0;
+    __gabixx::__reset_eh_counters();
+    double start = now_ns();
+    for (int nn = 0; nn < NUM_THROWS; nn++) {
+        try {
+            rethrow_levels(kLevels);
+        } catch (const IoError&) {
+            caught++;
+        }
+    }
+    double elapsed = now_ns() - start;
+    CHECK(caught == NUM_THROWS);
+    printf("rethrow, %d levels:   %8.0f ns/throw\n",
+           kLevels, elapsed / NUM_THROWS);
+
+    __gabixx::__eh_counters counters;
+    if (__gabixx::__get_eh_counters(&counters))
+        CHECK(counters.exceptions_rethrown ==
+              (unsigned long)NUM_THROWS * kLevels);
+    print_counters("counters", NUM_THROWS);
+}
+
+// std::uncaught_exception()
+
+static int sUncaughtDuringUnwind;
+
+struct CheckUncaught {
+    ~CheckUncaught() {
+        sUncaughtDuringUnwind += std::uncaught_exception();
+        sUncaughtDuringUnwind += abi::__cxa_uncaught_exception();
+    }
+};
+
+static void bench_uncaught_exception(void)
+{
+    try {
+        CheckUncaught check;
+        throw 1;
+    } catch (int) {
+        CHECK(!std::uncaught_exception());
+    }
+    CHECK(sUncaughtDuringUnwind == 2);
+    CHECK(!std::uncaught_exception());
+    CHECK(!abi::__cxa_uncaught_exception());
+
+    int count = 0;
+    double start = now_ns();
+    for (int nn = 0; nn < NUM_CALLS; nn++)
+        count += std::uncaught_exception();
+    double elapsed = now_ns() - start;
+    CHECK(count == 0);
+    printf("uncaught_exception:  %8.1f ns/call\n", elapsed / NUM_CALLS);
+}
+
+int main(void)
+{
+    __gabixx::__eh_counters counters;
+    if (!__gabixx::__get_eh_counters(&counters))
+        printf("(rebuild GAbi++ with GABIXX_EH_COUNTERS=true for counters)\n");
+
+    // Warm up the exception buffer cache and the call-site cache.
+    try {
+        throw_at_depth(1);
+    } catch (int) {
+    }
+
+    bench_depth();
+    bench_vmi_catch();
+    bench_rethrow();
+    bench_uncaught_exception();
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
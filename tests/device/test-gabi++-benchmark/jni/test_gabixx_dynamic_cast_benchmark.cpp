@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program measures dynamic_cast<> with and without the GAbi++ cast
+ * result cache, on a hierarchy with multiple and virtual inheritance, and
+ * checks that both paths give the same results.
+ */
+
+#include <cxxabi.h>
+#include <stdio.h>
+#include <time.h>
+
+struct Node         { virtual ~Node() {} };
+struct Visitable    { virtual ~Visitable() {} };
+struct Named        { virtual ~Named() {} };
+struct Shape : virtual Node, Visitable        { int s; };
+struct Light : virtual Node, Named            { int l; };
+struct Mesh : Shape                           { int m; };
+struct Lamp : Mesh, Light                     { int p; };
+struct Group : virtual Node, Visitable, Named { int g; };
+struct Left : Visitable                       { int a; };
+struct Right : Visitable                      { int b; };
+struct Both : Left, Right                     { int c; };
+
+#define NUM_ITERATIONS  200000
+
+static Node*       sNodes[4];
+static Visitable*  sVisitables[4];
+static Named*      sNameds[4];
+
+// Performs a fixed mix of down-casts and cross-casts, returning a checksum
+// of the results, so both paths can be compared.
+static unsigned long run_casts(void)
+{
+    unsigned long sum = 0;
+    for (int n = 0; n < 4; n++) {
+        sum = sum * 3 + (dynamic_cast<Lamp*>(sNodes[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Mesh*>(sNodes[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Group*>(sNodes[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Named*>(sVisitables[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Both*>(sVisitables[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Shape*>(sNameds[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Light*>(sNameds[n]) != NULL);
+        sum = sum * 3 + (dynamic_cast<Left*>(sVisitables[n]) != NULL);
+        sum += reinterpret_cast<unsigned long>(dynamic_cast<void*>(sVisitables[n])) & 0xff;
+    }
+    return sum;
+}
+
+static double time_casts(unsigned long* sum)
+{
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    *sum = 0;
+    for (int nn = 0; nn < NUM_ITERATIONS; nn++)
+        *sum += run_casts();
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+int main(void)
+{
+    int fail = 0;
+    Lamp lamp;
+    Group group;
+    Mesh mesh;
+    Both both;
+
+    sNodes[0] = &lamp;  sVisitables[0] = &lamp;  sNameds[0] = &lamp;
+    sNodes[1] = &group; sVisitables[1] = &group; sNameds[1] = &group;
+    sNodes[2] = &mesh;  sVisitables[2] = &mesh;  sNameds[2] = &group;
+    sNodes[3] = &lamp;  sNameds[3] = &lamp;
+    sVisitables[3] = static_cast<Right*>(&both);
+
+    // Number of dynamic_cast<> calls in one run_casts() call.
+    const double casts = 4.0 * 9 * NUM_ITERATIONS;
+
+    __gabixx::__set_dynamic_cast_cache_enabled(false);
+    unsigned long uncached_sum;
+    double uncached = time_casts(&uncached_sum);
+
+    __gabixx::__set_dynamic_cast_cache_enabled(true);
+    unsigned long cached_sum;
+    double cached = time_casts(&cached_sum);
+
+    unsigned long hits, misses;
+    bool have_stats = __gabixx::__get_dynamic_cast_cache_stats(&hits, &misses);
+
+    if (cached_sum != uncached_sum) {
+        fprintf(stderr, "KO: cached casts differ from uncached ones\n");
+        fail++;
+    }
+    if (have_stats && hits == 0) {
+        fprintf(stderr, "KO: no cast has been served by the cache\n");
+        fail++;
+    }
+
+    printf("uncached: %.1f ns/cast\n", uncached / casts);
+    if (have_stats)
+        printf("cached:   %.1f ns/cast (%lu hits, %lu misses)\n",
+               cached / casts, hits, misses);
+    else
+        printf("cached:   %.1f ns/cast\n", cached / casts);
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program measures the cost of one-time construction (function-local
+ * statics) when many threads use it at the same time:
+ *
+ *  - "initialized": all threads repeatedly call __cxa_guard_acquire() on
+ *    guards that are already complete, which is what every call to a
+ *    function with a local static costs once the compiler's inline check
+ *    has been bypassed.
+ *
+ *  - "contended": all threads race to construct the same set of statics,
+ *    each with a slow constructor, so most of them have to wait for the
+ *    winner, and are woken up when it completes.
+ *
+ * It also checks that every static has been constructed exactly once.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+
+extern "C" int __cxa_guard_acquire(int volatile * gv);
+
+#define NUM_THREADS      8
+#define NUM_STATICS      64
+#define NUM_ITERATIONS   1000000
+
+static int sConstructed[NUM_STATICS];
+
+template <int N>
+class Slow {
+public:
+    Slow() {
+        // Keep the guard pending long enough for the other threads to see it.
+        struct timespec ts = { 0, 100000 };
+        nanosleep(&ts, NULL);
+        __sync_fetch_and_add(&sConstructed[N], 1);
+    }
+};
+
+template <int N>
+static void touchStatic(void)
+{
+    static Slow<N> instance;
+    (void)instance;
+}
+
+template <int N>
+struct StaticTable {
+    static void fill(void (**table)(void)) {
+        table[N - 1] = touchStatic<N - 1>;
+        StaticTable<N - 1>::fill(table);
+    }
+};
+
+template <>
+struct StaticTable<0> {
+    static void fill(void (**)(void)) {}
+};
+
+static void (*sTouch[NUM_STATICS])(void);
+
+// Guards, that are already complete. Each thread uses its own one, so the
+// guards don't share cache lines with the ones of other threads.
+struct PaddedGuard {
+    int volatile  value;
+    char          padding[60];
+};
+static PaddedGuard sGuards[NUM_THREADS];
+
+// Threads spin on this flag, so they all start at the same time. Note
+// that older C libraries don't provide pthread barriers.
+static int volatile sStart;
+
+static void wait_start(void)
+{
+    while (__sync_fetch_and_add(&sStart, 0) == 0)
+        sched_yield();
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void* initialized_thread(void* arg)
+{
+    int volatile * gv = &sGuards[reinterpret_cast<long>(arg)].value;
+    int count = 0;
+    wait_start();
+    for (int nn = 0; nn < NUM_ITERATIONS; nn++)
+        count += __cxa_guard_acquire(gv);
+    return reinterpret_cast<void*>(static_cast<long>(count));
+}
+
+static void* contended_thread(void* arg)
+{
+    long index = reinterpret_cast<long>(arg);
+    wait_start();
+    // Threads start at different statics, so some of them find the guard
+    // free, and others find it pending.
+    for (int nn = 0; nn < NUM_STATICS; nn++)
+        sTouch[(nn + index) % NUM_STATICS]();
+    return NULL;
+}
+
+static double run_threads(void* (*func)(void*), long* total)
+{
+    pthread_t threads[NUM_THREADS];
+    sStart = 0;
+    for (long nn = 0; nn < NUM_THREADS; nn++)
+        pthread_create(&threads[nn], NULL, func, reinterpret_cast<void*>(nn));
+    double start = now_ns();
+    __sync_lock_test_and_set(&sStart, 1);
+    *total = 0;
+    for (int nn = 0; nn < NUM_THREADS; nn++) {
+        void* ret;
+        pthread_join(threads[nn], &ret);
+        *total += reinterpret_cast<long>(ret);
+    }
+    return now_ns() - start;
+}
+
+int main(void)
+{
+    int fail = 0;
+    long total;
+
+    for (int nn = 0; nn < NUM_THREADS; nn++)
+        sGuards[nn].value = 1;
+    double elapsed = run_threads(initialized_thread, &total);
+    if (total != 0) {
+        fprintf(stderr, "KO: %ld complete guards acquired for construction\n",
+                total);
+        fail++;
+    }
+    printf("initialized: %d threads x %d acquires, %.1f ns/acquire\n",
+           NUM_THREADS, NUM_ITERATIONS,
+           elapsed / NUM_ITERATIONS);
+
+    StaticTable<NUM_STATICS>::fill(sTouch);
+    elapsed = run_threads(contended_thread, &total);
+    for (int nn = 0; nn < NUM_STATICS; nn++) {
+        if (sConstructed[nn] != 1) {
+            fprintf(stderr, "KO: static %d constructed %d times (1 expected)\n",
+                    nn, sConstructed[nn]);
+            fail++;
+        }
+    }
+    printf("contended:   %d threads x %d statics, %.1f us total\n",
+           NUM_THREADS, NUM_STATICS, elapsed / 1000);
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
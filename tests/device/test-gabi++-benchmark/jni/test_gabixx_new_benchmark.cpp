@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program measures small-block allocation with malloc()/free(), with
+ * the GAbi++ size-class allocator, and with operator new/delete (which use
+ * the size-class allocator only if GAbi++ was built with
+ * GABIXX_SIZE_CLASS_ALLOCATOR=1). It also checks the aligned forms of
+ * operator new, and that the allocator statistics add up.
+ */
+
+#include <cxxabi.h>
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_BLOCKS      256
+#define NUM_ITERATIONS  2000
+
+static void* sBlocks[NUM_BLOCKS];
+
+// Sizes of the blocks, typical of small C++ objects.
+static size_t block_size(int n)
+{
+    static const size_t kSizes[] = { 8, 12, 16, 24, 32, 48, 64, 100 };
+    return kSizes[n % (sizeof(kSizes) / sizeof(kSizes[0]))];
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double time_malloc(void)
+{
+    double start = now_ns();
+    for (int nn = 0; nn < NUM_ITERATIONS; nn++) {
+        for (int n = 0; n < NUM_BLOCKS; n++)
+            sBlocks[n] = malloc(block_size(n));
+        for (int n = 0; n < NUM_BLOCKS; n++)
+            free(sBlocks[n]);
+    }
+    return now_ns() - start;
+}
+
+static double time_size_class(void)
+{
+    double start = now_ns();
+    for (int nn = 0; nn < NUM_ITERATIONS; nn++) {
+        for (int n = 0; n < NUM_BLOCKS; n++)
+            sBlocks[n] = __gabixx::__size_class_allocate(block_size(n));
+        for (int n = 0; n < NUM_BLOCKS; n++)
+            __gabixx::__size_class_deallocate_sized(sBlocks[n], block_size(n));
+    }
+    return now_ns() - start;
+}
+
+static double time_new(void)
+{
+    double start = now_ns();
+    for (int nn = 0; nn < NUM_ITERATIONS; nn++) {
+        for (int n = 0; n < NUM_BLOCKS; n++)
+            sBlocks[n] = ::operator new(block_size(n));
+        for (int n = 0; n < NUM_BLOCKS; n++)
+            ::operator delete(sBlocks[n]);
+    }
+    return now_ns() - start;
+}
+
+static int check_aligned_new(void)
+{
+    int fail = 0;
+    for (size_t align = 1; align <= 4096; align *= 2) {
+        std::align_val_t al = static_cast<std::align_val_t>(align);
+        void* p = ::operator new(40, al);
+        void* q = ::operator new[](40, al, std::nothrow);
+        if (reinterpret_cast<uintptr_t>(p) % align != 0 ||
+            q == NULL || reinterpret_cast<uintptr_t>(q) % align != 0) {
+            fprintf(stderr, "KO: aligned new returned %p and %p for %zu\n",
+                    p, q, align);
+            fail++;
+        }
+        memset(p, 0xaa, 40);
+        ::operator delete(p, 40, al);
+        ::operator delete[](q, al);
+    }
+    return fail;
+}
+
+static int check_stats(void)
+{
+    int fail = 0;
+    __gabixx::__size_class_stats stats[32];
+    int count = __gabixx::__get_size_class_stats(stats, 32);
+    unsigned long allocations = 0;
+    size_t span_bytes = 0, used_bytes = 0;
+    for (int n = 0; n < count; n++) {
+        allocations += stats[n].allocations;
+        span_bytes += stats[n].span_bytes;
+        used_bytes += stats[n].cached_bytes + stats[n].central_bytes;
+        printf("  %4zu bytes: %8lu allocations, %6zu cached, %6zu central, "
+               "%7zu in spans\n", stats[n].size, stats[n].allocations,
+               stats[n].cached_bytes, stats[n].central_bytes,
+               stats[n].span_bytes);
+    }
+    if (count <= 0 || allocations < (unsigned long)NUM_BLOCKS * NUM_ITERATIONS) {
+        fprintf(stderr, "KO: unexpected statistics (%d classes, %lu allocations)\n",
+                count, allocations);
+        fail++;
+    }
+    // All blocks have been freed, so they are all in a free list.
+    if (used_bytes > span_bytes) {
+        fprintf(stderr, "KO: %zu free bytes in %zu bytes of spans\n",
+                used_bytes, span_bytes);
+        fail++;
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+    const double ops = 2.0 * NUM_BLOCKS * NUM_ITERATIONS;
+
+    // Warm up the allocators.
+    time_malloc();
+    time_size_class();
+
+    double malloc_ns = time_malloc();
+    double size_class_ns = time_size_class();
+    double new_ns = time_new();
+
+    printf("malloc/free:     %.1f ns/op\n", malloc_ns / ops);
+    printf("size classes:    %.1f ns/op\n", size_class_ns / ops);
+    printf("new/delete:      %.1f ns/op\n", new_ns / ops);
+
+    fail += check_aligned_new();
+    fail += check_stats();
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
@@ -24,4 +24,39 @@ LOCAL_SRC_FILES := test_gabixx_exceptions.cpp
 LOCAL_SHARED_LIBRARIES := gabi++_shared
 include $(BUILD_EXECUTABLE)
 
+# The dlclose test loads two builds of the same library, and needs them to
+# share the __dynamic_cast() cache with the program, so it only links with
+# the shared GAbi++.
+include $(CLEAR_VARS)
+LOCAL_MODULE := libtest_gabixx_dlclose_a
+LOCAL_SRC_FILES := test_gabixx_dlclose_lib.cpp
+LOCAL_CFLAGS := -DTEST_GABIXX_DLCLOSE_TARGET=1
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_SHARED_LIBRARY)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := libtest_gabixx_dlclose_b
+LOCAL_SRC_FILES := test_gabixx_dlclose_lib.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_SHARED_LIBRARY)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_shared_dlclose
+LOCAL_SRC_FILES := test_gabixx_dlclose.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+LOCAL_LDLIBS := -ldl
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_static_demangle
+LOCAL_SRC_FILES := test_gabixx_demangle.cpp
+LOCAL_STATIC_LIBRARIES := gabi++_static
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_gabixx_shared_demangle
+LOCAL_SRC_FILES := test_gabixx_demangle.cpp
+LOCAL_SHARED_LIBRARIES := gabi++_shared
+include $(BUILD_EXECUTABLE)
+
 $(call import-module,cxx-stl/gabi++)
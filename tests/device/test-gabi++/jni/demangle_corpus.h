@@ -0,0 +1,1970 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Mangled names and their demangled forms, used by
+ * test_gabixx_demangle.cpp.
+ *
+ * This is a sample (one in sixteen, in sorted order) of the symbols defined
+ * by the C++ sources of the tests/device/test-stlport/unit directory, and of
+ * the jni directories of tests/build and tests/device, once compiled. The
+ * demangled forms are the ones printed by c++filt.
+ *
+ * The sample is followed by names that the demangler got wrong, with their
+ * demangled forms printed by c++filt too.
+ */
+
+#ifndef DEMANGLE_CORPUS_H
+#define DEMANGLE_CORPUS_H
+
+struct DemangleCorpusEntry {
+    const char* mangled;
+    const char* demangled;
+};
+
+static const DemangleCorpusEntry kDemangleCorpus[] = {
+    { "_Z10are_equalsIdEbT_S0_",
+      "bool are_equals<double>(double, double)" },
+    { "_Z11touchStaticILi14EEvv",
+      "void touchStatic<14>()" },
+    { "_Z11touchStaticILi29EEvv",
+      "void touchStatic<29>()" },
+    { "_Z11touchStaticILi43EEvv",
+      "void touchStatic<43>()" },
+    { "_Z11touchStaticILi58EEvv",
+      "void touchStatic<58>()" },
+    { "_Z12my_terminatev",
+      "my_terminate()" },
+    { "_Z15raise_exceptionv",
+      "raise_exception()" },
+    { "_Z17test_float_valuesIfEbT_S0_",
+      "bool test_float_values<float>(float, float)" },
+    { "_Z1fIvEbv",
+      "bool f<void>()" },
+    { "_Z20test_integral_limitsItEbRKT_bb",
+      "bool test_integral_limits<unsigned short>(unsigned short const&, bool, bool)" },
+    { "_Z26CreatePasswordFormFromDataRK16PasswordFormData",
+      "CreatePasswordFormFromData(PasswordFormData const&)" },
+    { "_Z2f2P2B2",
+      "f2(B2*)" },
+    { "_Z3f1cRK2S1",
+      "f1c(S1 const&)" },
+    { "_Z3fooii",
+      "foo(int, int)" },
+    { "_Z4initv",
+      "init()" },
+    { "_Z5test5v",
+      "test5()" },
+    { "_Z8my_thorwv",
+      "my_thorw()" },
+    { "_ZGVZ11touchStaticILi11EEvvE8instance",
+      "guard variable for touchStatic<11>()::instance" },
+    { "_ZGVZ11touchStaticILi26EEvvE8instance",
+      "guard variable for touchStatic<26>()::instance" },
+    { "_ZGVZ11touchStaticILi40EEvvE8instance",
+      "guard variable for touchStatic<40>()::instance" },
+    { "_ZGVZ11touchStaticILi55EEvvE8instance",
+      "guard variable for touchStatic<55>()::instance" },
+    { "_ZGVZStrsIcSt11char_traitsIcELm13EERSt13basic_istreamIT_T0_ES6_RSt6bitsetIXT1_EEE5__eof",
+      "guard variable for std::operator>><char, std::char_traits<char>, 13ul>(std::basic_istream<char, std::char_traits<char> >&, std::bitset<13ul>&)::__eof" },
+    { "_ZL1hv",
+      "h()" },
+    { "_ZL4fail",
+      "fail" },
+    { "_ZL8increaseRi",
+      "increase(int&)" },
+    { "_ZN10CCmdTarget15_messageEntriesE",
+      "CCmdTarget::_messageEntries" },
+    { "_ZN10DivideTest5myRunEPKcb",
+      "DivideTest::myRun(char const*, bool)" },
+    { "_ZN10InsertTestC5Ev",
+      "InsertTest::InsertTest()" },
+    { "_ZN10LexcmpTest5myRunEPKcb",
+      "LexcmpTest::myRun(char const*, bool)" },
+    { "_ZN10LocaleTest13_time_put_getERKSt6locale",
+      "LocaleTest::_time_put_get(std::locale const&)" },
+    { "_ZN10LocaleTest18moneypunct_by_nameEv",
+      "LocaleTest::moneypunct_by_name()" },
+    { "_ZN10MemoryTestC2Ev",
+      "MemoryTest::MemoryTest()" },
+    { "_ZN10RotateTestC1Ev",
+      "RotateTest::RotateTest()" },
+    { "_ZN10SearchTestD1Ev",
+      "SearchTest::~SearchTest()" },
+    { "_ZN10UniqueTestC2Ev",
+      "UniqueTest::UniqueTest()" },
+    { "_ZN11AdvanceTest3advEv",
+      "AdvanceTest::adv()" },
+    { "_ZN11BcomposTestD1Ev",
+      "BcomposTest::~BcomposTest()" },
+    { "_ZN11BnegateTestC1Ev",
+      "BnegateTest::BnegateTest()" },
+    { "_ZN11BsearchTestD2Ev",
+      "BsearchTest::~BsearchTest()" },
+    { "_ZN11CMainWindowC2Ev",
+      "CMainWindow::CMainWindow()" },
+    { "_ZN11CodecvtTestC1Ev",
+      "CodecvtTest::CodecvtTest()" },
+    { "_ZN11FinsertTestD5Ev",
+      "FinsertTest::~FinsertTest()" },
+    { "_ZN11FstreamTest2ioEv",
+      "FstreamTest::io()" },
+    { "_ZN11FstreamTestD1Ev",
+      "FstreamTest::~FstreamTest()" },
+    { "_ZN11InplaceTestC1Ev",
+      "InplaceTest::InplaceTest()" },
+    { "_ZN11NthElemTest5myRunEPKcb",
+      "NthElemTest::myRun(char const*, bool)" },
+    { "_ZN11PartialTest8parsrtc0Ev",
+      "PartialTest::parsrtc0()" },
+    { "_ZN11PtrSpecTestC1Ev",
+      "PtrSpecTest::PtrSpecTest()" },
+    { "_ZN11ReviterTestD2Ev",
+      "ReviterTest::~ReviterTest()" },
+    { "_ZN11StaticTableILi17EE4fillEPPFvvE",
+      "StaticTable<17>::fill(void (**)())" },
+    { "_ZN11StaticTableILi31EE4fillEPPFvvE",
+      "StaticTable<31>::fill(void (**)())" },
+    { "_ZN11StaticTableILi46EE4fillEPPFvvE",
+      "StaticTable<46>::fill(void (**)())" },
+    { "_ZN11StaticTableILi60EE4fillEPPFvvE",
+      "StaticTable<60>::fill(void (**)())" },
+    { "_ZN11TestFixtureD2Ev",
+      "TestFixture::~TestFixture()" },
+    { "_ZN12DataBlockPtrD2Ev",
+      "DataBlockPtr::~DataBlockPtr()" },
+    { "_ZN12IOStreamTest5myRunEPKcb",
+      "IOStreamTest::myRun(char const*, bool)" },
+    { "_ZN12IncludesTestC5Ev",
+      "IncludesTest::IncludesTest()" },
+    { "_ZN12MultisetTest12greater_thanEii",
+      "MultisetTest::greater_than(int, int)" },
+    { "_ZN12PasswordFormD2Ev",
+      "PasswordForm::~PasswordForm()" },
+    { "_ZN12SetUnionTestC5Ev",
+      "SetUnionTest::SetUnionTest()" },
+    { "_ZN12my_exceptionC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE",
+      "my_exception::my_exception(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&)" },
+    { "_ZN13DerivedStreamC1Ev",
+      "DerivedStream::DerivedStream()" },
+    { "_ZN13InnerprodTest4multEmm",
+      "InnerprodTest::mult(unsigned long, unsigned long)" },
+    { "_ZN13MemFunPtrTestC2Ev",
+      "MemFunPtrTest::MemFunPtrTest()" },
+    { "_ZN13MovableStructC5ERKS_",
+      "MovableStruct::MovableStruct(MovableStruct const&)" },
+    { "_ZN13PartitionTestC5Ev",
+      "PartitionTest::PartitionTest()" },
+    { "_ZN13RefCountedPtrC1EP19DataBlockController",
+      "RefCountedPtr::RefCountedPtr(DataBlockController*)" },
+    { "_ZN13TransformTestD0Ev",
+      "TransformTest::~TransformTest()" },
+    { "_ZN13UnorderedTestC1Ev",
+      "UnorderedTest::UnorderedTest()" },
+    { "_ZN14RndShuffleTest8rndshuf0Ev",
+      "RndShuffleTest::rndshuf0()" },
+    { "_ZN14TypeTraitsTest5myRunEPKcb",
+      "TypeTraitsTest::myRun(char const*, bool)" },
+    { "_ZN14full_streambufD0Ev",
+      "full_streambuf::~full_streambuf()" },
+    { "_ZN15_Deque_iteratorC2Ev",
+      "_Deque_iterator::_Deque_iterator()" },
+    { "_ZN17SetDifferenceTestD0Ev",
+      "SetDifferenceTest::~SetDifferenceTest()" },
+    { "_ZN17UninitializedTestC1Ev",
+      "UninitializedTest::UninitializedTest()" },
+    { "_ZN18RefCountedBlockPtrC2Ej",
+      "RefCountedBlockPtr::RefCountedBlockPtr(unsigned int)" },
+    { "_ZN19IStreamIteratorTestC5Ev",
+      "IStreamIteratorTest::IStreamIteratorTest()" },
+    { "_ZN19MoveConstructorTest5myRunEPKcb",
+      "MoveConstructorTest::myRun(char const*, bool)" },
+    { "_ZN19OstreamIteratorTestD5Ev",
+      "OstreamIteratorTest::~OstreamIteratorTest()" },
+    { "_ZN19StrstreamBufferTestC5Ev",
+      "StrstreamBufferTest::StrstreamBufferTest()" },
+    { "_ZN1AC1Ev",
+      "A::A()" },
+    { "_ZN1AIPPcED5Ev",
+      "A<char**>::~A()" },
+    { "_ZN1AIPvS0_EC5ERKS_IiiE",
+      "A<void*, void*>::A(A<int, int> const&)" },
+    { "_ZN1AIdEC5Ev",
+      "A<double>::A()" },
+    { "_ZN1AIfEC1Ei",
+      "A<float>::A(int)" },
+    { "_ZN1AIiiEC2Ei",
+      "A<int, int>::A(int)" },
+    { "_ZN1AIlED2Ev",
+      "A<long>::~A()" },
+    { "_ZN1AIsED5Ev",
+      "A<short>::~A()" },
+    { "_ZN1BC1EP1A",
+      "B::B(A*)" },
+    { "_ZN1BD5Ev",
+      "B::~B()" },
+    { "_ZN1CD2Ev",
+      "C::~C()" },
+    { "_ZN1DD0Ev",
+      "D::~D()" },
+    { "_ZN1ED2Ev",
+      "E::~E()" },
+    { "_ZN1SC1Ev",
+      "S::S()" },
+    { "_ZN1XC1EOS_",
+      "X::X(X&&)" },
+    { "_ZN1Y1pEv",
+      "Y::p()" },
+    { "_ZN1aD2Ev",
+      "a::~a()" },
+    { "_ZN21CompleteMovableStructC2ERKS_",
+      "CompleteMovableStruct::CompleteMovableStruct(CompleteMovableStruct const&)" },
+    { "_ZN2AAD2Ev",
+      "AA::~AA()" },
+    { "_ZN2ExC1Ei",
+      "Ex::Ex(int)" },
+    { "_ZN2S0C1Ev",
+      "S0::S0()" },
+    { "_ZN2VBC2ERKS_",
+      "VB::VB(VB const&)" },
+    { "_ZN2ccD2Ev",
+      "cc::~cc()" },
+    { "_ZN3BarC5Ev",
+      "Bar::Bar()" },
+    { "_ZN3FooC2Ev",
+      "Foo::Foo()" },
+    { "_ZN3My3I1FE1fEv",
+      "My3<F>::f()" },
+    { "_ZN3cpp4foo1Ei",
+      "cpp::foo1(int)" },
+    { "_ZN4BaseD2Ev",
+      "Base::~Base()" },
+    { "_ZN4NodeC5ERK8IntervalS2_",
+      "Node::Node(Interval const&, Interval const&)" },
+    { "_ZN4SlowILi14EEC1Ev",
+      "Slow<14>::Slow()" },
+    { "_ZN4SlowILi19EEC2Ev",
+      "Slow<19>::Slow()" },
+    { "_ZN4SlowILi23EEC5Ev",
+      "Slow<23>::Slow()" },
+    { "_ZN4SlowILi29EEC1Ev",
+      "Slow<29>::Slow()" },
+    { "_ZN4SlowILi33EEC2Ev",
+      "Slow<33>::Slow()" },
+    { "_ZN4SlowILi38EEC5Ev",
+      "Slow<38>::Slow()" },
+    { "_ZN4SlowILi43EEC1Ev",
+      "Slow<43>::Slow()" },
+    { "_ZN4SlowILi48EEC2Ev",
+      "Slow<48>::Slow()" },
+    { "_ZN4SlowILi52EEC5Ev",
+      "Slow<52>::Slow()" },
+    { "_ZN4SlowILi58EEC1Ev",
+      "Slow<58>::Slow()" },
+    { "_ZN4SlowILi62EEC2Ev",
+      "Slow<62>::Slow()" },
+    { "_ZN4SlowILi9EEC5Ev",
+      "Slow<9>::Slow()" },
+    { "_ZN4blahnwEm",
+      "blah::operator new(unsigned long)" },
+    { "_ZN5Class3vf1ERK2S1",
+      "Class::vf1(S1 const&)" },
+    { "_ZN5dequeC2ERKS_",
+      "deque::deque(deque const&)" },
+    { "_ZN6EngineD1Ev",
+      "Engine::~Engine()" },
+    { "_ZN7AdjTest8adjfind1Ev",
+      "AdjTest::adjfind1()" },
+    { "_ZN7AlgTestC1Ev",
+      "AlgTest::AlgTest()" },
+    { "_ZN7MaxTestD0Ev",
+      "MaxTest::~MaxTest()" },
+    { "_ZN7MinTestD5Ev",
+      "MinTest::~MinTest()" },
+    { "_ZN8BindTest8bind1st1Ev",
+      "BindTest::bind1st1()" },
+    { "_ZN8CopyTest5myRunEPKcb",
+      "CopyTest::myRun(char const*, bool)" },
+    { "_ZN8FillTestD1Ev",
+      "FillTest::~FillTest()" },
+    { "_ZN8FindTestD2Ev",
+      "FindTest::~FindTest()" },
+    { "_ZN8HeapTest6pheap1Ev",
+      "HeapTest::pheap1()" },
+    { "_ZN8IntervalC5Ei",
+      "Interval::Interval(int)" },
+    { "_ZN8IterTest8iterswp2Ev",
+      "IterTest::iterswp2()" },
+    { "_ZN8LessTestD1Ev",
+      "LessTest::~LessTest()" },
+    { "_ZN8PermTest8nextprm2Ev",
+      "PermTest::nextprm2()" },
+    { "_ZN8Ptr2TestC1Ev",
+      "Ptr2Test::Ptr2Test()" },
+    { "_ZN8RmCpTest8replcpy1Ev",
+      "RmCpTest::replcpy1()" },
+    { "_ZN8RopeTest5myRunEPKcb",
+      "RopeTest::myRun(char const*, bool)" },
+    { "_ZN8SortTestC1Ev",
+      "SortTest::SortTest()" },
+    { "_ZN8SwapTestD1Ev",
+      "SwapTest::~SwapTest()" },
+    { "_ZN8TestCaseC5Ev",
+      "TestCase::TestCase()" },
+    { "_ZN9AccumTestC2Ev",
+      "AccumTest::AccumTest()" },
+    { "_ZN9BoundTestD1Ev",
+      "BoundTest::~BoundTest()" },
+    { "_ZN9CMathTestD2Ev",
+      "CMathTest::~CMathTest()" },
+    { "_ZN9EqualTest12equal_range2Ev",
+      "EqualTest::equal_range2()" },
+    { "_ZN9ErrnoTestC1Ev",
+      "ErrnoTest::ErrnoTest()" },
+    { "_ZN9LimitTestC5Ev",
+      "LimitTest::LimitTest()" },
+    { "_ZN9MergeTest5myRunEPKcb",
+      "MergeTest::myRun(char const*, bool)" },
+    { "_ZN9QueueTestC2Ev",
+      "QueueTest::QueueTest()" },
+    { "_ZN9TimesTest5myRunEPKcb",
+      "TimesTest::myRun(char const*, bool)" },
+    { "_ZN9UnaryTestC2Ev",
+      "UnaryTest::UnaryTest()" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaI15MyIntComparableES1_E9constructIS1_EEvRS2_PS1_RKT_",
+      "void __gnu_cxx::__alloc_traits<std::allocator<MyIntComparable>, MyIntComparable>::construct<MyIntComparable>(std::allocator<MyIntComparable>&, MyIntComparable*, MyIntComparable const&)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaI21CompleteMovableStructES1_E8max_sizeERKS2_",
+      "__gnu_cxx::__alloc_traits<std::allocator<CompleteMovableStruct>, CompleteMovableStruct>::max_size(std::allocator<CompleteMovableStruct> const&)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIM6AClassFvvEES3_E8allocateERS4_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<void (AClass::*)()>, void (AClass::*)()>::allocate(std::allocator<void (AClass::*)()>&, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIP21CompleteMovableStructES2_E8allocateERS3_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<CompleteMovableStruct*>, CompleteMovableStruct*>::allocate(std::allocator<CompleteMovableStruct*>&, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIPFvvEES2_E8allocateERS3_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<void (*)()>, void (*)()>::allocate(std::allocator<void (*)()>&, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEES7_E8allocateERS8_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>::allocate(std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>&, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIPSt6vectorIiSaIiEEES4_E10deallocateERS5_PS4_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::vector<int, std::allocator<int> >*>, std::vector<int, std::allocator<int> >*>::deallocate(std::allocator<std::vector<int, std::allocator<int> >*>&, std::vector<int, std::allocator<int> >**, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIPiES1_E10_S_on_swapERS2_S4_",
+      "__gnu_cxx::__alloc_traits<std::allocator<int*>, int*>::_S_on_swap(std::allocator<int*>&, std::allocator<int*>&)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaISt10_List_nodeIPKiEES4_E17_S_select_on_copyERKS5_",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::_List_node<int const*> >, std::_List_node<int const*> >::_S_select_on_copy(std::allocator<std::_List_node<int const*> > const&)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaISt10_List_nodeIPiEES3_E8allocateERS4_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::_List_node<int*> >, std::_List_node<int*> >::allocate(std::allocator<std::_List_node<int*> >&, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaISt13_Rb_tree_nodeIPVKiEES4_E10_S_on_swapERS5_S7_",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::_Rb_tree_node<int const volatile*> >, std::_Rb_tree_node<int const volatile*> >::_S_on_swap(std::allocator<std::_Rb_tree_node<int const volatile*> >&, std::allocator<std::_Rb_tree_node<int const volatile*> >&)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaISt13_Rb_tree_nodeISt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEESB_E8allocateERSC_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >, std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::allocate(std::allocator<std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >&, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaISt6vectorIiSaIiEEES3_E10deallocateERS4_PS3_m",
+      "__gnu_cxx::__alloc_traits<std::allocator<std::vector<int, std::allocator<int> > >, std::vector<int, std::allocator<int> > >::deallocate(std::allocator<std::vector<int, std::allocator<int> > >&, std::vector<int, std::allocator<int> >*, unsigned long)" },
+    { "_ZN9__gnu_cxx14__alloc_traitsISaIfEfE8max_sizeERKS1_",
+      "__gnu_cxx::__alloc_traits<std::allocator<float>, float>::max_size(std::allocator<float> const&)" },
+    { "_ZN9__gnu_cxx16__aligned_membufIPK12PasswordFormE7_M_addrEv",
+      "__gnu_cxx::__aligned_membuf<PasswordForm const*>::_M_addr()" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIP1VSt6vectorIS1_SaIS1_EEEppEv",
+      "__gnu_cxx::__normal_iterator<V*, std::vector<V, std::allocator<V> > >::operator++()" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIP4TestSt6vectorIS1_SaIS1_EEEC2Ev",
+      "__gnu_cxx::__normal_iterator<Test*, std::vector<Test, std::allocator<Test> > >::__normal_iterator()" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPK21CompleteMovableStructSt6vectorIS1_SaIS1_EEEppEv",
+      "__gnu_cxx::__normal_iterator<CompleteMovableStruct const*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >::operator++()" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPKPVKiSt6vectorIS2_SaIS2_EEEC5ERKS4_",
+      "__gnu_cxx::__normal_iterator<int const volatile* const*, std::vector<int const volatile*, std::allocator<int const volatile*> > >::__normal_iterator(int const volatile* const* const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPKfSt6vectorIfSaIfEEEC1IPfEERKNS0_IT_NS_11__enable_ifIXsrSt10__are_sameIS9_S8_E7__valueES5_E6__typeEEE",
+      "__gnu_cxx::__normal_iterator<float const*, std::vector<float, std::allocator<float> > >::__normal_iterator<float*>(__gnu_cxx::__normal_iterator<float*, __gnu_cxx::__enable_if<std::__are_same<float*, float*>::__value, std::vector<float, std::allocator<float> > >::__type> const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESt6vectorIS6_SaIS6_EEEC5ERKS7_",
+      "__gnu_cxx::__normal_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::__normal_iterator(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >* const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPP7derivedSt6vectorIS2_SaIS2_EEEC2ERKS3_",
+      "__gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > >::__normal_iterator(derived** const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPPKiSt6vectorIS2_SaIS2_EEEC1ERKS3_",
+      "__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >::__normal_iterator(int const** const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPPiSt6vectorIS1_SaIS1_EEEC5ERKS2_",
+      "__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >::__normal_iterator(int** const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPSt6vectorIiSaIiEES1_IS3_SaIS3_EEEC5ERKS4_",
+      "__gnu_cxx::__normal_iterator<std::vector<int, std::allocator<int> >*, std::vector<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > > >::__normal_iterator(std::vector<int, std::allocator<int> >* const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPfSt6vectorIfSaIfEEEC2ERKS1_",
+      "__gnu_cxx::__normal_iterator<float*, std::vector<float, std::allocator<float> > >::__normal_iterator(float* const&)" },
+    { "_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC1ERKS1_",
+      "__gnu_cxx::__normal_iterator<unsigned long*, std::vector<unsigned long, std::allocator<unsigned long> > >::__normal_iterator(unsigned long* const&)" },
+    { "_ZN9__gnu_cxx5__ops10_Iter_predIPFiiEEC1ES3_",
+      "__gnu_cxx::__ops::_Iter_pred<int (*)(int)>::_Iter_pred(int (*)(int))" },
+    { "_ZN9__gnu_cxx5__ops10_Iter_predISt25pointer_to_unary_functionIibEEC1ES3_",
+      "__gnu_cxx::__ops::_Iter_pred<std::pointer_to_unary_function<int, bool> >::_Iter_pred(std::pointer_to_unary_function<int, bool>)" },
+    { "_ZN9__gnu_cxx5__ops11__pred_iterISt12unary_negateI3oddEEENS0_10_Iter_predIT_EES6_",
+      "__gnu_cxx::__ops::_Iter_pred<std::unary_negate<odd> > __gnu_cxx::__ops::__pred_iter<std::unary_negate<odd> >(std::unary_negate<odd>)" },
+    { "_ZN9__gnu_cxx5__ops14_Iter_comp_valIPFbPKcS3_EEclINS_17__normal_iteratorIPS3_St6vectorIS3_SaIS3_EEEES3_EEbT_RT0_",
+      "bool __gnu_cxx::__ops::_Iter_comp_val<bool (*)(char const*, char const*)>::operator()<__gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > >, char const*>(__gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > >, char const*&)" },
+    { "_ZN9__gnu_cxx5__ops14_Iter_comp_valISt13greater_equalIiEEC5ERKNS0_15_Iter_comp_iterIS3_EE",
+      "__gnu_cxx::__ops::_Iter_comp_val<std::greater_equal<int> >::_Iter_comp_val(__gnu_cxx::__ops::_Iter_comp_iter<std::greater_equal<int> > const&)" },
+    { "_ZN9__gnu_cxx5__ops14_Iter_comp_valISt6localeEC5ERKNS0_15_Iter_comp_iterIS2_EE",
+      "__gnu_cxx::__ops::_Iter_comp_val<std::locale>::_Iter_comp_val(__gnu_cxx::__ops::_Iter_comp_iter<std::locale> const&)" },
+    { "_ZN9__gnu_cxx5__ops14_Iter_comp_valISt7greaterImEEC2ERKNS0_15_Iter_comp_iterIS3_EE",
+      "__gnu_cxx::__ops::_Iter_comp_val<std::greater<unsigned long> >::_Iter_comp_val(__gnu_cxx::__ops::_Iter_comp_iter<std::greater<unsigned long> > const&)" },
+    { "_ZN9__gnu_cxx5__ops14_Val_comp_iterIPFbPKcS3_EEclIS3_NS_17__normal_iteratorIPS3_St6vectorIS3_SaIS3_EEEEEEbRT_T0_",
+      "bool __gnu_cxx::__ops::_Val_comp_iter<bool (*)(char const*, char const*)>::operator()<char const*, __gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > > >(char const*&, __gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > >)" },
+    { "_ZN9__gnu_cxx5__ops14_Val_comp_iterISt13greater_equalIiEEC5ERKNS0_15_Iter_comp_iterIS3_EE",
+      "__gnu_cxx::__ops::_Val_comp_iter<std::greater_equal<int> >::_Val_comp_iter(__gnu_cxx::__ops::_Iter_comp_iter<std::greater_equal<int> > const&)" },
+    { "_ZN9__gnu_cxx5__ops15_Iter_comp_iterIPFbPKcS3_EEC2ES5_",
+      "__gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)>::_Iter_comp_iter(bool (*)(char const*, char const*))" },
+    { "_ZN9__gnu_cxx5__ops15_Iter_comp_iterISt13binary_negateISt7greaterIiEEEC1ES5_",
+      "__gnu_cxx::__ops::_Iter_comp_iter<std::binary_negate<std::greater<int> > >::_Iter_comp_iter(std::binary_negate<std::greater<int> >)" },
+    { "_ZN9__gnu_cxx5__ops15_Iter_comp_iterISt4lessIiEEclIPiS6_EEbT_T0_",
+      "bool __gnu_cxx::__ops::_Iter_comp_iter<std::less<int> >::operator()<int*, int*>(int*, int*)" },
+    { "_ZN9__gnu_cxx5__ops15_Iter_comp_iterISt7greaterIcEEC5ES3_",
+      "__gnu_cxx::__ops::_Iter_comp_iter<std::greater<char> >::_Iter_comp_iter(std::greater<char>)" },
+    { "_ZN9__gnu_cxx5__ops15__iter_comp_valISt4lessIcEEENS0_14_Iter_comp_valIT_EES5_",
+      "__gnu_cxx::__ops::_Iter_comp_val<std::less<char> > __gnu_cxx::__ops::__iter_comp_val<std::less<char> >(std::less<char>)" },
+    { "_ZN9__gnu_cxx5__ops15__val_comp_iterISt7greaterImEEENS0_14_Val_comp_iterIT_EENS0_15_Iter_comp_iterIS5_EE",
+      "__gnu_cxx::__ops::_Val_comp_iter<std::greater<unsigned long> > __gnu_cxx::__ops::__val_comp_iter<std::greater<unsigned long> >(__gnu_cxx::__ops::_Iter_comp_iter<std::greater<unsigned long> >)" },
+    { "_ZN9__gnu_cxx5__ops16__iter_comp_iterIPFbPKcS3_EEENS0_15_Iter_comp_iterIT_EES7_",
+      "__gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)> __gnu_cxx::__ops::__iter_comp_iter<bool (*)(char const*, char const*)>(bool (*)(char const*, char const*))" },
+    { "_ZN9__gnu_cxx5__ops17_Iter_comp_to_valISt7greaterIiEKiEC2ES3_RS4_",
+      "__gnu_cxx::__ops::_Iter_comp_to_val<std::greater<int>, int const>::_Iter_comp_to_val(std::greater<int>, int const&)" },
+    { "_ZN9__gnu_cxx5__ops17__iter_equals_valIKcEENS0_16_Iter_equals_valIT_EERS4_",
+      "__gnu_cxx::__ops::_Iter_equals_val<char const> __gnu_cxx::__ops::__iter_equals_val<char const>(char const&)" },
+    { "_ZN9__gnu_cxxltIPiSt6vectorIiSaIiEEEEbRKNS_17__normal_iteratorIT_T0_EESA_",
+      "bool __gnu_cxx::operator< <int*, std::vector<int, std::allocator<int> > >(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > > const&, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > > const&)" },
+    { "_ZN9__gnu_cxxneIPK21CompleteMovableStructSt6vectorIS1_SaIS1_EEEEbRKNS_17__normal_iteratorIT_T0_EESC_",
+      "bool __gnu_cxx::operator!=<CompleteMovableStruct const*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >(__gnu_cxx::__normal_iterator<CompleteMovableStruct const*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > > const&, __gnu_cxx::__normal_iterator<CompleteMovableStruct const*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > > const&)" },
+    { "_ZN9__gnu_cxxneIPcSt6vectorIcSaIcEEEEbRKNS_17__normal_iteratorIT_T0_EESA_",
+      "bool __gnu_cxx::operator!=<char*, std::vector<char, std::allocator<char> > >(__gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > > const&, __gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > > const&)" },
+    { "_ZNK10my_codecvt5do_inER11__mbstate_tPKcS3_RS3_PwS5_RS5_",
+      "my_codecvt::do_in(__mbstate_t&, char const*, char const*, char const*&, wchar_t*, wchar_t*, wchar_t*&) const" },
+    { "_ZNK13pre_incrementclEiRi",
+      "pre_increment::operator()(int, int&) const" },
+    { "_ZNK4DataeqERKS_",
+      "Data::operator==(Data const&) const" },
+    { "_ZNK6DomainI12DomainTraitsI8IntervalEEixEi",
+      "Domain<DomainTraits<Interval> >::operator[](int) const" },
+    { "_ZNK9__gnu_cxx17__normal_iteratorIP20NotTrivialCopyStructSt6vectorIS1_SaIS1_EEE4baseEv",
+      "__gnu_cxx::__normal_iterator<NotTrivialCopyStruct*, std::vector<NotTrivialCopyStruct, std::allocator<NotTrivialCopyStruct> > >::base() const" },
+    { "_ZNK9__gnu_cxx17__normal_iteratorIPKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESt6vectorIS6_SaIS6_EEEdeEv",
+      "__gnu_cxx::__normal_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const*, std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::operator*() const" },
+    { "_ZNK9__gnu_cxx17__normal_iteratorIPP4baseSt6vectorIS2_SaIS2_EEEdeEv",
+      "__gnu_cxx::__normal_iterator<base**, std::vector<base*, std::allocator<base*> > >::operator*() const" },
+    { "_ZNK9__gnu_cxx17__normal_iteratorIPPVKiSt6vectorIS2_SaIS2_EEEplEl",
+      "__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >::operator+(long) const" },
+    { "_ZNK9__gnu_cxx17__normal_iteratorIPSt6vectorIiSaIiEES1_IS3_SaIS3_EEE4baseEv",
+      "__gnu_cxx::__normal_iterator<std::vector<int, std::allocator<int> >*, std::vector<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > > >::base() const" },
+    { "_ZNK9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEmiEl",
+      "__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >::operator-(long) const" },
+    { "_ZNK9__gnu_cxx5__ops14_Iter_less_valclISt15_Deque_iteratorIiRiPiEiEEbT_RT0_",
+      "bool __gnu_cxx::__ops::_Iter_less_val::operator()<std::_Deque_iterator<int, int&, int*>, int>(std::_Deque_iterator<int, int&, int*>, int&) const" },
+    { "_ZNK9__gnu_cxx5__ops15_Iter_less_iterclIPcS3_EEbT_T0_",
+      "bool __gnu_cxx::__ops::_Iter_less_iter::operator()<char*, char*>(char*, char*) const" },
+    { "_ZNKSt10logical_orIbEclERKbS2_",
+      "std::logical_or<bool>::operator()(bool const&, bool const&) const" },
+    { "_ZNKSt11_Deque_baseIPKiSaIS1_EE20_M_get_map_allocatorEv",
+      "std::_Deque_base<int const*, std::allocator<int const*> >::_M_get_map_allocator() const" },
+    { "_ZNKSt11logical_andIbEclERKbS2_",
+      "std::logical_and<bool>::operator()(bool const&, bool const&) const" },
+    { "_ZNKSt12_Vector_baseIPFvvESaIS1_EE19_M_get_Tp_allocatorEv",
+      "std::_Vector_base<void (*)(), std::allocator<void (*)()> >::_M_get_Tp_allocator() const" },
+    { "_ZNKSt13_Bvector_baseISaIbEE13_Bvector_impl11_M_end_addrEv",
+      "std::_Bvector_base<std::allocator<bool> >::_Bvector_impl::_M_end_addr() const" },
+    { "_ZNKSt13mem_fun_ref_tIi5ClassEclERS0_",
+      "std::mem_fun_ref_t<int, Class>::operator()(Class&) const" },
+    { "_ZNKSt14_List_iteratorIPiEdeEv",
+      "std::_List_iterator<int*>::operator*() const" },
+    { "_ZNKSt15_Deque_iteratorI3ObjRS0_PS0_EdeEv",
+      "std::_Deque_iterator<Obj, Obj&, Obj*>::operator*() const" },
+    { "_ZNKSt15_Deque_iteratorIPViRS1_PS1_EdeEv",
+      "std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>::operator*() const" },
+    { "_ZNKSt15__new_allocatorI15MyIntComparableE8max_sizeEv",
+      "std::__new_allocator<MyIntComparable>::max_size() const" },
+    { "_ZNKSt15__new_allocatorIM6AClassFvvEE8max_sizeEv",
+      "std::__new_allocator<void (AClass::*)()>::max_size() const" },
+    { "_ZNKSt15__new_allocatorIPFvvEE11_M_max_sizeEv",
+      "std::__new_allocator<void (*)()>::_M_max_size() const" },
+    { "_ZNKSt15__new_allocatorIPVKiE11_M_max_sizeEv",
+      "std::__new_allocator<int const volatile*>::_M_max_size() const" },
+    { "_ZNKSt15__new_allocatorISt10_List_nodeIPiEE8max_sizeEv",
+      "std::__new_allocator<std::_List_node<int*> >::max_size() const" },
+    { "_ZNKSt15__new_allocatorISt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EEE8max_sizeEv",
+      "std::__new_allocator<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::max_size() const" },
+    { "_ZNKSt15__new_allocatorIjE8max_sizeEv",
+      "std::__new_allocator<unsigned int>::max_size() const" },
+    { "_ZNKSt16reverse_iteratorIN9__gnu_cxx17__normal_iteratorIPPKcSt6vectorIS3_SaIS3_EEEEE4baseEv",
+      "std::reverse_iterator<__gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > > >::base() const" },
+    { "_ZNKSt19const_mem_fun_ref_tIi5ClassEclERKS0_",
+      "std::const_mem_fun_ref_t<int, Class>::operator()(Class const&) const" },
+    { "_ZNKSt20_List_const_iteratorIPiEdeEv",
+      "std::_List_const_iterator<int*>::operator*() const" },
+    { "_ZNKSt21__ctype_abstract_baseIwE8scan_notEtPKwS2_",
+      "std::__ctype_abstract_base<wchar_t>::scan_not(unsigned short, wchar_t const*, wchar_t const*) const" },
+    { "_ZNKSt25pointer_to_unary_functionIRK2S1iEclES2_",
+      "std::pointer_to_unary_function<S1 const&, int>::operator()(S1 const&) const" },
+    { "_ZNKSt3setIPKiSt4lessIS1_ESaIS1_EE11lower_boundERKS1_",
+      "std::set<int const*, std::less<int const*>, std::allocator<int const*> >::lower_bound(int const* const&) const" },
+    { "_ZNKSt3setIPVKiSt4lessIS1_ESaIS1_EE11upper_boundERKS1_",
+      "std::set<int const volatile*, std::less<int const volatile*>, std::allocator<int const volatile*> >::upper_bound(int const volatile* const&) const" },
+    { "_ZNKSt3setIPViSt4lessIS1_ESaIS1_EE13get_allocatorEv",
+      "std::set<int volatile*, std::less<int volatile*>, std::allocator<int volatile*> >::get_allocator() const" },
+    { "_ZNKSt3setIPiSt4lessIS0_ESaIS0_EE3endEv",
+      "std::set<int*, std::less<int*>, std::allocator<int*> >::end() const" },
+    { "_ZNKSt4_ExpclIdEET_RKS1_",
+      "double std::_Exp::operator()<double>(double const&) const" },
+    { "_ZNKSt4fposI8my_stateE5stateEv",
+      "std::fpos<my_state>::state() const" },
+    { "_ZNKSt5_AsinclIfEET_RKS1_",
+      "float std::_Asin::operator()<float>(float const&) const" },
+    { "_ZNKSt5_ExprINSt8__detail7_UnClosISt4_CosSt9_ValArrayeEEeEixEm",
+      "std::_Expr<std::__detail::_UnClos<std::_Cos, std::_ValArray, long double>, long double>::operator[](unsigned long) const" },
+    { "_ZNKSt5_ExprINSt8__detail7_UnClosISt4_SinSt9_ValArraydEEdEixEm",
+      "std::_Expr<std::__detail::_UnClos<std::_Sin, std::_ValArray, double>, double>::operator[](unsigned long) const" },
+    { "_ZNKSt5_ExprINSt8__detail7_UnClosISt5_AcosSt9_ValArrayfEEfEixEm",
+      "std::_Expr<std::__detail::_UnClos<std::_Acos, std::_ValArray, float>, float>::operator[](unsigned long) const" },
+    { "_ZNKSt5_ExprINSt8__detail7_UnClosISt5_CoshSt9_ValArrayeEEeEixEm",
+      "std::_Expr<std::__detail::_UnClos<std::_Cosh, std::_ValArray, long double>, long double>::operator[](unsigned long) const" },
+    { "_ZNKSt5_ExprINSt8__detail7_UnClosISt5_TanhSt9_ValArraydEEdEixEm",
+      "std::_Expr<std::__detail::_UnClos<std::_Tanh, std::_ValArray, double>, double>::operator[](unsigned long) const" },
+    { "_ZNKSt5_ExprINSt8__detail8_BinClosISt4_PowSt9_ConstantSt9_ValArrayffEEfEixEm",
+      "std::_Expr<std::__detail::_BinClos<std::_Pow, std::_Constant, std::_ValArray, float, float>, float>::operator[](unsigned long) const" },
+    { "_ZNKSt5_ExprINSt8__detail8_BinClosISt6_Atan2St9_ConstantSt9_ValArrayeeEEeEixEm",
+      "std::_Expr<std::__detail::_BinClos<std::_Atan2, std::_Constant, std::_ValArray, long double, long double>, long double>::operator[](unsigned long) const" },
+    { "_ZNKSt5_SinhclIeEET_RKS1_",
+      "long double std::_Sinh::operator()<long double>(long double const&) const" },
+    { "_ZNKSt5ctypeIcE7scan_isEtPKcS2_",
+      "std::ctype<char>::scan_is(unsigned short, char const*, char const*) const" },
+    { "_ZNKSt5dequeI3ObjSaIS0_EE5beginEv",
+      "std::deque<Obj, std::allocator<Obj> >::begin() const" },
+    { "_ZNKSt5dequeIPKiSaIS1_EE5beginEv",
+      "std::deque<int const*, std::allocator<int const*> >::begin() const" },
+    { "_ZNKSt5dequeIPVKiSaIS1_EE6rbeginEv",
+      "std::deque<int const volatile*, std::allocator<int const volatile*> >::rbegin() const" },
+    { "_ZNKSt5dequeIPiSaIS0_EE13get_allocatorEv",
+      "std::deque<int*, std::allocator<int*> >::get_allocator() const" },
+    { "_ZNKSt5dequeIiSaIiEE4sizeEv",
+      "std::deque<int, std::allocator<int> >::size() const" },
+    { "_ZNKSt6_Atan2clIfEET_RKS1_S3_",
+      "float std::_Atan2::operator()<float>(float const&, float const&) const" },
+    { "_ZNKSt6chrono8durationIlSt5ratioILl1ELl1000000000EEE5countEv",
+      "std::chrono::duration<long, std::ratio<1l, 1000000000l> >::count() const" },
+    { "_ZNKSt6vectorI13MovableStructSaIS0_EE12_M_check_lenEmPKc",
+      "std::vector<MovableStruct, std::allocator<MovableStruct> >::_M_check_len(unsigned long, char const*) const" },
+    { "_ZNKSt6vectorI3ObjSaIS0_EE12_M_check_lenEmPKc",
+      "std::vector<Obj, std::allocator<Obj> >::_M_check_len(unsigned long, char const*) const" },
+    { "_ZNKSt6vectorINSt7__cxx114listINS0_12basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EEESaIS8_EE3endEv",
+      "std::vector<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::end() const" },
+    { "_ZNKSt6vectorIPKcSaIS1_EE12_M_check_lenEmS1_",
+      "std::vector<char const*, std::allocator<char const*> >::_M_check_len(unsigned long, char const*) const" },
+    { "_ZNKSt6vectorIPKiSaIS1_EE8capacityEv",
+      "std::vector<int const*, std::allocator<int const*> >::capacity() const" },
+    { "_ZNKSt6vectorIPVKiSaIS1_EE8capacityEv",
+      "std::vector<int const volatile*, std::allocator<int const volatile*> >::capacity() const" },
+    { "_ZNKSt6vectorIPViSaIS1_EE8capacityEv",
+      "std::vector<int volatile*, std::allocator<int volatile*> >::capacity() const" },
+    { "_ZNKSt6vectorIPiSaIS0_EE8capacityEv",
+      "std::vector<int*, std::allocator<int*> >::capacity() const" },
+    { "_ZNKSt6vectorISt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EESaIS8_EE4sizeEv",
+      "std::vector<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::size() const" },
+    { "_ZNKSt6vectorIiSaIiEE12_M_check_lenEmPKc",
+      "std::vector<int, std::allocator<int> >::_M_check_len(unsigned long, char const*) const" },
+    { "_ZNKSt7__cxx1110_List_baseIPiSaIS1_EE21_M_get_Node_allocatorEv",
+      "std::__cxx11::_List_base<int*, std::allocator<int*> >::_M_get_Node_allocator() const" },
+    { "_ZNKSt7__cxx1110moneypunctIcLb1EE8groupingEv",
+      "std::__cxx11::moneypunct<char, true>::grouping() const" },
+    { "_ZNKSt7__cxx1118basic_stringstreamIcSt11char_traitsIcESaIcEE3strEv",
+      "std::__cxx11::basic_stringstream<char, std::char_traits<char>, std::allocator<char> >::str() const" },
+    { "_ZNKSt7__cxx114listIPKiSaIS2_EE4rendEv",
+      "std::__cxx11::list<int const*, std::allocator<int const*> >::rend() const" },
+    { "_ZNKSt7__cxx114listIPVKiSaIS2_EE5frontEv",
+      "std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >::front() const" },
+    { "_ZNKSt7__cxx114listIPiSaIS1_EE13_M_resize_posERm",
+      "std::__cxx11::list<int*, std::allocator<int*> >::_M_resize_pos(unsigned long&) const" },
+    { "_ZNKSt7__cxx117collateIwE7compareEPKwS3_S3_S3_",
+      "std::__cxx11::collate<wchar_t>::compare(wchar_t const*, wchar_t const*, wchar_t const*, wchar_t const*) const" },
+    { "_ZNKSt7__cxx119money_getIcSt19istreambuf_iteratorIcSt11char_traitsIcEEE3getES4_S4_bRSt8ios_baseRSt12_Ios_IostateRe",
+      "std::__cxx11::money_get<char, std::istreambuf_iterator<char, std::char_traits<char> > >::get(std::istreambuf_iterator<char, std::char_traits<char> >, std::istreambuf_iterator<char, std::char_traits<char> >, bool, std::ios_base&, std::_Ios_Iostate&, long double&) const" },
+    { "_ZNKSt7greaterIiEclERKiS2_",
+      "std::greater<int>::operator()(int const&, int const&) const" },
+    { "_ZNKSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE11equal_rangeERKS1_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::equal_range(int const* const&) const" },
+    { "_ZNKSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE7_M_rootEv",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_M_root() const" },
+    { "_ZNKSt8_Rb_treeIPVKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE4sizeEv",
+      "std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >::size() const" },
+    { "_ZNKSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE14_M_lower_boundEPKSt13_Rb_tree_nodeIS1_EPKSt18_Rb_tree_node_baseRKS1_",
+      "std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_M_lower_bound(std::_Rb_tree_node<int volatile*> const*, std::_Rb_tree_node_base const*, int volatile* const&) const" },
+    { "_ZNKSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE9_M_mbeginEv",
+      "std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_M_mbegin() const" },
+    { "_ZNKSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EE6_M_endEv",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::_M_end() const" },
+    { "_ZNKSt8_Rb_treeIiiSt9_IdentityIiESt26pointer_to_binary_functionIiibESaIiEE3endEv",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::pointer_to_binary_function<int, int, bool>, std::allocator<int> >::end() const" },
+    { "_ZNKSt8_Rb_treeIiiSt9_IdentityIiESt4lessIiESaIiEE8_M_beginEv",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_M_begin() const" },
+    { "_ZNKSt8__detail7_UnBaseISt4_CosSt8valarrayIeEEixEm",
+      "std::__detail::_UnBase<std::_Cos, std::valarray<long double> >::operator[](unsigned long) const" },
+    { "_ZNKSt8__detail7_UnBaseISt4_SinSt8valarrayIdEEixEm",
+      "std::__detail::_UnBase<std::_Sin, std::valarray<double> >::operator[](unsigned long) const" },
+    { "_ZNKSt8__detail7_UnBaseISt5_AcosSt8valarrayIfEEixEm",
+      "std::__detail::_UnBase<std::_Acos, std::valarray<float> >::operator[](unsigned long) const" },
+    { "_ZNKSt8__detail7_UnBaseISt5_CoshSt8valarrayIeEEixEm",
+      "std::__detail::_UnBase<std::_Cosh, std::valarray<long double> >::operator[](unsigned long) const" },
+    { "_ZNKSt8__detail7_UnBaseISt5_TanhSt8valarrayIdEEixEm",
+      "std::__detail::_UnBase<std::_Tanh, std::valarray<double> >::operator[](unsigned long) const" },
+    { "_ZNKSt8__detail8_BinBaseISt4_PowSt8valarrayIfES3_EixEm",
+      "std::__detail::_BinBase<std::_Pow, std::valarray<float>, std::valarray<float> >::operator[](unsigned long) const" },
+    { "_ZNKSt8__detail9_BinBase1ISt6_Atan2St8valarrayIeEEixEm",
+      "std::__detail::_BinBase1<std::_Atan2, std::valarray<long double> >::operator[](unsigned long) const" },
+    { "_ZNKSt8auto_ptrIVKiEdeEv",
+      "std::auto_ptr<int const volatile>::operator*() const" },
+    { "_ZNKSt8multisetIPKiSt4lessIS1_ESaIS1_EE5beginEv",
+      "std::multiset<int const*, std::less<int const*>, std::allocator<int const*> >::begin() const" },
+    { "_ZNKSt8multisetIPVKiSt4lessIS1_ESaIS1_EE5countERKS1_",
+      "std::multiset<int const volatile*, std::less<int const volatile*>, std::allocator<int const volatile*> >::count(int const volatile* const&) const" },
+    { "_ZNKSt8multisetIPViSt4lessIS1_ESaIS1_EE5emptyEv",
+      "std::multiset<int volatile*, std::less<int volatile*>, std::allocator<int volatile*> >::empty() const" },
+    { "_ZNKSt8multisetIPiSt4lessIS0_ESaIS0_EE6rbeginEv",
+      "std::multiset<int*, std::less<int*>, std::allocator<int*> >::rbegin() const" },
+    { "_ZNKSt8valarrayIfE4sizeEv",
+      "std::valarray<float>::size() const" },
+    { "_ZNKSt9basic_iosIc9my_traitsEntEv",
+      "std::basic_ios<char, my_traits>::operator!() const" },
+    { "_ZNKSt9binder2ndISt7greaterIiEEclERi",
+      "std::binder2nd<std::greater<int> >::operator()(int&) const" },
+    { "_ZNSaI15MyIntComparableEC2Ev",
+      "std::allocator<MyIntComparable>::allocator()" },
+    { "_ZNSaI1VEC5Ev",
+      "std::allocator<V>::allocator()" },
+    { "_ZNSaI20NotTrivialCopyStructEC5ERKS0_",
+      "std::allocator<NotTrivialCopyStruct>::allocator(std::allocator<NotTrivialCopyStruct> const&)" },
+    { "_ZNSaI3ObjEC1Ev",
+      "std::allocator<Obj>::allocator()" },
+    { "_ZNSaI9BigStructEC5Ev",
+      "std::allocator<BigStruct>::allocator()" },
+    { "_ZNSaINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC2ISt10_List_nodeIS4_EEERKSaIT_E",
+      "std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >::allocator<std::_List_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >(std::allocator<std::_List_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > const&)" },
+    { "_ZNSaINSt7__cxx114listINS_12basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EEEED2Ev",
+      "std::allocator<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::~allocator()" },
+    { "_ZNSaIP21CompleteMovableStructEC5IS_EERKSaIT_E",
+      "std::allocator<CompleteMovableStruct*>::allocator<CompleteMovableStruct>(std::allocator<CompleteMovableStruct> const&)" },
+    { "_ZNSaIP4baseED1Ev",
+      "std::allocator<base*>::~allocator()" },
+    { "_ZNSaIPFviEED2Ev",
+      "std::allocator<void (*)(int)>::~allocator()" },
+    { "_ZNSaIPKcED5Ev",
+      "std::allocator<char const*>::~allocator()" },
+    { "_ZNSaIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC1IS4_EERKSaIT_E",
+      "std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >(std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > const&)" },
+    { "_ZNSaIPPKiED2Ev",
+      "std::allocator<int const**>::~allocator()" },
+    { "_ZNSaIPPiEC5IS_EERKSaIT_E",
+      "std::allocator<int**>::allocator<int*>(std::allocator<int*> const&)" },
+    { "_ZNSaIPSt6vectorIfSaIfEEED1Ev",
+      "std::allocator<std::vector<float, std::allocator<float> >*>::~allocator()" },
+    { "_ZNSaIPVKiEC2ISt13_Rb_tree_nodeIS0_EEERKSaIT_E",
+      "std::allocator<int const volatile*>::allocator<std::_Rb_tree_node<int const volatile*> >(std::allocator<std::_Rb_tree_node<int const volatile*> > const&)" },
+    { "_ZNSaIPViEC5ERKS1_",
+      "std::allocator<int volatile*>::allocator(std::allocator<int volatile*> const&)" },
+    { "_ZNSaIPiEC2IiEERKSaIT_E",
+      "std::allocator<int*>::allocator<int>(std::allocator<int> const&)" },
+    { "_ZNSaIPvED2Ev",
+      "std::allocator<void*>::~allocator()" },
+    { "_ZNSaISt10_List_nodeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEC5IS5_EERKSaIT_E",
+      "std::allocator<std::_List_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >(std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > const&)" },
+    { "_ZNSaISt10_List_nodeIPVKiEEC1ERKS3_",
+      "std::allocator<std::_List_node<int const volatile*> >::allocator(std::allocator<std::_List_node<int const volatile*> > const&)" },
+    { "_ZNSaISt10_List_nodeIPViEEC2Ev",
+      "std::allocator<std::_List_node<int volatile*> >::allocator()" },
+    { "_ZNSaISt10_List_nodeIPiEEC5IS0_EERKSaIT_E",
+      "std::allocator<std::_List_node<int*> >::allocator<int*>(std::allocator<int*> const&)" },
+    { "_ZNSaISt10_List_nodeISt6vectorIiSaIiEEEED1Ev",
+      "std::allocator<std::_List_node<std::vector<int, std::allocator<int> > > >::~allocator()" },
+    { "_ZNSaISt13_Rb_tree_nodeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEC1Ev",
+      "std::allocator<std::_Rb_tree_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::allocator()" },
+    { "_ZNSaISt13_Rb_tree_nodeIPKiEEC1IS1_EERKSaIT_E",
+      "std::allocator<std::_Rb_tree_node<int const*> >::allocator<int const*>(std::allocator<int const*> const&)" },
+    { "_ZNSaISt13_Rb_tree_nodeIPVKiEEC5ERKS3_",
+      "std::allocator<std::_Rb_tree_node<int const volatile*> >::allocator(std::allocator<std::_Rb_tree_node<int const volatile*> > const&)" },
+    { "_ZNSaISt13_Rb_tree_nodeIPViEED2Ev",
+      "std::allocator<std::_Rb_tree_node<int volatile*> >::~allocator()" },
+    { "_ZNSaISt13_Rb_tree_nodeISt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEEC5Ev",
+      "std::allocator<std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::allocator()" },
+    { "_ZNSaISt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEC1ISt13_Rb_tree_nodeIS7_EEERKSaIT_E",
+      "std::allocator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::allocator<std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >(std::allocator<std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > const&)" },
+    { "_ZNSaISt6vectorINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EEEC1Ev",
+      "std::allocator<std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::allocator()" },
+    { "_ZNSaISt6vectorIbSaIbEEED5Ev",
+      "std::allocator<std::vector<bool, std::allocator<bool> > >::~allocator()" },
+    { "_ZNSaISt8multisetINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESt4lessIS5_ESaIS5_EEEC2Ev",
+      "std::allocator<std::multiset<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::less<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::allocator()" },
+    { "_ZNSaIcEC1Ev",
+      "std::allocator<char>::allocator()" },
+    { "_ZNSaIiEC1ISt10_List_nodeIiEEERKSaIT_E",
+      "std::allocator<int>::allocator<std::_List_node<int> >(std::allocator<std::_List_node<int> > const&)" },
+    { "_ZNSaIjEC2Ev",
+      "std::allocator<unsigned int>::allocator()" },
+    { "_ZNSaImED2Ev",
+      "std::allocator<unsigned long>::~allocator()" },
+    { "_ZNSo3putEc",
+      "std::basic_ostream<char, std::char_traits<char> >::put(char)" },
+    { "_ZNSt10_List_nodeIPKiE9_M_valptrEv",
+      "std::_List_node<int const*>::_M_valptr()" },
+    { "_ZNSt11_Deque_baseI13MovableStructSaIS0_EE11_Deque_implC2Ev",
+      "std::_Deque_base<MovableStruct, std::allocator<MovableStruct> >::_Deque_impl::_Deque_impl()" },
+    { "_ZNSt11_Deque_baseI13MovableStructSaIS0_EE19_M_get_Tp_allocatorEv",
+      "std::_Deque_base<MovableStruct, std::allocator<MovableStruct> >::_M_get_Tp_allocator()" },
+    { "_ZNSt11_Deque_baseI21CompleteMovableStructSaIS0_EE11_Deque_implD1Ev",
+      "std::_Deque_base<CompleteMovableStruct, std::allocator<CompleteMovableStruct> >::_Deque_impl::~_Deque_impl()" },
+    { "_ZNSt11_Deque_baseI21CompleteMovableStructSaIS0_EEC2ERKS1_m",
+      "std::_Deque_base<CompleteMovableStruct, std::allocator<CompleteMovableStruct> >::_Deque_base(std::allocator<CompleteMovableStruct> const&, unsigned long)" },
+    { "_ZNSt11_Deque_baseI3ObjSaIS0_EE15_M_allocate_mapEm",
+      "std::_Deque_base<Obj, std::allocator<Obj> >::_M_allocate_map(unsigned long)" },
+    { "_ZNSt11_Deque_baseI3ObjSaIS0_EEC5Ev",
+      "std::_Deque_base<Obj, std::allocator<Obj> >::_Deque_base()" },
+    { "_ZNSt11_Deque_baseINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EE16_M_destroy_nodesEPPS5_S9_",
+      "std::_Deque_base<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::_M_destroy_nodes(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >**, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >**)" },
+    { "_ZNSt11_Deque_baseIPKcSaIS1_EE11_Deque_implC5Ev",
+      "std::_Deque_base<char const*, std::allocator<char const*> >::_Deque_impl::_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIPKcSaIS1_EEC1Ev",
+      "std::_Deque_base<char const*, std::allocator<char const*> >::_Deque_base()" },
+    { "_ZNSt11_Deque_baseIPKiSaIS1_EE11_Deque_implD5Ev",
+      "std::_Deque_base<int const*, std::allocator<int const*> >::_Deque_impl::~_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIPKiSaIS1_EEC1ERKS2_m",
+      "std::_Deque_base<int const*, std::allocator<int const*> >::_Deque_base(std::allocator<int const*> const&, unsigned long)" },
+    { "_ZNSt11_Deque_baseIPVKiSaIS1_EE11_Deque_implD2Ev",
+      "std::_Deque_base<int const volatile*, std::allocator<int const volatile*> >::_Deque_impl::~_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIPVKiSaIS1_EE19_M_get_Tp_allocatorEv",
+      "std::_Deque_base<int const volatile*, std::allocator<int const volatile*> >::_M_get_Tp_allocator()" },
+    { "_ZNSt11_Deque_baseIPViSaIS1_EE11_Deque_implD1Ev",
+      "std::_Deque_base<int volatile*, std::allocator<int volatile*> >::_Deque_impl::~_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIPViSaIS1_EE18_M_deallocate_nodeEPS1_",
+      "std::_Deque_base<int volatile*, std::allocator<int volatile*> >::_M_deallocate_node(int volatile**)" },
+    { "_ZNSt11_Deque_baseIPiSaIS0_EE11_Deque_implC5Ev",
+      "std::_Deque_base<int*, std::allocator<int*> >::_Deque_impl::_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIPiSaIS0_EE17_M_initialize_mapEm",
+      "std::_Deque_base<int*, std::allocator<int*> >::_M_initialize_map(unsigned long)" },
+    { "_ZNSt11_Deque_baseIPvSaIS0_EE11_Deque_implC2Ev",
+      "std::_Deque_base<void*, std::allocator<void*> >::_Deque_impl::_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIPvSaIS0_EEC1Ev",
+      "std::_Deque_base<void*, std::allocator<void*> >::_Deque_base()" },
+    { "_ZNSt11_Deque_baseISt6vectorIiSaIiEESaIS2_EE16_Deque_impl_dataC5Ev",
+      "std::_Deque_base<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_Deque_impl_data::_Deque_impl_data()" },
+    { "_ZNSt11_Deque_baseIiSaIiEE11_Deque_implC2Ev",
+      "std::_Deque_base<int, std::allocator<int> >::_Deque_impl::_Deque_impl()" },
+    { "_ZNSt11_Deque_baseIiSaIiEE19_M_get_Tp_allocatorEv",
+      "std::_Deque_base<int, std::allocator<int> >::_M_get_Tp_allocator()" },
+    { "_ZNSt11__alloc_neqISaISt10_List_nodeIPViEELb1EE8_S_do_itERKS4_S7_",
+      "std::__alloc_neq<std::allocator<std::_List_node<int volatile*> >, true>::_S_do_it(std::allocator<std::_List_node<int volatile*> > const&, std::allocator<std::_List_node<int volatile*> > const&)" },
+    { "_ZNSt11__copy_moveILb0ELb0ESt26random_access_iterator_tagE8__copy_mIPPKcSt15insert_iteratorISt5dequeIS4_SaIS4_EEEEET0_T_SC_SB_",
+      "std::insert_iterator<std::deque<char const*, std::allocator<char const*> > > std::__copy_move<false, false, std::random_access_iterator_tag>::__copy_m<char const**, std::insert_iterator<std::deque<char const*, std::allocator<char const*> > > >(char const**, char const**, std::insert_iterator<std::deque<char const*, std::allocator<char const*> > >)" },
+    { "_ZNSt11__copy_moveILb0ELb0ESt26random_access_iterator_tagE8__copy_mIPiSt16ostream_iteratorIicSt11char_traitsIcEEEET0_T_S9_S8_",
+      "std::ostream_iterator<int, char, std::char_traits<char> > std::__copy_move<false, false, std::random_access_iterator_tag>::__copy_m<int*, std::ostream_iterator<int, char, std::char_traits<char> > >(int*, int*, std::ostream_iterator<int, char, std::char_traits<char> >)" },
+    { "_ZNSt11__copy_moveILb0ELb1ESt26random_access_iterator_tagE8__copy_mIPPVKiEEPT_PKS6_S9_S7_",
+      "int const volatile*** std::__copy_move<false, true, std::random_access_iterator_tag>::__copy_m<int const volatile**>(int const volatile** const*, int const volatile** const*, int const volatile***)" },
+    { "_ZNSt11__iter_swapILb1EE9iter_swapIN9__gnu_cxx17__normal_iteratorIPcSt6vectorIcSaIcEEEES8_EEvT_T0_",
+      "void std::__iter_swap<true>::iter_swap<__gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > >, __gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > > >(__gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > >, __gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > >)" },
+    { "_ZNSt11char_traitsIcE6assignERcRKc",
+      "std::char_traits<char>::assign(char&, char const&)" },
+    { "_ZNSt12_Base_bitsetILm1EE16_M_do_left_shiftEm",
+      "std::_Base_bitset<1ul>::_M_do_left_shift(unsigned long)" },
+    { "_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIbSaIbEEEEvT_S6_",
+      "void std::_Destroy_aux<false>::__destroy<std::vector<bool, std::allocator<bool> >*>(std::vector<bool, std::allocator<bool> >*, std::vector<bool, std::allocator<bool> >*)" },
+    { "_ZNSt12_Destroy_auxILb1EE9__destroyIP20NotTrivialCopyStructEEvT_S4_",
+      "void std::_Destroy_aux<true>::__destroy<NotTrivialCopyStruct*>(NotTrivialCopyStruct*, NotTrivialCopyStruct*)" },
+    { "_ZNSt12_Destroy_auxILb1EE9__destroyIPPvEEvT_S4_",
+      "void std::_Destroy_aux<true>::__destroy<void**>(void**, void**)" },
+    { "_ZNSt12_Vector_baseI13MovableStructSaIS0_EE12_Vector_implC1Ev",
+      "std::_Vector_base<MovableStruct, std::allocator<MovableStruct> >::_Vector_impl::_Vector_impl()" },
+    { "_ZNSt12_Vector_baseI13MovableStructSaIS0_EEC2EmRKS1_",
+      "std::_Vector_base<MovableStruct, std::allocator<MovableStruct> >::_Vector_base(unsigned long, std::allocator<MovableStruct> const&)" },
+    { "_ZNSt12_Vector_baseI15MyIntComparableSaIS0_EE17_Vector_impl_dataC2Ev",
+      "std::_Vector_base<MyIntComparable, std::allocator<MyIntComparable> >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseI17TrivialInitStructSaIS0_EE13_M_deallocateEPS0_m",
+      "std::_Vector_base<TrivialInitStruct, std::allocator<TrivialInitStruct> >::_M_deallocate(TrivialInitStruct*, unsigned long)" },
+    { "_ZNSt12_Vector_baseI1VSaIS0_EE12_Vector_implD1Ev",
+      "std::_Vector_base<V, std::allocator<V> >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseI20NotTrivialCopyStructSaIS0_EE12_Vector_implC2ERKS1_",
+      "std::_Vector_base<NotTrivialCopyStruct, std::allocator<NotTrivialCopyStruct> >::_Vector_impl::_Vector_impl(std::allocator<NotTrivialCopyStruct> const&)" },
+    { "_ZNSt12_Vector_baseI20NotTrivialCopyStructSaIS0_EED5Ev",
+      "std::_Vector_base<NotTrivialCopyStruct, std::allocator<NotTrivialCopyStruct> >::~_Vector_base()" },
+    { "_ZNSt12_Vector_baseI21CompleteMovableStructSaIS0_EE19_M_get_Tp_allocatorEv",
+      "std::_Vector_base<CompleteMovableStruct, std::allocator<CompleteMovableStruct> >::_M_get_Tp_allocator()" },
+    { "_ZNSt12_Vector_baseI3ObjSaIS0_EE12_Vector_implD5Ev",
+      "std::_Vector_base<Obj, std::allocator<Obj> >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseI4TestSaIS0_EE12_Vector_implC2Ev",
+      "std::_Vector_base<Test, std::allocator<Test> >::_Vector_impl::_Vector_impl()" },
+    { "_ZNSt12_Vector_baseIM6AClassFvvESaIS2_EE11_M_allocateEm",
+      "std::_Vector_base<void (AClass::*)(), std::allocator<void (AClass::*)()> >::_M_allocate(unsigned long)" },
+    { "_ZNSt12_Vector_baseIM6AClassFvvESaIS2_EED2Ev",
+      "std::_Vector_base<void (AClass::*)(), std::allocator<void (AClass::*)()> >::~_Vector_base()" },
+    { "_ZNSt12_Vector_baseINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EE17_Vector_impl_dataC5Ev",
+      "std::_Vector_base<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseINSt7__cxx114listINS0_12basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EEESaIS8_EED5Ev",
+      "std::_Vector_base<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::~_Vector_base()" },
+    { "_ZNSt12_Vector_baseIP12PasswordFormSaIS1_EED1Ev",
+      "std::_Vector_base<PasswordForm*, std::allocator<PasswordForm*> >::~_Vector_base()" },
+    { "_ZNSt12_Vector_baseIP4baseSaIS1_EEC2ERKS2_",
+      "std::_Vector_base<base*, std::allocator<base*> >::_Vector_base(std::allocator<base*> const&)" },
+    { "_ZNSt12_Vector_baseIP7derivedSaIS1_EE17_Vector_impl_dataC5Ev",
+      "std::_Vector_base<derived*, std::allocator<derived*> >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseIPFviESaIS1_EE17_Vector_impl_dataC1Ev",
+      "std::_Vector_base<void (*)(int), std::allocator<void (*)(int)> >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseIPFvvESaIS1_EE12_Vector_implD5Ev",
+      "std::_Vector_base<void (*)(), std::allocator<void (*)()> >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseIPKcSaIS1_EE12_Vector_implC2Ev",
+      "std::_Vector_base<char const*, std::allocator<char const*> >::_Vector_impl::_Vector_impl()" },
+    { "_ZNSt12_Vector_baseIPKcSaIS1_EEC5EmRKS2_",
+      "std::_Vector_base<char const*, std::allocator<char const*> >::_Vector_base(unsigned long, std::allocator<char const*> const&)" },
+    { "_ZNSt12_Vector_baseIPKiSaIS1_EE17_M_create_storageEm",
+      "std::_Vector_base<int const*, std::allocator<int const*> >::_M_create_storage(unsigned long)" },
+    { "_ZNSt12_Vector_baseIPKiSaIS1_EED1Ev",
+      "std::_Vector_base<int const*, std::allocator<int const*> >::~_Vector_base()" },
+    { "_ZNSt12_Vector_baseIPSt6vectorIfSaIfEESaIS3_EEC1ERKS4_",
+      "std::_Vector_base<std::vector<float, std::allocator<float> >*, std::allocator<std::vector<float, std::allocator<float> >*> >::_Vector_base(std::allocator<std::vector<float, std::allocator<float> >*> const&)" },
+    { "_ZNSt12_Vector_baseIPVKiSaIS1_EE12_Vector_implD1Ev",
+      "std::_Vector_base<int const volatile*, std::allocator<int const volatile*> >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseIPVKiSaIS1_EEC2Ev",
+      "std::_Vector_base<int const volatile*, std::allocator<int const volatile*> >::_Vector_base()" },
+    { "_ZNSt12_Vector_baseIPViSaIS1_EE12_Vector_implD5Ev",
+      "std::_Vector_base<int volatile*, std::allocator<int volatile*> >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseIPViSaIS1_EEC5EmRKS2_",
+      "std::_Vector_base<int volatile*, std::allocator<int volatile*> >::_Vector_base(unsigned long, std::allocator<int volatile*> const&)" },
+    { "_ZNSt12_Vector_baseIPiSaIS0_EE17_M_create_storageEm",
+      "std::_Vector_base<int*, std::allocator<int*> >::_M_create_storage(unsigned long)" },
+    { "_ZNSt12_Vector_baseIPiSaIS0_EED1Ev",
+      "std::_Vector_base<int*, std::allocator<int*> >::~_Vector_base()" },
+    { "_ZNSt12_Vector_baseIPvSaIS0_EEC5Ev",
+      "std::_Vector_base<void*, std::allocator<void*> >::_Vector_base()" },
+    { "_ZNSt12_Vector_baseISt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EESaIS8_EE19_M_get_Tp_allocatorEv",
+      "std::_Vector_base<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::_M_get_Tp_allocator()" },
+    { "_ZNSt12_Vector_baseISt6vectorINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EESaIS8_EE17_Vector_impl_dataC1Ev",
+      "std::_Vector_base<std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseISt6vectorIbSaIbEESaIS2_EE12_Vector_implD5Ev",
+      "std::_Vector_base<std::vector<bool, std::allocator<bool> >, std::allocator<std::vector<bool, std::allocator<bool> > > >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseISt6vectorIiSaIiEESaIS2_EE12_Vector_implC2ERKS3_",
+      "std::_Vector_base<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_Vector_impl::_Vector_impl(std::allocator<std::vector<int, std::allocator<int> > > const&)" },
+    { "_ZNSt12_Vector_baseISt6vectorIiSaIiEESaIS2_EEC1Ev",
+      "std::_Vector_base<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_Vector_base()" },
+    { "_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC5ERKS0_",
+      "std::_Vector_base<char, std::allocator<char> >::_Vector_impl::_Vector_impl(std::allocator<char> const&)" },
+    { "_ZNSt12_Vector_baseIcSaIcEEC2Ev",
+      "std::_Vector_base<char, std::allocator<char> >::_Vector_base()" },
+    { "_ZNSt12_Vector_baseIfSaIfEE17_Vector_impl_dataC2Ev",
+      "std::_Vector_base<float, std::allocator<float> >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseIiSaIiEE12_Vector_implD1Ev",
+      "std::_Vector_base<int, std::allocator<int> >::_Vector_impl::~_Vector_impl()" },
+    { "_ZNSt12_Vector_baseIiSaIiEEC2Ev",
+      "std::_Vector_base<int, std::allocator<int> >::_Vector_base()" },
+    { "_ZNSt12_Vector_baseIjSaIjEE17_Vector_impl_dataC2Ev",
+      "std::_Vector_base<unsigned int, std::allocator<unsigned int> >::_Vector_impl_data::_Vector_impl_data()" },
+    { "_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm",
+      "std::_Vector_base<unsigned long, std::allocator<unsigned long> >::_M_deallocate(unsigned long*, unsigned long)" },
+    { "_ZNSt12__alloc_swapISaIPiELb1EE8_S_do_itERS1_S3_",
+      "std::__alloc_swap<std::allocator<int*>, true>::_S_do_it(std::allocator<int*>&, std::allocator<int*>&)" },
+    { "_ZNSt12__basic_fileIcE9showmanycEv",
+      "std::__basic_file<char>::showmanyc()" },
+    { "_ZNSt12unary_negateISt25pointer_to_unary_functionIibEEC5ERKS1_",
+      "std::unary_negate<std::pointer_to_unary_function<int, bool> >::unary_negate(std::pointer_to_unary_function<int, bool> const&)" },
+    { "_ZNSt13_Bvector_baseISaIbEE13_Bvector_implC2Ev",
+      "std::_Bvector_base<std::allocator<bool> >::_Bvector_impl::_Bvector_impl()" },
+    { "_ZNSt13_Bvector_baseISaIbEEC5ERKS0_",
+      "std::_Bvector_base<std::allocator<bool> >::_Bvector_base(std::allocator<bool> const&)" },
+    { "_ZNSt13bad_exceptionD1Ev",
+      "std::bad_exception::~bad_exception()" },
+    { "_ZNSt13basic_filebufIc9my_traitsE7_M_seekElSt12_Ios_Seekdir8my_state",
+      "std::basic_filebuf<char, my_traits>::_M_seek(long, std::_Ios_Seekdir, my_state)" },
+    { "_ZNSt13basic_fstreamIcSt11char_traitsIcEED1Ev",
+      "std::basic_fstream<char, std::char_traits<char> >::~basic_fstream()" },
+    { "_ZNSt13mem_fun_ref_tIv5ClassEC2EMS0_FvvE",
+      "std::mem_fun_ref_t<void, Class>::mem_fun_ref_t(void (Class::*)())" },
+    { "_ZNSt14_List_iteratorI20NotTrivialCopyStructEC5EPNSt8__detail15_List_node_baseE",
+      "std::_List_iterator<NotTrivialCopyStruct>::_List_iterator(std::__detail::_List_node_base*)" },
+    { "_ZNSt14_List_iteratorIPViEC1EPNSt8__detail15_List_node_baseE",
+      "std::_List_iterator<int volatile*>::_List_iterator(std::__detail::_List_node_base*)" },
+    { "_ZNSt14_List_iteratorIiEmmEv",
+      "std::_List_iterator<int>::operator--()" },
+    { "_ZNSt14basic_ofstreamIwSt11char_traitsIwEEC1EPKcSt13_Ios_Openmode",
+      "std::basic_ofstream<wchar_t, std::char_traits<wchar_t> >::basic_ofstream(char const*, std::_Ios_Openmode)" },
+    { "_ZNSt14numeric_limitsIaE3minEv",
+      "std::numeric_limits<signed char>::min()" },
+    { "_ZNSt14numeric_limitsIdE13has_quiet_NaNE",
+      "std::numeric_limits<double>::has_quiet_NaN" },
+    { "_ZNSt14numeric_limitsIeE7epsilonEv",
+      "std::numeric_limits<long double>::epsilon()" },
+    { "_ZNSt14numeric_limitsIhE14is_specializedE",
+      "std::numeric_limits<unsigned char>::is_specialized" },
+    { "_ZNSt14numeric_limitsIjE8is_exactE",
+      "std::numeric_limits<unsigned int>::is_exact" },
+    { "_ZNSt14numeric_limitsIsE14is_specializedE",
+      "std::numeric_limits<short>::is_specialized" },
+    { "_ZNSt14priority_queueIiSt5dequeIiSaIiEESt4lessIiEED1Ev",
+      "std::priority_queue<int, std::deque<int, std::allocator<int> >, std::less<int> >::~priority_queue()" },
+    { "_ZNSt15_Deque_iteratorI13MovableStructRS0_PS0_EC2Ev",
+      "std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>::_Deque_iterator()" },
+    { "_ZNSt15_Deque_iteratorI21CompleteMovableStructRS0_PS0_EC1ES2_PS2_",
+      "std::_Deque_iterator<CompleteMovableStruct, CompleteMovableStruct&, CompleteMovableStruct*>::_Deque_iterator(CompleteMovableStruct*, CompleteMovableStruct**)" },
+    { "_ZNSt15_Deque_iteratorI3ObjRKS0_PS1_EpLEl",
+      "std::_Deque_iterator<Obj, Obj const&, Obj const*>::operator+=(long)" },
+    { "_ZNSt15_Deque_iteratorINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEERS5_PS5_EmIEl",
+      "std::_Deque_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >&, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>::operator-=(long)" },
+    { "_ZNSt15_Deque_iteratorIPKcRS1_PS1_EpLEl",
+      "std::_Deque_iterator<char const*, char const*&, char const**>::operator+=(long)" },
+    { "_ZNSt15_Deque_iteratorIPKiRS1_PS1_EC2Ev",
+      "std::_Deque_iterator<int const*, int const*&, int const**>::_Deque_iterator()" },
+    { "_ZNSt15_Deque_iteratorIPVKiRS1_PS1_E14_S_buffer_sizeEv",
+      "std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>::_S_buffer_size()" },
+    { "_ZNSt15_Deque_iteratorIPViRKS1_PS2_EC1ERKS_IS1_RS1_PS1_E",
+      "std::_Deque_iterator<int volatile*, int volatile* const&, int volatile* const*>::_Deque_iterator(std::_Deque_iterator<int volatile*, int volatile*&, int volatile**> const&)" },
+    { "_ZNSt15_Deque_iteratorIPViRS1_PS1_EmIEl",
+      "std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>::operator-=(long)" },
+    { "_ZNSt15_Deque_iteratorIPiRS0_PS0_EC2ERKS3_",
+      "std::_Deque_iterator<int*, int*&, int**>::_Deque_iterator(std::_Deque_iterator<int*, int*&, int**> const&)" },
+    { "_ZNSt15_Deque_iteratorIPvRS0_PS0_EC5ERKS3_",
+      "std::_Deque_iterator<void*, void*&, void**>::_Deque_iterator(std::_Deque_iterator<void*, void*&, void**> const&)" },
+    { "_ZNSt15_Deque_iteratorISt6vectorIiSaIiEERS2_PS2_EppEv",
+      "std::_Deque_iterator<std::vector<int, std::allocator<int> >, std::vector<int, std::allocator<int> >&, std::vector<int, std::allocator<int> >*>::operator++()" },
+    { "_ZNSt15_Deque_iteratorIiRiPiEmIEl",
+      "std::_Deque_iterator<int, int&, int*>::operator-=(long)" },
+    { "_ZNSt15__new_allocatorI13MovableStructEC2ERKS1_",
+      "std::__new_allocator<MovableStruct>::__new_allocator(std::__new_allocator<MovableStruct> const&)" },
+    { "_ZNSt15__new_allocatorI15MyIntComparableED5Ev",
+      "std::__new_allocator<MyIntComparable>::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorI1VEC1Ev",
+      "std::__new_allocator<V>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorI20NotTrivialCopyStructE8allocateEmPKv",
+      "std::__new_allocator<NotTrivialCopyStruct>::allocate(unsigned long, void const*)" },
+    { "_ZNSt15__new_allocatorI21CompleteMovableStructEC1Ev",
+      "std::__new_allocator<CompleteMovableStruct>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorI3ObjEC5ERKS1_",
+      "std::__new_allocator<Obj>::__new_allocator(std::__new_allocator<Obj> const&)" },
+    { "_ZNSt15__new_allocatorI9BigStructE8allocateEmPKv",
+      "std::__new_allocator<BigStruct>::allocate(unsigned long, void const*)" },
+    { "_ZNSt15__new_allocatorIM6AClassFvvEED5Ev",
+      "std::__new_allocator<void (AClass::*)()>::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorINSt7__cxx114listINS0_12basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EEEE8allocateEmPKv",
+      "std::__new_allocator<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::allocate(unsigned long, void const*)" },
+    { "_ZNSt15__new_allocatorIP12PasswordFormEC5Ev",
+      "std::__new_allocator<PasswordForm*>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorIP21CompleteMovableStructEC5Ev",
+      "std::__new_allocator<CompleteMovableStruct*>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorIP4baseEC2ERKS2_",
+      "std::__new_allocator<base*>::__new_allocator(std::__new_allocator<base*> const&)" },
+    { "_ZNSt15__new_allocatorIP7derivedED2Ev",
+      "std::__new_allocator<derived*>::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorIPFvvEEC1Ev",
+      "std::__new_allocator<void (*)()>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorIPKcED1Ev",
+      "std::__new_allocator<char const*>::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE10deallocateEPS6_m",
+      "std::__new_allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>::deallocate(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >**, unsigned long)" },
+    { "_ZNSt15__new_allocatorIPPKiE10deallocateEPS2_m",
+      "std::__new_allocator<int const**>::deallocate(int const***, unsigned long)" },
+    { "_ZNSt15__new_allocatorIPPViE10deallocateEPS2_m",
+      "std::__new_allocator<int volatile**>::deallocate(int volatile***, unsigned long)" },
+    { "_ZNSt15__new_allocatorIPPvE10deallocateEPS1_m",
+      "std::__new_allocator<void**>::deallocate(void***, unsigned long)" },
+    { "_ZNSt15__new_allocatorIPSt6vectorIfSaIfEEED1Ev",
+      "std::__new_allocator<std::vector<float, std::allocator<float> >*>::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorIPVKiEC1Ev",
+      "std::__new_allocator<int const volatile*>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorIPViEC5ERKS2_",
+      "std::__new_allocator<int volatile*>::__new_allocator(std::__new_allocator<int volatile*> const&)" },
+    { "_ZNSt15__new_allocatorIPiED2Ev",
+      "std::__new_allocator<int*>::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt10_List_nodeI20NotTrivialCopyStructEEC2Ev",
+      "std::__new_allocator<std::_List_node<NotTrivialCopyStruct> >::__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt10_List_nodeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEED5Ev",
+      "std::__new_allocator<std::_List_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt10_List_nodeIPVKiEEC2ERKS4_",
+      "std::__new_allocator<std::_List_node<int const volatile*> >::__new_allocator(std::__new_allocator<std::_List_node<int const volatile*> > const&)" },
+    { "_ZNSt15__new_allocatorISt10_List_nodeIPViEED2Ev",
+      "std::__new_allocator<std::_List_node<int volatile*> >::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt10_List_nodeIPvEEC5Ev",
+      "std::__new_allocator<std::_List_node<void*> >::__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt10_List_nodeIiEE8allocateEmPKv",
+      "std::__new_allocator<std::_List_node<int> >::allocate(unsigned long, void const*)" },
+    { "_ZNSt15__new_allocatorISt13_Rb_tree_nodeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEC5ERKS8_",
+      "std::__new_allocator<std::_Rb_tree_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::__new_allocator(std::__new_allocator<std::_Rb_tree_node<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > const&)" },
+    { "_ZNSt15__new_allocatorISt13_Rb_tree_nodeIPKiEE8allocateEmPKv",
+      "std::__new_allocator<std::_Rb_tree_node<int const*> >::allocate(unsigned long, void const*)" },
+    { "_ZNSt15__new_allocatorISt13_Rb_tree_nodeIPVKiEEC5ERKS4_",
+      "std::__new_allocator<std::_Rb_tree_node<int const volatile*> >::__new_allocator(std::__new_allocator<std::_Rb_tree_node<int const volatile*> > const&)" },
+    { "_ZNSt15__new_allocatorISt13_Rb_tree_nodeIPiEE10deallocateEPS2_m",
+      "std::__new_allocator<std::_Rb_tree_node<int*> >::deallocate(std::_Rb_tree_node<int*>*, unsigned long)" },
+    { "_ZNSt15__new_allocatorISt13_Rb_tree_nodeISt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEED1Ev",
+      "std::__new_allocator<std::_Rb_tree_node<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEEC1Ev",
+      "std::__new_allocator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EEED2Ev",
+      "std::__new_allocator<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::~__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt6vectorIbSaIbEEE8allocateEmPKv",
+      "std::__new_allocator<std::vector<bool, std::allocator<bool> > >::allocate(unsigned long, void const*)" },
+    { "_ZNSt15__new_allocatorISt6vectorIiSaIiEEEC1Ev",
+      "std::__new_allocator<std::vector<int, std::allocator<int> > >::__new_allocator()" },
+    { "_ZNSt15__new_allocatorISt8multisetINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESt4lessIS6_ESaIS6_EEEC5Ev",
+      "std::__new_allocator<std::multiset<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::less<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::__new_allocator()" },
+    { "_ZNSt15__new_allocatorIfEC1ERKS0_",
+      "std::__new_allocator<float>::__new_allocator(std::__new_allocator<float> const&)" },
+    { "_ZNSt15__new_allocatorIiEC2Ev",
+      "std::__new_allocator<int>::__new_allocator()" },
+    { "_ZNSt15__new_allocatorIjED5Ev",
+      "std::__new_allocator<unsigned int>::~__new_allocator()" },
+    { "_ZNSt15basic_streambufIc9my_traitsE4syncEv",
+      "std::basic_streambuf<char, my_traits>::sync()" },
+    { "_ZNSt15basic_streambufIc9my_traitsEC2Ev",
+      "std::basic_streambuf<char, my_traits>::basic_streambuf()" },
+    { "_ZNSt15basic_streambufIcSt11char_traitsIcEE7seekoffElSt12_Ios_SeekdirSt13_Ios_Openmode",
+      "std::basic_streambuf<char, std::char_traits<char> >::seekoff(long, std::_Ios_Seekdir, std::_Ios_Openmode)" },
+    { "_ZNSt15const_mem_fun_tIi5ClassEC5EMS0_KFivE",
+      "std::const_mem_fun_t<int, Class>::const_mem_fun_t(int (Class::*)() const)" },
+    { "_ZNSt15insert_iteratorISt5dequeIPKcSaIS2_EEEaSERKS2_",
+      "std::insert_iterator<std::deque<char const*, std::allocator<char const*> > >::operator=(char const* const&)" },
+    { "_ZNSt16allocator_traitsISaIP12PasswordFormEE9constructIS1_JRKS1_EEEvRS2_PT_DpOT0_",
+      "void std::allocator_traits<std::allocator<PasswordForm*> >::construct<PasswordForm*, PasswordForm* const&>(std::allocator<PasswordForm*>&, PasswordForm**, PasswordForm* const&)" },
+    { "_ZNSt16istream_iteratorIccSt11char_traitsIcElEC2ERSi",
+      "std::istream_iterator<char, char, std::char_traits<char>, long>::istream_iterator(std::basic_istream<char, std::char_traits<char> >&)" },
+    { "_ZNSt16ostream_iteratorIicSt11char_traitsIcEEC1ERSo",
+      "std::ostream_iterator<int, char, std::char_traits<char> >::ostream_iterator(std::basic_ostream<char, std::char_traits<char> >&)" },
+    { "_ZNSt16reverse_iteratorIN9__gnu_cxx17__normal_iteratorIPKPViSt6vectorIS3_SaIS3_EEEEEC5ES9_",
+      "std::reverse_iterator<__gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > > >::reverse_iterator(__gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >)" },
+    { "_ZNSt16reverse_iteratorIN9__gnu_cxx17__normal_iteratorIPPVKiSt6vectorIS3_SaIS3_EEEEEC5ES8_",
+      "std::reverse_iterator<__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > > >::reverse_iterator(__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >)" },
+    { "_ZNSt16reverse_iteratorIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEEEmmEi",
+      "std::reverse_iterator<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > > >::operator--(int)" },
+    { "_ZNSt16reverse_iteratorISt14_List_iteratorIiEEC2ERKS2_",
+      "std::reverse_iterator<std::_List_iterator<int> >::reverse_iterator(std::reverse_iterator<std::_List_iterator<int> > const&)" },
+    { "_ZNSt16reverse_iteratorISt15_Deque_iteratorIPVKiRS2_PS2_EEC5ES5_",
+      "std::reverse_iterator<std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**> >::reverse_iterator(std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>)" },
+    { "_ZNSt16reverse_iteratorISt20_List_const_iteratorIPVKiEEC1ES3_",
+      "std::reverse_iterator<std::_List_const_iterator<int const volatile*> >::reverse_iterator(std::_List_const_iterator<int const volatile*>)" },
+    { "_ZNSt16reverse_iteratorISt23_Rb_tree_const_iteratorIPViEEC2ES3_",
+      "std::reverse_iterator<std::_Rb_tree_const_iterator<int volatile*> >::reverse_iterator(std::_Rb_tree_const_iterator<int volatile*>)" },
+    { "_ZNSt17_Rb_tree_iteratorIPKiEmmEv",
+      "std::_Rb_tree_iterator<int const*>::operator--()" },
+    { "_ZNSt17_Rb_tree_iteratorIPiEppEv",
+      "std::_Rb_tree_iterator<int*>::operator++()" },
+    { "_ZNSt17_Temporary_bufferIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEEiED2Ev",
+      "std::_Temporary_buffer<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, int>::~_Temporary_buffer()" },
+    { "_ZNSt17_Temporary_bufferIPPKcS1_E5beginEv",
+      "std::_Temporary_buffer<char const**, char const*>::begin()" },
+    { "_ZNSt18_Bit_iterator_base7_M_incrEl",
+      "std::_Bit_iterator_base::_M_incr(long)" },
+    { "_ZNSt19const_mem_fun_ref_tIv5ClassEC1EMS0_KFvvE",
+      "std::const_mem_fun_ref_t<void, Class>::const_mem_fun_ref_t(void (Class::*)() const)" },
+    { "_ZNSt19istreambuf_iteratorIwSt11char_traitsIwEEC1Ev",
+      "std::istreambuf_iterator<wchar_t, std::char_traits<wchar_t> >::istreambuf_iterator()" },
+    { "_ZNSt20_List_const_iteratorIPKiEC1EPKNSt8__detail15_List_node_baseE",
+      "std::_List_const_iterator<int const*>::_List_const_iterator(std::__detail::_List_node_base const*)" },
+    { "_ZNSt20_List_const_iteratorIPVKiEC2Ev",
+      "std::_List_const_iterator<int const volatile*>::_List_const_iterator()" },
+    { "_ZNSt20_List_const_iteratorIPViEppEv",
+      "std::_List_const_iterator<int volatile*>::operator++()" },
+    { "_ZNSt20_Rb_tree_key_compareISt26pointer_to_binary_functionIiibEEC1ERKS1_",
+      "std::_Rb_tree_key_compare<std::pointer_to_binary_function<int, int, bool> >::_Rb_tree_key_compare(std::pointer_to_binary_function<int, int, bool> const&)" },
+    { "_ZNSt20_Rb_tree_key_compareISt4lessIPKiEEC5ERKS3_",
+      "std::_Rb_tree_key_compare<std::less<int const*> >::_Rb_tree_key_compare(std::less<int const*> const&)" },
+    { "_ZNSt20_Rb_tree_key_compareISt4lessIPiEEC2ERKS2_",
+      "std::_Rb_tree_key_compare<std::less<int*> >::_Rb_tree_key_compare(std::less<int*> const&)" },
+    { "_ZNSt20__copy_move_backwardILb0ELb1ESt26random_access_iterator_tagE13__copy_move_bIP21CompleteMovableStructEEPT_PKS5_S8_S6_",
+      "CompleteMovableStruct** std::__copy_move_backward<false, true, std::random_access_iterator_tag>::__copy_move_b<CompleteMovableStruct*>(CompleteMovableStruct* const*, CompleteMovableStruct* const*, CompleteMovableStruct**)" },
+    { "_ZNSt20__copy_move_backwardILb0ELb1ESt26random_access_iterator_tagE13__copy_move_bImEEPT_PKS3_S6_S4_",
+      "unsigned long* std::__copy_move_backward<false, true, std::random_access_iterator_tag>::__copy_move_b<unsigned long>(unsigned long const*, unsigned long const*, unsigned long*)" },
+    { "_ZNSt20__uninitialized_copyILb0EE13__uninit_copyIP4TestS3_EET0_T_S5_S4_",
+      "Test* std::__uninitialized_copy<false>::__uninit_copy<Test*, Test*>(Test*, Test*, Test*)" },
+    { "_ZNSt20__uninitialized_copyILb1EE13__uninit_copyIN9__gnu_cxx17__normal_iteratorIPKPViSt6vectorIS5_SaIS5_EEEEPS5_EET0_T_SE_SD_",
+      "int volatile** std::__uninitialized_copy<true>::__uninit_copy<__gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >, int volatile**>(__gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >, __gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >, int volatile**)" },
+    { "_ZNSt20__uninitialized_copyILb1EE13__uninit_copyIPPFvvES4_EET0_T_S6_S5_",
+      "void (**std::__uninitialized_copy<true>::__uninit_copy<void (**)(), void (**)()>(void (**)(), void (**)(), void (**)()))()" },
+    { "_ZNSt20__uninitialized_copyILb1EE13__uninit_copyISt15_Deque_iteratorIPKiRKS4_PS5_ES2_IS4_RS4_PS4_EEET0_T_SD_SC_",
+      "std::_Deque_iterator<int const*, int const*&, int const**> std::__uninitialized_copy<true>::__uninit_copy<std::_Deque_iterator<int const*, int const* const&, int const* const*>, std::_Deque_iterator<int const*, int const*&, int const**> >(std::_Deque_iterator<int const*, int const* const&, int const* const*>, std::_Deque_iterator<int const*, int const* const&, int const* const*>, std::_Deque_iterator<int const*, int const*&, int const**>)" },
+    { "_ZNSt20__uninitialized_fillILb1EE13__uninit_fillISt15_Deque_iteratorIPKiRS4_PS4_ES4_EEvT_S8_RKT0_",
+      "void std::__uninitialized_fill<true>::__uninit_fill<std::_Deque_iterator<int const*, int const*&, int const**>, int const*>(std::_Deque_iterator<int const*, int const*&, int const**>, std::_Deque_iterator<int const*, int const*&, int const**>, int const* const&)" },
+    { "_ZNSt20back_insert_iteratorISt5dequeIPiSaIS1_EEEC1ERS3_",
+      "std::back_insert_iterator<std::deque<int*, std::allocator<int*> > >::back_insert_iterator(std::deque<int*, std::allocator<int*> >&)" },
+    { "_ZNSt20back_insert_iteratorISt6vectorIPiSaIS1_EEEdeEv",
+      "std::back_insert_iterator<std::vector<int*, std::allocator<int*> > >::operator*()" },
+    { "_ZNSt20const_mem_fun1_ref_tIv5ClassRK2S1EC5EMS0_KFvS3_E",
+      "std::const_mem_fun1_ref_t<void, Class, S1 const&>::const_mem_fun1_ref_t(void (Class::*)(S1 const&) const)" },
+    { "_ZNSt23_Rb_tree_const_iteratorINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC1EPKSt18_Rb_tree_node_base",
+      "std::_Rb_tree_const_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >::_Rb_tree_const_iterator(std::_Rb_tree_node_base const*)" },
+    { "_ZNSt23_Rb_tree_const_iteratorIPKiEC2ERKSt17_Rb_tree_iteratorIS1_E",
+      "std::_Rb_tree_const_iterator<int const*>::_Rb_tree_const_iterator(std::_Rb_tree_iterator<int const*> const&)" },
+    { "_ZNSt23_Rb_tree_const_iteratorIPViEC2ERKSt17_Rb_tree_iteratorIS1_E",
+      "std::_Rb_tree_const_iterator<int volatile*>::_Rb_tree_const_iterator(std::_Rb_tree_iterator<int volatile*> const&)" },
+    { "_ZNSt23_Rb_tree_const_iteratorIiEC1EPKSt18_Rb_tree_node_base",
+      "std::_Rb_tree_const_iterator<int>::_Rb_tree_const_iterator(std::_Rb_tree_node_base const*)" },
+    { "_ZNSt25pointer_to_unary_functionIR2S1vEC2EPFvS1_E",
+      "std::pointer_to_unary_function<S1&, void>::pointer_to_unary_function(void (*)(S1&))" },
+    { "_ZNSt26pointer_to_binary_functionIR2S1R2S2iEC5EPFiS1_S3_E",
+      "std::pointer_to_binary_function<S1&, S2&, int>::pointer_to_binary_function(int (*)(S1&, S2&))" },
+    { "_ZNSt38__uninitialized_construct_buf_dispatchILb0EE5__ucrIP4DataS3_EEvT_S4_T0_",
+      "void std::__uninitialized_construct_buf_dispatch<false>::__ucr<Data*, Data*>(Data*, Data*, Data*)" },
+    { "_ZNSt3mapIiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESt4lessIiESaISt4pairIKiS5_EEE3endEv",
+      "std::map<int, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::less<int>, std::allocator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::end()" },
+    { "_ZNSt3setIPK12PasswordFormSt4lessIS2_ESaIS2_EED5Ev",
+      "std::set<PasswordForm const*, std::less<PasswordForm const*>, std::allocator<PasswordForm const*> >::~set()" },
+    { "_ZNSt3setIPKiSt4lessIS1_ESaIS1_EEC2ERKS5_",
+      "std::set<int const*, std::less<int const*>, std::allocator<int const*> >::set(std::set<int const*, std::less<int const*>, std::allocator<int const*> > const&)" },
+    { "_ZNSt3setIPVKiSt4lessIS1_ESaIS1_EE6insertESt23_Rb_tree_const_iteratorIS1_ERKS1_",
+      "std::set<int const volatile*, std::less<int const volatile*>, std::allocator<int const volatile*> >::insert(std::_Rb_tree_const_iterator<int const volatile*>, int const volatile* const&)" },
+    { "_ZNSt3setIPViSt4lessIS1_ESaIS1_EE5clearEv",
+      "std::set<int volatile*, std::less<int volatile*>, std::allocator<int volatile*> >::clear()" },
+    { "_ZNSt3setIPiSt4lessIS0_ESaIS0_EE11equal_rangeERKS0_",
+      "std::set<int*, std::less<int*>, std::allocator<int*> >::equal_range(int* const&)" },
+    { "_ZNSt3setIPiSt4lessIS0_ESaIS0_EEC2Ev",
+      "std::set<int*, std::less<int*>, std::allocator<int*> >::set()" },
+    { "_ZNSt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC2ERS0_RKS6_",
+      "std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >::pair(int const&, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&)" },
+    { "_ZNSt4pairIP4DatalEC2ERKS1_RKl",
+      "std::pair<Data*, long>::pair(Data* const&, long const&)" },
+    { "_ZNSt4pairIPSt18_Rb_tree_node_baseS1_EC5ERKS1_S4_",
+      "std::pair<std::_Rb_tree_node_base*, std::_Rb_tree_node_base*>::pair(std::_Rb_tree_node_base* const&, std::_Rb_tree_node_base* const&)" },
+    { "_ZNSt4pairISt17_Rb_tree_iteratorIPKiES3_EC1ERKS3_S6_",
+      "std::pair<std::_Rb_tree_iterator<int const*>, std::_Rb_tree_iterator<int const*> >::pair(std::_Rb_tree_iterator<int const*> const&, std::_Rb_tree_iterator<int const*> const&)" },
+    { "_ZNSt4pairISt17_Rb_tree_iteratorIPViEbEC2ERKS3_RKb",
+      "std::pair<std::_Rb_tree_iterator<int volatile*>, bool>::pair(std::_Rb_tree_iterator<int volatile*> const&, bool const&)" },
+    { "_ZNSt4pairISt23_Rb_tree_const_iteratorIPKiES3_EC5ISt17_Rb_tree_iteratorIS2_ES7_EERKS_IT_T0_E",
+      "std::pair<std::_Rb_tree_const_iterator<int const*>, std::_Rb_tree_const_iterator<int const*> >::pair<std::_Rb_tree_iterator<int const*>, std::_Rb_tree_iterator<int const*> >(std::pair<std::_Rb_tree_iterator<int const*>, std::_Rb_tree_iterator<int const*> > const&)" },
+    { "_ZNSt4pairISt23_Rb_tree_const_iteratorIPViES3_EC2ISt17_Rb_tree_iteratorIS2_ES7_EERKS_IT_T0_E",
+      "std::pair<std::_Rb_tree_const_iterator<int volatile*>, std::_Rb_tree_const_iterator<int volatile*> >::pair<std::_Rb_tree_iterator<int volatile*>, std::_Rb_tree_iterator<int volatile*> >(std::pair<std::_Rb_tree_iterator<int volatile*>, std::_Rb_tree_iterator<int volatile*> > const&)" },
+    { "_ZNSt4pairISt23_Rb_tree_const_iteratorIiES1_EC1Ev",
+      "std::pair<std::_Rb_tree_const_iterator<int>, std::_Rb_tree_const_iterator<int> >::pair()" },
+    { "_ZNSt4pairIiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEED5Ev",
+      "std::pair<int, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >::~pair()" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt4_CosSt9_ValArrayeEEeEC1ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Cos, std::_ValArray, long double>, long double>::_Expr(std::__detail::_UnClos<std::_Cos, std::_ValArray, long double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt4_LogSt9_ValArraydEEdEC2ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Log, std::_ValArray, double>, double>::_Expr(std::__detail::_UnClos<std::_Log, std::_ValArray, double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt4_SinSt9_ValArrayfEEfEC5ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Sin, std::_ValArray, float>, float>::_Expr(std::__detail::_UnClos<std::_Sin, std::_ValArray, float> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt5_AcosSt9_ValArrayfEEfEC1ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Acos, std::_ValArray, float>, float>::_Expr(std::__detail::_UnClos<std::_Acos, std::_ValArray, float> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt5_AtanSt9_ValArrayeEEeEC2ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Atan, std::_ValArray, long double>, long double>::_Expr(std::__detail::_UnClos<std::_Atan, std::_ValArray, long double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt5_SinhSt9_ValArraydEEdEC5ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Sinh, std::_ValArray, double>, double>::_Expr(std::__detail::_UnClos<std::_Sinh, std::_ValArray, double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt5_TanhSt9_ValArraydEEdEC1ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Tanh, std::_ValArray, double>, double>::_Expr(std::__detail::_UnClos<std::_Tanh, std::_ValArray, double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail7_UnClosISt6_Log10St9_ValArrayfEEfEC2ERKS4_",
+      "std::_Expr<std::__detail::_UnClos<std::_Log10, std::_ValArray, float>, float>::_Expr(std::__detail::_UnClos<std::_Log10, std::_ValArray, float> const&)" },
+    { "_ZNSt5_ExprINSt8__detail8_BinClosISt4_PowSt9_ValArrayS3_eeEEeEC5ERKS4_",
+      "std::_Expr<std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_ValArray, long double, long double>, long double>::_Expr(std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_ValArray, long double, long double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail8_BinClosISt6_Atan2St9_ConstantSt9_ValArrayeeEEeEC1ERKS5_",
+      "std::_Expr<std::__detail::_BinClos<std::_Atan2, std::_Constant, std::_ValArray, long double, long double>, long double>::_Expr(std::__detail::_BinClos<std::_Atan2, std::_Constant, std::_ValArray, long double, long double> const&)" },
+    { "_ZNSt5_ExprINSt8__detail8_BinClosISt6_Atan2St9_ValArraySt9_ConstantddEEdEC2ERKS5_",
+      "std::_Expr<std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, double, double>, double>::_Expr(std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, double, double> const&)" },
+    { "_ZNSt5dequeI13MovableStructSaIS0_EE16_M_pop_front_auxEv",
+      "std::deque<MovableStruct, std::allocator<MovableStruct> >::_M_pop_front_aux()" },
+    { "_ZNSt5dequeI13MovableStructSaIS0_EE5eraseESt15_Deque_iteratorIS0_RS0_PS0_E",
+      "std::deque<MovableStruct, std::allocator<MovableStruct> >::erase(std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>)" },
+    { "_ZNSt5dequeI13MovableStructSaIS0_EED5Ev",
+      "std::deque<MovableStruct, std::allocator<MovableStruct> >::~deque()" },
+    { "_ZNSt5dequeI21CompleteMovableStructSaIS0_EE23_M_reserve_map_at_frontEm",
+      "std::deque<CompleteMovableStruct, std::allocator<CompleteMovableStruct> >::_M_reserve_map_at_front(unsigned long)" },
+    { "_ZNSt5dequeI21CompleteMovableStructSaIS0_EEC1Ev",
+      "std::deque<CompleteMovableStruct, std::allocator<CompleteMovableStruct> >::deque()" },
+    { "_ZNSt5dequeI3ObjSaIS0_EE22_M_reserve_map_at_backEm",
+      "std::deque<Obj, std::allocator<Obj> >::_M_reserve_map_at_back(unsigned long)" },
+    { "_ZNSt5dequeI3ObjSaIS0_EEC5Ev",
+      "std::deque<Obj, std::allocator<Obj> >::deque()" },
+    { "_ZNSt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EE22_M_reserve_map_at_backEm",
+      "std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::_M_reserve_map_at_back(unsigned long)" },
+    { "_ZNSt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EED1Ev",
+      "std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::~deque()" },
+    { "_ZNSt5dequeIPKcSaIS1_EE23_M_reserve_map_at_frontEm",
+      "std::deque<char const*, std::allocator<char const*> >::_M_reserve_map_at_front(unsigned long)" },
+    { "_ZNSt5dequeIPKcSaIS1_EEixEm",
+      "std::deque<char const*, std::allocator<char const*> >::operator[](unsigned long)" },
+    { "_ZNSt5dequeIPKiSaIS1_EE14_S_buffer_sizeEv",
+      "std::deque<int const*, std::allocator<int const*> >::_S_buffer_size()" },
+    { "_ZNSt5dequeIPKiSaIS1_EE18_M_insert_dispatchIPPiEEvSt15_Deque_iteratorIS1_RS1_PS1_ET_SB_St12__false_type",
+      "void std::deque<int const*, std::allocator<int const*> >::_M_insert_dispatch<int**>(std::_Deque_iterator<int const*, int const*&, int const**>, int**, int**, std::__false_type)" },
+    { "_ZNSt5dequeIPKiSaIS1_EE2atEm",
+      "std::deque<int const*, std::allocator<int const*> >::at(unsigned long)" },
+    { "_ZNSt5dequeIPKiSaIS1_EE6insertIN9__gnu_cxx17__normal_iteratorIPPiSt6vectorIS7_SaIS7_EEEEEEvSt15_Deque_iteratorIS1_RS1_PS1_ET_SH_",
+      "void std::deque<int const*, std::allocator<int const*> >::insert<__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > > >(std::_Deque_iterator<int const*, int const*&, int const**>, __gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, __gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >)" },
+    { "_ZNSt5dequeIPKiSaIS1_EEC2ERKS2_",
+      "std::deque<int const*, std::allocator<int const*> >::deque(std::allocator<int const*> const&)" },
+    { "_ZNSt5dequeIPVKiSaIS1_EE13_M_insert_auxESt15_Deque_iteratorIS1_RS1_PS1_EmRKS1_",
+      "std::deque<int const volatile*, std::allocator<int const volatile*> >::_M_insert_aux(std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>, unsigned long, int const volatile* const&)" },
+    { "_ZNSt5dequeIPVKiSaIS1_EE19_M_range_insert_auxISt15_Deque_iteratorIS1_RKS1_PS6_EEEvS5_IS1_RS1_PS1_ET_SD_St20forward_iterator_tag",
+      "void std::deque<int const volatile*, std::allocator<int const volatile*> >::_M_range_insert_aux<std::_Deque_iterator<int const volatile*, int const volatile* const&, int const volatile* const*> >(std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>, std::_Deque_iterator<int const volatile*, int const volatile* const&, int const volatile* const*>, std::_Deque_iterator<int const volatile*, int const volatile* const&, int const volatile* const*>, std::forward_iterator_tag)" },
+    { "_ZNSt5dequeIPVKiSaIS1_EE5frontEv",
+      "std::deque<int const volatile*, std::allocator<int const volatile*> >::front()" },
+    { "_ZNSt5dequeIPVKiSaIS1_EEC2ERKS3_",
+      "std::deque<int const volatile*, std::allocator<int const volatile*> >::deque(std::deque<int const volatile*, std::allocator<int const volatile*> > const&)" },
+    { "_ZNSt5dequeIPViSaIS1_EE13_M_insert_auxISt15_Deque_iteratorIS1_RKS1_PS6_EEEvS5_IS1_RS1_PS1_ET_SD_m",
+      "void std::deque<int volatile*, std::allocator<int volatile*> >::_M_insert_aux<std::_Deque_iterator<int volatile*, int volatile* const&, int volatile* const*> >(std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, std::_Deque_iterator<int volatile*, int volatile* const&, int volatile* const*>, std::_Deque_iterator<int volatile*, int volatile* const&, int volatile* const*>, unsigned long)" },
+    { "_ZNSt5dequeIPViSaIS1_EE22_M_reserve_map_at_backEm",
+      "std::deque<int volatile*, std::allocator<int volatile*> >::_M_reserve_map_at_back(unsigned long)" },
+    { "_ZNSt5dequeIPViSaIS1_EE6assignEmRKS1_",
+      "std::deque<int volatile*, std::allocator<int volatile*> >::assign(unsigned long, int volatile* const&)" },
+    { "_ZNSt5dequeIPViSaIS1_EEC2EmRKS1_RKS2_",
+      "std::deque<int volatile*, std::allocator<int volatile*> >::deque(unsigned long, int volatile* const&, std::allocator<int volatile*> const&)" },
+    { "_ZNSt5dequeIPiSaIS0_EE13_M_insert_auxESt15_Deque_iteratorIS0_RS0_PS0_EmRKS0_",
+      "std::deque<int*, std::allocator<int*> >::_M_insert_aux(std::_Deque_iterator<int*, int*&, int**>, unsigned long, int* const&)" },
+    { "_ZNSt5dequeIPiSaIS0_EE17_S_check_init_lenEmRKS1_",
+      "std::deque<int*, std::allocator<int*> >::_S_check_init_len(unsigned long, std::allocator<int*> const&)" },
+    { "_ZNSt5dequeIPiSaIS0_EE23_M_reserve_map_at_frontEm",
+      "std::deque<int*, std::allocator<int*> >::_M_reserve_map_at_front(unsigned long)" },
+    { "_ZNSt5dequeIPiSaIS0_EE6assignIPS0_EEvT_S5_",
+      "void std::deque<int*, std::allocator<int*> >::assign<int**>(int**, int**)" },
+    { "_ZNSt5dequeIPiSaIS0_EEC1Ev",
+      "std::deque<int*, std::allocator<int*> >::deque()" },
+    { "_ZNSt5dequeIPiSaIS0_EEixEm",
+      "std::deque<int*, std::allocator<int*> >::operator[](unsigned long)" },
+    { "_ZNSt5dequeISt6vectorIiSaIiEESaIS2_EE14_M_fill_insertESt15_Deque_iteratorIS2_RS2_PS2_EmRKS2_",
+      "std::deque<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_M_fill_insert(std::_Deque_iterator<std::vector<int, std::allocator<int> >, std::vector<int, std::allocator<int> >&, std::vector<int, std::allocator<int> >*>, unsigned long, std::vector<int, std::allocator<int> > const&)" },
+    { "_ZNSt5dequeISt6vectorIiSaIiEESaIS2_EE24_M_new_elements_at_frontEm",
+      "std::deque<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_M_new_elements_at_front(unsigned long)" },
+    { "_ZNSt5dequeISt6vectorIiSaIiEESaIS2_EE8pop_backEv",
+      "std::deque<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::pop_back()" },
+    { "_ZNSt5dequeIiSaIiEE17_S_check_init_lenEmRKS0_",
+      "std::deque<int, std::allocator<int> >::_S_check_init_len(unsigned long, std::allocator<int> const&)" },
+    { "_ZNSt5dequeIiSaIiEEC5Ev",
+      "std::deque<int, std::allocator<int> >::deque()" },
+    { "_ZNSt5queueI3ObjSt5dequeIS0_SaIS0_EEED2Ev",
+      "std::queue<Obj, std::deque<Obj, std::allocator<Obj> > >::~queue()" },
+    { "_ZNSt5stackIiNSt7__cxx114listIiSaIiEEEE3topEv",
+      "std::stack<int, std::__cxx11::list<int, std::allocator<int> > >::top()" },
+    { "_ZNSt5stackIiSt5dequeIiSaIiEEED5Ev",
+      "std::stack<int, std::deque<int, std::allocator<int> > >::~stack()" },
+    { "_ZNSt6bitsetILm13EE16_M_copy_from_ptrIwSt11char_traitsIwEEEvPKT_mmmS4_S4_",
+      "void std::bitset<13ul>::_M_copy_from_ptr<wchar_t, std::char_traits<wchar_t> >(wchar_t const*, unsigned long, unsigned long, unsigned long, wchar_t, wchar_t)" },
+    { "_ZNSt6locale2idC2Ev",
+      "std::locale::id::id()" },
+    { "_ZNSt6localeC1ERKS_PKci",
+      "std::locale::locale(std::locale const&, char const*, int)" },
+    { "_ZNSt6localeC1ISt12ctype_bynameIcEEERKS_PT_",
+      "std::locale::locale<std::ctype_byname<char> >(std::locale const&, std::ctype_byname<char>*)" },
+    { "_ZNSt6localeC2INSt7__cxx1115time_get_bynameIcSt19istreambuf_iteratorIcSt11char_traitsIcEEEEEERKS_PT_",
+      "std::locale::locale<std::__cxx11::time_get_byname<char, std::istreambuf_iterator<char, std::char_traits<char> > > >(std::locale const&, std::__cxx11::time_get_byname<char, std::istreambuf_iterator<char, std::char_traits<char> > >*)" },
+    { "_ZNSt6localeC5INSt7__cxx1114collate_bynameIcEEEERKS_PT_",
+      "std::locale::locale<std::__cxx11::collate_byname<char> >(std::locale const&, std::__cxx11::collate_byname<char>*)" },
+    { "_ZNSt6localeC5ISt15time_put_bynameIcSt19ostreambuf_iteratorIcSt11char_traitsIcEEEEERKS_PT_",
+      "std::locale::locale<std::time_put_byname<char, std::ostreambuf_iterator<char, std::char_traits<char> > > >(std::locale const&, std::time_put_byname<char, std::ostreambuf_iterator<char, std::char_traits<char> > >*)" },
+    { "_ZNSt6vectorI13MovableStructSaIS0_EE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPS0_S2_EE",
+      "std::vector<MovableStruct, std::allocator<MovableStruct> >::_M_erase(__gnu_cxx::__normal_iterator<MovableStruct*, std::vector<MovableStruct, std::allocator<MovableStruct> > >)" },
+    { "_ZNSt6vectorI15MyIntComparableSaIS0_EE9push_backERKS0_",
+      "std::vector<MyIntComparable, std::allocator<MyIntComparable> >::push_back(MyIntComparable const&)" },
+    { "_ZNSt6vectorI1VSaIS0_EE11_S_max_sizeERKS1_",
+      "std::vector<V, std::allocator<V> >::_S_max_size(std::allocator<V> const&)" },
+    { "_ZNSt6vectorI20NotTrivialCopyStructSaIS0_EEC1EmRKS0_RKS1_",
+      "std::vector<NotTrivialCopyStruct, std::allocator<NotTrivialCopyStruct> >::vector(unsigned long, NotTrivialCopyStruct const&, std::allocator<NotTrivialCopyStruct> const&)" },
+    { "_ZNSt6vectorI21CompleteMovableStructSaIS0_EE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPS0_S2_EE",
+      "std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> >::_M_erase(__gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >)" },
+    { "_ZNSt6vectorI3ObjSaIS0_EE5beginEv",
+      "std::vector<Obj, std::allocator<Obj> >::begin()" },
+    { "_ZNSt6vectorI4TestSaIS0_EEC5Ev",
+      "std::vector<Test, std::allocator<Test> >::vector()" },
+    { "_ZNSt6vectorINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EEC2ERKS7_",
+      "std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::vector(std::vector<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > const&)" },
+    { "_ZNSt6vectorINSt7__cxx114listINS0_12basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EEESaIS8_EE3endEv",
+      "std::vector<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::end()" },
+    { "_ZNSt6vectorIP12PasswordFormSaIS1_EE3endEv",
+      "std::vector<PasswordForm*, std::allocator<PasswordForm*> >::end()" },
+    { "_ZNSt6vectorIP4baseSaIS1_EEC2IN9__gnu_cxx17__normal_iteratorIPP7derivedS_IS8_SaIS8_EEEEEET_SD_RKS2_",
+      "std::vector<base*, std::allocator<base*> >::vector<__gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > > >(__gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > >, __gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > >, std::allocator<base*> const&)" },
+    { "_ZNSt6vectorIPFviESaIS1_EE11_S_max_sizeERKS2_",
+      "std::vector<void (*)(int), std::allocator<void (*)(int)> >::_S_max_size(std::allocator<void (*)(int)> const&)" },
+    { "_ZNSt6vectorIPFvvESaIS1_EEC1Ev",
+      "std::vector<void (*)(), std::allocator<void (*)()> >::vector()" },
+    { "_ZNSt6vectorIPKcSaIS1_EEC1Ev",
+      "std::vector<char const*, std::allocator<char const*> >::vector()" },
+    { "_ZNSt6vectorIPKiSaIS1_EE14_M_fill_insertEN9__gnu_cxx17__normal_iteratorIPS1_S3_EEmRKS1_",
+      "std::vector<int const*, std::allocator<int const*> >::_M_fill_insert(__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >, unsigned long, int const* const&)" },
+    { "_ZNSt6vectorIPKiSaIS1_EE18_M_insert_dispatchISt14_List_iteratorIPiEEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EET_SC_St12__false_type",
+      "void std::vector<int const*, std::allocator<int const*> >::_M_insert_dispatch<std::_List_iterator<int*> >(__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >, std::_List_iterator<int*>, std::_List_iterator<int*>, std::__false_type)" },
+    { "_ZNSt6vectorIPKiSaIS1_EE5frontEv",
+      "std::vector<int const*, std::allocator<int const*> >::front()" },
+    { "_ZNSt6vectorIPKiSaIS1_EE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPS1_S3_EES7_",
+      "std::vector<int const*, std::allocator<int const*> >::_M_erase(__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >, __gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >)" },
+    { "_ZNSt6vectorIPKiSaIS1_EED2Ev",
+      "std::vector<int const*, std::allocator<int const*> >::~vector()" },
+    { "_ZNSt6vectorIPVKiSaIS1_EE3endEv",
+      "std::vector<int const volatile*, std::allocator<int const volatile*> >::end()" },
+    { "_ZNSt6vectorIPVKiSaIS1_EE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPS1_S3_EE",
+      "std::vector<int const volatile*, std::allocator<int const volatile*> >::_M_erase(__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >)" },
+    { "_ZNSt6vectorIPVKiSaIS1_EED1Ev",
+      "std::vector<int const volatile*, std::allocator<int const volatile*> >::~vector()" },
+    { "_ZNSt6vectorIPViSaIS1_EE2atEm",
+      "std::vector<int volatile*, std::allocator<int volatile*> >::at(unsigned long)" },
+    { "_ZNSt6vectorIPViSaIS1_EE7reserveEm",
+      "std::vector<int volatile*, std::allocator<int volatile*> >::reserve(unsigned long)" },
+    { "_ZNSt6vectorIPViSaIS1_EEC5Ev",
+      "std::vector<int volatile*, std::allocator<int volatile*> >::vector()" },
+    { "_ZNSt6vectorIPiSaIS0_EE15_M_range_insertISt14_List_iteratorIS0_EEEvN9__gnu_cxx17__normal_iteratorIPS0_S2_EET_SA_St20forward_iterator_tag",
+      "void std::vector<int*, std::allocator<int*> >::_M_range_insert<std::_List_iterator<int*> >(__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, std::_List_iterator<int*>, std::_List_iterator<int*>, std::forward_iterator_tag)" },
+    { "_ZNSt6vectorIPiSaIS0_EE4backEv",
+      "std::vector<int*, std::allocator<int*> >::back()" },
+    { "_ZNSt6vectorIPiSaIS0_EE6insertISt14_List_iteratorIS0_EEEvN9__gnu_cxx17__normal_iteratorIPS0_S2_EET_SA_",
+      "void std::vector<int*, std::allocator<int*> >::insert<std::_List_iterator<int*> >(__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, std::_List_iterator<int*>, std::_List_iterator<int*>)" },
+    { "_ZNSt6vectorIPiSaIS0_EEC2Ev",
+      "std::vector<int*, std::allocator<int*> >::vector()" },
+    { "_ZNSt6vectorIPvSaIS0_EED2Ev",
+      "std::vector<void*, std::allocator<void*> >::~vector()" },
+    { "_ZNSt6vectorIS_IbSaIbEESaIS1_EE17_M_realloc_insertEN9__gnu_cxx17__normal_iteratorIPS1_S3_EERKS1_",
+      "std::vector<std::vector<bool, std::allocator<bool> >, std::allocator<std::vector<bool, std::allocator<bool> > > >::_M_realloc_insert(__gnu_cxx::__normal_iterator<std::vector<bool, std::allocator<bool> >*, std::vector<std::vector<bool, std::allocator<bool> >, std::allocator<std::vector<bool, std::allocator<bool> > > > >, std::vector<bool, std::allocator<bool> > const&)" },
+    { "_ZNSt6vectorIS_IiSaIiEESaIS1_EE15_M_erase_at_endEPS1_",
+      "std::vector<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_M_erase_at_end(std::vector<int, std::allocator<int> >*)" },
+    { "_ZNSt6vectorIS_IiSaIiEESaIS1_EE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPS1_S3_EES7_",
+      "std::vector<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_M_erase(__gnu_cxx::__normal_iterator<std::vector<int, std::allocator<int> >*, std::vector<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > > >, __gnu_cxx::__normal_iterator<std::vector<int, std::allocator<int> >*, std::vector<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > > >)" },
+    { "_ZNSt6vectorISt5dequeINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESaIS6_EESaIS8_EE5beginEv",
+      "std::vector<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::allocator<std::deque<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > > >::begin()" },
+    { "_ZNSt6vectorIbSaIbEEC1EmRKbRKS0_",
+      "std::vector<bool, std::allocator<bool> >::vector(unsigned long, bool const&, std::allocator<bool> const&)" },
+    { "_ZNSt6vectorIcSaIcEE15_M_range_insertIN9__gnu_cxx17__normal_iteratorIPcS1_EEEEvS6_T_S7_St20forward_iterator_tag",
+      "void std::vector<char, std::allocator<char> >::_M_range_insert<__gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > > >(__gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > >, __gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > >, __gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > >, std::forward_iterator_tag)" },
+    { "_ZNSt6vectorIcSaIcEEC1EmRKcRKS0_",
+      "std::vector<char, std::allocator<char> >::vector(unsigned long, char const&, std::allocator<char> const&)" },
+    { "_ZNSt6vectorIfSaIfEE22_M_initialize_dispatchIN9__gnu_cxx17__normal_iteratorIPiS_IiSaIiEEEEEEvT_S9_St12__false_type",
+      "void std::vector<float, std::allocator<float> >::_M_initialize_dispatch<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > > >(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, std::__false_type)" },
+    { "_ZNSt6vectorIiSaIiEE22_M_initialize_dispatchIiEEvT_S3_St11__true_type",
+      "void std::vector<int, std::allocator<int> >::_M_initialize_dispatch<int>(int, int, std::__true_type)" },
+    { "_ZNSt6vectorIiSaIiEEC2Ev",
+      "std::vector<int, std::allocator<int> >::vector()" },
+    { "_ZNSt6vectorIjSaIjEE19_M_range_initializeIN9__gnu_cxx17__normal_iteratorIPiS_IiSaIiEEEEEEvT_S9_St20forward_iterator_tag",
+      "void std::vector<unsigned int, std::allocator<unsigned int> >::_M_range_initialize<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > > >(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, std::forward_iterator_tag)" },
+    { "_ZNSt6vectorImSaImEE3endEv",
+      "std::vector<unsigned long, std::allocator<unsigned long> >::end()" },
+    { "_ZNSt7__cxx1110_List_baseI20NotTrivialCopyStructSaIS1_EE11_M_inc_sizeEm",
+      "std::__cxx11::_List_base<NotTrivialCopyStruct, std::allocator<NotTrivialCopyStruct> >::_M_inc_size(unsigned long)" },
+    { "_ZNSt7__cxx1110_List_baseINS_12basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EE11_M_dec_sizeEm",
+      "std::__cxx11::_List_base<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::_M_dec_size(unsigned long)" },
+    { "_ZNSt7__cxx1110_List_baseIPKiSaIS2_EE10_List_implC2Ev",
+      "std::__cxx11::_List_base<int const*, std::allocator<int const*> >::_List_impl::_List_impl()" },
+    { "_ZNSt7__cxx1110_List_baseIPKiSaIS2_EEC2ERKSaISt10_List_nodeIS2_EE",
+      "std::__cxx11::_List_base<int const*, std::allocator<int const*> >::_List_base(std::allocator<std::_List_node<int const*> > const&)" },
+    { "_ZNSt7__cxx1110_List_baseIPVKiSaIS2_EE11_M_dec_sizeEm",
+      "std::__cxx11::_List_base<int const volatile*, std::allocator<int const volatile*> >::_M_dec_size(unsigned long)" },
+    { "_ZNSt7__cxx1110_List_baseIPVKiSaIS2_EED5Ev",
+      "std::__cxx11::_List_base<int const volatile*, std::allocator<int const volatile*> >::~_List_base()" },
+    { "_ZNSt7__cxx1110_List_baseIPViSaIS2_EE7_M_initEv",
+      "std::__cxx11::_List_base<int volatile*, std::allocator<int volatile*> >::_M_init()" },
+    { "_ZNSt7__cxx1110_List_baseIPiSaIS1_EE10_List_implC5Ev",
+      "std::__cxx11::_List_base<int*, std::allocator<int*> >::_List_impl::_List_impl()" },
+    { "_ZNSt7__cxx1110_List_baseIPiSaIS1_EEC5ERKSaISt10_List_nodeIS1_EE",
+      "std::__cxx11::_List_base<int*, std::allocator<int*> >::_List_base(std::allocator<std::_List_node<int*> > const&)" },
+    { "_ZNSt7__cxx1110_List_baseIPvSaIS1_EEC5Ev",
+      "std::__cxx11::_List_base<void*, std::allocator<void*> >::_List_base()" },
+    { "_ZNSt7__cxx1110_List_baseISt6vectorIiSaIiEESaIS3_EEC2ERKSaISt10_List_nodeIS3_EE",
+      "std::__cxx11::_List_base<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::_List_base(std::allocator<std::_List_node<std::vector<int, std::allocator<int> > > > const&)" },
+    { "_ZNSt7__cxx1110_List_baseIiSaIiEE11_M_inc_sizeEm",
+      "std::__cxx11::_List_base<int, std::allocator<int> >::_M_inc_size(unsigned long)" },
+    { "_ZNSt7__cxx1110moneypunctIwLb1EE2idE",
+      "std::__cxx11::moneypunct<wchar_t, true>::id" },
+    { "_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_",
+      "std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >::append(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&)" },
+    { "_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEPKc",
+      "std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >::operator=(char const*)" },
+    { "_ZNSt7__cxx1112basic_stringIwSt11char_traitsIwESaIwEEC1Ev",
+      "std::__cxx11::basic_string<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t> >::basic_string()" },
+    { "_ZNSt7__cxx1117moneypunct_bynameIwLb1EEC1EPKcm",
+      "std::__cxx11::moneypunct_byname<wchar_t, true>::moneypunct_byname(char const*, unsigned long)" },
+    { "_ZNSt7__cxx1119basic_ostringstreamIwSt11char_traitsIwESaIwEEC1Ev",
+      "std::__cxx11::basic_ostringstream<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t> >::basic_ostringstream()" },
+    { "_ZNSt7__cxx114listINS_12basic_stringIcSt11char_traitsIcESaIcEEESaIS5_EEC1EmRKS5_RKS6_",
+      "std::__cxx11::list<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::list(unsigned long, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > const&)" },
+    { "_ZNSt7__cxx114listIPKiSaIS2_EE14_M_fill_assignEmRKS2_",
+      "std::__cxx11::list<int const*, std::allocator<int const*> >::_M_fill_assign(unsigned long, int const* const&)" },
+    { "_ZNSt7__cxx114listIPKiSaIS2_EE22_M_initialize_dispatchISt14_List_iteratorIPiEEEvT_S9_St12__false_type",
+      "void std::__cxx11::list<int const*, std::allocator<int const*> >::_M_initialize_dispatch<std::_List_iterator<int*> >(std::_List_iterator<int*>, std::_List_iterator<int*>, std::__false_type)" },
+    { "_ZNSt7__cxx114listIPKiSaIS2_EE6assignEmRKS2_",
+      "std::__cxx11::list<int const*, std::allocator<int const*> >::assign(unsigned long, int const* const&)" },
+    { "_ZNSt7__cxx114listIPKiSaIS2_EE6spliceESt14_List_iteratorIS2_ERS4_S6_",
+      "std::__cxx11::list<int const*, std::allocator<int const*> >::splice(std::_List_iterator<int const*>, std::__cxx11::list<int const*, std::allocator<int const*> >&, std::_List_iterator<int const*>)" },
+    { "_ZNSt7__cxx114listIPKiSaIS2_EEC1IN9__gnu_cxx17__normal_iteratorIPS2_St6vectorIS2_S3_EEEEET_SC_RKS3_",
+      "std::__cxx11::list<int const*, std::allocator<int const*> >::list<__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > > >(__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >, __gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >, std::allocator<int const*> const&)" },
+    { "_ZNSt7__cxx114listIPKiSaIS2_EEC5ERKS4_",
+      "std::__cxx11::list<int const*, std::allocator<int const*> >::list(std::__cxx11::list<int const*, std::allocator<int const*> > const&)" },
+    { "_ZNSt7__cxx114listIPVKiSaIS2_EE14_M_create_nodeERKS2_",
+      "std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >::_M_create_node(int const volatile* const&)" },
+    { "_ZNSt7__cxx114listIPVKiSaIS2_EE4swapERS4_",
+      "std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >::swap(std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >&)" },
+    { "_ZNSt7__cxx114listIPVKiSaIS2_EE6spliceESt14_List_iteratorIS2_ERS4_S6_S6_",
+      "std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >::splice(std::_List_iterator<int const volatile*>, std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >&, std::_List_iterator<int const volatile*>, std::_List_iterator<int const volatile*>)" },
+    { "_ZNSt7__cxx114listIPVKiSaIS2_EEC2Ev",
+      "std::__cxx11::list<int const volatile*, std::allocator<int const volatile*> >::list()" },
+    { "_ZNSt7__cxx114listIPViSaIS2_EE15_Finalize_mergeC1ERS4_S6_RKSt14_List_iteratorIS2_E",
+      "std::__cxx11::list<int volatile*, std::allocator<int volatile*> >::_Finalize_merge::_Finalize_merge(std::__cxx11::list<int volatile*, std::allocator<int volatile*> >&, std::__cxx11::list<int volatile*, std::allocator<int volatile*> >&, std::_List_iterator<int volatile*> const&)" },
+    { "_ZNSt7__cxx114listIPViSaIS2_EE5clearEv",
+      "std::__cxx11::list<int volatile*, std::allocator<int volatile*> >::clear()" },
+    { "_ZNSt7__cxx114listIPViSaIS2_EE7reverseEv",
+      "std::__cxx11::list<int volatile*, std::allocator<int volatile*> >::reverse()" },
+    { "_ZNSt7__cxx114listIPViSaIS2_EEC5ERKS3_",
+      "std::__cxx11::list<int volatile*, std::allocator<int volatile*> >::list(std::allocator<int volatile*> const&)" },
+    { "_ZNSt7__cxx114listIPiSaIS1_EE15_Finalize_mergeC5ERS3_S5_RKSt14_List_iteratorIS1_E",
+      "std::__cxx11::list<int*, std::allocator<int*> >::_Finalize_merge::_Finalize_merge(std::__cxx11::list<int*, std::allocator<int*> >&, std::__cxx11::list<int*, std::allocator<int*> >&, std::_List_iterator<int*> const&)" },
+    { "_ZNSt7__cxx114listIPiSaIS1_EE4sortEv",
+      "std::__cxx11::list<int*, std::allocator<int*> >::sort()" },
+    { "_ZNSt7__cxx114listIPiSaIS1_EE6insertIPS1_EEvSt14_List_iteratorIS1_ET_S8_",
+      "void std::__cxx11::list<int*, std::allocator<int*> >::insert<int**>(std::_List_iterator<int*>, int**, int**)" },
+    { "_ZNSt7__cxx114listIPiSaIS1_EE9push_backERKS1_",
+      "std::__cxx11::list<int*, std::allocator<int*> >::push_back(int* const&)" },
+    { "_ZNSt7__cxx114listIPiSaIS1_EEC2ISt14_List_iteratorIS1_EEET_S7_RKS2_",
+      "std::__cxx11::list<int*, std::allocator<int*> >::list<std::_List_iterator<int*> >(std::_List_iterator<int*>, std::_List_iterator<int*>, std::allocator<int*> const&)" },
+    { "_ZNSt7__cxx114listIPvSaIS1_EEC5Ev",
+      "std::__cxx11::list<void*, std::allocator<void*> >::list()" },
+    { "_ZNSt7__cxx114listISt6vectorIiSaIiEESaIS3_EED5Ev",
+      "std::__cxx11::list<std::vector<int, std::allocator<int> >, std::allocator<std::vector<int, std::allocator<int> > > >::~list()" },
+    { "_ZNSt7__cxx114listIiSaIiEEC1ERKS2_",
+      "std::__cxx11::list<int, std::allocator<int> >::list(std::__cxx11::list<int, std::allocator<int> > const&)" },
+    { "_ZNSt7__cxx118numpunctIcE2idE",
+      "std::__cxx11::numpunct<char>::id" },
+    { "_ZNSt7codecvtIcc8my_stateEC2Em",
+      "std::codecvt<char, char, my_state>::codecvt(unsigned long)" },
+    { "_ZNSt8_Rb_treeIPK12PasswordFormS2_St9_IdentityIS2_ESt4lessIS2_ESaIS2_EE12_M_rightmostEv",
+      "std::_Rb_tree<PasswordForm const*, PasswordForm const*, std::_Identity<PasswordForm const*>, std::less<PasswordForm const*>, std::allocator<PasswordForm const*> >::_M_rightmost()" },
+    { "_ZNSt8_Rb_treeIPK12PasswordFormS2_St9_IdentityIS2_ESt4lessIS2_ESaIS2_EE6_M_endEv",
+      "std::_Rb_tree<PasswordForm const*, PasswordForm const*, std::_Identity<PasswordForm const*>, std::less<PasswordForm const*>, std::allocator<PasswordForm const*> >::_M_end()" },
+    { "_ZNSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE11_Alloc_nodeC1ERS7_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_Alloc_node::_Alloc_node(std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >&)" },
+    { "_ZNSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE13_Rb_tree_implIS5_Lb0EEC1ERKS9_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_Rb_tree_impl<std::less<int const*>, false>::_Rb_tree_impl(std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_Rb_tree_impl<std::less<int const*>, false> const&)" },
+    { "_ZNSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE15_M_insert_lowerEPSt18_Rb_tree_node_baseRKS1_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_M_insert_lower(std::_Rb_tree_node_base*, int const* const&)" },
+    { "_ZNSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE21_M_insert_equal_lowerERKS1_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_M_insert_equal_lower(int const* const&)" },
+    { "_ZNSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE7_M_copyERKS7_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_M_copy(std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> > const&)" },
+    { "_ZNSt8_Rb_treeIPKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EEC2ERKS7_",
+      "std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> >::_Rb_tree(std::_Rb_tree<int const*, int const*, std::_Identity<int const*>, std::less<int const*>, std::allocator<int const*> > const&)" },
+    { "_ZNSt8_Rb_treeIPVKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE11lower_boundERKS1_",
+      "std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >::lower_bound(int const volatile* const&)" },
+    { "_ZNSt8_Rb_treeIPVKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE13_Rb_tree_implIS5_Lb0EEC5Ev",
+      "std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >::_Rb_tree_impl<std::less<int const volatile*>, false>::_Rb_tree_impl()" },
+    { "_ZNSt8_Rb_treeIPVKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE20_Reuse_or_alloc_node10_M_extractEv",
+      "std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >::_Reuse_or_alloc_node::_M_extract()" },
+    { "_ZNSt8_Rb_treeIPVKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE4swapERS7_",
+      "std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >::swap(std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >&)" },
+    { "_ZNSt8_Rb_treeIPVKiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE7_S_leftEPSt18_Rb_tree_node_base",
+      "std::_Rb_tree<int const volatile*, int const volatile*, std::_Identity<int const volatile*>, std::less<int const volatile*>, std::allocator<int const volatile*> >::_S_left(std::_Rb_tree_node_base*)" },
+    { "_ZNSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE10_S_maximumEPSt18_Rb_tree_node_base",
+      "std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_S_maximum(std::_Rb_tree_node_base*)" },
+    { "_ZNSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE15_M_destroy_nodeEPSt13_Rb_tree_nodeIS1_E",
+      "std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_M_destroy_node(std::_Rb_tree_node<int volatile*>*)" },
+    { "_ZNSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE20_Reuse_or_alloc_nodeclIS1_EEPSt13_Rb_tree_nodeIS1_ERKT_",
+      "std::_Rb_tree_node<int volatile*>* std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_Reuse_or_alloc_node::operator()<int volatile*>(int volatile* const&)" },
+    { "_ZNSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EE6_S_keyEPKSt13_Rb_tree_nodeIS1_E",
+      "std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_S_key(std::_Rb_tree_node<int volatile*> const*)" },
+    { "_ZNSt8_Rb_treeIPViS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EEC1Ev",
+      "std::_Rb_tree<int volatile*, int volatile*, std::_Identity<int volatile*>, std::less<int volatile*>, std::allocator<int volatile*> >::_Rb_tree()" },
+    { "_ZNSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EE11_M_put_nodeEPSt13_Rb_tree_nodeIS0_E",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::_M_put_node(std::_Rb_tree_node<int*>*)" },
+    { "_ZNSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EE13_Rb_tree_implIS4_Lb0EEC5ERKS4_RKSaISt13_Rb_tree_nodeIS0_EE",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::_Rb_tree_impl<std::less<int*>, false>::_Rb_tree_impl(std::less<int*> const&, std::allocator<std::_Rb_tree_node<int*> > const&)" },
+    { "_ZNSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EE17_M_insert_unique_ESt23_Rb_tree_const_iteratorIS0_ERKS0_",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::_M_insert_unique_(std::_Rb_tree_const_iterator<int*>, int* const&)" },
+    { "_ZNSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EE3endEv",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::end()" },
+    { "_ZNSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EE7_M_rootEv",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::_M_root()" },
+    { "_ZNSt8_Rb_treeIPiS0_St9_IdentityIS0_ESt4lessIS0_ESaIS0_EEaSERKS6_",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> >::operator=(std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> > const&)" },
+    { "_ZNSt8_Rb_treeIiSt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEESt10_Select1stIS8_ESt4lessIiESaIS8_EE13_Rb_tree_implISC_Lb0EED5Ev",
+      "std::_Rb_tree<int, std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >, std::_Select1st<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::less<int>, std::allocator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::_Rb_tree_impl<std::less<int>, false>::~_Rb_tree_impl()" },
+    { "_ZNSt8_Rb_treeIiSt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEESt10_Select1stIS8_ESt4lessIiESaIS8_EE8_M_beginEv",
+      "std::_Rb_tree<int, std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >, std::_Select1st<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >, std::less<int>, std::allocator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > >::_M_begin()" },
+    { "_ZNSt8_Rb_treeIiiSt9_IdentityIiESt26pointer_to_binary_functionIiibESaIiEE12_M_drop_nodeEPSt13_Rb_tree_nodeIiE",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::pointer_to_binary_function<int, int, bool>, std::allocator<int> >::_M_drop_node(std::_Rb_tree_node<int>*)" },
+    { "_ZNSt8_Rb_treeIiiSt9_IdentityIiESt26pointer_to_binary_functionIiibESaIiEE23_M_get_insert_equal_posERKi",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::pointer_to_binary_function<int, int, bool>, std::allocator<int> >::_M_get_insert_equal_pos(int const&)" },
+    { "_ZNSt8_Rb_treeIiiSt9_IdentityIiESt4lessIiESaIiEE10_M_insert_INS5_11_Alloc_nodeEEESt17_Rb_tree_iteratorIiEPSt18_Rb_tree_node_baseSB_RKiRT_",
+      "std::_Rb_tree_iterator<int> std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_M_insert_<std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_Alloc_node>(std::_Rb_tree_node_base*, std::_Rb_tree_node_base*, int const&, std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_Alloc_node&)" },
+    { "_ZNSt8_Rb_treeIiiSt9_IdentityIiESt4lessIiESaIiEE13_Rb_tree_implIS3_Lb0EEC5Ev",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_Rb_tree_impl<std::less<int>, false>::_Rb_tree_impl()" },
+    { "_ZNSt8_Rb_treeIiiSt9_IdentityIiESt4lessIiESaIiEE28_M_get_insert_hint_equal_posESt23_Rb_tree_const_iteratorIiERKi",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_M_get_insert_hint_equal_pos(std::_Rb_tree_const_iterator<int>, int const&)" },
+    { "_ZNSt8_Rb_treeIiiSt9_IdentityIiESt4lessIiESaIiEEC2Ev",
+      "std::_Rb_tree<int, int, std::_Identity<int>, std::less<int>, std::allocator<int> >::_Rb_tree()" },
+    { "_ZNSt8__detail13_Scratch_listC1Ev",
+      "std::__detail::_Scratch_list::_Scratch_list()" },
+    { "_ZNSt8__detail7_UnBaseISt4_AbsSt8valarrayIdEEC1ERKS3_",
+      "std::__detail::_UnBase<std::_Abs, std::valarray<double> >::_UnBase(std::valarray<double> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt4_CosSt8valarrayIfEEC2ERKS3_",
+      "std::__detail::_UnBase<std::_Cos, std::valarray<float> >::_UnBase(std::valarray<float> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt4_LogSt8valarrayIeEEC5ERKS3_",
+      "std::__detail::_UnBase<std::_Log, std::valarray<long double> >::_UnBase(std::valarray<long double> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt4_TanSt8valarrayIeEEC1ERKS3_",
+      "std::__detail::_UnBase<std::_Tan, std::valarray<long double> >::_UnBase(std::valarray<long double> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt5_AsinSt8valarrayIdEEC2ERKS3_",
+      "std::__detail::_UnBase<std::_Asin, std::valarray<double> >::_UnBase(std::valarray<double> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt5_AtanSt8valarrayIfEEC5ERKS3_",
+      "std::__detail::_UnBase<std::_Atan, std::valarray<float> >::_UnBase(std::valarray<float> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt5_SinhSt8valarrayIfEEC1ERKS3_",
+      "std::__detail::_UnBase<std::_Sinh, std::valarray<float> >::_UnBase(std::valarray<float> const&)" },
+    { "_ZNSt8__detail7_UnBaseISt5_TanhSt8valarrayIeEEC2ERKS3_",
+      "std::__detail::_UnBase<std::_Tanh, std::valarray<long double> >::_UnBase(std::valarray<long double> const&)" },
+    { "_ZNSt8__detail7_UnClosISt4_AbsSt9_ValArraydEC5ERKSt8valarrayIdE",
+      "std::__detail::_UnClos<std::_Abs, std::_ValArray, double>::_UnClos(std::valarray<double> const&)" },
+    { "_ZNSt8__detail7_UnClosISt4_ExpSt9_ValArraydEC1ERKSt8valarrayIdE",
+      "std::__detail::_UnClos<std::_Exp, std::_ValArray, double>::_UnClos(std::valarray<double> const&)" },
+    { "_ZNSt8__detail7_UnClosISt4_LogSt9_ValArrayfEC2ERKSt8valarrayIfE",
+      "std::__detail::_UnClos<std::_Log, std::_ValArray, float>::_UnClos(std::valarray<float> const&)" },
+    { "_ZNSt8__detail7_UnClosISt4_TanSt9_ValArrayeEC5ERKSt8valarrayIeE",
+      "std::__detail::_UnClos<std::_Tan, std::_ValArray, long double>::_UnClos(std::valarray<long double> const&)" },
+    { "_ZNSt8__detail7_UnClosISt5_AsinSt9_ValArrayeEC1ERKSt8valarrayIeE",
+      "std::__detail::_UnClos<std::_Asin, std::_ValArray, long double>::_UnClos(std::valarray<long double> const&)" },
+    { "_ZNSt8__detail7_UnClosISt5_CoshSt9_ValArraydEC2ERKSt8valarrayIdE",
+      "std::__detail::_UnClos<std::_Cosh, std::_ValArray, double>::_UnClos(std::valarray<double> const&)" },
+    { "_ZNSt8__detail7_UnClosISt5_SinhSt9_ValArrayfEC5ERKSt8valarrayIfE",
+      "std::__detail::_UnClos<std::_Sinh, std::_ValArray, float>::_UnClos(std::valarray<float> const&)" },
+    { "_ZNSt8__detail7_UnClosISt5_TanhSt9_ValArrayfEC1ERKSt8valarrayIfE",
+      "std::__detail::_UnClos<std::_Tanh, std::_ValArray, float>::_UnClos(std::valarray<float> const&)" },
+    { "_ZNSt8__detail8_BinBaseISt4_PowSt8valarrayIeES3_EC2ERKS3_S6_",
+      "std::__detail::_BinBase<std::_Pow, std::valarray<long double>, std::valarray<long double> >::_BinBase(std::valarray<long double> const&, std::valarray<long double> const&)" },
+    { "_ZNSt8__detail8_BinClosISt4_PowSt9_ConstantSt9_ValArrayddEC5ERKdRKSt8valarrayIdE",
+      "std::__detail::_BinClos<std::_Pow, std::_Constant, std::_ValArray, double, double>::_BinClos(double const&, std::valarray<double> const&)" },
+    { "_ZNSt8__detail8_BinClosISt4_PowSt9_ValArraySt9_ConstantddEC1ERKSt8valarrayIdERKd",
+      "std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_Constant, double, double>::_BinClos(std::valarray<double> const&, double const&)" },
+    { "_ZNSt8__detail8_BinClosISt6_Atan2St9_ConstantSt9_ValArrayffEC2ERKfRKSt8valarrayIfE",
+      "std::__detail::_BinClos<std::_Atan2, std::_Constant, std::_ValArray, float, float>::_BinClos(float const&, std::valarray<float> const&)" },
+    { "_ZNSt8__detail8_BinClosISt6_Atan2St9_ValArraySt9_ConstanteeEC5ERKSt8valarrayIeERKe",
+      "std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, long double, long double>::_BinClos(std::valarray<long double> const&, long double const&)" },
+    { "_ZNSt8__detail9_BinBase1ISt6_Atan2St8valarrayIeEEC1ERKeRKS3_",
+      "std::__detail::_BinBase1<std::_Atan2, std::valarray<long double> >::_BinBase1(long double const&, std::valarray<long double> const&)" },
+    { "_ZNSt8__detail9_BinBase2ISt6_Atan2St8valarrayIdEEC2ERKS3_RKd",
+      "std::__detail::_BinBase2<std::_Atan2, std::valarray<double> >::_BinBase2(std::valarray<double> const&, double const&)" },
+    { "_ZNSt8auto_ptrIVKiEC1EPS0_",
+      "std::auto_ptr<int const volatile>::auto_ptr(int const volatile*)" },
+    { "_ZNSt8auto_ptrIiEC2EPi",
+      "std::auto_ptr<int>::auto_ptr(int*)" },
+    { "_ZNSt8ios_base4setfESt13_Ios_Fmtflags",
+      "std::ios_base::setf(std::_Ios_Fmtflags)" },
+    { "_ZNSt8multisetINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEESt4lessIS5_ESaIS5_EED2Ev",
+      "std::multiset<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >, std::less<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >, std::allocator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >::~multiset()" },
+    { "_ZNSt8multisetIPKiSt4lessIS1_ESaIS1_EEC1Ev",
+      "std::multiset<int const*, std::less<int const*>, std::allocator<int const*> >::multiset()" },
+    { "_ZNSt8multisetIPVKiSt4lessIS1_ESaIS1_EE5eraseESt23_Rb_tree_const_iteratorIS1_ES7_",
+      "std::multiset<int const volatile*, std::less<int const volatile*>, std::allocator<int const volatile*> >::erase(std::_Rb_tree_const_iterator<int const volatile*>, std::_Rb_tree_const_iterator<int const volatile*>)" },
+    { "_ZNSt8multisetIPViSt4lessIS1_ESaIS1_EE4findERKS1_",
+      "std::multiset<int volatile*, std::less<int volatile*>, std::allocator<int volatile*> >::find(int volatile* const&)" },
+    { "_ZNSt8multisetIPViSt4lessIS1_ESaIS1_EEC5Ev",
+      "std::multiset<int volatile*, std::less<int volatile*>, std::allocator<int volatile*> >::multiset()" },
+    { "_ZNSt8multisetIPiSt4lessIS0_ESaIS0_EEC2ERKS2_RKS3_",
+      "std::multiset<int*, std::less<int*>, std::allocator<int*> >::multiset(std::less<int*> const&, std::allocator<int*> const&)" },
+    { "_ZNSt8multisetIiSt4lessIiESaIiEE4findERKi",
+      "std::multiset<int, std::less<int>, std::allocator<int> >::find(int const&)" },
+    { "_ZNSt8valarrayIdEC1ERKSt14indirect_arrayIdE",
+      "std::valarray<double>::valarray(std::indirect_array<double> const&)" },
+    { "_ZNSt8valarrayIdEaSINSt8__detail7_UnClosISt4_AbsSt9_ValArraydEEEERS0_RKSt5_ExprIT_dE",
+      "std::valarray<double>& std::valarray<double>::operator=<std::__detail::_UnClos<std::_Abs, std::_ValArray, double> >(std::_Expr<std::__detail::_UnClos<std::_Abs, std::_ValArray, double>, double> const&)" },
+    { "_ZNSt8valarrayIdEaSINSt8__detail8_BinClosISt4_PowSt9_ValArraySt9_ConstantddEEEERS0_RKSt5_ExprIT_dE",
+      "std::valarray<double>& std::valarray<double>::operator=<std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_Constant, double, double> >(std::_Expr<std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_Constant, double, double>, double> const&)" },
+    { "_ZNSt8valarrayIeEaSINSt8__detail7_UnClosISt4_LogSt9_ValArrayeEEEERS0_RKSt5_ExprIT_eE",
+      "std::valarray<long double>& std::valarray<long double>::operator=<std::__detail::_UnClos<std::_Log, std::_ValArray, long double> >(std::_Expr<std::__detail::_UnClos<std::_Log, std::_ValArray, long double>, long double> const&)" },
+    { "_ZNSt8valarrayIeEaSINSt8__detail8_BinClosISt6_Atan2St9_ValArraySt9_ConstanteeEEEERS0_RKSt5_ExprIT_eE",
+      "std::valarray<long double>& std::valarray<long double>::operator=<std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, long double, long double> >(std::_Expr<std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, long double, long double>, long double> const&)" },
+    { "_ZNSt8valarrayIfEaSINSt8__detail7_UnClosISt5_CoshSt9_ValArrayfEEEERS0_RKSt5_ExprIT_fE",
+      "std::valarray<float>& std::valarray<float>::operator=<std::__detail::_UnClos<std::_Cosh, std::_ValArray, float> >(std::_Expr<std::__detail::_UnClos<std::_Cosh, std::_ValArray, float>, float> const&)" },
+    { "_ZNSt8valarrayImED5Ev",
+      "std::valarray<unsigned long>::~valarray()" },
+    { "_ZNSt9basic_iosIcSt11char_traitsIcEE5imbueERKSt6locale",
+      "std::basic_ios<char, std::char_traits<char> >::imbue(std::locale const&)" },
+    { "_ZNSt9binder2ndISt20const_mem_fun1_ref_tIb1ViEEC1ERKS2_RKi",
+      "std::binder2nd<std::const_mem_fun1_ref_t<bool, V, int> >::binder2nd(std::const_mem_fun1_ref_t<bool, V, int> const&, int const&)" },
+    { "_ZNSt9mem_fun_tIi5ClassEC5EMS0_FivE",
+      "std::mem_fun_t<int, Class>::mem_fun_t(int (Class::*)())" },
+    { "_ZSt10_ConstructI4TestS0_EvPT_RKT0_",
+      "void std::_Construct<Test, Test>(Test*, Test const&)" },
+    { "_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPP7derivedSt6vectorIS3_SaIS3_EEEEENSt15iterator_traitsIT_E15difference_typeESA_SA_St26random_access_iterator_tag",
+      "std::iterator_traits<__gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > > >::difference_type std::__distance<__gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > > >(__gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > >, __gnu_cxx::__normal_iterator<derived**, std::vector<derived*, std::allocator<derived*> > >, std::random_access_iterator_tag)" },
+    { "_ZSt10__distanceIPVKiElSt20_List_const_iteratorIT_ES4_St18input_iterator_tag",
+      "long std::__distance<int const volatile*>(std::_List_const_iterator<int const volatile*>, std::_List_const_iterator<int const volatile*>, std::input_iterator_tag)" },
+    { "_ZSt10__distanceISt23_Rb_tree_const_iteratorIPKiEENSt15iterator_traitsIT_E15difference_typeES5_S5_St18input_iterator_tag",
+      "std::iterator_traits<std::_Rb_tree_const_iterator<int const*> >::difference_type std::__distance<std::_Rb_tree_const_iterator<int const*> >(std::_Rb_tree_const_iterator<int const*>, std::_Rb_tree_const_iterator<int const*>, std::input_iterator_tag)" },
+    { "_ZSt10__fill_n_aIPmmmET_S1_T0_RKT1_St26random_access_iterator_tag",
+      "unsigned long* std::__fill_n_a<unsigned long*, unsigned long, unsigned long>(unsigned long*, unsigned long, unsigned long const&, std::random_access_iterator_tag)" },
+    { "_ZSt10__pop_heapIPiN9__gnu_cxx5__ops15_Iter_comp_iterISt10less_equalIiEEEEvT_S7_S7_RT0_",
+      "void std::__pop_heap<int*, __gnu_cxx::__ops::_Iter_comp_iter<std::less_equal<int> > >(int*, int*, int*, __gnu_cxx::__ops::_Iter_comp_iter<std::less_equal<int> >&)" },
+    { "_ZSt10accumulateIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEEiPFiiiEET0_T_SA_S9_T1_",
+      "int std::accumulate<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, int, int (*)(int, int)>(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, int, int (*)(int, int))" },
+    { "_ZSt11__addressofI4DataEPT_RS1_",
+      "Data* std::__addressof<Data>(Data&)" },
+    { "_ZSt11__addressofIKSt5dequeIPKiSaIS2_EEEPT_RS6_",
+      "std::deque<int const*, std::allocator<int const*> > const* std::__addressof<std::deque<int const*, std::allocator<int const*> > const>(std::deque<int const*, std::allocator<int const*> > const&)" },
+    { "_ZSt11__addressofIKSt8_Rb_treeIPiS1_St9_IdentityIS1_ESt4lessIS1_ESaIS1_EEEPT_RS9_",
+      "std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> > const* std::__addressof<std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> > const>(std::_Rb_tree<int*, int*, std::_Identity<int*>, std::less<int*>, std::allocator<int*> > const&)" },
+    { "_ZSt11__addressofISt3setIPK12PasswordFormSt4lessIS3_ESaIS3_EEEPT_RS8_",
+      "std::set<PasswordForm const*, std::less<PasswordForm const*>, std::allocator<PasswordForm const*> >* std::__addressof<std::set<PasswordForm const*, std::less<PasswordForm const*>, std::allocator<PasswordForm const*> > >(std::set<PasswordForm const*, std::less<PasswordForm const*>, std::allocator<PasswordForm const*> >&)" },
+    { "_ZSt11__equal_auxIPcS0_EbT_S1_T0_",
+      "bool std::__equal_aux<char*, char*>(char*, char*, char*)" },
+    { "_ZSt11__make_heapIPiN9__gnu_cxx5__ops15_Iter_comp_iterISt7greaterIiEEEEvT_S7_RT0_",
+      "void std::__make_heap<int*, __gnu_cxx::__ops::_Iter_comp_iter<std::greater<int> > >(int*, int*, __gnu_cxx::__ops::_Iter_comp_iter<std::greater<int> >&)" },
+    { "_ZSt11__push_heapIPiliN9__gnu_cxx5__ops14_Iter_comp_valISt10less_equalIiEEEEvT_T0_S8_T1_RT2_",
+      "void std::__push_heap<int*, long, int, __gnu_cxx::__ops::_Iter_comp_val<std::less_equal<int> > >(int*, long, long, int, __gnu_cxx::__ops::_Iter_comp_val<std::less_equal<int> >&)" },
+    { "_ZSt11__sort_heapIN9__gnu_cxx17__normal_iteratorIPPKcSt6vectorIS3_SaIS3_EEEENS0_5__ops15_Iter_comp_iterIPFbS3_S3_EEEEvT_SE_RT0_",
+      "void std::__sort_heap<__gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > >, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)> >(__gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > >, __gnu_cxx::__normal_iterator<char const**, std::vector<char const*, std::allocator<char const*> > >, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)>&)" },
+    { "_ZSt11equal_rangeIN9__gnu_cxx17__normal_iteratorIP4TestSt6vectorIS2_SaIS2_EEEEiESt4pairIT_S9_ES9_S9_RKT0_",
+      "std::pair<__gnu_cxx::__normal_iterator<Test*, std::vector<Test, std::allocator<Test> > >, __gnu_cxx::__normal_iterator<Test*, std::vector<Test, std::allocator<Test> > > > std::equal_range<__gnu_cxx::__normal_iterator<Test*, std::vector<Test, std::allocator<Test> > >, int>(__gnu_cxx::__normal_iterator<Test*, std::vector<Test, std::allocator<Test> > >, __gnu_cxx::__normal_iterator<Test*, std::vector<Test, std::allocator<Test> > >, int const&)" },
+    { "_ZSt11mem_fun_refIv5ClassRK2S1ESt14mem_fun1_ref_tIT_T0_T1_EMS6_FS5_S7_E",
+      "std::mem_fun1_ref_t<void, Class, S1 const&> std::mem_fun_ref<void, Class, S1 const&>(void (Class::*)(S1 const&))" },
+    { "_ZSt11stable_sortIPiEvT_S1_",
+      "void std::stable_sort<int*>(int*, int*)" },
+    { "_ZSt12__equal_aux1IPwS0_EbT_S1_T0_",
+      "bool std::__equal_aux1<wchar_t*, wchar_t*>(wchar_t*, wchar_t*, wchar_t*)" },
+    { "_ZSt12__miter_baseIN9__gnu_cxx17__normal_iteratorIPPVKiSt6vectorIS3_SaIS3_EEEEET_S9_",
+      "__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > > std::__miter_base<__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > > >(__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >)" },
+    { "_ZSt12__miter_baseIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEET_S7_",
+      "std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >* std::__miter_base<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*)" },
+    { "_ZSt12__miter_baseIPPPiET_S3_",
+      "int*** std::__miter_base<int***>(int***)" },
+    { "_ZSt12__move_mergeIPPKcS2_N9__gnu_cxx5__ops15_Iter_comp_iterIPFbS1_S1_EEEET0_T_SA_SA_SA_S9_T1_",
+      "char const** std::__move_merge<char const**, char const**, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)> >(char const**, char const**, char const**, char const**, char const**, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)>)" },
+    { "_ZSt12__niter_baseIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEET_S7_",
+      "std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >* std::__niter_base<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*>(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*)" },
+    { "_ZSt12__niter_baseIPPKiSt6vectorIS1_SaIS1_EEET_N9__gnu_cxx17__normal_iteratorIS6_T0_EE",
+      "int const** std::__niter_base<int const**, std::vector<int const*, std::allocator<int const*> > >(__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >)" },
+    { "_ZSt12__niter_baseISt14_List_iteratorIPKiEET_S4_",
+      "std::_List_iterator<int const*> std::__niter_base<std::_List_iterator<int const*> >(std::_List_iterator<int const*>)" },
+    { "_ZSt12__niter_baseISt15_Deque_iteratorIPiRS1_PS1_EET_S5_",
+      "std::_Deque_iterator<int*, int*&, int**> std::__niter_base<std::_Deque_iterator<int*, int*&, int**> >(std::_Deque_iterator<int*, int*&, int**>)" },
+    { "_ZSt12__niter_baseISt21front_insert_iteratorISt5dequeIPKcSaIS3_EEEET_S7_",
+      "std::front_insert_iterator<std::deque<char const*, std::allocator<char const*> > > std::__niter_base<std::front_insert_iterator<std::deque<char const*, std::allocator<char const*> > > >(std::front_insert_iterator<std::deque<char const*, std::allocator<char const*> > >)" },
+    { "_ZSt12__niter_wrapIN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEES2_ET_S7_T0_",
+      "__gnu_cxx::__normal_iterator<unsigned long*, std::vector<unsigned long, std::allocator<unsigned long> > > std::__niter_wrap<__gnu_cxx::__normal_iterator<unsigned long*, std::vector<unsigned long, std::allocator<unsigned long> > >, unsigned long*>(__gnu_cxx::__normal_iterator<unsigned long*, std::vector<unsigned long, std::allocator<unsigned long> > >, unsigned long*)" },
+    { "_ZSt12__niter_wrapIPPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEET_RKS8_S8_",
+      "std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >** std::__niter_wrap<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >**>(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >** const&, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >**)" },
+    { "_ZSt12__niter_wrapIPjET_RKS1_S1_",
+      "unsigned int* std::__niter_wrap<unsigned int*>(unsigned int* const&, unsigned int*)" },
+    { "_ZSt12__niter_wrapISt15insert_iteratorISt6vectorIiSaIiEEEET_RKS5_S5_",
+      "std::insert_iterator<std::vector<int, std::allocator<int> > > std::__niter_wrap<std::insert_iterator<std::vector<int, std::allocator<int> > > >(std::insert_iterator<std::vector<int, std::allocator<int> > > const&, std::insert_iterator<std::vector<int, std::allocator<int> > >)" },
+    { "_ZSt13__adjust_heapISt15_Deque_iteratorIiRiPiEliN9__gnu_cxx5__ops15_Iter_comp_iterISt4lessIiEEEEvT_T0_SB_T1_T2_",
+      "void std::__adjust_heap<std::_Deque_iterator<int, int&, int*>, long, int, __gnu_cxx::__ops::_Iter_comp_iter<std::less<int> > >(std::_Deque_iterator<int, int&, int*>, long, long, int, __gnu_cxx::__ops::_Iter_comp_iter<std::less<int> >)" },
+    { "_ZSt13__copy_move_aILb0EPKcSt20back_insert_iteratorINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEET1_T0_SB_SA_",
+      "std::back_insert_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > std::__copy_move_a<false, char const*, std::back_insert_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >(char const*, char const*, std::back_insert_iterator<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >)" },
+    { "_ZSt13__copy_move_aILb0EPPiSt20back_insert_iteratorISt5dequeIS0_SaIS0_EEEET1_T0_S8_S7_",
+      "std::back_insert_iterator<std::deque<int*, std::allocator<int*> > > std::__copy_move_a<false, int**, std::back_insert_iterator<std::deque<int*, std::allocator<int*> > > >(int**, int**, std::back_insert_iterator<std::deque<int*, std::allocator<int*> > >)" },
+    { "_ZSt13__copy_move_aILb0ESt15_Deque_iteratorI13MovableStructRS1_PS1_ES4_ET1_T0_S6_S5_",
+      "std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*> std::__copy_move_a<false, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*> >(std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>)" },
+    { "_ZSt13__heap_selectIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEN9__gnu_cxx5__ops15_Iter_less_iterEEvT_SA_SA_T0_",
+      "void std::__heap_select<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, __gnu_cxx::__ops::_Iter_less_iter>(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt13copy_backwardIPPPKiS3_ET0_T_S5_S4_",
+      "int const*** std::copy_backward<int const***, int const***>(int const***, int const***, int const***)" },
+    { "_ZSt13inner_productIPiS0_iET1_T_S2_T0_S1_",
+      "int std::inner_product<int*, int*, int>(int*, int*, int*, int)" },
+    { "_ZSt14__copy_move_a1ILb0EP3ObjS1_ET1_T0_S3_S2_",
+      "Obj* std::__copy_move_a1<false, Obj*, Obj*>(Obj*, Obj*, Obj*)" },
+    { "_ZSt14__copy_move_a1ILb0EPPiSt20back_insert_iteratorINSt7__cxx114listIS0_SaIS0_EEEEET1_T0_S9_S8_",
+      "std::back_insert_iterator<std::__cxx11::list<int*, std::allocator<int*> > > std::__copy_move_a1<false, int**, std::back_insert_iterator<std::__cxx11::list<int*, std::allocator<int*> > > >(int**, int**, std::back_insert_iterator<std::__cxx11::list<int*, std::allocator<int*> > >)" },
+    { "_ZSt14__copy_move_a1ILb0EPiPjET1_T0_S3_S2_",
+      "unsigned int* std::__copy_move_a1<false, int*, unsigned int*>(int*, int*, unsigned int*)" },
+    { "_ZSt14__copy_move_a1ILb0EiRKiPS0_iESt15_Deque_iteratorIT3_RS4_PS4_ES3_IT0_T1_T2_ESB_S7_",
+      "std::_Deque_iterator<int, int&, int*> std::__copy_move_a1<false, int, int const&, int const*, int>(std::_Deque_iterator<int, int const&, int const*>, std::_Deque_iterator<int, int const&, int const*>, std::_Deque_iterator<int, int&, int*>)" },
+    { "_ZSt14__copy_move_a2ILb0EPPPKiS3_ET1_T0_S5_S4_",
+      "int const*** std::__copy_move_a2<false, int const***, int const***>(int const***, int const***, int const***)" },
+    { "_ZSt14__copy_move_a2ILb1EPP12PasswordFormS2_ET1_T0_S4_S3_",
+      "PasswordForm** std::__copy_move_a2<true, PasswordForm**, PasswordForm**>(PasswordForm**, PasswordForm**, PasswordForm**)" },
+    { "_ZSt14__partial_sortIPiN9__gnu_cxx5__ops15_Iter_less_iterEEvT_S4_S4_T0_",
+      "void std::__partial_sort<int*, __gnu_cxx::__ops::_Iter_less_iter>(int*, int*, int*, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt14set_differenceIPiS0_S0_ET1_T_S2_T0_S3_S1_",
+      "int* std::set_difference<int*, int*, int*>(int*, int*, int*, int*, int*)" },
+    { "_ZSt15__valarray_copyIdNSt8__detail7_UnClosISt4_SinSt9_ValArraydEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS7_E",
+      "void std::__valarray_copy<double, std::__detail::_UnClos<std::_Sin, std::_ValArray, double> >(std::_Expr<std::__detail::_UnClos<std::_Sin, std::_ValArray, double>, double> const&, unsigned long, std::_Array<double>)" },
+    { "_ZSt15__valarray_copyIeNSt8__detail7_UnClosISt4_AbsSt9_ValArrayeEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS7_E",
+      "void std::__valarray_copy<long double, std::__detail::_UnClos<std::_Abs, std::_ValArray, long double> >(std::_Expr<std::__detail::_UnClos<std::_Abs, std::_ValArray, long double>, long double> const&, unsigned long, std::_Array<long double>)" },
+    { "_ZSt15__valarray_copyIeNSt8__detail8_BinClosISt4_PowSt9_ValArraySt9_ConstanteeEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS8_E",
+      "void std::__valarray_copy<long double, std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_Constant, long double, long double> >(std::_Expr<std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_Constant, long double, long double>, long double> const&, unsigned long, std::_Array<long double>)" },
+    { "_ZSt15__valarray_copyIfNSt8__detail7_UnClosISt5_TanhSt9_ValArrayfEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS7_E",
+      "void std::__valarray_copy<float, std::__detail::_UnClos<std::_Tanh, std::_ValArray, float> >(std::_Expr<std::__detail::_UnClos<std::_Tanh, std::_ValArray, float>, float> const&, unsigned long, std::_Array<float>)" },
+    { "_ZSt16__do_uninit_copyIN9__gnu_cxx17__normal_iteratorIP21CompleteMovableStructSt6vectorIS2_SaIS2_EEEES3_ET0_T_S9_S8_",
+      "CompleteMovableStruct* std::__do_uninit_copy<__gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >, CompleteMovableStruct*>(__gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >, __gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >, CompleteMovableStruct*)" },
+    { "_ZSt16__insertion_sortIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEENS0_5__ops15_Iter_comp_iterISt7greaterIiEEEEvT_SC_T0_",
+      "void std::__insertion_sort<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__ops::_Iter_comp_iter<std::greater<int> > >(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__ops::_Iter_comp_iter<std::greater<int> >)" },
+    { "_ZSt16__introsort_loopISt15_Deque_iteratorIiRiPiElN9__gnu_cxx5__ops15_Iter_less_iterEEvT_S7_T0_T1_",
+      "void std::__introsort_loop<std::_Deque_iterator<int, int&, int*>, long, __gnu_cxx::__ops::_Iter_less_iter>(std::_Deque_iterator<int, int&, int*>, std::_Deque_iterator<int, int&, int*>, long, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt16prev_permutationIPiEbT_S1_",
+      "bool std::prev_permutation<int*>(int*, int*)" },
+    { "_ZSt17__size_to_integerm",
+      "std::__size_to_integer(unsigned long)" },
+    { "_ZSt18uninitialized_copyIN9__gnu_cxx17__normal_iteratorIP21CompleteMovableStructSt6vectorIS2_SaIS2_EEEES3_ET0_T_S9_S8_",
+      "CompleteMovableStruct* std::uninitialized_copy<__gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >, CompleteMovableStruct*>(__gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >, __gnu_cxx::__normal_iterator<CompleteMovableStruct*, std::vector<CompleteMovableStruct, std::allocator<CompleteMovableStruct> > >, CompleteMovableStruct*)" },
+    { "_ZSt18uninitialized_copyIPPFvvES2_ET0_T_S4_S3_",
+      "void (**std::uninitialized_copy<void (**)(), void (**)()>(void (**)(), void (**)(), void (**)()))()" },
+    { "_ZSt18uninitialized_copyISt14_List_iteratorIPKiEPS2_ET0_T_S6_S5_",
+      "int const** std::uninitialized_copy<std::_List_iterator<int const*>, int const**>(std::_List_iterator<int const*>, std::_List_iterator<int const*>, int const**)" },
+    { "_ZSt18uninitialized_copyISt15_Deque_iteratorIPViRS2_PS2_ES5_ET0_T_S7_S6_",
+      "std::_Deque_iterator<int volatile*, int volatile*&, int volatile**> std::uninitialized_copy<std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, std::_Deque_iterator<int volatile*, int volatile*&, int volatile**> >(std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>)" },
+    { "_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIP13MovableStructSt6vectorIS2_SaIS2_EEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_",
+      "std::iterator_traits<__gnu_cxx::__normal_iterator<MovableStruct*, std::vector<MovableStruct, std::allocator<MovableStruct> > > >::iterator_category std::__iterator_category<__gnu_cxx::__normal_iterator<MovableStruct*, std::vector<MovableStruct, std::allocator<MovableStruct> > > >(__gnu_cxx::__normal_iterator<MovableStruct*, std::vector<MovableStruct, std::allocator<MovableStruct> > > const&)" },
+    { "_ZSt19__iterator_categoryIP3KeyENSt15iterator_traitsIT_E17iterator_categoryERKS3_",
+      "std::iterator_traits<Key*>::iterator_category std::__iterator_category<Key*>(Key* const&)" },
+    { "_ZSt19__iterator_categoryISt14_List_iteratorIPVKiEENSt15iterator_traitsIT_E17iterator_categoryERKS5_",
+      "std::iterator_traits<std::_List_iterator<int const volatile*> >::iterator_category std::__iterator_category<std::_List_iterator<int const volatile*> >(std::_List_iterator<int const volatile*> const&)" },
+    { "_ZSt19__iterator_categoryISt20_List_const_iteratorIPVKiEENSt15iterator_traitsIT_E17iterator_categoryERKS5_",
+      "std::iterator_traits<std::_List_const_iterator<int const volatile*> >::iterator_category std::__iterator_category<std::_List_const_iterator<int const volatile*> >(std::_List_const_iterator<int const volatile*> const&)" },
+    { "_ZSt20__throw_length_errorPKc",
+      "std::__throw_length_error(char const*)" },
+    { "_ZSt22__chunk_insertion_sortIP4DatalN9__gnu_cxx5__ops15_Iter_less_iterEEvT_S5_T0_T1_",
+      "void std::__chunk_insertion_sort<Data*, long, __gnu_cxx::__ops::_Iter_less_iter>(Data*, Data*, long, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt22__copy_move_backward_aILb0EPPKiS2_ET1_T0_S4_S3_",
+      "int const** std::__copy_move_backward_a<false, int const**, int const**>(int const**, int const**, int const**)" },
+    { "_ZSt22__copy_move_backward_aILb0ESt15_Deque_iteratorI13MovableStructRS1_PS1_ES4_ET1_T0_S6_S5_",
+      "std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*> std::__copy_move_backward_a<false, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*> >(std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>)" },
+    { "_ZSt22__final_insertion_sortIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEN9__gnu_cxx5__ops15_Iter_comp_iterISt6localeEEEvT_SC_T0_",
+      "void std::__final_insertion_sort<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, __gnu_cxx::__ops::_Iter_comp_iter<std::locale> >(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, __gnu_cxx::__ops::_Iter_comp_iter<std::locale>)" },
+    { "_ZSt22__move_median_to_firstISt15_Deque_iteratorIiRiPiEN9__gnu_cxx5__ops15_Iter_less_iterEEvT_S7_S7_S7_T0_",
+      "void std::__move_median_to_first<std::_Deque_iterator<int, int&, int*>, __gnu_cxx::__ops::_Iter_less_iter>(std::_Deque_iterator<int, int&, int*>, std::_Deque_iterator<int, int&, int*>, std::_Deque_iterator<int, int&, int*>, std::_Deque_iterator<int, int&, int*>, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt22__uninitialized_copy_aIP4TestS1_S0_ET0_T_S3_S2_RSaIT1_E",
+      "Test* std::__uninitialized_copy_a<Test*, Test*, Test>(Test*, Test*, Test*, std::allocator<Test>&)" },
+    { "_ZSt22__uninitialized_copy_aIPcS0_cET0_T_S2_S1_RSaIT1_E",
+      "char* std::__uninitialized_copy_a<char*, char*, char>(char*, char*, char*, std::allocator<char>&)" },
+    { "_ZSt22__uninitialized_fill_aISt15_Deque_iteratorIPViRS2_PS2_ES2_S2_EvT_S6_RKT0_RSaIT1_E",
+      "void std::__uninitialized_fill_a<std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, int volatile*, int volatile*>(std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, std::_Deque_iterator<int volatile*, int volatile*&, int volatile**>, int volatile* const&, std::allocator<int volatile*>&)" },
+    { "_ZSt23__copy_move_backward_a1ILb0EP3ObjS1_ET1_T0_S3_S2_",
+      "Obj* std::__copy_move_backward_a1<false, Obj*, Obj*>(Obj*, Obj*, Obj*)" },
+    { "_ZSt23__copy_move_backward_a1ILb0EPPPKiS3_ET1_T0_S5_S4_",
+      "int const*** std::__copy_move_backward_a1<false, int const***, int const***>(int const***, int const***, int const***)" },
+    { "_ZSt23__copy_move_backward_a1ILb0EPiRS0_PS0_S0_ESt15_Deque_iteratorIT3_RS4_PS4_ES3_IT0_T1_T2_ESB_S7_",
+      "std::_Deque_iterator<int*, int*&, int**> std::__copy_move_backward_a1<false, int*, int*&, int**, int*>(std::_Deque_iterator<int*, int*&, int**>, std::_Deque_iterator<int*, int*&, int**>, std::_Deque_iterator<int*, int*&, int**>)" },
+    { "_ZSt23__copy_move_backward_a2ILb0EPPKcS2_ET1_T0_S4_S3_",
+      "char const** std::__copy_move_backward_a2<false, char const**, char const**>(char const**, char const**, char const**)" },
+    { "_ZSt23__copy_move_backward_a2ILb0ESt13_Bit_iteratorS0_ET1_T0_S2_S1_",
+      "std::_Bit_iterator std::__copy_move_backward_a2<false, std::_Bit_iterator, std::_Bit_iterator>(std::_Bit_iterator, std::_Bit_iterator, std::_Bit_iterator)" },
+    { "_ZSt24__merge_sort_with_bufferIPPKcS2_N9__gnu_cxx5__ops15_Iter_comp_iterIPFbS1_S1_EEEEvT_S9_T0_T1_",
+      "void std::__merge_sort_with_buffer<char const**, char const**, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)> >(char const**, char const**, char const**, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(char const*, char const*)>)" },
+    { "_ZSt25__unguarded_linear_insertIPNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEN9__gnu_cxx5__ops14_Val_comp_iterISt6localeEEEvT_T0_",
+      "void std::__unguarded_linear_insert<std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, __gnu_cxx::__ops::_Val_comp_iter<std::locale> >(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >*, __gnu_cxx::__ops::_Val_comp_iter<std::locale>)" },
+    { "_ZSt25__uninitialized_move_copyISt15_Deque_iteratorIPiRS1_PS1_ES0_IS1_RKS1_PS5_ES4_SaIS1_EET1_T_SB_T0_SC_SA_RT2_",
+      "std::_Deque_iterator<int*, int*&, int**> std::__uninitialized_move_copy<std::_Deque_iterator<int*, int*&, int**>, std::_Deque_iterator<int*, int* const&, int* const*>, std::_Deque_iterator<int*, int*&, int**>, std::allocator<int*> >(std::_Deque_iterator<int*, int*&, int**>, std::_Deque_iterator<int*, int*&, int**>, std::_Deque_iterator<int*, int* const&, int* const*>, std::_Deque_iterator<int*, int* const&, int* const*>, std::_Deque_iterator<int*, int*&, int**>, std::allocator<int*>&)" },
+    { "_ZSt25__valarray_copy_constructIdNSt8__detail7_UnClosISt4_LogSt9_ValArraydEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS7_E",
+      "void std::__valarray_copy_construct<double, std::__detail::_UnClos<std::_Log, std::_ValArray, double> >(std::_Expr<std::__detail::_UnClos<std::_Log, std::_ValArray, double>, double> const&, unsigned long, std::_Array<double>)" },
+    { "_ZSt25__valarray_copy_constructIdNSt8__detail8_BinClosISt6_Atan2St9_ValArraySt9_ConstantddEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS8_E",
+      "void std::__valarray_copy_construct<double, std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, double, double> >(std::_Expr<std::__detail::_BinClos<std::_Atan2, std::_ValArray, std::_Constant, double, double>, double> const&, unsigned long, std::_Array<double>)" },
+    { "_ZSt25__valarray_copy_constructIeNSt8__detail8_BinClosISt4_PowSt9_ValArrayS3_eeEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS7_E",
+      "void std::__valarray_copy_construct<long double, std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_ValArray, long double, long double> >(std::_Expr<std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_ValArray, long double, long double>, long double> const&, unsigned long, std::_Array<long double>)" },
+    { "_ZSt25__valarray_copy_constructIfNSt8__detail7_UnClosISt5_SqrtSt9_ValArrayfEEEvRKSt5_ExprIT0_T_EmSt6_ArrayIS7_E",
+      "void std::__valarray_copy_construct<float, std::__detail::_UnClos<std::_Sqrt, std::_ValArray, float> >(std::_Expr<std::__detail::_UnClos<std::_Sqrt, std::_ValArray, float>, float> const&, unsigned long, std::_Array<float>)" },
+    { "_ZSt26__unguarded_insertion_sortIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEENS0_5__ops15_Iter_comp_iterIPFbiiEEEEvT_SC_T0_",
+      "void std::__unguarded_insertion_sort<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(int, int)> >(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__ops::_Iter_comp_iter<bool (*)(int, int)>)" },
+    { "_ZSt27__stable_partition_adaptiveIPiS0_N9__gnu_cxx5__ops10_Iter_predIN13PartitionTest6less_nEEElET_S7_S7_T1_T2_T0_S9_",
+      "int* std::__stable_partition_adaptive<int*, int*, __gnu_cxx::__ops::_Iter_pred<PartitionTest::less_n>, long>(int*, int*, __gnu_cxx::__ops::_Iter_pred<PartitionTest::less_n>, long, int*, long)" },
+    { "_ZSt27__unguarded_partition_pivotISt13_Bit_iteratorN9__gnu_cxx5__ops15_Iter_less_iterEET_S4_S4_T0_",
+      "std::_Bit_iterator std::__unguarded_partition_pivot<std::_Bit_iterator, __gnu_cxx::__ops::_Iter_less_iter>(std::_Bit_iterator, std::_Bit_iterator, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt30__lexicographical_compare_aux1IPcS0_EbT_S1_T0_S2_",
+      "bool std::__lexicographical_compare_aux1<char*, char*>(char*, char*, char*, char*)" },
+    { "_ZSt34__uninitialized_move_if_noexcept_aIPP12PasswordFormS2_SaIS1_EET0_T_S5_S4_RT1_",
+      "PasswordForm** std::__uninitialized_move_if_noexcept_a<PasswordForm**, PasswordForm**, std::allocator<PasswordForm*> >(PasswordForm**, PasswordForm**, PasswordForm**, std::allocator<PasswordForm*>&)" },
+    { "_ZSt3abse",
+      "std::abs(long double)" },
+    { "_ZSt3logIeESt5_ExprINSt8__detail7_UnClosISt4_LogSt9_ValArrayT_EES5_ERKSt8valarrayIS5_E",
+      "std::_Expr<std::__detail::_UnClos<std::_Log, std::_ValArray, long double>, long double> std::log<long double>(std::valarray<long double> const&)" },
+    { "_ZSt3powIeESt5_ExprINSt8__detail8_BinClosISt4_PowSt9_ValArrayS4_T_S5_EES5_ERKSt8valarrayIS5_ESB_",
+      "std::_Expr<std::__detail::_BinClos<std::_Pow, std::_ValArray, std::_ValArray, long double, long double>, long double> std::pow<long double>(std::valarray<long double> const&, std::valarray<long double> const&)" },
+    { "_ZSt3tanIeESt5_ExprINSt8__detail7_UnClosISt4_TanSt9_ValArrayT_EES5_ERKSt8valarrayIS5_E",
+      "std::_Expr<std::__detail::_UnClos<std::_Tan, std::_ValArray, long double>, long double> std::tan<long double>(std::valarray<long double> const&)" },
+    { "_ZSt4atanIeESt5_ExprINSt8__detail7_UnClosISt5_AtanSt9_ValArrayT_EES5_ERKSt8valarrayIS5_E",
+      "std::_Expr<std::__detail::_UnClos<std::_Atan, std::_ValArray, long double>, long double> std::atan<long double>(std::valarray<long double> const&)" },
+    { "_ZSt4copyIN9__gnu_cxx17__normal_iteratorIPKPViSt6vectorIS3_SaIS3_EEEEPS3_ET0_T_SC_SB_",
+      "int volatile** std::copy<__gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >, int volatile**>(__gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >, __gnu_cxx::__normal_iterator<int volatile* const*, std::vector<int volatile*, std::allocator<int volatile*> > >, int volatile**)" },
+    { "_ZSt4copyIN9__gnu_cxx17__normal_iteratorIPPiSt6vectorIS2_SaIS2_EEEES3_ET0_T_S9_S8_",
+      "int** std::copy<__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, int**>(__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, __gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, int**)" },
+    { "_ZSt4copyIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEESt20back_insert_iteratorIS5_EET0_T_SA_S9_",
+      "std::back_insert_iterator<std::vector<int, std::allocator<int> > > std::copy<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, std::back_insert_iterator<std::vector<int, std::allocator<int> > > >(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, std::back_insert_iterator<std::vector<int, std::allocator<int> > >)" },
+    { "_ZSt4copyIPPKcSt20back_insert_iteratorISt6vectorIS1_SaIS1_EEEET0_T_S9_S8_",
+      "std::back_insert_iterator<std::vector<char const*, std::allocator<char const*> > > std::copy<char const**, std::back_insert_iterator<std::vector<char const*, std::allocator<char const*> > > >(char const**, char const**, std::back_insert_iterator<std::vector<char const*, std::allocator<char const*> > >)" },
+    { "_ZSt4copyIPPiPPKiET0_T_S6_S5_",
+      "int const** std::copy<int**, int const**>(int**, int**, int const**)" },
+    { "_ZSt4copyISt14_List_iteratorIPKiEN9__gnu_cxx17__normal_iteratorIPS2_St6vectorIS2_SaIS2_EEEEET0_T_SC_SB_",
+      "__gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > > std::copy<std::_List_iterator<int const*>, __gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > > >(std::_List_iterator<int const*>, std::_List_iterator<int const*>, __gnu_cxx::__normal_iterator<int const**, std::vector<int const*, std::allocator<int const*> > >)" },
+    { "_ZSt4fabse",
+      "std::fabs(long double)" },
+    { "_ZSt4fillISt15_Deque_iteratorIPVKiRS2_PS2_ES2_EvT_S6_RKT0_",
+      "void std::fill<std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>, int const volatile*>(std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>, std::_Deque_iterator<int const volatile*, int const volatile*&, int const volatile**>, int const volatile* const&)" },
+    { "_ZSt4setwi",
+      "std::setw(int)" },
+    { "_ZSt4sortIPiSt10less_equalIiEEvT_S3_T0_",
+      "void std::sort<int*, std::less_equal<int> >(int*, int*, std::less_equal<int>)" },
+    { "_ZSt4swapINSt11_Deque_baseIPViSaIS2_EE16_Deque_impl_dataEEvRT_S7_",
+      "void std::swap<std::_Deque_base<int volatile*, std::allocator<int volatile*> >::_Deque_impl_data>(std::_Deque_base<int volatile*, std::allocator<int volatile*> >::_Deque_impl_data&, std::_Deque_base<int volatile*, std::allocator<int volatile*> >::_Deque_impl_data&)" },
+    { "_ZSt4tanhIdESt5_ExprINSt8__detail7_UnClosISt5_TanhSt9_ValArrayT_EES5_ERKSt8valarrayIS5_E",
+      "std::_Expr<std::__detail::_UnClos<std::_Tanh, std::_ValArray, double>, double> std::tanh<double>(std::valarray<double> const&)" },
+    { "_ZSt5atan2ff",
+      "std::atan2(float, float)" },
+    { "_ZSt5ldexpfi",
+      "std::ldexp(float, int)" },
+    { "_ZSt6__sortIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEENS0_5__ops15_Iter_less_iterEEvT_S9_T0_",
+      "void std::__sort<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__ops::_Iter_less_iter>(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, __gnu_cxx::__ops::_Iter_less_iter)" },
+    { "_ZSt6fill_nIPPKimS1_ET_S3_T0_RKT1_",
+      "int const** std::fill_n<int const**, unsigned long, int const*>(int const**, unsigned long, int const* const&)" },
+    { "_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPiSt6vectorIiSaIiEEEElEvRT_T0_",
+      "void std::advance<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >, long>(__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > >&, long)" },
+    { "_ZSt7advanceISt15_Deque_iteratorI3ObjRKS1_PS2_ElEvRT_T0_",
+      "void std::advance<std::_Deque_iterator<Obj, Obj const&, Obj const*>, long>(std::_Deque_iterator<Obj, Obj const&, Obj const*>&, long)" },
+    { "_ZSt7bind1stISt4lessIiEiESt9binder1stIT_ERKS3_RKT0_",
+      "std::binder1st<std::less<int> > std::bind1st<std::less<int>, int>(std::less<int> const&, int const&)" },
+    { "_ZSt7mem_funIi5ClassESt15const_mem_fun_tIT_T0_EMS3_KFS2_vE",
+      "std::const_mem_fun_t<int, Class> std::mem_fun<int, Class>(int (Class::*)() const)" },
+    { "_ZSt7ptr_funIRK2S1vESt25pointer_to_unary_functionIT_T0_EPFS5_S4_E",
+      "std::pointer_to_unary_function<S1 const&, void> std::ptr_fun<S1 const&, void>(void (*)(S1 const&))" },
+    { "_ZSt8_DestroyIN9__gnu_cxx17__normal_iteratorIPPVKiSt6vectorIS3_SaIS3_EEEES3_EvT_S9_RSaIT0_E",
+      "void std::_Destroy<__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >, int const volatile*>(__gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >, __gnu_cxx::__normal_iterator<int const volatile**, std::vector<int const volatile*, std::allocator<int const volatile*> > >, std::allocator<int const volatile*>&)" },
+    { "_ZSt8_DestroyIP1VS0_EvT_S2_RSaIT0_E",
+      "void std::_Destroy<V*, V>(V*, V*, std::allocator<V>&)" },
+    { "_ZSt8_DestroyIPP12PasswordFormEvT_S3_",
+      "void std::_Destroy<PasswordForm**>(PasswordForm**, PasswordForm**)" },
+    { "_ZSt8_DestroyIPPVKiEvT_S3_",
+      "void std::_Destroy<int const volatile**>(int const volatile**, int const volatile**)" },
+    { "_ZSt8_DestroyISt15_Deque_iteratorI21CompleteMovableStructRS1_PS1_ES1_EvT_S5_RSaIT0_E",
+      "void std::_Destroy<std::_Deque_iterator<CompleteMovableStruct, CompleteMovableStruct&, CompleteMovableStruct*>, CompleteMovableStruct>(std::_Deque_iterator<CompleteMovableStruct, CompleteMovableStruct&, CompleteMovableStruct*>, std::_Deque_iterator<CompleteMovableStruct, CompleteMovableStruct&, CompleteMovableStruct*>, std::allocator<CompleteMovableStruct>&)" },
+    { "_ZSt8__fill_aIPPKcS1_EvT_S3_RKT0_",
+      "void std::__fill_a<char const**, char const*>(char const**, char const**, char const* const&)" },
+    { "_ZSt8__memcmpIccEiPKT_PKT0_m",
+      "int std::__memcmp<char, char>(char const*, char const*, unsigned long)" },
+    { "_ZSt8distanceISt14_List_iteratorIPiEENSt15iterator_traitsIT_E15difference_typeES4_S4_",
+      "std::iterator_traits<std::_List_iterator<int*> >::difference_type std::distance<std::_List_iterator<int*> >(std::_List_iterator<int*>, std::_List_iterator<int*>)" },
+    { "_ZSt8distanceISt23_Rb_tree_const_iteratorIPViEENSt15iterator_traitsIT_E15difference_typeES5_S5_",
+      "std::iterator_traits<std::_Rb_tree_const_iterator<int volatile*> >::difference_type std::distance<std::_Rb_tree_const_iterator<int volatile*> >(std::_Rb_tree_const_iterator<int volatile*>, std::_Rb_tree_const_iterator<int volatile*>)" },
+    { "_ZSt8mismatchIPiS0_ESt4pairIT_T0_ES2_S2_S3_",
+      "std::pair<int*, int*> std::mismatch<int*, int*>(int*, int*, int*)" },
+    { "_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPPiSt6vectorIS2_SaIS2_EEEElEvRT_T0_St26random_access_iterator_tag",
+      "void std::__advance<__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >, long>(__gnu_cxx::__normal_iterator<int**, std::vector<int*, std::allocator<int*> > >&, long, std::random_access_iterator_tag)" },
+    { "_ZSt9__advanceISt15_Deque_iteratorI13MovableStructRS1_PS1_ElEvRT_T0_St26random_access_iterator_tag",
+      "void std::__advance<std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>, long>(std::_Deque_iterator<MovableStruct, MovableStruct&, MovableStruct*>&, long, std::random_access_iterator_tag)" },
+    { "_ZSt9__fill_a1IPPKcS1_EN9__gnu_cxx11__enable_ifIXsrSt11__is_scalarIT0_E7__valueEvE6__typeET_SA_RKS6_",
+      "__gnu_cxx::__enable_if<std::__is_scalar<char const*>::__value, void>::__type std::__fill_a1<char const**, char const*>(char const**, char const**, char const* const&)" },
+    { "_ZSt9__fill_a1IPiiEN9__gnu_cxx11__enable_ifIXsrSt11__is_scalarIT0_E7__valueEvE6__typeET_S8_RKS4_",
+      "__gnu_cxx::__enable_if<std::__is_scalar<int>::__value, void>::__type std::__fill_a1<int*, int>(int*, int*, int const&)" },
+    { "_ZSt9__find_ifIPPKcN9__gnu_cxx5__ops18_Iter_comp_to_iterIPFbS1_S1_ES2_EEET_S9_S9_T0_",
+      "char const** std::__find_if<char const**, __gnu_cxx::__ops::_Iter_comp_to_iter<bool (*)(char const*, char const*), char const**> >(char const**, char const**, __gnu_cxx::__ops::_Iter_comp_to_iter<bool (*)(char const*, char const*), char const**>)" },
+    { "_ZSt9__find_ifIPiN9__gnu_cxx5__ops16_Iter_equals_valIKiEEET_S6_S6_T0_St26random_access_iterator_tag",
+      "int* std::__find_if<int*, __gnu_cxx::__ops::_Iter_equals_val<int const> >(int*, int*, __gnu_cxx::__ops::_Iter_equals_val<int const>, std::random_access_iterator_tag)" },
+    { "_ZSt9boolalphaRSt8ios_base",
+      "std::boolalpha(std::ios_base&)" },
+    { "_ZSt9has_facetISt7codecvtIwc11__mbstate_tEEbRKSt6locale",
+      "bool std::has_facet<std::codecvt<wchar_t, char, __mbstate_t> >(std::locale const&)" },
+    { "_ZSt9iter_swapIPiS0_EvT_T0_",
+      "void std::iter_swap<int*, int*>(int*, int*)" },
+    { "_ZSt9transformIPiS0_St6negateIiEET0_T_S4_S3_T1_",
+      "int* std::transform<int*, int*, std::negate<int> >(int*, int*, int*, std::negate<int>)" },
+    { "_ZSt9use_facetISt8time_putIcSt19ostreambuf_iteratorIcSt11char_traitsIcEEEERKT_RKSt6locale",
+      "std::time_put<char, std::ostreambuf_iterator<char, std::char_traits<char> > > const& std::use_facet<std::time_put<char, std::ostreambuf_iterator<char, std::char_traits<char> > > >(std::locale const&)" },
+    { "_ZSteqIcEN9__gnu_cxx11__enable_ifIXsrSt9__is_charIT_E7__valueEbE6__typeERKNSt7__cxx1112basic_stringIS3_St11char_traitsIS3_ESaIS3_EEESE_",
+      "__gnu_cxx::__enable_if<std::__is_char<char>::__value, bool>::__type std::operator==<char>(std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > const&)" },
+    { "_ZSteqRKSt15_Deque_iteratorI3ObjRS0_PS0_ES5_",
+      "std::operator==(std::_Deque_iterator<Obj, Obj&, Obj*> const&, std::_Deque_iterator<Obj, Obj&, Obj*> const&)" },
+    { "_ZSteqRKSt17_Rb_tree_iteratorIiES2_",
+      "std::operator==(std::_Rb_tree_iterator<int> const&, std::_Rb_tree_iterator<int> const&)" },
+    { "_ZStlsIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_St8_SetfillIS3_E",
+      "std::basic_ostream<char, std::char_traits<char> >& std::operator<< <char, std::char_traits<char> >(std::basic_ostream<char, std::char_traits<char> >&, std::_Setfill<char>)" },
+    { "_ZStmiRKSt15_Deque_iteratorI3ObjRKS0_PS1_ES6_",
+      "std::operator-(std::_Deque_iterator<Obj, Obj const&, Obj const*> const&, std::_Deque_iterator<Obj, Obj const&, Obj const*> const&)" },
+    { "_ZStmiRKSt15_Deque_iteratorIPiRKS0_PS1_ES6_",
+      "std::operator-(std::_Deque_iterator<int*, int* const&, int* const*> const&, std::_Deque_iterator<int*, int* const&, int* const*> const&)" },
+    { "_ZStneRKSt14_List_iteratorIPiES3_",
+      "std::operator!=(std::_List_iterator<int*> const&, std::_List_iterator<int*> const&)" },
+    { "_ZStneRKSt17_Rb_tree_iteratorISt4pairIKiNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEESB_",
+      "std::operator!=(std::_Rb_tree_iterator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > const&, std::_Rb_tree_iterator<std::pair<int const, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > > const&)" },
+    { "_ZStorSt12_Ios_IostateS_",
+      "std::operator|(std::_Ios_Iostate, std::_Ios_Iostate)" },
+    { "_ZStplRKSt15_Deque_iteratorIPViRKS1_PS2_El",
+      "std::operator+(std::_Deque_iterator<int volatile*, int volatile* const&, int volatile* const*> const&, long)" },
+    { "_ZTC1E16_1B",
+      "construction vtable for B-in-E" },
+    { "_ZTI10LocaleTest",
+      "typeinfo for LocaleTest" },
+    { "_ZTI11CodecvtTest",
+      "typeinfo for CodecvtTest" },
+    { "_ZTI12MultisetTest",
+      "typeinfo for MultisetTest" },
+    { "_ZTI13eater_codecvt",
+      "typeinfo for eater_codecvt" },
+    { "_ZTI1B",
+      "typeinfo for B" },
+    { "_ZTI2S2",
+      "typeinfo for S2" },
+    { "_ZTI4Base",
+      "typeinfo for Base" },
+    { "_ZTI8BindTest",
+      "typeinfo for BindTest" },
+    { "_ZTI8TestCase",
+      "typeinfo for TestCase" },
+    { "_ZTIFvvE",
+      "typeinfo for void ()" },
+    { "_ZTIP9Poly_Base",
+      "typeinfo for Poly_Base*" },
+    { "_ZTIPPKPKv",
+      "typeinfo for void const* const**" },
+    { "_ZTISt7codecvtIcc11__mbstate_tE",
+      "typeinfo for std::codecvt<char, char, __mbstate_t>" },
+    { "_ZTS10BitsetTest",
+      "typeinfo name for BitsetTest" },
+    { "_ZTS11BcomposTest",
+      "typeinfo name for BcomposTest" },
+    { "_ZTS11PtrSpecTest",
+      "typeinfo name for PtrSpecTest" },
+    { "_ZTS13GeneratorTest",
+      "typeinfo name for GeneratorTest" },
+    { "_ZTS19OstreamIteratorTest",
+      "typeinfo name for OstreamIteratorTest" },
+    { "_ZTS1e",
+      "typeinfo name for e" },
+    { "_ZTS2pD",
+      "typeinfo name for pD" },
+    { "_ZTS7AdjTest",
+      "typeinfo name for AdjTest" },
+    { "_ZTS8PairTest",
+      "typeinfo name for PairTest" },
+    { "_ZTS9LogicTest",
+      "typeinfo name for LogicTest" },
+    { "_ZTSP1F",
+      "typeinfo name for F*" },
+    { "_ZTSPP1C",
+      "typeinfo name for C**" },
+    { "_ZTT1A",
+      "VTT for A" },
+    { "_ZTV10InsertTest",
+      "vtable for InsertTest" },
+    { "_ZTV11CMainWindow",
+      "vtable for CMainWindow" },
+    { "_ZTV12MismatchTest",
+      "vtable for MismatchTest" },
+    { "_ZTV13eater_codecvt",
+      "vtable for eater_codecvt" },
+    { "_ZTV1F",
+      "vtable for F" },
+    { "_ZTV3Bar",
+      "vtable for Bar" },
+    { "_ZTV8FindTest",
+      "vtable for FindTest" },
+    { "_ZTV9CFrameWnd",
+      "vtable for CFrameWnd" },
+    { "_ZTVN10__cxxabiv121__vmi_class_type_infoE",
+      "vtable for __cxxabiv1::__vmi_class_type_info" },
+    { "_ZThn32_N1DD1Ev",
+      "non-virtual thunk to D::~D()" },
+    { "_ZTv0_n40_N2S42s1Ev",
+      "virtual thunk to S4::s1()" },
+    { "_ZZ11touchStaticILi1EEvvE8instance",
+      "touchStatic<1>()::instance" },
+    { "_ZZ11touchStaticILi34EEvvE8instance",
+      "touchStatic<34>()::instance" },
+    { "_ZZ11touchStaticILi49EEvvE8instance",
+      "touchStatic<49>()::instance" },
+    { "_ZZ11touchStaticILi63EEvvE8instance",
+      "touchStatic<63>()::instance" },
+    { "_ZZNSt13basic_filebufIc9my_traitsE5closeEvEN14__close_sentryC1EPS1_",
+      "std::basic_filebuf<char, my_traits>::close()::__close_sentry::__close_sentry(std::basic_filebuf<char, my_traits>*)" },
+    { "_ZdlPvR9SomeClassRKSt9nothrow_t",
+      "operator delete(void*, SomeClass&, std::nothrow_t const&)" },
+
+    // A cv-qualified member function type is a single substitution
+    // candidate, not one for the function type and one for the qualified
+    // one.
+    { "_Z1gM1AKFivES1_",
+      "g(int (A::*)() const, int (A::*)() const)" },
+    { "_Z1gM1AKFivES0_",
+      "g(int (A::*)() const, int () const)" },
+    { "_Z1gM1AVKFivES1_",
+      "g(int (A::*)() const volatile, int (A::*)() const volatile)" },
+    { "_Z1gPM1AKFivES2_",
+      "g(int (A::**)() const, int (A::**)() const)" },
+    { "_Z1fIiN1BIM1AKFbvEEEEvT_S3_",
+      "void f<int, B<bool (A::*)() const> >(int, bool (A::*)() const)" },
+};
+
+#endif  // DEMANGLE_CORPUS_H
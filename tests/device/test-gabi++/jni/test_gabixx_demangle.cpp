@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program checks the GAbi++ demangler against a corpus of mangled
+ * names taken from the tests (see demangle_corpus.h), and against names of
+ * kinds the corpus lacks. It also checks the error cases of __cxa_demangle(),
+ * the growth of a buffer passed to it, and truncated output.
+ */
+
+#include <cxxabi.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "demangle_corpus.h"
+
+static const size_t kCorpusSize =
+    sizeof(kDemangleCorpus) / sizeof(kDemangleCorpus[0]);
+
+// Names of kinds the corpus has few of, mostly with argument packs. The
+// demangled forms are the ones printed by c++filt, except that it prints a
+// stray ", " for the empty pack of "f<long>()".
+static const DemangleCorpusEntry kExtraNames[] = {
+    // The modifiers of the pattern apply to each element, and references
+    // collapse.
+    { "_Z1fIJiRiEEvDpOT_",
+      "void f<int, int&>(int&&, int&)" },
+    { "_Z1fIJRA3_KccEEvDpOT_",
+      "void f<char const (&) [3], char>(char const (&) [3], char&&)" },
+    { "_Z4crefIJiA3_cEEvDpRKT_",
+      "void cref<int, char [3]>(int const&, char const (&) [3])" },
+    { "_Z6constpIJiKcEEvDpPKT_",
+      "void constp<int, char const>(int const*, char const*)" },
+    // Empty packs print nothing, and c++filt doesn't separate the closing
+    // '>' from a previous one after them.
+    { "_Z1fIJEEvDpOT_",
+      "void f<>()" },
+    { "_Z1hIiJEEvT_DpT0_",
+      "void h<int>(int)" },
+    { "_Z1hIiJdcEEvT_DpT0_",
+      "void h<int, double, char>(int, double, char)" },
+    { "_Z4ptrsIJEEv5tupleIJDpT_EEDpPS1_",
+      "void ptrs<>(tuple<>)" },
+    { "_Z4ptrsIJicEEv5tupleIJDpT_EEDpPS1_",
+      "void ptrs<int, char>(tuple<int, char>, int*, char*)" },
+    { "_Z1fI1AIiJEEJEEvv",
+      "void f<A<int>>()" },
+    // Nested expansions.
+    { "_Z1fIJicEJlsEEvDp5tupleIJT_DpT0_EE",
+      "void f<int, char, long, short>(tuple<int, long, short>, "
+      "tuple<char, long, short>)" },
+    { "_Z1fIJicEJlEEvDpPFvT_DpRT0_E",
+      "void f<int, char, long>(void (*)(int, long&), void (*)(char, long&))" },
+    { "_Z1fIJicEJEEvDp5tupleIJT_DpT0_EE",
+      "void f<int, char>(tuple<int>, tuple<char>)" },
+    { "_Z1fIJEJlEEvDp5tupleIJT_DpT0_EE",
+      "void f<long>()" },
+    { "_ZN1XIJicEE6nestedIJlEEEv5tupleIJiDpT_EES2_IJcS4_EE",
+      "void X<int, char>::nested<long>(tuple<int, long>, tuple<char, long>)" },
+    // Packs in expressions.
+    { "_Z5countIJicEEvP5labelIXsZT_EEDpT_",
+      "void count<int, char>(label<2>*, int, char)" },
+    { "_Z5countIJEEvP5labelIXsZT_EEDpT_",
+      "void count<>(label<0>*)" },
+    { "_Z3idxIiJLi0ELi1ELi2EEEv3seqIT_JXspT0_EEE",
+      "void idx<int, 0, 1, 2>(seq<int, 0, 1, 2>)" },
+    { "_Z3idxIlJEEv3seqIT_JXspT0_EEE",
+      "void idx<long>(seq<long>)" },
+    // Addresses of variables and member functions are printed as names.
+    { "_Z1fIXadL_Z1xEEEvv",
+      "void f<&x>()" },
+    { "_Z1fIXadL_ZN1A1gEiEEEvv",
+      "void f<&A::g>()" },
+    { "_Z1fIXadL_ZNK1A1gEiEEEvv",
+      "void f<&(A::g(int) const)>()" },
+    { "_Z1fIXadL_Z1giEEEvv",
+      "void f<&(g(int))>()" },
+};
+
+static int check_names(const DemangleCorpusEntry* entries, size_t count)
+{
+    int fail = 0;
+    char buffer[1024];
+    for (size_t n = 0; n < count; n++) {
+        const DemangleCorpusEntry& entry = entries[n];
+        int length = __gabixx::__demangle(entry.mangled, buffer, sizeof(buffer));
+        if (length < 0 || strcmp(buffer, entry.demangled) != 0 ||
+            static_cast<size_t>(length) != strlen(entry.demangled)) {
+            fprintf(stderr, "KO: %s\n  expected: %s\n  got:      %s\n",
+                    entry.mangled, entry.demangled,
+                    length < 0 ? "(invalid)" : buffer);
+            fail++;
+        }
+    }
+    return fail;
+}
+
+static int check_cxa_demangle(void)
+{
+    int fail = 0;
+    int status;
+
+    // Buffer too small: it must be reallocated, and |length| updated.
+    size_t length = 4;
+    char* buffer = static_cast<char*>(malloc(length));
+    buffer = abi::__cxa_demangle("_ZNSt6vectorIiSaIiEE9push_backERKi",
+                                 buffer, &length, &status);
+    if (status != 0 || buffer == NULL ||
+        strcmp(buffer, "std::vector<int, std::allocator<int> >::"
+                       "push_back(int const&)") != 0 ||
+        length <= strlen(buffer)) {
+        fprintf(stderr, "KO: __cxa_demangle() didn't grow the buffer\n");
+        fail++;
+    }
+    free(buffer);
+
+    buffer = abi::__cxa_demangle("_ZN3foo", NULL, NULL, &status);
+    if (buffer != NULL || status != -2) {
+        fprintf(stderr, "KO: invalid name gave status %d\n", status);
+        fail++;
+    }
+    free(buffer);
+
+    buffer = abi::__cxa_demangle(NULL, NULL, NULL, &status);
+    if (buffer != NULL || status != -3) {
+        fprintf(stderr, "KO: NULL name gave status %d\n", status);
+        fail++;
+    }
+
+    // Truncated output must still be zero-terminated.
+    char small[8];
+    int needed = __gabixx::__demangle("_ZN9Namespace5ClassC2Ev",
+                                      small, sizeof(small));
+    if (needed != static_cast<int>(strlen("Namespace::Class::Class()")) ||
+        strlen(small) >= sizeof(small)) {
+        fprintf(stderr, "KO: truncated output returned %d\n", needed);
+        fail++;
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    fail += check_names(kDemangleCorpus, kCorpusSize);
+    fail += check_names(kExtraNames,
+                        sizeof(kExtraNames) / sizeof(kExtraNames[0]));
+    fail += check_cxa_demangle();
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
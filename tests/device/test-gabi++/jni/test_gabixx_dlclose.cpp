@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program checks that dynamic_cast<> results cached for a library
+ * are not used for another library loaded at the same address after a
+ * dlclose(). The two libraries are built from test_gabixx_dlclose_lib.cpp;
+ * the cast succeeds in the first one only.
+ *
+ * The libraries are looked up in the directory given as first argument,
+ * or in /data/local/tmp/ndk-tests.
+ */
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef int (*cast_func)();
+typedef void (*keys_func)(const void** keys);
+
+#define NUM_KEYS  3
+
+static const char* sDir = "/data/local/tmp/ndk-tests";
+
+// Loads |name|, stores the cache keys of its cast in |keys| and returns
+// the result of the cast, or -1 on error.
+static int cast_in(const char* name, const void** keys)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", sDir, name);
+    void* lib = dlopen(path, RTLD_NOW);
+    if (lib == NULL) {
+        fprintf(stderr, "Could not dlopen(\"%s\"): %s\n", path, dlerror());
+        return -1;
+    }
+    cast_func cast = (cast_func) dlsym(lib, "test_gabixx_dlclose_cast");
+    keys_func get_keys = (keys_func) dlsym(lib, "test_gabixx_dlclose_keys");
+    if (cast == NULL || get_keys == NULL) {
+        fprintf(stderr, "Missing symbols in %s\n", path);
+        dlclose(lib);
+        return -1;
+    }
+    get_keys(keys);
+    // Cast twice, so that the second cast can be served by the cache.
+    int result = cast();
+    result = cast();
+    dlclose(lib);
+    return result;
+}
+
+// Casts in the library that derives from Target, then in the one that
+// doesn't. Returns the number of failures.
+static int run(const char* what, bool flush)
+{
+    const void* keys_a[NUM_KEYS];
+    const void* keys_b[NUM_KEYS];
+    int a = cast_in("libtest_gabixx_dlclose_a.so", keys_a);
+    if (flush)
+        __gabixx::__flush_dynamic_cast_cache();
+    int b = cast_in("libtest_gabixx_dlclose_b.so", keys_b);
+    if (a < 0 || b < 0)
+        return 1;
+
+    if (memcmp(keys_a, keys_b, sizeof(keys_a)) != 0)
+        printf("%s: libraries not loaded at the same address, "
+               "stale entries can't be checked\n", what);
+
+    int fail = 0;
+    if (a != 1) {
+        fprintf(stderr, "KO: %s: cast failed in the first library\n", what);
+        fail++;
+    }
+    if (b != 0) {
+        fprintf(stderr, "KO: %s: cast succeeded in the second library\n",
+                what);
+        fail++;
+    }
+    return fail;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        sDir = argv[1];
+
+    int fail = run("cache disabled", false);
+
+    __gabixx::__set_dynamic_cast_cache_enabled(true);
+    fail += run("cache enabled", true);
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
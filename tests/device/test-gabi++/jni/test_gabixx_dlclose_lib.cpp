@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Library loaded by test_gabixx_dlclose.cpp. It is built twice, with the
+ * same classes at the same places: with TEST_GABIXX_DLCLOSE_TARGET=1, Impl
+ * derives from Target, otherwise from Object, which has the same layout.
+ * A dynamic_cast<Target*> of an Impl succeeds in the first library only.
+ */
+
+#include <typeinfo>
+
+struct Base   { virtual ~Base(); int b; };
+struct Target { virtual ~Target(); int t; };
+struct Object { virtual ~Object(); int o; };
+
+#if TEST_GABIXX_DLCLOSE_TARGET
+struct Impl : Base, Target { virtual ~Impl(); int i; };
+#else
+struct Impl : Base, Object { virtual ~Impl(); int i; };
+#endif
+
+Base::~Base() {}
+Target::~Target() {}
+Object::~Object() {}
+Impl::~Impl() {}
+
+static Impl sImpl;
+
+// Returns 1 if the cast to Target succeeds.
+extern "C" int test_gabixx_dlclose_cast()
+{
+    // Keep the compiler from folding the cast.
+    Base* volatile base = &sImpl;
+    return dynamic_cast<Target*>(base) != 0;
+}
+
+// Returns the addresses the __dynamic_cast() cache is keyed by.
+extern "C" void test_gabixx_dlclose_keys(const void** keys)
+{
+    keys[0] = *reinterpret_cast<void* const*>(&sImpl);
+    keys[1] = &typeid(Base);
+    keys[2] = &typeid(Target);
+}
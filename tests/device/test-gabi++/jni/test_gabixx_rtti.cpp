@@ -90,7 +90,14 @@ int main()
 
     printf("polyderived is: %s\n", typeid(polyderived).name());
     printf(" *ppolybase is: %s\n", typeid(*ppolybase).name());
-    
+
+    // inequality and hashes:
+    CHECK(typeid(Poly_Derived) != typeid(Poly_Base));
+    CHECK(typeid(Derived) != typeid(Base));
+    CHECK(!(typeid(int) != typeid(i)));
+    CHECK(typeid(polyderived).hash_code() == typeid(*ppolybase).hash_code());
+    CHECK(typeid(pbase).hash_code() == typeid(Base*).hash_code());
+
     bar = dynamic_cast<Bar*>(foo);
     if (bar != NULL) {
         printf("OK: 'foo' is pointing to a Bar class instance.\n");
@@ -0,0 +1,21 @@
+LOCAL_PATH := $(call my-dir)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_stlport_hash_benchmark
+LOCAL_SRC_FILES := test_stlport_hash_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := libstlport_shared
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_stlport_iostream_benchmark
+LOCAL_SRC_FILES := test_stlport_iostream_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := libstlport_shared
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_stlport_locale_benchmark
+LOCAL_SRC_FILES := test_stlport_locale_benchmark.cpp
+LOCAL_SHARED_LIBRARIES := libstlport_shared
+include $(BUILD_EXECUTABLE)
+
+$(call import-module,cxx-stl/stlport)
@@ -0,0 +1,12 @@
+# Note: by default, build for all supported ABIs
+#       build.sh in the project tree will check
+#       all generated files to ensure that none
+#       was forgotten.
+#
+APP_ABI := all
+
+# Note: we use APP_STL because we explicitely import
+#       the STLport libraries in our modules.
+#
+APP_STL := none
+STLPORT_FORCE_REBUILD := true
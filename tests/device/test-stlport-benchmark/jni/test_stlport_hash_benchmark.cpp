@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program compares the STLport hash containers on NUM_KEYS distinct
+ * integer keys, in a random order:
+ *
+ *  - insertion of all the keys in an empty container,
+ *  - lookup of all the keys in another order, then of as many missing keys,
+ *  - erasure of all the keys, one by one.
+ *
+ * The containers are hash_map, which chains nodes from a single list,
+ * tr1::unordered_map, which uses the same hashtable, and flat_hash_map,
+ * which stores the elements in a single array with open addressing.
+ */
+
+#include <flat_hash_map>
+#include <hash_map>
+#include <unordered_map>
+#include <vector>
+#include <stdio.h>
+#include <time.h>
+
+#ifndef NUM_KEYS
+#define NUM_KEYS        10000000
+#endif
+
+static int fail = 0;
+
+#define CHECK(cond)  \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "KO: Assertion failure: %s\n", #cond); \
+            fail++;\
+        }\
+    } while (0)
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// The keys are a bijection of the integers, so they are distinct, and
+// look random: consecutive keys do not go to neighbouring buckets with the
+// identity hash function of hash_map. The missing keys are the images of
+// the even integers.
+static unsigned int scramble(unsigned int x)
+{
+    x ^= x >> 16;
+    x *= 0x85ebca6b;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35;
+    x ^= x >> 16;
+    return x;
+}
+
+static unsigned int key_at(unsigned int n)
+{
+    return scramble(2 * n + 1);
+}
+
+static unsigned int missing_key_at(unsigned int n)
+{
+    return scramble(2 * n);
+}
+
+// The keys are looked up and erased in a random order, so that the nodes
+// of hash_map and unordered_map are not visited in the order they were
+// allocated.
+static std::vector<unsigned int> sOrder;
+
+static void shuffle_order(void)
+{
+    sOrder.resize(NUM_KEYS);
+    for (unsigned int nn = 0; nn < NUM_KEYS; nn++)
+        sOrder[nn] = nn;
+    unsigned long long seed = 1;
+    for (unsigned int nn = NUM_KEYS - 1; nn > 0; nn--) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        unsigned int other = (unsigned int)((seed >> 33) % (nn + 1));
+        std::swap(sOrder[nn], sOrder[other]);
+    }
+}
+
+template <class Map>
+static void bench_map(const char* name)
+{
+    Map map;
+
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_KEYS; nn++)
+        map[key_at(nn)] = nn;
+    double elapsed = now_ns() - start;
+    CHECK(map.size() == NUM_KEYS);
+    printf("%-14s insert:     %6.1f ns/key\n", name, elapsed / NUM_KEYS);
+
+    unsigned int found = 0;
+    start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_KEYS; nn++) {
+        unsigned int index = sOrder[nn];
+        typename Map::const_iterator it = map.find(key_at(index));
+        found += (it != map.end() && it->second == index);
+    }
+    elapsed = now_ns() - start;
+    CHECK(found == NUM_KEYS);
+    printf("%-14s find:       %6.1f ns/key\n", name, elapsed / NUM_KEYS);
+
+    found = 0;
+    start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_KEYS; nn++)
+        found += (map.find(missing_key_at(nn)) != map.end());
+    elapsed = now_ns() - start;
+    CHECK(found == 0);
+    printf("%-14s find missing:%5.1f ns/key\n", name, elapsed / NUM_KEYS);
+
+    unsigned int erased = 0;
+    start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_KEYS; nn++)
+        erased += map.erase(key_at(sOrder[nn]));
+    elapsed = now_ns() - start;
+    CHECK(erased == NUM_KEYS);
+    CHECK(map.empty());
+    printf("%-14s erase:      %6.1f ns/key\n", name, elapsed / NUM_KEYS);
+}
+
+int main(void)
+{
+    shuffle_order();
+
+    bench_map<std::hash_map<unsigned int, unsigned int> >("hash_map");
+    bench_map<std::tr1::unordered_map<unsigned int, unsigned int> >("unordered_map");
+    bench_map<std::flat_hash_map<unsigned int, unsigned int> >("flat_hash_map");
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
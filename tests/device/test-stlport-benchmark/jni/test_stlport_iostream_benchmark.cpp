@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program compares the formatted integer input and output of char
+ * streams using the classic locale, which go straight to the stream
+ * buffer, with the ones of streams whose locale only differs by its
+ * num_put and num_get facets, which go through the facets:
+ *
+ *  - output of NUM_VALUES integers to an ostringstream,
+ *  - input of the same integers from an istringstream.
+ *
+ * The values are spread over all the magnitudes, half of them negative.
+ */
+
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <time.h>
+
+#ifndef NUM_VALUES
+#define NUM_VALUES      2000000
+#endif
+
+static int fail = 0;
+
+#define CHECK(cond)  \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "KO: Assertion failure: %s\n", #cond); \
+            fail++;\
+        }\
+    } while (0)
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static std::vector<int> sValues;
+
+static void make_values(void)
+{
+    sValues.resize(NUM_VALUES);
+    unsigned long long seed = 1;
+    for (unsigned int nn = 0; nn < NUM_VALUES; nn++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int value = (int)((seed >> 33) >> ((seed >> 8) % 31));
+        sValues[nn] = (nn & 1) ? -value : value;
+    }
+}
+
+// Same behavior as the classic locale, but the locale has no name since
+// its facets were replaced, so the streams cannot take the shortcut.
+static std::locale facet_locale(void)
+{
+    std::locale loc(std::locale::classic(), new std::num_put<char>);
+    return std::locale(loc, new std::num_get<char>);
+}
+
+static std::string bench_output(const char* name, const std::locale& loc)
+{
+    std::ostringstream os;
+    os.imbue(loc);
+
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_VALUES; nn++)
+        os << sValues[nn] << ' ';
+    double elapsed = now_ns() - start;
+    CHECK(os.good());
+    printf("%-8s output: %6.1f ns/value\n", name, elapsed / NUM_VALUES);
+    return os.str();
+}
+
+static void bench_input(const char* name, const std::locale& loc,
+                        const std::string& str)
+{
+    std::istringstream is(str);
+    is.imbue(loc);
+
+    unsigned int matched = 0;
+    int value;
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_VALUES; nn++) {
+        is >> value;
+        matched += (value == sValues[nn]);
+    }
+    double elapsed = now_ns() - start;
+    CHECK(!is.fail());
+    CHECK(matched == NUM_VALUES);
+    is >> value;
+    CHECK(is.fail() && is.eof());
+    printf("%-8s input:  %6.1f ns/value\n", name, elapsed / NUM_VALUES);
+}
+
+int main(void)
+{
+    make_values();
+
+    const std::locale classic = std::locale::classic();
+    const std::locale facets = facet_locale();
+
+    std::string classic_str = bench_output("classic", classic);
+    std::string facets_str = bench_output("facets", facets);
+    CHECK(classic_str == facets_str);
+
+    bench_input("classic", classic, classic_str);
+    bench_input("facets", facets, classic_str);
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2013 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This program measures the locale bookkeeping done by char streams, which
+ * is dominated by the reference counts of the locales:
+ *
+ *  - construction of NUM_STREAMS ostringstreams, each writing one integer,
+ *  - copies of the global locale,
+ *  - use_facet lookups on the classic locale,
+ *  - output of doubles, which goes through the num_put facet of the stream.
+ */
+
+#include <locale>
+#include <sstream>
+#include <string>
+#include <stdio.h>
+#include <time.h>
+
+#ifndef NUM_STREAMS
+#define NUM_STREAMS     1000000
+#endif
+
+static int fail = 0;
+
+#define CHECK(cond)  \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "KO: Assertion failure: %s\n", #cond); \
+            fail++;\
+        }\
+    } while (0)
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_streams(void)
+{
+    size_t length = 0;
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_STREAMS; nn++) {
+        std::ostringstream os;
+        os << nn;
+        length += os.str().size();
+    }
+    double elapsed = now_ns() - start;
+    CHECK(length > NUM_STREAMS);
+    printf("ostringstream:    %6.1f ns/stream\n", elapsed / NUM_STREAMS);
+}
+
+static void bench_locale_copies(void)
+{
+    unsigned int matched = 0;
+    const std::locale global;
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_STREAMS; nn++) {
+        std::locale loc;
+        matched += (loc == global);
+    }
+    double elapsed = now_ns() - start;
+    CHECK(matched == NUM_STREAMS);
+    printf("locale copy:      %6.1f ns/copy\n", elapsed / NUM_STREAMS);
+}
+
+static void bench_use_facet(void)
+{
+    typedef std::num_put<char> NumPut;
+    const std::locale& classic = std::locale::classic();
+    const std::ctype<char>* ctype = &std::use_facet<std::ctype<char> >(classic);
+    const NumPut* num_put = &std::use_facet<NumPut>(classic);
+
+    unsigned int matched = 0;
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_STREAMS; nn++) {
+        matched += (&std::use_facet<std::ctype<char> >(classic) == ctype);
+        matched += (&std::use_facet<NumPut>(classic) == num_put);
+    }
+    double elapsed = now_ns() - start;
+    CHECK(matched == 2 * NUM_STREAMS);
+    printf("use_facet:        %6.1f ns/lookup\n", elapsed / (2 * NUM_STREAMS));
+}
+
+static void bench_num_put(void)
+{
+    std::ostringstream os;
+    double start = now_ns();
+    for (unsigned int nn = 0; nn < NUM_STREAMS; nn++)
+        os << nn * 0.5 << ' ';
+    double elapsed = now_ns() - start;
+    CHECK(os.good());
+    CHECK(os.str().compare(0, 10, "0 0.5 1 1.") == 0);
+    printf("double output:    %6.1f ns/value\n", elapsed / NUM_STREAMS);
+}
+
+int main(void)
+{
+    bench_streams();
+    bench_locale_copies();
+    bench_use_facet();
+    bench_num_put();
+
+    if (fail == 0)
+        printf("OK\n");
+    return fail;
+}
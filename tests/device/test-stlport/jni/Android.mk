@@ -24,4 +24,21 @@ LOCAL_SHARED_LIBRARIES := libstlport_shared
 
 include $(BUILD_EXECUTABLE)
 
+# The emplace and rvalue reference tests only run in C++11 mode.
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_stlport_cxx11
+LOCAL_SRC_FILES := unit/emplace_test.cpp unit/cppunit/test_main.cpp
+LOCAL_CPPFLAGS := -std=gnu++11
+LOCAL_SHARED_LIBRARIES := libstlport_shared
+include $(BUILD_EXECUTABLE)
+
+# The whole suite again in the light debug mode, where debug_iterator_test.cpp
+# also checks that the use of invalid iterators is detected.
+include $(CLEAR_VARS)
+LOCAL_MODULE := test_stlport_debug_light
+LOCAL_SRC_FILES := $(sources)
+LOCAL_SRC_FILES += unit/cppunit/test_main.cpp
+LOCAL_STATIC_LIBRARIES := stlport_static_debug_light
+include $(BUILD_EXECUTABLE)
+
 $(call import-module,cxx-stl/stlport)
\ No newline at end of file
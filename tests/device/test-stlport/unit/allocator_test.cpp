@@ -21,6 +21,9 @@ class AllocatorTest : public CPPUNIT_NS::TestCase
 #endif
 #if defined (STLPORT) && defined (_STLP_THREADS) && defined (_STLP_USE_PERTHREAD_ALLOC)
   CPPUNIT_TEST(per_thread_alloc);
+#endif
+#if defined (STLPORT) && !defined (_STLP_USE_NO_IOSTREAMS)
+  CPPUNIT_TEST(node_alloc_trim);
 #endif
   CPPUNIT_TEST_SUITE_END();
 
@@ -28,6 +31,7 @@ protected:
   void zero_allocation();
   void bad_alloc_test();
   void per_thread_alloc();
+  void node_alloc_trim();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(AllocatorTest);
@@ -166,3 +170,114 @@ void AllocatorTest::per_thread_alloc()
   }
 }
 #endif
+
+#if defined (STLPORT) && !defined (_STLP_USE_NO_IOSTREAMS)
+#  if defined (_STLP_PTHREADS)
+#    include <pthread.h>
+#  endif
+
+// Allocates n nodes of each size class of the node allocator, and stores
+// them in nodes, or frees each one right away if nodes is 0.
+static void node_alloc_burst(void** nodes, size_t n) {
+  __node_alloc_stats stats;
+  __node_alloc::get_stats(stats);
+  for (size_t i = 0; i < __node_alloc_stats::size_classes; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      size_t size = stats.node_size[i];
+      void* p = __node_alloc::allocate(size);
+      if (nodes != 0)
+        nodes[i * n + j] = p;
+      else
+        __node_alloc::deallocate(p, size);
+    }
+  }
+}
+
+static void node_alloc_free(void** nodes, size_t n) {
+  __node_alloc_stats stats;
+  __node_alloc::get_stats(stats);
+  for (size_t i = 0; i < __node_alloc_stats::size_classes; ++i) {
+    for (size_t j = 0; j < n; ++j)
+      __node_alloc::deallocate(nodes[i * n + j], stats.node_size[i]);
+  }
+}
+
+#  if defined (_STLP_PTHREADS)
+static void* node_alloc_thread(void*) {
+  // Leaves nodes in the cache of the thread, that go back to the shared
+  // free lists when it exits.
+  node_alloc_burst(0, 100);
+  return 0;
+}
+#  endif
+
+static bool node_alloc_stats_consistent(const __node_alloc_stats& stats) {
+  size_t bytes = 0;
+  for (size_t i = 0; i < __node_alloc_stats::size_classes; ++i) {
+    if (stats.free_nodes[i] * stats.node_size[i] > stats.bytes[i])
+      return false;
+    bytes += stats.bytes[i];
+  }
+  return bytes <= stats.heap_bytes &&
+         stats.heap_bytes <= stats.heap_high_watermark &&
+         (stats.chunk_count != 0) == (stats.heap_bytes != 0);
+}
+
+void AllocatorTest::node_alloc_trim()
+{
+  const size_t n = 200;
+  void** nodes = new void*[__node_alloc_stats::size_classes * n];
+
+  __node_alloc::trim();
+  __node_alloc_stats before;
+  __node_alloc::get_stats(before);
+  CPPUNIT_CHECK( node_alloc_stats_consistent(before) );
+
+  node_alloc_burst(nodes, n);
+#  if defined (_STLP_PTHREADS)
+  pthread_t thread;
+  CPPUNIT_ASSERT( pthread_create(&thread, 0, node_alloc_thread, 0) == 0 );
+  pthread_join(thread, 0);
+#  endif
+
+  __node_alloc_stats busy;
+  __node_alloc::get_stats(busy);
+  CPPUNIT_CHECK( node_alloc_stats_consistent(busy) );
+  if (busy.chunk_count == 0) {
+    // The lock free implementation does not keep track of its chunks, and
+    // never releases them.
+    CPPUNIT_CHECK( __node_alloc::trim() == 0 );
+    node_alloc_free(nodes, n);
+    delete [] nodes;
+    return;
+  }
+  CPPUNIT_CHECK( busy.chunk_count > before.chunk_count );
+  CPPUNIT_CHECK( busy.heap_bytes > before.heap_bytes );
+  for (size_t i = 0; i < __node_alloc_stats::size_classes; ++i)
+    CPPUNIT_CHECK( busy.bytes[i] >= n * busy.node_size[i] );
+
+  node_alloc_free(nodes, n);
+  size_t released = __node_alloc::trim();
+  __node_alloc_stats trimmed;
+  __node_alloc::get_stats(trimmed);
+  CPPUNIT_CHECK( node_alloc_stats_consistent(trimmed) );
+  CPPUNIT_CHECK( released > 0 );
+  CPPUNIT_CHECK( trimmed.chunk_count < busy.chunk_count );
+  CPPUNIT_CHECK( trimmed.heap_bytes == busy.heap_bytes - released );
+  CPPUNIT_CHECK( trimmed.heap_high_watermark == busy.heap_high_watermark );
+
+  // With a threshold, deallocations release chunks by themselves.
+  node_alloc_burst(nodes, n);
+  __node_alloc::get_stats(busy);
+  __node_alloc::set_trim_threshold(4096);
+  node_alloc_free(nodes, n);
+  __node_alloc_stats auto_trimmed;
+  __node_alloc::get_stats(auto_trimmed);
+  __node_alloc::set_trim_threshold(0);
+  CPPUNIT_CHECK( node_alloc_stats_consistent(auto_trimmed) );
+  CPPUNIT_CHECK( auto_trimmed.chunk_count < busy.chunk_count );
+  CPPUNIT_CHECK( auto_trimmed.heap_bytes < busy.heap_bytes );
+
+  delete [] nodes;
+}
+#endif
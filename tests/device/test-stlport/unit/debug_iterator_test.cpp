@@ -0,0 +1,182 @@
+#include <vector>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+
+#if defined (STLPORT) && defined (_STLP_DEBUG) && defined (_STLP_DEBUG_MODE_THROWS)
+#  define DO_INVALID_ITERATOR_TEST
+#  include <stdexcept>
+#endif
+
+#include "cppunit/cppunit_proxy.h"
+
+#if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
+using namespace std;
+#endif
+
+//
+// TestCase class
+//
+class DebugIteratorTest : public CPPUNIT_NS::TestCase
+{
+  CPPUNIT_TEST_SUITE(DebugIteratorTest);
+  CPPUNIT_TEST(end_after_clear);
+  CPPUNIT_TEST(swapped_iterators);
+#if !defined (DO_INVALID_ITERATOR_TEST)
+  CPPUNIT_IGNORE;
+#endif
+  CPPUNIT_TEST(invalid_iterators);
+  CPPUNIT_TEST_SUITE_END();
+
+protected:
+  void end_after_clear();
+  void swapped_iterators();
+  void invalid_iterators();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(DebugIteratorTest);
+
+//
+// tests implementation
+//
+// The past-the-end iterator of a node based container stays valid when the
+// container is cleared, and moves to the elements inserted afterwards.
+void DebugIteratorTest::end_after_clear()
+{
+  {
+    list<int> l(3, 1);
+    list<int>::iterator e = l.end();
+    l.clear();
+    CPPUNIT_ASSERT( e == l.end() );
+    l.push_back(7);
+    --e;
+    CPPUNIT_ASSERT( *e == 7 );
+    CPPUNIT_ASSERT( e == l.begin() );
+    ++e;
+    CPPUNIT_ASSERT( e == l.end() );
+  }
+  {
+    list<int> l(3, 1);
+    list<int>::iterator e = l.end();
+    l.clear();
+    l.insert(e, 5);
+    l.insert(e, 6);
+    --e;
+    CPPUNIT_ASSERT( *e == 6 );
+    --e;
+    CPPUNIT_ASSERT( *e == 5 );
+  }
+  {
+    map<int, int> m;
+    m[1] = 1;
+    m[2] = 2;
+    map<int, int>::iterator e = m.end();
+    m.clear();
+    m[7] = 8;
+    --e;
+    CPPUNIT_ASSERT( e->first == 7 );
+    CPPUNIT_ASSERT( (*e).second == 8 );
+  }
+  {
+    set<int> s;
+    s.insert(1);
+    set<int>::const_iterator e = s.end();
+    s.clear();
+    s.insert(3);
+    s.insert(4);
+    --e;
+    CPPUNIT_ASSERT( *e == 4 );
+    --e;
+    CPPUNIT_ASSERT( *e == 3 );
+    CPPUNIT_ASSERT( e == s.begin() );
+  }
+}
+
+// Iterators keep pointing to their elements in the container they have been
+// moved to by a swap or a splice.
+void DebugIteratorTest::swapped_iterators()
+{
+  {
+    vector<int> v1(3, 1), v2(2, 2);
+    vector<int>::iterator it = v1.begin();
+    v1.swap(v2);
+    CPPUNIT_ASSERT( *it == 1 );
+    ++it;
+    CPPUNIT_ASSERT( *it == 1 );
+    CPPUNIT_ASSERT( it + 2 == v2.end() );
+  }
+  {
+    list<int> l1(2, 1), l2(2, 2);
+    list<int>::iterator it = l1.begin();
+    l2.splice(l2.begin(), l1);
+    CPPUNIT_ASSERT( *it == 1 );
+    CPPUNIT_ASSERT( it == l2.begin() );
+    l1.clear();
+    CPPUNIT_ASSERT( *it == 1 );
+  }
+}
+
+#if defined (DO_INVALID_ITERATOR_TEST)
+// The use of an invalidated iterator is reported with a runtime_error.
+#  define CHECK_INVALID(expr) \
+  try { \
+    expr; \
+    CPPUNIT_ASSERT( false ); \
+  } \
+  catch (runtime_error const&) \
+  {}
+#endif
+
+void DebugIteratorTest::invalid_iterators()
+{
+#if defined (DO_INVALID_ITERATOR_TEST)
+  {
+    vector<int> v(4, 1);
+    vector<int>::iterator it = v.begin();
+    v.reserve(v.capacity() + 1);
+    CHECK_INVALID( *it )
+    CHECK_INVALID( ++it )
+    it = v.begin();
+    CPPUNIT_ASSERT( *it == 1 );
+    v.clear();
+    CHECK_INVALID( *it )
+  }
+  {
+    deque<int> d(4, 1);
+    deque<int>::iterator it = d.begin() + 1;
+    d.clear();
+    CHECK_INVALID( *it )
+    CHECK_INVALID( it += 1 )
+  }
+  {
+    list<int> l(3, 1);
+    list<int>::iterator it = l.begin(), e = l.end();
+    l.clear();
+    CHECK_INVALID( *it )
+    CHECK_INVALID( --it )
+    // end() is still valid, but there is nothing before it.
+    CHECK_INVALID( --e )
+  }
+  {
+    map<int, int> m;
+    m[1] = 1;
+    map<int, int>::iterator it = m.begin();
+    m.clear();
+    m[1] = 1;
+    CHECK_INVALID( ++it )
+    CHECK_INVALID( m.erase(it) )
+  }
+  {
+    // The past-the-end iterator moved to the current generation is checked
+    // again once the container is cleared another time.
+    list<int> l(3, 1);
+    list<int>::iterator e = l.end();
+    l.clear();
+    l.push_back(7);
+    --e;
+    l.clear();
+    CHECK_INVALID( *e )
+  }
+#endif
+}
@@ -0,0 +1,332 @@
+#include <vector>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#if defined (STLPORT)
+#  include <unordered_set>
+#endif
+
+#include "cppunit/cppunit_proxy.h"
+
+#if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
+using namespace std;
+#  if defined (STLPORT)
+using namespace std::tr1;
+#  endif
+#endif
+
+#if (defined (STLPORT) && defined (_STLP_HAS_RVALUE_REFERENCES)) || \
+    (!defined (STLPORT) && __cplusplus >= 201103L)
+#  define DO_EMPLACE_TEST
+#endif
+
+//
+// TestCase class
+//
+class EmplaceTest : public CPPUNIT_NS::TestCase
+{
+  CPPUNIT_TEST_SUITE(EmplaceTest);
+#if !defined (DO_EMPLACE_TEST)
+  CPPUNIT_IGNORE;
+#endif
+  CPPUNIT_TEST(vector_emplace);
+  CPPUNIT_TEST(deque_emplace);
+  CPPUNIT_TEST(list_emplace);
+  CPPUNIT_TEST(associative_emplace);
+  CPPUNIT_TEST(move_only);
+  CPPUNIT_TEST(failed_insert);
+  CPPUNIT_TEST_SUITE_END();
+
+protected:
+  void vector_emplace();
+  void deque_emplace();
+  void list_emplace();
+  void associative_emplace();
+  void move_only();
+  void failed_insert();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(EmplaceTest);
+
+#if defined (DO_EMPLACE_TEST)
+// Counts the copies and the moves of its instances.
+struct Tracked {
+  static int copies;
+  static int moves;
+
+  Tracked(int a = 0, int b = 0) : value(a + b) {}
+  Tracked(const Tracked& other) : value(other.value) { ++copies; }
+  Tracked(Tracked&& other) noexcept : value(other.value) { other.value = -1; ++moves; }
+  Tracked& operator=(const Tracked& other) { value = other.value; ++copies; return *this; }
+  Tracked& operator=(Tracked&& other) noexcept { value = other.value; other.value = -1; ++moves; return *this; }
+
+  bool operator<(const Tracked& other) const { return value < other.value; }
+
+  static void reset() { copies = moves = 0; }
+
+  int value;
+};
+
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+// Can only be moved.
+struct MoveOnly {
+  explicit MoveOnly(int v = 0) : value(v) {}
+  MoveOnly(MoveOnly&& other) noexcept : value(other.value) { other.value = -1; }
+  MoveOnly& operator=(MoveOnly&& other) noexcept { value = other.value; other.value = -1; return *this; }
+
+  bool operator<(const MoveOnly& other) const { return value < other.value; }
+
+  int value;
+
+private:
+  MoveOnly(const MoveOnly&);
+  MoveOnly& operator=(const MoveOnly&);
+};
+#endif
+
+//
+// tests implementation
+//
+void EmplaceTest::vector_emplace()
+{
+#if defined (DO_EMPLACE_TEST)
+  vector<Tracked> v;
+  v.reserve(3);
+  Tracked::reset();
+  v.emplace_back(1, 2);
+  v.emplace_back(4);
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( Tracked::moves == 0 );
+  CPPUNIT_ASSERT( v.size() == 2 );
+  CPPUNIT_ASSERT( v[0].value == 3 );
+  CPPUNIT_ASSERT( v[1].value == 4 );
+
+  v.emplace(v.begin() + 1, 10, 10);
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( v.size() == 3 );
+  CPPUNIT_ASSERT( v[0].value == 3 );
+  CPPUNIT_ASSERT( v[1].value == 20 );
+  CPPUNIT_ASSERT( v[2].value == 4 );
+
+  // Reallocation moves the elements, as their move constructor can't throw.
+  for (int i = 0; i < 100; ++i) {
+    v.emplace_back(i);
+  }
+  v.emplace(v.begin(), 7);
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( v.size() == 104 );
+  CPPUNIT_ASSERT( v[0].value == 7 );
+  CPPUNIT_ASSERT( v[2].value == 20 );
+  CPPUNIT_ASSERT( v[103].value == 99 );
+
+  Tracked t(5);
+  v.push_back(std::move(t));
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( t.value == -1 );
+  CPPUNIT_ASSERT( v.back().value == 5 );
+#endif
+}
+
+void EmplaceTest::deque_emplace()
+{
+#if defined (DO_EMPLACE_TEST)
+  deque<Tracked> d;
+  Tracked::reset();
+  for (int i = 0; i < 50; ++i) {
+    d.emplace_back(i, 1);
+    d.emplace_front(-i, -1);
+  }
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( d.size() == 100 );
+  CPPUNIT_ASSERT( d.front().value == -50 );
+  CPPUNIT_ASSERT( d.back().value == 50 );
+
+  d.emplace(d.begin() + 30, 1000);
+  d.emplace(d.end() - 10, 2000);
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( d.size() == 102 );
+  CPPUNIT_ASSERT( d[30].value == 1000 );
+  CPPUNIT_ASSERT( d[d.size() - 11].value == 2000 );
+  CPPUNIT_ASSERT( d.front().value == -50 );
+  CPPUNIT_ASSERT( d.back().value == 50 );
+#endif
+}
+
+void EmplaceTest::list_emplace()
+{
+#if defined (DO_EMPLACE_TEST)
+  list<Tracked> l;
+  Tracked::reset();
+  l.emplace_back(2);
+  l.emplace_front(1);
+  list<Tracked>::iterator it = l.emplace(l.end(), 3, 1);
+  l.emplace(it, 3);
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( Tracked::moves == 0 );
+  CPPUNIT_ASSERT( l.size() == 4 );
+  int expected[] = { 1, 2, 3, 4 };
+  int i = 0;
+  for (it = l.begin(); it != l.end(); ++it, ++i) {
+    CPPUNIT_ASSERT( it->value == expected[i] );
+  }
+#endif
+}
+
+void EmplaceTest::associative_emplace()
+{
+#if defined (DO_EMPLACE_TEST)
+  map<int, Tracked> m;
+  Tracked::reset();
+  CPPUNIT_ASSERT( m.emplace(2, Tracked(2)).second );
+  CPPUNIT_ASSERT( !m.emplace(2, Tracked(3)).second );
+  CPPUNIT_ASSERT( m[2].value == 2 );
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+
+  // Values coming in order are appended through the end() hint.
+  map<int, Tracked>::iterator it;
+  for (int i = 3; i < 10; ++i) {
+    it = m.emplace_hint(m.end(), i, Tracked(i));
+    CPPUNIT_ASSERT( it->first == i );
+  }
+  it = m.emplace_hint(m.end(), 1, Tracked(1));
+  CPPUNIT_ASSERT( it == m.begin() );
+  it = m.emplace_hint(m.begin(), 5, Tracked(50));
+  CPPUNIT_ASSERT( it->second.value == 5 );
+  CPPUNIT_ASSERT( m.size() == 9 );
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+
+  set<Tracked> s;
+  s.emplace(3, 4);
+  s.emplace_hint(s.end(), 10);
+  s.emplace_hint(s.end(), 1);
+  CPPUNIT_ASSERT( !s.emplace(7).second );
+  CPPUNIT_ASSERT( s.size() == 3 );
+  CPPUNIT_ASSERT( s.begin()->value == 1 );
+  CPPUNIT_ASSERT( (--s.end())->value == 10 );
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+
+  multiset<Tracked> ms;
+  ms.emplace(1);
+  ms.emplace(1);
+  ms.emplace_hint(ms.end(), 1);
+  CPPUNIT_ASSERT( ms.count(Tracked(1)) == 3 );
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+#endif
+}
+
+void EmplaceTest::move_only()
+{
+#if defined (DO_EMPLACE_TEST)
+  vector<MoveOnly> v;
+  for (int i = 0; i < 20; ++i) {
+    v.push_back(MoveOnly(i));
+  }
+  v.emplace(v.begin(), 100);
+  v.erase(v.begin() + 1);
+  CPPUNIT_ASSERT( v.size() == 20 );
+  CPPUNIT_ASSERT( v[0].value == 100 );
+  CPPUNIT_ASSERT( v[1].value == 1 );
+  CPPUNIT_ASSERT( v[19].value == 19 );
+  v.erase(v.begin() + 2, v.begin() + 5);
+  CPPUNIT_ASSERT( v.size() == 17 );
+  CPPUNIT_ASSERT( v[2].value == 5 );
+  CPPUNIT_ASSERT( v[16].value == 19 );
+
+  vector<MoveOnly> v2(std::move(v));
+  CPPUNIT_ASSERT( v2.size() == 17 );
+  CPPUNIT_ASSERT( v.empty() );
+
+  list<MoveOnly> l;
+  l.emplace_back(1);
+  l.push_front(MoveOnly(0));
+  CPPUNIT_ASSERT( l.front().value == 0 );
+  CPPUNIT_ASSERT( l.back().value == 1 );
+
+  deque<MoveOnly> d;
+  for (int i = 0; i < 10; ++i) {
+    d.push_back(MoveOnly(i));
+  }
+  d.emplace_front(-1);
+  d.emplace(d.begin() + 5, 100);
+  d.erase(d.begin() + 2);
+  d.erase(d.end() - 3);
+  d.erase(d.begin() + 1, d.begin() + 3);
+  d.erase(d.end() - 3, d.end() - 1);
+  int expected[] = { -1, 3, 100, 4, 5, 9 };
+  CPPUNIT_ASSERT( d.size() == 6 );
+  for (size_t i = 0; i < d.size(); ++i) {
+    CPPUNIT_ASSERT( d[i].value == expected[i] );
+  }
+
+  map<int, MoveOnly> m;
+  m.emplace(1, MoveOnly(10));
+  MoveOnly mo(20);
+  m.emplace(2, std::move(mo));
+  CPPUNIT_ASSERT( mo.value == -1 );
+  CPPUNIT_ASSERT( m.size() == 2 );
+  CPPUNIT_ASSERT( m.find(2)->second.value == 20 );
+
+  set<MoveOnly> s;
+  MoveOnly a(1), b(1);
+  CPPUNIT_ASSERT( s.insert(std::move(a)).second );
+  CPPUNIT_ASSERT( a.value == -1 );
+  CPPUNIT_ASSERT( !s.insert(std::move(b)).second );
+  CPPUNIT_ASSERT( b.value == 1 );
+#endif
+}
+
+void EmplaceTest::failed_insert()
+{
+#if defined (DO_EMPLACE_TEST)
+  // An rvalue is left alone when an equivalent key is already there.
+  set<string> s;
+  s.insert(string("abc"));
+  string y("abc");
+  CPPUNIT_ASSERT( !s.insert(std::move(y)).second );
+  CPPUNIT_ASSERT( y == "abc" );
+  CPPUNIT_ASSERT( *s.insert(s.end(), std::move(y)) == "abc" );
+  CPPUNIT_ASSERT( y == "abc" );
+  CPPUNIT_ASSERT( *s.insert(s.begin(), std::move(y)) == "abc" );
+  CPPUNIT_ASSERT( y == "abc" );
+  CPPUNIT_ASSERT( s.size() == 1 );
+
+  string z("abd");
+  CPPUNIT_ASSERT( s.insert(std::move(z)).second );
+  string w("abe");
+  CPPUNIT_ASSERT( *s.insert(s.end(), std::move(w)) == "abe" );
+  string u("aaa");
+  CPPUNIT_ASSERT( *s.insert(s.end(), std::move(u)) == "aaa" );
+  CPPUNIT_ASSERT( s.size() == 4 );
+  CPPUNIT_ASSERT( *s.begin() == "aaa" );
+
+  map<string, string> m;
+  m["key"] = "value";
+  pair<const string, string> p("key", "other");
+  CPPUNIT_ASSERT( !m.insert(std::move(p)).second );
+  CPPUNIT_ASSERT( p.second == "other" );
+  CPPUNIT_ASSERT( m.insert(m.end(), std::move(p))->second == "value" );
+  CPPUNIT_ASSERT( p.second == "other" );
+  CPPUNIT_ASSERT( m["key"] == "value" );
+
+  Tracked::reset();
+  set<Tracked> ts;
+  ts.insert(Tracked(1));
+  Tracked t(1);
+  CPPUNIT_ASSERT( !ts.insert(std::move(t)).second );
+  CPPUNIT_ASSERT( t.value == 1 );
+  CPPUNIT_ASSERT( Tracked::copies == 0 );
+  CPPUNIT_ASSERT( Tracked::moves == 1 );
+
+#  if defined (STLPORT)
+  unordered_set<string> us;
+  us.insert(string("abc"));
+  string x("abc");
+  CPPUNIT_ASSERT( !us.insert(std::move(x)).second );
+  CPPUNIT_ASSERT( x == "abc" );
+#  endif
+#endif
+}
@@ -0,0 +1,281 @@
+//Has to be first for StackAllocator swap overload to be taken
+//into account (at least using GCC 4.0.1)
+#include "stack_allocator.h"
+
+#include <map>
+#include <string>
+
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+#  include <flat_hash_map>
+#  include <flat_hash_set>
+#endif
+
+#include "cppunit/cppunit_proxy.h"
+
+#if !defined (STLPORT) || defined (_STLP_USE_NAMESPACES)
+using namespace std;
+#endif
+
+//
+// TestCase class
+//
+class FlatHashTest : public CPPUNIT_NS::TestCase
+{
+  CPPUNIT_TEST_SUITE(FlatHashTest);
+#if !defined (STLPORT) || defined (_STLP_NO_EXTENSIONS)
+  CPPUNIT_IGNORE;
+#endif
+  CPPUNIT_TEST(fmap1);
+  CPPUNIT_TEST(fset1);
+  CPPUNIT_TEST(insert_erase);
+  CPPUNIT_TEST(erase_range);
+  CPPUNIT_TEST(copy_swap);
+  CPPUNIT_TEST(resize);
+  CPPUNIT_TEST(allocator_with_state);
+  CPPUNIT_TEST_SUITE_END();
+
+protected:
+  void fmap1();
+  void fset1();
+  void insert_erase();
+  void erase_range();
+  void copy_swap();
+  void resize();
+  void allocator_with_state();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(FlatHashTest);
+
+//
+// tests implementation
+//
+void FlatHashTest::fmap1()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  typedef flat_hash_map<char, string> maptype;
+  maptype m;
+  CPPUNIT_ASSERT( m.empty() );
+  CPPUNIT_ASSERT( m.begin() == m.end() );
+  CPPUNIT_ASSERT( m.find('x') == m.end() );
+
+  m['l'] = "50";
+  m['x'] = "20"; // Deliberate mistake.
+  m['v'] = "5";
+  m['i'] = "1";
+  CPPUNIT_ASSERT( m['x'] == "20" );
+  m['x'] = "10"; // Correct mistake.
+  CPPUNIT_ASSERT( m['x'] == "10" );
+
+  CPPUNIT_ASSERT( m['z'] == "" );
+  CPPUNIT_ASSERT( m.count('z') == 1 );
+  CPPUNIT_ASSERT( m.size() == 5 );
+
+  pair<maptype::iterator, bool> p = m.insert(pair<const char, string>('c', string("100")));
+  CPPUNIT_ASSERT( p.second );
+  CPPUNIT_ASSERT( p.first->first == 'c' );
+
+  p = m.insert(pair<const char, string>('c', string("200")));
+  CPPUNIT_ASSERT( !p.second );
+  CPPUNIT_ASSERT( p.first->second == "100" );
+
+  //Some iterators compare check, really compile time checks
+  maptype::iterator ite(m.begin());
+  maptype::const_iterator cite(m.begin());
+  cite = m.begin();
+  maptype const& cm = m;
+  cite = cm.begin();
+  CPPUNIT_ASSERT( ite == cite );
+  CPPUNIT_ASSERT( !(ite != cite) );
+  CPPUNIT_ASSERT( cite == ite );
+  CPPUNIT_ASSERT( !(cite != ite) );
+
+  size_t n = 0;
+  for (cite = cm.begin(); cite != cm.end(); ++cite, ++n) {
+    CPPUNIT_ASSERT( cm.find(cite->first) == cite );
+  }
+  CPPUNIT_ASSERT( n == m.size() );
+
+  CPPUNIT_ASSERT( m.erase('x') == 1 );
+  CPPUNIT_ASSERT( m.erase('x') == 0 );
+  CPPUNIT_ASSERT( m.find('x') == m.end() );
+  CPPUNIT_ASSERT( m.size() == 5 );
+#endif
+}
+
+void FlatHashTest::fset1()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  typedef flat_hash_set<string> settype;
+  settype s;
+  CPPUNIT_ASSERT( s.insert("one").second );
+  CPPUNIT_ASSERT( s.insert("two").second );
+  CPPUNIT_ASSERT( !s.insert("one").second );
+  CPPUNIT_ASSERT( s.size() == 2 );
+  CPPUNIT_ASSERT( s.count("two") == 1 );
+  CPPUNIT_ASSERT( s.count("three") == 0 );
+
+  pair<settype::iterator, settype::iterator> range = s.equal_range("one");
+  CPPUNIT_ASSERT( range.first != s.end() );
+  CPPUNIT_ASSERT( *range.first == "one" );
+  CPPUNIT_ASSERT( ++range.first == range.second );
+
+  range = s.equal_range("three");
+  CPPUNIT_ASSERT( range.first == range.second );
+
+  s.erase(s.find("one"));
+  CPPUNIT_ASSERT( s.size() == 1 );
+  CPPUNIT_ASSERT( *s.begin() == "two" );
+#endif
+}
+
+void FlatHashTest::insert_erase()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  // Mixes insertions and erasures to go through growths and in place
+  // rehashes, and checks the table against a map.
+  typedef flat_hash_map<int, int> fmaptype;
+  fmaptype fm;
+  map<int, int> m;
+
+  unsigned int seed = 1;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = (seed >> 16) % 1000;
+    if ((seed >> 8) & 1) {
+      fm[key] = i;
+      m[key] = i;
+    }
+    else {
+      CPPUNIT_ASSERT( fm.erase(key) == m.erase(key) );
+    }
+  }
+  CPPUNIT_ASSERT( fm.size() == m.size() );
+  CPPUNIT_ASSERT( fm.load_factor() <= 1.0f );
+
+  for (map<int, int>::const_iterator it = m.begin(); it != m.end(); ++it) {
+    fmaptype::const_iterator fit = fm.find(it->first);
+    CPPUNIT_ASSERT( fit != fm.end() );
+    CPPUNIT_ASSERT( fit->second == it->second );
+  }
+
+  size_t n = 0;
+  for (fmaptype::const_iterator fit = fm.begin(); fit != fm.end(); ++fit, ++n) {
+    CPPUNIT_ASSERT( m.count(fit->first) == 1 );
+  }
+  CPPUNIT_ASSERT( n == m.size() );
+
+  fm.clear();
+  CPPUNIT_ASSERT( fm.empty() );
+  CPPUNIT_ASSERT( fm.begin() == fm.end() );
+  CPPUNIT_ASSERT( fm.find(1) == fm.end() );
+#endif
+}
+
+void FlatHashTest::erase_range()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  typedef flat_hash_set<int> settype;
+  settype s;
+  int i;
+  for (i = 0; i < 1000; ++i)
+    s.insert(i);
+
+  // Erasing does not move the other elements.
+  for (settype::iterator it = s.begin(); it != s.end();) {
+    settype::iterator cur = it++;
+    if (*cur % 2 != 0)
+      s.erase(cur);
+  }
+  CPPUNIT_ASSERT( s.size() == 500 );
+  for (i = 0; i < 1000; ++i)
+    CPPUNIT_ASSERT( s.count(i) == (i % 2 == 0 ? 1u : 0u) );
+
+  s.erase(s.begin(), s.end());
+  CPPUNIT_ASSERT( s.empty() );
+#endif
+}
+
+void FlatHashTest::copy_swap()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  typedef flat_hash_map<int, string> maptype;
+  maptype m1, m2;
+  int i;
+  for (i = 0; i < 100; ++i)
+    m1[i] = "m1";
+  m2[-1] = "m2";
+
+  maptype m3(m1);
+  CPPUNIT_ASSERT( m3.size() == 100 );
+  CPPUNIT_ASSERT( m3[42] == "m1" );
+
+  m3 = m2;
+  CPPUNIT_ASSERT( m3.size() == 1 );
+  CPPUNIT_ASSERT( m3[-1] == "m2" );
+
+  m1.swap(m2);
+  CPPUNIT_ASSERT( m1.size() == 1 );
+  CPPUNIT_ASSERT( m2.size() == 100 );
+  CPPUNIT_ASSERT( m1.count(-1) == 1 );
+  CPPUNIT_ASSERT( m2.count(99) == 1 );
+
+  swap(m1, m2);
+  CPPUNIT_ASSERT( m1.size() == 100 );
+#endif
+}
+
+void FlatHashTest::resize()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  typedef flat_hash_set<int> settype;
+  settype s(1000);
+  size_t buckets = s.bucket_count();
+  CPPUNIT_ASSERT( buckets >= 1000 );
+  for (int i = 0; i < 1000; ++i)
+    s.insert(i);
+  // No rehash while the requested size is not reached.
+  CPPUNIT_ASSERT( s.bucket_count() == buckets );
+
+  s.resize(10);
+  CPPUNIT_ASSERT( s.bucket_count() == buckets );
+  s.resize(10000);
+  CPPUNIT_ASSERT( s.bucket_count() >= 10000 );
+  CPPUNIT_ASSERT( s.size() == 1000 );
+#endif
+}
+
+void FlatHashTest::allocator_with_state()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  char buf1[2048];
+  StackAllocator<int> stack1(buf1, buf1 + sizeof(buf1));
+
+  char buf2[2048];
+  StackAllocator<int> stack2(buf2, buf2 + sizeof(buf2));
+
+  {
+    typedef flat_hash_set<int, hash<int>, equal_to<int>, StackAllocator<int> > FlatHashSetInt;
+    FlatHashSetInt hint1(10, hash<int>(), equal_to<int>(), stack1);
+
+    int i;
+    for (i = 0; i < 5; ++i)
+      hint1.insert(i);
+    FlatHashSetInt hint1Cpy(hint1);
+
+    FlatHashSetInt hint2(10, hash<int>(), equal_to<int>(), stack2);
+    for (; i < 10; ++i)
+      hint2.insert(i);
+    FlatHashSetInt hint2Cpy(hint2);
+
+    hint1.swap(hint2);
+
+    CPPUNIT_ASSERT( hint1.get_allocator().swaped() );
+    CPPUNIT_ASSERT( hint2.get_allocator().swaped() );
+
+    CPPUNIT_ASSERT( hint1.get_allocator() == stack2 );
+    CPPUNIT_ASSERT( hint2.get_allocator() == stack1 );
+  }
+  CPPUNIT_ASSERT( stack1.ok() );
+  CPPUNIT_ASSERT( stack2.ok() );
+#endif
+}
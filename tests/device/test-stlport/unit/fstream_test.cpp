@@ -44,6 +44,9 @@ class FstreamTest : public CPPUNIT_NS::TestCase
   CPPUNIT_TEST(tellp);
   CPPUNIT_TEST(seek);
   CPPUNIT_TEST(buf);
+  CPPUNIT_TEST(large_write);
+  CPPUNIT_TEST(setbuf_size);
+  CPPUNIT_TEST(mapped_seek);
   CPPUNIT_TEST(rdbuf);
   CPPUNIT_TEST(streambuf_output);
   CPPUNIT_TEST(win32_file_format);
@@ -74,6 +77,9 @@ class FstreamTest : public CPPUNIT_NS::TestCase
     void tellp();
     void seek();
     void buf();
+    void large_write();
+    void setbuf_size();
+    void mapped_seek();
     void rdbuf();
     void streambuf_output();
     void win32_file_format();
@@ -506,6 +512,160 @@ void FstreamTest::seek()
 #endif
 }
 
+// Content of the files written by the following tests.
+static string pattern_string(size_t n, size_t seed)
+{
+  string str;
+  str.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    str += (char)('a' + (i * 7 + seed) % 26);
+  }
+  return str;
+}
+
+static string file_content(const char* name)
+{
+  ifstream f(name, ios_base::binary);
+  ostringstream os;
+  os << f.rdbuf();
+  return os.str();
+}
+
+void FstreamTest::large_write()
+{
+  // Writes larger than the buffer bypass it, after the characters it holds.
+  string small1 = pattern_string(10, 1);
+  string large1 = pattern_string(100000, 2);
+  string small2 = pattern_string(3, 3);
+  string large2 = pattern_string(4096, 4);
+  {
+    ofstream f("test_file.txt", ios_base::binary);
+    CPPUNIT_ASSERT( f );
+    f << small1;
+    f.write(large1.data(), large1.size());
+    f << small2;
+    f.write(large2.data(), large2.size());
+    f.write(large1.data(), large1.size());
+    CPPUNIT_ASSERT( f );
+  }
+  CPPUNIT_ASSERT( file_content("test_file.txt") == small1 + large1 + small2 + large2 + large1 );
+
+  // Same with a buffer that is filled, then straddled by a write.
+  string expected;
+  {
+    ofstream f;
+    f.rdbuf()->pubsetbuf(0, 16);
+    f.open("test_file.txt", ios_base::binary);
+    CPPUNIT_ASSERT( f );
+    for (size_t n = 1; n < 40; ++n) {
+      string str = pattern_string(n, n);
+      f.write(str.data(), str.size());
+      expected += str;
+    }
+    CPPUNIT_ASSERT( f );
+  }
+  CPPUNIT_ASSERT( file_content("test_file.txt") == expected );
+
+  // The input part of a stream in both modes is not disturbed.
+  {
+    fstream f("test_file.txt", ios_base::in | ios_base::out | ios_base::binary | ios_base::trunc);
+    CPPUNIT_ASSERT( f );
+    f << small1;
+    f.write(large1.data(), large1.size());
+    f.seekg(5, ios_base::beg);
+    char buf[10];
+    f.read(buf, 10);
+    CPPUNIT_ASSERT( f );
+    CPPUNIT_ASSERT( string(buf, 10) == (small1 + large1).substr(5, 10) );
+    f.seekp(0, ios_base::end);
+    f.write(large2.data(), large2.size());
+    CPPUNIT_ASSERT( f );
+  }
+  CPPUNIT_ASSERT( file_content("test_file.txt") == small1 + large1 + large2 );
+}
+
+void FstreamTest::setbuf_size()
+{
+  // pubsetbuf(0, n) asks for an internal buffer of n characters.
+  string str = pattern_string(1000, 5);
+  {
+    ofstream f;
+    CPPUNIT_ASSERT( f.rdbuf()->pubsetbuf(0, 7) == f.rdbuf() );
+    f.open("test_file.txt", ios_base::binary);
+    CPPUNIT_ASSERT( f );
+    for (size_t i = 0; i < str.size(); ++i) {
+      f.put(str[i]);
+    }
+    CPPUNIT_ASSERT( f );
+    // Only the last few characters are still in the buffer.
+    CPPUNIT_ASSERT( file_content("test_file.txt").size() + 7 >= str.size() );
+  }
+  CPPUNIT_ASSERT( file_content("test_file.txt") == str );
+
+  {
+    ifstream f;
+    CPPUNIT_ASSERT( f.rdbuf()->pubsetbuf(0, 3) == f.rdbuf() );
+    f.open("test_file.txt");
+    CPPUNIT_ASSERT( f );
+    string line;
+    getline(f, line);
+    CPPUNIT_ASSERT( line == str );
+    CPPUNIT_ASSERT( f.eof() );
+  }
+
+  {
+    // Too late once the file is open: the call has no effect.
+    fstream f("test_file.txt", ios_base::in | ios_base::out | ios_base::binary);
+    CPPUNIT_ASSERT( f );
+    CPPUNIT_ASSERT( f.get() == str[0] );
+    f.rdbuf()->pubsetbuf(0, 2);
+    f.seekg(500, ios_base::beg);
+    char buf[20];
+    f.read(buf, 20);
+    CPPUNIT_ASSERT( f );
+    CPPUNIT_ASSERT( string(buf, 20) == str.substr(500, 20) );
+  }
+}
+
+void FstreamTest::mapped_seek()
+{
+  // Binary input of a regular file is memory mapped: seeking in it must
+  // move the mapped window.
+  string str = pattern_string(3 * 65536 + 123, 6);
+  {
+    ofstream f("test_file.txt", ios_base::binary);
+    f.write(str.data(), str.size());
+    CPPUNIT_ASSERT( f );
+  }
+
+  ifstream f("test_file.txt", ios_base::binary);
+  CPPUNIT_ASSERT( f );
+  char buf[100];
+  f.read(buf, 100);
+  CPPUNIT_ASSERT( f );
+  CPPUNIT_ASSERT( string(buf, 100) == str.substr(0, 100) );
+
+  streamoff offsets[] = { 70000, 4095, 4096, 65536 * 3, 1, 150001, 0 };
+  for (size_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); ++i) {
+    f.seekg(offsets[i], ios_base::beg);
+    CPPUNIT_ASSERT( f.tellg() == ifstream::pos_type(offsets[i]) );
+    f.read(buf, 100);
+    CPPUNIT_ASSERT( f );
+    CPPUNIT_ASSERT( string(buf, 100) == str.substr((size_t)offsets[i], 100) );
+  }
+
+  f.seekg(-10, ios_base::end);
+  f.read(buf, 100);
+  CPPUNIT_ASSERT( f.gcount() == 10 );
+  CPPUNIT_ASSERT( string(buf, 10) == str.substr(str.size() - 10) );
+  CPPUNIT_ASSERT( f.eof() );
+
+  f.clear();
+  f.seekg(-20000, ios_base::cur);
+  CPPUNIT_ASSERT( f.tellg() == ifstream::pos_type(str.size() - 20000) );
+  CPPUNIT_ASSERT( f.get() == str[str.size() - 20000] );
+}
+
 void FstreamTest::rdbuf()
 {
   fstream ss( "test_file.txt", ios_base::in | ios_base::out | ios_base::binary | ios_base::trunc );
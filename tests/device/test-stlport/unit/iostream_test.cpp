@@ -4,8 +4,16 @@
 #  include <sstream>
 //#  include <locale>
 #  include <iostream>
+#  include <iomanip>
+#  include <fstream>
+#  include <cstdio>
 //#  include <stdexcept>
 
+#  if defined (__unix) || defined (__unix__)
+#    include <unistd.h>
+#    define DO_STDIO_SYNC_TEST
+#  endif
+
 #  include "cppunit/cppunit_proxy.h"
 
 #  if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
@@ -20,6 +28,11 @@ class IOStreamTest : public CPPUNIT_NS::TestCase
   CPPUNIT_TEST_SUITE(IOStreamTest);
   CPPUNIT_TEST(manipulators);
   CPPUNIT_TEST(in_avail);
+#  if !defined (DO_STDIO_SYNC_TEST)
+  CPPUNIT_IGNORE;
+#  endif
+  CPPUNIT_TEST(stdout_sync);
+  CPPUNIT_TEST(stdin_sync);
 //#if defined (STLPORT) && defined (_STLP_NO_WCHAR_T)
   //CPPUNIT_IGNORE;
 //#endif
@@ -29,6 +42,8 @@ class IOStreamTest : public CPPUNIT_NS::TestCase
 private:
   void manipulators();
   void in_avail();
+  void stdout_sync();
+  void stdin_sync();
   //void wimbue();
 };
 
@@ -94,6 +109,88 @@ void IOStreamTest::in_avail()
 #endif
 }
 
+// cout and cin synchronized with stdio go through the stdout and stdin
+// FILEs, so they can be mixed with C stdio calls. These tests redirect the
+// FILEs to a file for a while.
+void IOStreamTest::stdout_sync()
+{
+#  if defined (DO_STDIO_SYNC_TEST)
+  cout.flush();
+  fflush(stdout);
+  int saved = dup(1);
+  CPPUNIT_ASSERT( saved >= 0 );
+  CPPUNIT_ASSERT( freopen("test_file.txt", "w", stdout) == stdout );
+
+  printf("a%d", 1);
+  cout << "b" << 2;
+  putchar('c');
+  cout << string("dd") << ' ' << 3.5;
+  printf("%s", "e");
+  cout.write("fg", 2);
+  cout << setw(4) << 'h' << setfill('*') << setw(3) << "" ;
+  fputs("i\n", stdout);
+  cout << setfill(' ') << "j" << endl;
+
+  fflush(stdout);
+  dup2(saved, 1);
+  close(saved);
+  clearerr(stdout);
+  CPPUNIT_ASSERT( cout.good() );
+
+  ifstream in("test_file.txt");
+  string line1, line2;
+  getline(in, line1);
+  getline(in, line2);
+  CPPUNIT_CHECK( line1 == "a1b2cdd 3.5efg   h***i" );
+  CPPUNIT_CHECK( line2 == "j" );
+  CPPUNIT_CHECK( in.get() == char_traits<char>::eof() );
+#  endif
+}
+
+void IOStreamTest::stdin_sync()
+{
+#  if defined (DO_STDIO_SYNC_TEST)
+  {
+    ofstream out("test_file.txt");
+    out << "12345 hello 42 world\nlast";
+  }
+  int saved = dup(0);
+  CPPUNIT_ASSERT( saved >= 0 );
+  CPPUNIT_ASSERT( freopen("test_file.txt", "r", stdin) == stdin );
+  cin.clear();
+
+  char buf[8];
+  cin.read(buf, 3);
+  CPPUNIT_CHECK( cin.gcount() == 3 && string(buf, 3) == "123" );
+  CPPUNIT_CHECK( getchar() == '4' );
+  CPPUNIT_CHECK( ungetc('X', stdin) == 'X' );
+  cin.read(buf, 2);
+  CPPUNIT_CHECK( string(buf, 2) == "X5" );
+
+  string word;
+  cin >> word;
+  CPPUNIT_CHECK( word == "hello" );
+  // The space that ended the word is still in the FILE.
+  CPPUNIT_CHECK( getchar() == ' ' );
+  int n = 0;
+  CPPUNIT_CHECK( scanf("%d", &n) == 1 && n == 42 );
+  cin >> word;
+  CPPUNIT_CHECK( word == "world" );
+  CPPUNIT_CHECK( getchar() == '\n' );
+  CPPUNIT_CHECK( ungetc('L', stdin) == 'L' );
+  CPPUNIT_CHECK( cin.get() == 'L' );
+  CPPUNIT_CHECK( cin.readsome(buf, sizeof(buf)) == 0 );
+  CPPUNIT_CHECK( cin.read(buf, sizeof(buf)).gcount() == 4 );
+  CPPUNIT_CHECK( string(buf, 4) == "last" );
+  CPPUNIT_CHECK( cin.eof() );
+
+  dup2(saved, 0);
+  close(saved);
+  clearerr(stdin);
+  cin.clear();
+#  endif
+}
+
 //void IOStreamTest::wimbue()
 //{
 //#if !defined (STLPORT) || !defined (_STLP_NO_WCHAR_T)
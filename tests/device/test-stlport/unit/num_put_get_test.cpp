@@ -609,6 +609,42 @@ void NumPutGetTest::num_put_float()
     // cerr << DBL_MAX << endl;
     // cerr << 1.0e+37 << endl;
   }
+
+  {
+    // Rounding of the digits, the results must be the ones of printf.
+    ostringstream str;
+
+    str << 0.3;
+    CPPUNIT_CHECK( str.str() == "0.3" );
+
+    reset_stream(str);
+    str << setprecision(17) << 0.1;
+    CPPUNIT_CHECK( str.str() == "0.10000000000000001" );
+
+    reset_stream(str);
+    str << setprecision(15) << 0.1;
+    CPPUNIT_CHECK( str.str() == "0.1" );
+
+    reset_stream(str);
+    str << setprecision(3) << 9.995; // 9.99499999999999957367435854394
+    CPPUNIT_CHECK( str.str() == "9.99" );
+
+    reset_stream(str);
+    str << setprecision(2) << 0.125; // exact tie, rounded to even
+    CPPUNIT_CHECK( str.str() == "0.12" );
+
+    reset_stream(str);
+    str << fixed << setprecision(1) << 999.96;
+    CPPUNIT_CHECK( str.str() == "1000.0" );
+
+    reset_stream(str);
+    str << scientific << setprecision(3) << -1.0e23;
+    CPPUNIT_CHECK( str.str() == "-1.000e+23" );
+
+    reset_stream(str);
+    str << scientific << setprecision(20) << 0.1;
+    CPPUNIT_CHECK( str.str() == "1.00000000000000005551e-01" );
+  }
 }
 
 #define CHECK_COMPLETE(type, val, base, showbase, showpos, casing, width, adjust, expected) \
@@ -850,6 +886,36 @@ void NumPutGetTest::num_get_float()
     CPPUNIT_ASSERT( numeric_limits<double>::min_exponent10 >= numeric_limits<float>::min_exponent10 ||
                     val == 0.0f );
   }
+  {
+    // The result must be the correctly rounded double.
+    istringstream istr;
+    double val;
+
+    istr.str("3.25");
+    istr >> val;
+    CPPUNIT_ASSERT( !istr.fail() );
+    CPPUNIT_CHECK( val == 3.25 );
+    istr.clear();
+
+    istr.str("0.1");
+    istr >> val;
+    CPPUNIT_CHECK( val == 0.1 );
+    istr.clear();
+
+    istr.str("123456789012345678");
+    istr >> val;
+    CPPUNIT_CHECK( val == 123456789012345678.0 );
+    istr.clear();
+
+    istr.str("-4.9406564584124654e-300");
+    istr >> val;
+    CPPUNIT_CHECK( val == -4.9406564584124654e-300 );
+    istr.clear();
+
+    istr.str("1.7976931348623157e308");
+    istr >> val;
+    CPPUNIT_CHECK( val == numeric_limits<double>::max() );
+  }
 #if !defined (STLPORT) || !defined (_STLP_NO_LONG_DOUBLE)
   {
     stringstream str;
@@ -959,6 +1025,38 @@ void NumPutGetTest::num_get_integer()
     istr.clear();
   }
 
+  //decimal input ending before the end of the input
+  {
+    ostringstream ostr;
+    unsigned long lmax = (numeric_limits<long>::max)();
+    ostr << -1234 << ' ' << lmax << " -" << lmax + 1 << ' ' << lmax + 1 << " 12a";
+
+    istringstream istr(ostr.str());
+    long val = 0;
+    istr >> val;
+    CPPUNIT_ASSERT( !istr.fail() );
+    CPPUNIT_ASSERT( val == -1234 );
+    istr >> val;
+    CPPUNIT_ASSERT( !istr.fail() );
+    CPPUNIT_ASSERT( val == (numeric_limits<long>::max)() );
+    istr >> val;
+    CPPUNIT_ASSERT( !istr.fail() );
+    CPPUNIT_ASSERT( val == (numeric_limits<long>::min)() );
+    istr >> val;
+    CPPUNIT_ASSERT( istr.fail() );
+    CPPUNIT_ASSERT( !istr.eof() );
+    CPPUNIT_ASSERT( val == (numeric_limits<long>::max)() );
+    istr.clear();
+
+    int ival = -1;
+    istr >> ival;
+    CPPUNIT_ASSERT( !istr.fail() );
+    CPPUNIT_ASSERT( ival == 12 );
+    char c = 0;
+    istr >> c;
+    CPPUNIT_ASSERT( c == 'a' );
+  }
+
   //hexadecimal input
   {
     istringstream istr;
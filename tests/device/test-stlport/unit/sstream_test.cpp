@@ -36,6 +36,7 @@ class SstreamTest : public CPPUNIT_NS::TestCase
   CPPUNIT_TEST(seek_gp);
   CPPUNIT_TEST(tellp);
   CPPUNIT_TEST(negative);
+  CPPUNIT_TEST(extensions);
   CPPUNIT_TEST_SUITE_END();
 
   protected:
@@ -56,6 +57,7 @@ class SstreamTest : public CPPUNIT_NS::TestCase
     void seek_gp();
     void tellp();
     void negative();
+    void extensions();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(SstreamTest);
@@ -484,4 +486,54 @@ void SstreamTest::negative()
   CPPUNIT_CHECK( to_string<long>(-1) == "-1" );
 }
 
+void SstreamTest::extensions()
+{
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  {
+    ostringstream o;
+    o.reserve(1024);
+    const char* data = o.view().first;
+    for (int i = 0; i < 100; ++i)
+      o << "0123456789";
+    CPPUNIT_CHECK( o.view().first == data );
+    CPPUNIT_CHECK( o.view().second == 1000 );
+
+    string s;
+    o.swap_str(s);
+    CPPUNIT_CHECK( s.size() == 1000 );
+    CPPUNIT_CHECK( s.data() == data );
+    CPPUNIT_CHECK( o.str().empty() );
+    CPPUNIT_CHECK( o.view().second == 0 );
+
+    o << "abc";
+    CPPUNIT_CHECK( o.str() == "abc" );
+  }
+  {
+    ostringstream o( "123", ios_base::out | ios_base::app );
+    o << "45";
+    o.reserve(1024);
+    o << "67";
+    CPPUNIT_CHECK( o.str() == "1234567" );
+    CPPUNIT_CHECK( string(o.view().first, o.view().second) == "1234567" );
+  }
+  {
+    ostringstream o( "123", ios_base::out | ios_base::ate );
+    o.reserve(1024);
+    o << "45";
+    CPPUNIT_CHECK( o.str() == "12345" );
+  }
+  {
+    stringstream s;
+    s << "1 2";
+    string str( "3 4" );
+    s.swap_str(str);
+    CPPUNIT_CHECK( str == "1 2" );
+    int i = 0, j = 0;
+    s >> i >> j;
+    CPPUNIT_CHECK( i == 3 );
+    CPPUNIT_CHECK( j == 4 );
+  }
+#endif
+}
+
 #endif
@@ -60,6 +60,7 @@ class StringTest : public CPPUNIT_NS::TestCase
   CPPUNIT_TEST(resize);
   CPPUNIT_TEST(short_string);
   CPPUNIT_TEST(find);
+  CPPUNIT_TEST(find_blocks);
   CPPUNIT_TEST(bogus_edge_find);
   CPPUNIT_TEST(rfind);
   CPPUNIT_TEST(find_last_of);
@@ -119,6 +120,7 @@ protected:
   void resize();
   void short_string();
   void find();
+  void find_blocks();
   void bogus_edge_find();
   void rfind();
   void find_last_of();
@@ -660,6 +662,90 @@ void StringTest::find()
   CPPUNIT_ASSERT( s.substr(s.find(empty), empty.size()) == empty );
 }
 
+// Straightforward versions of find, find_first_of and find_first_not_of
+// to check the block searches against.
+static size_t naive_find(const string& s, const string& pat, size_t pos)
+{
+  for (size_t i = pos; i + pat.size() <= s.size(); ++i) {
+    if (s.compare(i, pat.size(), pat) == 0)
+      return i;
+  }
+  return string::npos;
+}
+
+static size_t naive_find_first_of(const string& s, const string& set,
+                                  size_t pos, bool not_of)
+{
+  for (size_t i = pos; i < s.size(); ++i) {
+    if ((set.find(s[i]) != string::npos) != not_of)
+      return i;
+  }
+  return string::npos;
+}
+
+// Strings of 15 to 40 characters span one or two 16-byte blocks and a
+// tail, so matches are placed at each position, and searches start at
+// each position up to past the end.
+void StringTest::find_blocks()
+{
+  const char non_ascii[] = { '\xe9', '\xfc', '\x80', '\xff', '\x01', '\0' };
+  const char small_non_ascii[] = { '\xe9', '\xff', '\0' };
+  // Small sets are searched for with comparisons, larger ASCII ones with
+  // a table, and others with the scalar loop. None contains '-'.
+  const string sets[] = {
+    string("x"), string("xy"), string("aeio"), string("aeiou"),
+    string("0123456789abcdefXYZ"), string(small_non_ascii),
+    string(non_ascii)
+  };
+  const size_t num_sets = sizeof(sets) / sizeof(sets[0]);
+  const string patterns[] = {
+    string("a"), string("ab"), string("aab"), string("abcde"),
+    string("aaaaaaaaaaaaaaab"), string("abcdefghijklmnopq")
+  };
+  const size_t num_patterns = sizeof(patterns) / sizeof(patterns[0]);
+
+  int errors = 0;
+  for (size_t len = 15; len <= 40; ++len) {
+    for (size_t at = 0; at < len; ++at) {
+      for (size_t n = 0; n < num_sets; ++n) {
+        const string& set = sets[n];
+        // One character of the set among others.
+        string s(len, '-');
+        s[at] = set[at % set.size()];
+        // One other character among characters of the set.
+        string t(len, set[0]);
+        for (size_t i = 0; i < len; ++i)
+          t[i] = set[i % set.size()];
+        t[at] = '-';
+        for (size_t pos = 0; pos <= len + 1; ++pos) {
+          if (s.find_first_of(set, pos) != naive_find_first_of(s, set, pos, false))
+            ++errors;
+          if (s.find_first_not_of(set, pos) != naive_find_first_of(s, set, pos, true))
+            ++errors;
+          if (t.find_first_not_of(set, pos) != naive_find_first_of(t, set, pos, true))
+            ++errors;
+          if (t.find_first_of(set, pos) != naive_find_first_of(t, set, pos, false))
+            ++errors;
+        }
+      }
+      for (size_t n = 0; n < num_patterns; ++n) {
+        const string& pat = patterns[n];
+        if (at + pat.size() > len)
+          continue;
+        // The first character of the pattern all around, so every block
+        // has candidates.
+        string s(len, 'a');
+        s.replace(at, pat.size(), pat);
+        for (size_t pos = 0; pos <= len + 1; ++pos) {
+          if (s.find(pat, pos) != naive_find(s, pat, pos))
+            ++errors;
+        }
+      }
+    }
+  }
+  CPPUNIT_CHECK( errors == 0 );
+}
+
 void StringTest::bogus_edge_find()
 {
   /* ISO/IEC 14882 2003, 21.3.6.1 basic_string::find [lib.string::find]
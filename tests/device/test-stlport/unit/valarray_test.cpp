@@ -1,4 +1,5 @@
 #include <valarray>
+#include <cmath>
 
 #include "cppunit/cppunit_proxy.h"
 
@@ -13,10 +14,18 @@ class ValarrayTest : public CPPUNIT_NS::TestCase
 {
   CPPUNIT_TEST_SUITE(ValarrayTest);
   CPPUNIT_TEST(transcendentals);
+  CPPUNIT_TEST(expressions);
+  CPPUNIT_TEST(subset_operands);
+  CPPUNIT_TEST(aliasing);
+  CPPUNIT_TEST(reductions);
   CPPUNIT_TEST_SUITE_END();
 
 protected:
   void transcendentals();
+  void expressions();
+  void subset_operands();
+  void aliasing();
+  void reductions();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(ValarrayTest);
@@ -119,3 +128,232 @@ void ValarrayTest::transcendentals()
   //valarray<double> v3(v0[valarray<bool>()]);
   valarray<double> v4(v0[valarray<size_t>()]);
 }
+
+//
+// Packet kernels may fold elements in a different order than a scalar loop,
+// and the compiler may contract the scalar reference into fused multiply-adds,
+// so floating point results are compared with a tolerance relative to the
+// magnitude of the expected value.
+//
+template <class _Tp>
+static bool is_close(_Tp val, _Tp ref, _Tp tol) {
+  _Tp diff = val < ref ? ref - val : val - ref;
+  _Tp mag = ref < 0 ? -ref : ref;
+  return diff <= tol * (mag < 1 ? 1 : mag);
+}
+
+// Sizes around the packet widths, to cover both the vector loops and
+// their scalar tails.
+static const size_t sizes[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33 };
+
+void ValarrayTest::expressions()
+{
+  for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k) {
+    size_t n = sizes[k];
+    {
+      valarray<double> a(n), b(n), c(n);
+      for (size_t i = 0; i < n; ++i) {
+        a[i] = 1.5 + i;
+        b[i] = 2.0 * i - 7.25;
+        c[i] = 0.5 * (i % 3) + 1.0;
+      }
+
+      valarray<double> r = a * b + c - a / c;
+      CPPUNIT_ASSERT( r.size() == n );
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( is_close(r[i], a[i] * b[i] + c[i] - a[i] / c[i], 1e-12) );
+
+      r = -(a - b) * 2.0 + 1.0 / c;
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( is_close(r[i], -(a[i] - b[i]) * 2.0 + 1.0 / c[i], 1e-12) );
+
+      r += a * c;
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( is_close(r[i], (-(a[i] - b[i]) * 2.0 + 1.0 / c[i]) + a[i] * c[i], 1e-12) );
+
+      r = sqrt(a * a + b * b);
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( is_close(r[i], ::sqrt(a[i] * a[i] + b[i] * b[i]), 1e-12) );
+
+      // Element access and size of an expression that is not assigned.
+      CPPUNIT_CHECK( (a + b).size() == n );
+      CPPUNIT_CHECK( (a - c)[n - 1] == a[n - 1] - c[n - 1] );
+
+      valarray<bool> m = (a + b) < c;
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( m[i] == (a[i] + b[i] < c[i]) );
+    }
+    {
+      valarray<float> a(n), b(n);
+      for (size_t i = 0; i < n; ++i) {
+        a[i] = 0.25f * i + 1.0f;
+        b[i] = 3.0f - 0.5f * i;
+      }
+
+      valarray<float> r = (a - b) * (a + b) / 4.0f - b;
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( is_close(r[i], (a[i] - b[i]) * (a[i] + b[i]) / 4.0f - b[i], 1e-5f) );
+    }
+    {
+      // No packet kernels for int: the scalar evaluation only.
+      valarray<int> a(n), b(n);
+      for (size_t i = 0; i < n; ++i) {
+        a[i] = (int)i - 4;
+        b[i] = 3 * (int)i + 1;
+      }
+
+      valarray<int> r = (a * b - 2) % 5 + (a & b);
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( r[i] == (a[i] * b[i] - 2) % 5 + (a[i] & b[i]) );
+    }
+  }
+}
+
+void ValarrayTest::subset_operands()
+{
+  valarray<double> v(12);
+  for (size_t i = 0; i < v.size(); ++i)
+    v[i] = 1.0 + i;
+  const valarray<double>& cv = v;
+
+  // slice: elements 1, 4, 7 and 10.
+  valarray<double> r = valarray<double>(v[slice(1, 4, 3)]) * 2.0 + cv[slice(0, 4, 1)];
+  CPPUNIT_ASSERT( r.size() == 4 );
+  for (size_t i = 0; i < 4; ++i)
+    CPPUNIT_CHECK( is_close(r[i], v[1 + 3 * i] * 2.0 + v[i], 1e-12) );
+
+  // gslice: the 2x3 block starting at 2, with rows 6 elements apart.
+  size_t len[] = { 2, 3 };
+  size_t str[] = { 6, 1 };
+  gslice gs(2, valarray<size_t>(len, 2), valarray<size_t>(str, 2));
+  r.resize(6);
+  r = cv[gs] - valarray<double>(v[slice(6, 6, 1)]);
+  for (size_t i = 0; i < 2; ++i)
+    for (size_t j = 0; j < 3; ++j)
+      CPPUNIT_CHECK( r[3 * i + j] == v[2 + 6 * i + j] - v[6 + 3 * i + j] );
+
+  // mask: elements greater than 8, that is 9, 10, 11 and 12.
+  valarray<bool> mask = v > 8.0;
+  r.resize(4);
+  r = valarray<double>(v[mask]) / 2.0 - cv[slice(0, 4, 1)];
+  for (size_t i = 0; i < 4; ++i)
+    CPPUNIT_CHECK( r[i] == v[8 + i] / 2.0 - v[i] );
+
+  // indirect: elements 11, 0 and 5.
+  size_t idx[] = { 11, 0, 5 };
+  valarray<size_t> ind(idx, 3);
+  r.resize(3);
+  r = valarray<double>(v[ind]) * cv[slice(0, 3, 2)];
+  for (size_t i = 0; i < 3; ++i)
+    CPPUNIT_CHECK( r[i] == v[idx[i]] * v[2 * i] );
+
+  // Expressions assigned to subsets.
+  valarray<double> w(v);
+  w[slice(0, 4, 3)] = cv[slice(1, 4, 3)] + cv[slice(2, 4, 3)];
+  w[mask] = valarray<double>(4) - 1.0;
+  w[ind] *= cv[slice(0, 3, 1)] + 1.0;
+  valarray<double> expected(v);
+  for (size_t i = 0; i < 4; ++i)
+    expected[3 * i] = v[3 * i + 1] + v[3 * i + 2];
+  for (size_t i = 8; i < 12; ++i)
+    expected[i] = -1.0;
+  for (size_t i = 0; i < 3; ++i)
+    expected[idx[i]] *= v[i] + 1.0;
+  for (size_t i = 0; i < w.size(); ++i)
+    CPPUNIT_CHECK( w[i] == expected[i] );
+}
+
+void ValarrayTest::aliasing()
+{
+  for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k) {
+    size_t n = sizes[k];
+    valarray<double> v(n), ref(n);
+    for (size_t i = 0; i < n; ++i)
+      v[i] = ref[i] = 1.0 + i;
+    const valarray<double>& cv = v;
+
+    // v = v + v[slice]: the slice reads elements other than the one assigned.
+    v = v + cv[slice(n - 1, n, 0)];
+    for (size_t i = 0; i < n; ++i) {
+      ref[i] += 1.0 * n;
+      CPPUNIT_CHECK( is_close(v[i], ref[i], 1e-12) );
+    }
+
+    v = v * v - v / 2.0;
+    for (size_t i = 0; i < n; ++i) {
+      ref[i] = ref[i] * ref[i] - ref[i] / 2.0;
+      CPPUNIT_CHECK( is_close(v[i], ref[i], 1e-12) );
+    }
+
+    // The shifted operands are evaluated before v is written.
+    v = v.cshift(-1) + v;
+    valarray<double> prev(ref);
+    for (size_t i = 0; i < n; ++i) {
+      ref[i] = prev[(i + n - 1) % n] + prev[i];
+      CPPUNIT_CHECK( is_close(v[i], ref[i], 1e-12) );
+    }
+
+    v -= (v + 1.0).shift(1);
+    prev = ref;
+    for (size_t i = 0; i < n; ++i) {
+      ref[i] = prev[i] - (i + 1 < n ? prev[i + 1] + 1.0 : 0.0);
+      CPPUNIT_CHECK( is_close(v[i], ref[i], 1e-12) );
+    }
+
+    // A slice of v assigned an expression reading v.
+    if (n >= 2) {
+      v[slice(1, n - 1, 1)] = cv[slice(0, n - 1, 1)] * 2.0;
+      prev = ref;
+      for (size_t i = 1; i < n; ++i)
+        ref[i] = prev[i - 1] * 2.0;
+      for (size_t i = 0; i < n; ++i)
+        CPPUNIT_CHECK( is_close(v[i], ref[i], 1e-12) );
+    }
+  }
+}
+
+void ValarrayTest::reductions()
+{
+  for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k) {
+    size_t n = sizes[k];
+    {
+      valarray<double> v(n);
+      double sum = 0.0, vmin = 0.0, vmax = 0.0;
+      for (size_t i = 0; i < n; ++i) {
+        v[i] = 0.1 * ((i * 7) % 11) - 0.35;
+        sum += v[i];
+        if (i == 0 || v[i] < vmin) vmin = v[i];
+        if (i == 0 || vmax < v[i]) vmax = v[i];
+      }
+      CPPUNIT_CHECK( is_close(v.sum(), sum, 1e-12) );
+      CPPUNIT_CHECK( (v.min)() == vmin );
+      CPPUNIT_CHECK( (v.max)() == vmax );
+
+      CPPUNIT_CHECK( is_close((v * 2.0 + 1.0).sum(), 2.0 * sum + n, 1e-12) );
+      CPPUNIT_CHECK( ((-v).max)() == -vmin );
+      CPPUNIT_CHECK( ((-v).min)() == -vmax );
+    }
+    {
+      valarray<float> v(n);
+      float sum = 0.0f, vmin = 0.0f, vmax = 0.0f;
+      for (size_t i = 0; i < n; ++i) {
+        v[i] = 0.3f * ((i * 5) % 13) - 1.1f;
+        sum += v[i];
+        if (i == 0 || v[i] < vmin) vmin = v[i];
+        if (i == 0 || vmax < v[i]) vmax = v[i];
+      }
+      CPPUNIT_CHECK( is_close(v.sum(), sum, 1e-5f) );
+      CPPUNIT_CHECK( (v.min)() == vmin );
+      CPPUNIT_CHECK( (v.max)() == vmax );
+    }
+  }
+
+  // A long sum, where the order of the additions matters.
+  valarray<double> big(10000);
+  for (size_t i = 0; i < big.size(); ++i)
+    big[i] = 1.0 / (1.0 + i);
+  double sum = 0.0;
+  for (size_t i = 0; i < big.size(); ++i)
+    sum += big[i];
+  CPPUNIT_CHECK( is_close(big.sum(), sum, 1e-12) );
+}